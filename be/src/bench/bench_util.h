@@ -12,11 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <string>
 #include <vector>
 
 #include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 
 namespace starrocks {
 
@@ -117,6 +121,49 @@ public:
         return column;
     }
 
+    // Create a BIGINT column of `num_rows` values in [0, cardinality).
+    // The values follow a zipf distribution with exponent `skew`, 0 means uniform.
+    // `null_ratio` of the rows are null, and the column is nullable only if it is positive.
+    static ColumnPtr create_skewed_bigint_column(int num_rows, int64_t cardinality, double skew, double null_ratio,
+                                                 uint64_t seed = 0) {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> dist_real(0, 1);
+        std::uniform_int_distribution<int64_t> dist_uniform(0, cardinality - 1);
+
+        std::vector<double> cdf;
+        if (skew > 0) {
+            cdf.resize(cardinality);
+            double sum = 0;
+            for (int64_t i = 0; i < cardinality; i++) {
+                sum += 1.0 / std::pow(i + 1, skew);
+                cdf[i] = sum;
+            }
+            for (auto& x : cdf) {
+                x /= sum;
+            }
+        }
+
+        auto data_column = Int64Column::create();
+        auto null_column = NullColumn::create();
+        data_column->resize(num_rows);
+        null_column->resize(num_rows);
+        auto& data = data_column->get_data();
+        auto& nulls = null_column->get_data();
+        for (int i = 0; i < num_rows; i++) {
+            if (skew > 0) {
+                data[i] = std::upper_bound(cdf.begin(), cdf.end(), dist_real(rng)) - cdf.begin();
+                data[i] = std::min<int64_t>(data[i], cardinality - 1);
+            } else {
+                data[i] = dist_uniform(rng);
+            }
+            nulls[i] = null_ratio > 0 && dist_real(rng) < null_ratio;
+        }
+        if (null_ratio <= 0) {
+            return std::move(data_column);
+        }
+        return NullableColumn::create(std::move(data_column), std::move(null_column));
+    }
+
     static ColumnPtr create_random_string_column(int num_rows, int min_length) {
         std::vector<string> elements = create_random_string(num_rows, min_length, 60);
         TypeDescriptor type_desc = TypeDescriptor(TYPE_VARCHAR);
@@ -0,0 +1,119 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "types/bitmap_value.h"
+#include "util/random.h"
+
+namespace starrocks {
+
+// Union `bitmap_count` bitmaps with `value_count` values in [0, range) each, like the bitmap_union
+// aggregation of a user-retention query does.
+class BitmapAggBench {
+public:
+    BitmapAggBench(size_t bitmap_count, size_t value_count, size_t range) : _rand(0) {
+        _bitmaps.resize(bitmap_count);
+        for (auto& bitmap : _bitmaps) {
+            for (size_t i = 0; i < value_count; i++) {
+                bitmap.add(_rand.Next64() % range);
+            }
+        }
+        for (const auto& bitmap : _bitmaps) {
+            _values.push_back(&bitmap);
+        }
+    }
+
+    void union_one_by_one(benchmark::State& state) {
+        for (auto _ : state) {
+            BitmapValue result;
+            for (const auto& bitmap : _bitmaps) {
+                result |= bitmap;
+            }
+            benchmark::DoNotOptimize(result.cardinality());
+        }
+    }
+
+    void union_many(benchmark::State& state) {
+        for (auto _ : state) {
+            BitmapValue result;
+            result.union_many(_values.size(), _values.data());
+            benchmark::DoNotOptimize(result.cardinality());
+        }
+    }
+
+    void intersect_one_by_one(benchmark::State& state) {
+        for (auto _ : state) {
+            BitmapValue result = _bitmaps[0];
+            for (size_t i = 1; i < _bitmaps.size(); i++) {
+                result &= _bitmaps[i];
+            }
+            benchmark::DoNotOptimize(result.cardinality());
+        }
+    }
+
+    void intersect_many(benchmark::State& state) {
+        for (auto _ : state) {
+            BitmapValue result = _bitmaps[0];
+            result.intersect_many(_values.size() - 1, _values.data() + 1);
+            benchmark::DoNotOptimize(result.cardinality());
+        }
+    }
+
+private:
+    std::vector<BitmapValue> _bitmaps;
+    std::vector<const BitmapValue*> _values;
+    Random _rand;
+};
+
+static void bench_union_one_by_one(benchmark::State& state) {
+    BitmapAggBench bench(state.range(0), state.range(1), state.range(2));
+    bench.union_one_by_one(state);
+}
+
+static void bench_union_many(benchmark::State& state) {
+    BitmapAggBench bench(state.range(0), state.range(1), state.range(2));
+    bench.union_many(state);
+}
+
+static void bench_intersect_one_by_one(benchmark::State& state) {
+    BitmapAggBench bench(state.range(0), state.range(1), state.range(2));
+    bench.intersect_one_by_one(state);
+}
+
+static void bench_intersect_many(benchmark::State& state) {
+    BitmapAggBench bench(state.range(0), state.range(1), state.range(2));
+    bench.intersect_many(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // bitmap_count, value_count, range
+    b->Args({1000, 1, 100000000});
+    b->Args({1000, 16, 100000000});
+    b->Args({1000, 1000, 100000000});
+    b->Args({1000, 1000, 1000000});
+    b->Args({100, 100000, 10000000});
+    b->Args({100, 100000, 5000000000});
+}
+
+BENCHMARK(bench_union_one_by_one)->Apply(process_args);
+BENCHMARK(bench_union_many)->Apply(process_args);
+BENCHMARK(bench_intersect_one_by_one)->Apply(process_args);
+BENCHMARK(bench_intersect_many)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
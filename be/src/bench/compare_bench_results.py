@@ -0,0 +1,76 @@
+#! /usr/bin/python3
+# Copyright 2021-present StarRocks, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare two Google Benchmark json outputs and report the regressions.
+
+Usage:
+    compare_bench_results.py base.json new.json [--threshold 0.05]
+
+The exit code is 1 if any benchmark is slower than the base by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for bench in data.get("benchmarks", []):
+        # Skip the aggregates (mean, median, stddev) of repeated runs, except the mean.
+        if bench.get("run_type") == "aggregate" and bench.get("aggregate_name") != "mean":
+            continue
+        name = bench.get("run_name", bench["name"])
+        results[name] = bench["real_time"]
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two Google Benchmark json outputs.")
+    parser.add_argument("base")
+    parser.add_argument("new")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="the relative slowdown reported as a regression, 0.05 by default")
+    args = parser.parse_args()
+
+    base = load(args.base)
+    new = load(args.new)
+
+    regressions = 0
+    width = max([len(name) for name in base] + [len("benchmark")])
+    print("%-*s %14s %14s %9s" % (width, "benchmark", "base", "new", "change"))
+    for name in sorted(base):
+        if name not in new:
+            print("%-*s %14.3f %14s %9s" % (width, name, base[name], "missing", ""))
+            continue
+        change = new[name] / base[name] - 1 if base[name] > 0 else 0
+        mark = ""
+        if change > args.threshold:
+            mark = " REGRESSION"
+            regressions += 1
+        print("%-*s %14.3f %14.3f %+8.1f%%%s" % (width, name, base[name], new[name], change * 100, mark))
+    for name in sorted(set(new) - set(base)):
+        print("%-*s %14s %14.3f %9s" % (width, name, "missing", new[name], ""))
+
+    if regressions > 0:
+        print("%d benchmark(s) regressed by more than %.1f%%" % (regressions, args.threshold * 100))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
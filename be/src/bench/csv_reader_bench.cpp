@@ -237,5 +237,11 @@ int main(int argc, char** argv) {
         std::chrono::duration<double> diff = end - start;
         std::cout << "Have read " << read_row_cnt << " records" << std::endl;
         std::cout << "Parsing: " << diff.count() << std::endl;
+        // the parsing runs in this thread only, so it's the throughput of a single core
+        auto file_size = FileSystem::Default()->get_file_size(filename);
+        if (file_size.ok() && diff.count() > 0) {
+            std::cout << "Parsing throughput: " << *file_size / diff.count() / (1024 * 1024 * 1024) << " GB/s per core"
+                      << std::endl;
+        }
     }
 } // namespace starrocks
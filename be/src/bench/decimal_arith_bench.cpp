@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "exprs/decimal_binary_function.h"
+
+namespace starrocks {
+
+// Decimal128 operands whose unscaled values are at most `bits` bits wide.
+static std::vector<int128_t> random_decimal128(size_t size, int bits, uint64_t seed) {
+    std::mt19937_64 rand(seed);
+    std::vector<int128_t> values(size);
+    for (auto& value : values) {
+        auto v = static_cast<int128_t>((static_cast<uint128_t>(rand()) << 64) | rand());
+        value = v >> (128 - bits);
+    }
+    return values;
+}
+
+template <typename Op>
+static void BM_decimal128_per_row(benchmark::State& state) {
+    const size_t size = state.range(0);
+    const int bits = state.range(1);
+    auto lhs = random_decimal128(size, bits, 1);
+    auto rhs = random_decimal128(size, bits, 2);
+    std::vector<int128_t> result(size);
+    using BinaryOperator = ArithmeticBinaryOperator<Op, TYPE_DECIMAL128>;
+    for (auto _ : state) {
+        bool overflow = false;
+        for (size_t i = 0; i < size; ++i) {
+            overflow |= BinaryOperator::template apply<true, false, int128_t, int128_t, int128_t>(lhs[i], rhs[i],
+                                                                                                  &result[i], 1);
+        }
+        benchmark::DoNotOptimize(overflow);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <typename Op>
+static void BM_decimal128_batch(benchmark::State& state) {
+    const size_t size = state.range(0);
+    const int bits = state.range(1);
+    auto lhs = random_decimal128(size, bits, 1);
+    auto rhs = random_decimal128(size, bits, 2);
+    std::vector<int128_t> result(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DecimalBatchArithmetics<Op>::evaluate(size, lhs.data(), rhs.data(), result.data()));
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+// args: number of rows, width in bits of the operands, 63 bits fits decimal(18, s), 100 bits fits decimal(30, s)
+static void decimal_arith_args(benchmark::internal::Benchmark* b) {
+    for (int64_t size : {4096, 65536}) {
+        for (int64_t bits : {32, 63, 100, 126}) {
+            b->Args({size, bits});
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_decimal128_per_row, AddOp)->Apply(decimal_arith_args);
+BENCHMARK_TEMPLATE(BM_decimal128_batch, AddOp)->Apply(decimal_arith_args);
+BENCHMARK_TEMPLATE(BM_decimal128_per_row, SubOp)->Apply(decimal_arith_args);
+BENCHMARK_TEMPLATE(BM_decimal128_batch, SubOp)->Apply(decimal_arith_args);
+BENCHMARK_TEMPLATE(BM_decimal128_per_row, MulOp)->Apply(decimal_arith_args);
+BENCHMARK_TEMPLATE(BM_decimal128_batch, MulOp)->Apply(decimal_arith_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -84,6 +84,20 @@ static void BM_HashFunctions_Eval(benchmark::State& state) {
 
 BENCHMARK(BM_HashFunctions_Eval)->Apply(BM_HashFunctions_Eval_Arg);
 
+// crc32_hash of the fixed length columns, which is used by the shuffle and the tablet distribution
+static void BM_Column_Crc32Hash(benchmark::State& state) {
+    size_t num_rows = state.range(0);
+    ColumnPtr column = BenchUtil::create_series_int_column(num_rows);
+    std::vector<uint32_t> hashes(num_rows);
+    for (auto _ : state) {
+        column->crc32_hash(hashes.data(), 0, num_rows);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(BM_Column_Crc32Hash)->Arg(4096)->Arg(65536);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "types/hll.h"
+#include "util/random.h"
+
+namespace starrocks {
+
+// Merge `hll_count` full sketches of `value_count` random hashes each, like the hll_union aggregation over a
+// pre-aggregated HLL column does, and estimate the cardinality of sketches, like hll_union_agg and ndv do per group.
+// The scalar cases run the register loops the way they are written without SIMD, as the baseline.
+class HllBench {
+public:
+    HllBench(size_t hll_count, size_t value_count) : _rand(0) {
+        for (int v = 0; v < 65; v++) {
+            _harmonic_table[v] = std::ldexp(1.0f, -v);
+        }
+        _hlls.resize(hll_count);
+        std::vector<uint8_t> buf;
+        for (auto& hll : _hlls) {
+            for (size_t i = 0; i < value_count; i++) {
+                hll.update(_rand.Next64());
+            }
+            buf.resize(hll.max_serialized_size());
+            size_t size = hll.serialize(buf.data());
+            CHECK_EQ(buf[0], HLL_DATA_FULL) << "the sketches must be full, use more values";
+            CHECK_EQ(size, HLL_REGISTERS_COUNT + 1);
+            _registers.emplace_back(buf.begin() + 1, buf.end());
+        }
+    }
+
+    void merge(benchmark::State& state) {
+        for (auto _ : state) {
+            HyperLogLog result;
+            for (const auto& hll : _hlls) {
+                result.merge(hll);
+            }
+            benchmark::DoNotOptimize(result.estimate_cardinality());
+        }
+    }
+
+    void merge_scalar(benchmark::State& state) {
+        for (auto _ : state) {
+            std::vector<uint8_t> result(HLL_REGISTERS_COUNT, 0);
+            for (const auto& registers : _registers) {
+                for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
+                    result[i] = std::max(result[i], registers[i]);
+                }
+                benchmark::ClobberMemory();
+            }
+            benchmark::DoNotOptimize(estimate_scalar(result.data()));
+        }
+    }
+
+    void estimate(benchmark::State& state) {
+        for (auto _ : state) {
+            for (const auto& hll : _hlls) {
+                benchmark::DoNotOptimize(hll.estimate_cardinality());
+            }
+        }
+    }
+
+    void estimate_scalar(benchmark::State& state) {
+        for (auto _ : state) {
+            for (const auto& registers : _registers) {
+                benchmark::DoNotOptimize(estimate_scalar(registers.data()));
+            }
+        }
+    }
+
+private:
+    // The serial float sum of HyperLogLog::estimate_cardinality() before the register histogram.
+    int64_t estimate_scalar(const uint8_t* registers) const {
+        constexpr int num_streams = HLL_REGISTERS_COUNT;
+        const float alpha = 0.7213f / (1 + 1.079f / num_streams);
+        float harmonic_mean = 0;
+        int num_zero_registers = 0;
+        for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
+            harmonic_mean += _harmonic_table[registers[i]];
+            if (registers[i] == 0) {
+                ++num_zero_registers;
+            }
+        }
+        harmonic_mean = 1.0f / harmonic_mean;
+        double estimate = alpha * num_streams * num_streams * harmonic_mean;
+        if (estimate <= num_streams * 2.5 && num_zero_registers != 0) {
+            estimate = num_streams * std::log(static_cast<float>(num_streams) / num_zero_registers);
+        }
+        return std::lround(estimate);
+    }
+
+    float _harmonic_table[65];
+    std::vector<HyperLogLog> _hlls;
+    std::vector<std::vector<uint8_t>> _registers;
+    Random _rand;
+};
+
+static void bench_merge(benchmark::State& state) {
+    HllBench bench(state.range(0), state.range(1));
+    bench.merge(state);
+}
+
+static void bench_merge_scalar(benchmark::State& state) {
+    HllBench bench(state.range(0), state.range(1));
+    bench.merge_scalar(state);
+}
+
+static void bench_estimate(benchmark::State& state) {
+    HllBench bench(state.range(0), state.range(1));
+    bench.estimate(state);
+}
+
+static void bench_estimate_scalar(benchmark::State& state) {
+    HllBench bench(state.range(0), state.range(1));
+    bench.estimate_scalar(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // hll_count, value_count
+    b->Args({1000, 10000});
+    b->Args({100, 1000000});
+    b->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(bench_merge)->Apply(process_args);
+BENCHMARK(bench_merge_scalar)->Apply(process_args);
+BENCHMARK(bench_estimate)->Apply(process_args);
+BENCHMARK(bench_estimate_scalar)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
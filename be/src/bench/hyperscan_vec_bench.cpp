@@ -26,6 +26,7 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exprs/like_predicate.h"
 #include "exprs/string_functions.h"
 
 namespace starrocks {
@@ -154,6 +155,39 @@ BENCHMARK(BM_HyperScan_Eval)->Apply(BM_HyperScan_Eval_Arg);
     BM_HyperScan_Eval/100/0/iterations:10000     100563 ns       100588 ns        10000
      */
 
+// Evaluate the disjunction of `num_patterns` LIKE patterns on the same strings, with one hyperscan database per
+// pattern or with one multi pattern database.
+static void BM_MultiPattern_Like(benchmark::State& state) {
+    size_t num_patterns = state.range(0);
+    bool use_multi_pattern = state.range(1);
+
+    ColumnPtr column = BenchUtil::create_random_string_column(4096, 64);
+    std::vector<std::unique_ptr<LikePredicate::MultiPatternMatcher>> matchers;
+    if (use_multi_pattern) {
+        matchers.emplace_back(std::make_unique<LikePredicate::MultiPatternMatcher>());
+    }
+    for (size_t i = 0; i < num_patterns; i++) {
+        if (!use_multi_pattern) {
+            matchers.emplace_back(std::make_unique<LikePredicate::MultiPatternMatcher>());
+        }
+        std::string pattern = "%" + std::to_string(i) + "_pattern%";
+        matchers.back()->add_like_pattern(pattern);
+    }
+    for (auto& matcher : matchers) {
+        ASSERT_TRUE(matcher->compile());
+    }
+
+    for (auto _ : state) {
+        for (auto& matcher : matchers) {
+            auto result = matcher->match_any(column);
+            ASSERT_TRUE(result.ok());
+            benchmark::DoNotOptimize(result.value());
+        }
+    }
+}
+
+BENCHMARK(BM_MultiPattern_Like)->Args({5, false})->Args({5, true})->Args({50, false})->Args({50, true});
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "exec/join_hash_map.h"
+
+namespace starrocks {
+
+// Simulates the probe of a fixed-size key hash table, the layout is the same as JoinHashTableItems:
+// row 0 of build_data is a placeholder and `first`/`next` link the build rows of each bucket.
+class JoinProbeBench {
+public:
+    JoinProbeBench(size_t num_build_rows, size_t num_probe_rows) {
+        std::mt19937_64 rng(0);
+
+        _build_data.resize(num_build_rows + 1);
+        for (size_t i = 1; i <= num_build_rows; i++) {
+            _build_data[i] = static_cast<int64_t>(rng());
+        }
+
+        _bucket_size = JoinHashMapHelper::calc_bucket_size(num_build_rows + 1);
+        _log_bucket_size = __builtin_ctz(_bucket_size);
+        _first.assign(_bucket_size, 0);
+        _next.assign(num_build_rows + 1, 0);
+        for (uint32_t i = 1; i <= num_build_rows; i++) {
+            uint32_t bucket = JoinHashMapHelper::calc_bucket_num<int64_t>(_build_data[i], _bucket_size,
+                                                                          _log_bucket_size);
+            _next[i] = _first[bucket];
+            _first[bucket] = i;
+        }
+
+        // half of the probe rows hit the hash table
+        _probe_data.resize(num_probe_rows);
+        for (size_t i = 0; i < num_probe_rows; i++) {
+            _probe_data[i] = (i & 1) ? _build_data[1 + rng() % num_build_rows] : static_cast<int64_t>(rng());
+        }
+        _buckets.resize(num_probe_rows);
+        _probe_next.resize(num_probe_rows);
+    }
+
+    template <bool prefetch>
+    size_t probe() {
+        uint32_t count = _probe_data.size();
+        JoinHashMapHelper::calc_bucket_nums<int64_t>(_probe_data, _bucket_size, _log_bucket_size, &_buckets, 0,
+                                                     count);
+        if constexpr (prefetch) {
+            JoinHashMapHelper::lookup_first_with_prefetch<int64_t>(_first, _buckets, _build_data, nullptr, count,
+                                                                   &_probe_next);
+        } else {
+            for (uint32_t i = 0; i < count; i++) {
+                _probe_next[i] = _first[_buckets[i]];
+            }
+        }
+
+        size_t match_count = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            for (uint32_t build_index = _probe_next[i]; build_index != 0; build_index = _next[build_index]) {
+                match_count += _build_data[build_index] == _probe_data[i];
+            }
+        }
+        return match_count;
+    }
+
+private:
+    uint32_t _bucket_size = 0;
+    uint32_t _log_bucket_size = 0;
+    Buffer<int64_t> _build_data;
+    Buffer<uint32_t> _first;
+    Buffer<uint32_t> _next;
+
+    Buffer<int64_t> _probe_data;
+    Buffer<uint32_t> _buckets;
+    Buffer<uint32_t> _probe_next;
+};
+
+template <bool prefetch>
+static void BM_JoinProbe(benchmark::State& state) {
+    JoinProbeBench bench(1UL << state.range(0), 4096);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench.probe<prefetch>());
+    }
+    state.SetItemsProcessed(state.iterations() * 4096);
+}
+
+static void BM_JoinProbe_Arg(benchmark::internal::Benchmark* b) {
+    // build side from 64K rows (fits in L2) to 64M rows (far beyond L3)
+    for (int log_rows = 16; log_rows <= 26; log_rows += 2) {
+        b->Arg(log_rows);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_JoinProbe, false)->Apply(BM_JoinProbe_Arg);
+BENCHMARK_TEMPLATE(BM_JoinProbe, true)->Apply(BM_JoinProbe_Arg);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,247 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "bench/bench_util.h"
+#include "column/chunk.h"
+#include "common/config.h"
+#include "exec/aggregator.h"
+#include "exec/chunks_sorter_topn.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/data.pb.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// Drives the real operator implementations over synthetic chunks of two BIGINT columns `k` and `v`:
+//   range(0): log2 of the cardinality of `k`
+//   range(1): the zipf exponent of `k` multiplied by 10, 0 means uniform
+//   range(2): the percentage of null rows of both columns
+//
+// Compare two runs with compare_bench_results.py:
+//   operator_bench --benchmark_out=base.json --benchmark_out_format=json
+class OperatorBenchSuite {
+public:
+    static constexpr int kChunkSize = 4096;
+    static constexpr int kNumChunks = 256;
+    static constexpr TupleId kInputTupleId = 0;
+    static constexpr TupleId kIntermediateTupleId = 1;
+    static constexpr TupleId kOutputTupleId = 2;
+
+    explicit OperatorBenchSuite(const benchmark::State& state)
+            : _cardinality(1L << state.range(0)), _skew(state.range(1) / 10.0), _null_ratio(state.range(2) / 100.0) {
+        config::vector_chunk_size = kChunkSize;
+        TQueryOptions query_options;
+        query_options.batch_size = kChunkSize;
+        _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _runtime_state->init_instance_mem_tracker();
+
+        const bool nullable = _null_ratio > 0;
+        std::vector<std::vector<SlotTypeInfo>> slot_infos = {
+                {{"k", TYPE_BIGINT, nullable}, {"v", TYPE_BIGINT, nullable}},
+                {{"k", TYPE_BIGINT, nullable}, {"sum_v", TYPE_BIGINT, true}},
+                {{"k", TYPE_BIGINT, nullable}, {"sum_v", TYPE_BIGINT, true}},
+        };
+        _desc_tbl = DescTblHelper::generate_desc_tbl(_runtime_state.get(), _pool,
+                                                     DescTblHelper::create_slot_type_desc_info_arrays(slot_infos));
+        _runtime_state->set_desc_tbl(_desc_tbl);
+
+        for (int i = 0; i < kNumChunks; i++) {
+            auto k = BenchUtil::create_skewed_bigint_column(kChunkSize, _cardinality, _skew, _null_ratio, i);
+            auto v = BenchUtil::create_skewed_bigint_column(kChunkSize, 1L << 30, 0, _null_ratio, kNumChunks + i);
+            Chunk::SlotHashMap slot_map{{0, 0}, {1, 1}};
+            _chunks.emplace_back(std::make_shared<Chunk>(Columns{std::move(k), std::move(v)}, slot_map));
+        }
+    }
+
+    RuntimeState* runtime_state() const { return _runtime_state.get(); }
+    const std::vector<ChunkPtr>& chunks() const { return _chunks; }
+    int64_t num_rows() const { return kChunkSize * kNumChunks; }
+    bool nullable() const { return _null_ratio > 0; }
+
+    // select k, sum(v) from t group by k
+    std::shared_ptr<Aggregator> create_aggregator(TStreamingPreaggregationMode::type mode, RuntimeProfile* profile) {
+        auto bigint_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+
+        auto params = std::make_shared<AggregatorParams>();
+        params->needs_finalize = false;
+        params->has_outer_join_child = false;
+        params->limit = -1;
+        params->enable_pipeline_share_limit = false;
+        params->streaming_preaggregation_mode = mode;
+        params->intermediate_tuple_id = kIntermediateTupleId;
+        params->output_tuple_id = kOutputTupleId;
+        params->is_testing = false;
+        params->is_append_only = true;
+        params->is_generate_retract = false;
+        params->count_agg_idx = 0;
+        params->grouping_exprs = {ExprsTestHelper::create_slot_expr(
+                ExprsTestHelper::create_slot_expr_node(kInputTupleId, 0, bigint_type, nullable()))};
+        auto sum_fn = ExprsTestHelper::create_builtin_function("sum", {bigint_type}, bigint_type, bigint_type);
+        params->aggregate_functions = {ExprsTestHelper::create_aggregate_expr(
+                sum_fn, {ExprsTestHelper::create_slot_expr_node(kInputTupleId, 1, bigint_type, nullable())})};
+        params->init();
+
+        auto aggregator = std::make_shared<Aggregator>(std::move(params));
+        CHECK(aggregator->prepare(runtime_state(), &_pool, profile).ok());
+        CHECK(aggregator->open(runtime_state()).ok());
+        return aggregator;
+    }
+
+    RowDescriptor input_row_desc() const { return RowDescriptor(*_desc_tbl, {kInputTupleId}); }
+
+private:
+    const int64_t _cardinality;
+    const double _skew;
+    const double _null_ratio;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    DescriptorTbl* _desc_tbl = nullptr;
+    std::vector<ChunkPtr> _chunks;
+};
+
+// The blocking aggregation: build the hash map and update the agg states of every input chunk.
+static void BM_AggregateBlocking(benchmark::State& state) {
+    OperatorBenchSuite suite(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        RuntimeProfile profile("aggregator");
+        auto aggregator = suite.create_aggregator(TStreamingPreaggregationMode::FORCE_PREAGGREGATION, &profile);
+        state.ResumeTiming();
+
+        for (const auto& chunk : suite.chunks()) {
+            const size_t chunk_size = chunk->num_rows();
+            CHECK(aggregator->evaluate_groupby_exprs(chunk.get()).ok());
+            aggregator->build_hash_map(chunk_size);
+            aggregator->try_convert_to_two_level_map();
+            CHECK(aggregator->compute_batch_agg_states(chunk.get(), chunk_size).ok());
+        }
+        benchmark::DoNotOptimize(aggregator->hash_map_variant().size());
+
+        state.PauseTiming();
+        aggregator->close(suite.runtime_state());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * suite.num_rows());
+}
+
+// The streaming aggregation which passes every input chunk through, as it does for a low reduction.
+static void BM_AggregateStreaming(benchmark::State& state) {
+    OperatorBenchSuite suite(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        RuntimeProfile profile("aggregator");
+        auto aggregator = suite.create_aggregator(TStreamingPreaggregationMode::FORCE_STREAMING, &profile);
+        state.ResumeTiming();
+
+        for (const auto& chunk : suite.chunks()) {
+            CHECK(aggregator->evaluate_groupby_exprs(chunk.get()).ok());
+            ChunkPtr res = std::make_shared<Chunk>();
+            CHECK(aggregator->output_chunk_by_streaming(chunk.get(), &res).ok());
+            benchmark::DoNotOptimize(res->num_rows());
+        }
+
+        state.PauseTiming();
+        aggregator->close(suite.runtime_state());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * suite.num_rows());
+}
+
+// order by k limit 100
+static void BM_TopN(benchmark::State& state) {
+    OperatorBenchSuite suite(state);
+    RuntimeState* runtime_state = suite.runtime_state();
+
+    ColumnRef sort_key(TypeDescriptor(TYPE_BIGINT), 0);
+    ExprContext sort_expr_ctx(&sort_key);
+    CHECK(sort_expr_ctx.prepare(runtime_state).ok());
+    CHECK(sort_expr_ctx.open(runtime_state).ok());
+    std::vector<ExprContext*> sort_exprs{&sort_expr_ctx};
+    std::vector<bool> is_asc{true};
+    std::vector<bool> is_null_first{true};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        RuntimeProfile profile("topn");
+        ChunksSorterTopn sorter(runtime_state, &sort_exprs, &is_asc, &is_null_first, "", 0, 100);
+        sorter.setup_runtime(runtime_state, &profile, runtime_state->instance_mem_tracker());
+        state.ResumeTiming();
+
+        for (const auto& chunk : suite.chunks()) {
+            CHECK(sorter.update(runtime_state, chunk).ok());
+        }
+        CHECK(sorter.done(runtime_state).ok());
+        bool eos = false;
+        while (!eos) {
+            ChunkPtr page;
+            CHECK(sorter.get_next(&page, &eos).ok());
+        }
+    }
+    sort_expr_ctx.close(runtime_state);
+    state.SetItemsProcessed(state.iterations() * suite.num_rows());
+}
+
+// The chunk serde of ExchangeSinkOperator and ExchangeSourceOperator.
+static void BM_ExchangeSerde(benchmark::State& state) {
+    OperatorBenchSuite suite(state);
+    RowDescriptor row_desc = suite.input_row_desc();
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        for (const auto& chunk : suite.chunks()) {
+            auto chunk_pb = serde::ProtobufChunkSerde::serialize(*chunk);
+            CHECK(chunk_pb.ok());
+            bytes += chunk_pb.value().data().size();
+            auto res = serde::ProtobufChunkSerde::deserialize(row_desc, chunk_pb.value());
+            CHECK(res.ok());
+            benchmark::DoNotOptimize(res.value().num_rows());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * suite.num_rows());
+    state.SetBytesProcessed(bytes);
+}
+
+static void BM_Operator_Args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"log_card", "skew_x10", "null_pct"});
+    // cardinality from 1K (fits in L1) to 16M (far beyond L3), uniform
+    for (int log_card = 10; log_card <= 24; log_card += 7) {
+        b->Args({log_card, 0, 0});
+    }
+    // skew and nulls on a medium cardinality
+    b->Args({17, 10, 0});
+    b->Args({17, 20, 0});
+    b->Args({17, 0, 10});
+    b->Args({17, 0, 50});
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_AggregateBlocking)->Apply(BM_Operator_Args);
+BENCHMARK(BM_AggregateStreaming)->Apply(BM_Operator_Args);
+BENCHMARK(BM_TopN)->Apply(BM_Operator_Args);
+BENCHMARK(BM_ExchangeSerde)->Apply(BM_Operator_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -73,7 +73,7 @@ public:
     ~PersistentIndexBenchTest() { (void)fs::remove_all(_index_dir); }
 
     void do_bench(benchmark::State& state);
-    void do_verify();
+    void do_verify(benchmark::State& state);
 
 private:
     PersistentIndexMetaPB _index_meta;
@@ -87,7 +87,7 @@ private:
     uint64_t _long_tail_stat = 0;
 };
 
-void PersistentIndexBenchTest::do_verify() {
+void PersistentIndexBenchTest::do_verify(benchmark::State& state) {
     // verify
     vector<Key> keys(_params.total_record);
     vector<Slice> key_slices(_params.total_record);
@@ -98,7 +98,14 @@ void PersistentIndexBenchTest::do_verify() {
         key_slices[i] = keys[i];
     }
     std::vector<IndexValue> get_values(keys.size());
+    MonotonicStopWatch watch;
+    watch.start();
     ASSERT_CHECK(_index->get(keys.size(), key_slices.data(), get_values.data()));
+    // the get runs in the calling thread, so this is the lookup throughput of a single core
+    double lookup_keys_per_sec = keys.size() * 1e9 / std::max<uint64_t>(watch.elapsed_time(), 1);
+    state.counters["lookup_keys_per_sec"] = lookup_keys_per_sec;
+    LOG(INFO) << fmt::format("PersistentIndexBench lookup {} keys, {:.0f} keys/s per core", keys.size(),
+                             lookup_keys_per_sec);
     assert(keys.size() == get_values.size());
     for (int i = 0; i < values.size(); i++) {
         assert(values[i] == get_values[i]);
@@ -154,7 +161,7 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
             _total_stat.flush_or_wal_cost / total_step, _total_stat.compaction_cost / total_step,
             _total_stat.reload_meta_cost / total_step, _long_tail_stat);
     // verify
-    do_verify();
+    do_verify(state);
 }
 
 static void bench_func(benchmark::State& state) {
@@ -0,0 +1,287 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cache/datacache.h"
+#include "cache/lrucache_engine.h"
+#include "cache/object_cache/page_cache.h"
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "common/config.h"
+#include "fs/fs.h"
+#include "fs/fs_memory.h"
+#include "fs/fs_util.h"
+#include "gen_cpp/tablet_schema.pb.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/olap_common.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "testutil/assert.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+
+// Writes a real segment with SegmentWriter and scans it with SegmentIterator.
+//
+// The encoding of a column follows its type, so the columns are chosen to cover the common encodings:
+//   c0 INT      sorted key, BIT_SHUFFLE
+//   c1 INT      uniform in [0, kValueRange), BIT_SHUFFLE, the column of the predicate
+//   c2 VARCHAR  low cardinality, DICT
+//   c3 VARCHAR  high cardinality, DICT falls back to PLAIN
+//   c4 BOOLEAN  RLE
+//
+// Every scan reads c1 and one target column with `c1 < selectivity * kValueRange`. Below 100% the target column
+// is late materialized by the iterator, only the rows passing the predicate are read.
+//   range(0): the file system, 0: MemoryFileSystem, 1: tmpfs (/dev/shm), 2: disk ($SEGMENT_BENCH_DIR or cwd)
+//   range(1): the target column id
+//   range(2): the selectivity of the predicate in percent, 100 means no predicate
+//   range(3): 1 to read with a warmed page cache, 0 to bypass it
+//
+// Besides rows/s and bytes/s, the time of each phase in OlapReaderStatistics is reported in ms per iteration.
+// Note the OS page cache is not dropped for the posix file systems, the disk case measures a warm OS cache.
+class SegmentScanBenchSuite {
+public:
+    static constexpr int kNumRows = 1 << 20;
+    static constexpr int kChunkSize = 4096;
+    static constexpr int32_t kValueRange = 1000000;
+    static constexpr int kPredicateColumn = 1;
+    static constexpr size_t kPageCacheSize = 1024L * 1024 * 1024;
+
+    explicit SegmentScanBenchSuite(const benchmark::State& state)
+            : _fs_type(state.range(0)),
+              _target_column(state.range(1)),
+              _selectivity(state.range(2)),
+              _use_page_cache(state.range(3) != 0) {
+        config::vector_chunk_size = kChunkSize;
+        _init_page_cache();
+        _init_fs();
+        _tablet_schema = _create_tablet_schema();
+        _write_segment();
+        ASSIGN_OR_ABORT(_segment, Segment::open(_fs, FileInfo{_filename}, 0, _tablet_schema));
+    }
+
+    ~SegmentScanBenchSuite() {
+        _segment.reset();
+        if (_fs_type != 0) {
+            (void)fs::remove_all(_dir);
+        }
+        DataCache::GetInstance()->set_page_cache(_prev_page_cache);
+    }
+
+    // Scan the segment once, return the number of rows output.
+    int64_t scan(OlapReaderStatistics* stats) {
+        std::vector<ColumnId> column_ids{kPredicateColumn};
+        if (_target_column != kPredicateColumn) {
+            column_ids.emplace_back(_target_column);
+        }
+        auto schema = ChunkHelper::convert_schema(_tablet_schema, column_ids);
+
+        SegmentReadOptions seg_options;
+        seg_options.fs = _fs;
+        seg_options.stats = stats;
+        seg_options.tablet_schema = _tablet_schema;
+        seg_options.use_page_cache = _use_page_cache;
+
+        std::unique_ptr<ColumnPredicate> predicate;
+        if (_selectivity < 100) {
+            const auto upper = static_cast<int32_t>(_selectivity * (kValueRange / 100));
+            predicate.reset(
+                    new_column_lt_predicate_from_datum(get_type_info(TYPE_INT), kPredicateColumn, Datum(upper)));
+            PredicateAndNode pred_root;
+            pred_root.add_child(PredicateColumnNode{predicate.get()});
+            seg_options.pred_tree = PredicateTree::create(std::move(pred_root));
+        }
+
+        ASSIGN_OR_ABORT(auto iter, _segment->new_iterator(schema, seg_options));
+        auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+        int64_t rows = 0;
+        while (true) {
+            chunk->reset();
+            auto st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            rows += chunk->num_rows();
+        }
+        iter->close();
+        return rows;
+    }
+
+private:
+    void _init_page_cache() {
+        _prev_page_cache = DataCache::GetInstance()->page_cache_ptr();
+        CacheOptions options{.mem_space_size = kPageCacheSize};
+        _cache_engine = std::make_shared<LRUCacheEngine>();
+        CHECK(_cache_engine->init(options).ok());
+        DataCache::GetInstance()->set_page_cache(std::make_shared<StoragePageCache>(_cache_engine.get()));
+    }
+
+    void _init_fs() {
+        if (_fs_type == 0) {
+            _fs = std::make_shared<MemoryFileSystem>();
+            _dir = "/segment_scan_bench";
+            CHECK(_fs->create_dir(_dir).ok());
+        } else {
+            ASSIGN_OR_ABORT(_fs, FileSystem::CreateSharedFromString("posix://"));
+            std::string parent = "/dev/shm";
+            if (_fs_type == 2) {
+                const char* env = getenv("SEGMENT_BENCH_DIR");
+                parent = env != nullptr ? env : ".";
+            }
+            _dir = fmt::format("{}/segment_scan_bench_{}", parent, getpid());
+            CHECK(fs::create_directories(_dir).ok());
+        }
+        // The page cache is keyed by the file name, a fresh name per suite keeps the runs apart.
+        static int seg_id = 0;
+        _filename = fmt::format("{}/{}.dat", _dir, seg_id++);
+    }
+
+    static TabletSchemaSPtr _create_tablet_schema() {
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(DUP_KEYS);
+        schema_pb.set_num_short_key_columns(1);
+        auto add_column = [&](int32_t id, const std::string& type, int32_t length, bool is_key) {
+            auto col = schema_pb.add_column();
+            col->set_unique_id(id);
+            col->set_name(fmt::format("c{}", id));
+            col->set_type(type);
+            col->set_length(length);
+            col->set_index_length(std::min(length, 16));
+            col->set_is_key(is_key);
+            col->set_is_nullable(false);
+            col->set_aggregation("NONE");
+        };
+        add_column(0, "INT", 4, true);
+        add_column(1, "INT", 4, false);
+        add_column(2, "VARCHAR", 64, false);
+        add_column(3, "VARCHAR", 64, false);
+        add_column(4, "BOOLEAN", 1, false);
+        return TabletSchema::create(schema_pb);
+    }
+
+    void _write_segment() {
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(_filename));
+        SegmentWriterOptions opts;
+        SegmentWriter writer(std::move(wfile), 0, _tablet_schema, opts);
+        CHECK(writer.init().ok());
+
+        std::mt19937 rng(0);
+        std::uniform_int_distribution<int32_t> value_dist(0, kValueRange - 1);
+        std::uniform_int_distribution<int32_t> low_card_dist(0, 63);
+        std::vector<std::string> low_card_values;
+        for (int i = 0; i < 64; i++) {
+            low_card_values.emplace_back(fmt::format("category_{:04d}", i));
+        }
+
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+        std::string high_card_value;
+        for (int32_t rid = 0; rid < kNumRows;) {
+            chunk->reset();
+            auto& cols = chunk->columns();
+            for (int i = 0; i < kChunkSize && rid < kNumRows; i++, rid++) {
+                high_card_value = fmt::format("{:016x}-{}", rng(), rid);
+                cols[0]->append_datum(Datum(rid));
+                cols[1]->append_datum(Datum(value_dist(rng)));
+                cols[2]->append_datum(Datum(Slice(low_card_values[low_card_dist(rng)])));
+                cols[3]->append_datum(Datum(Slice(high_card_value)));
+                cols[4]->append_datum(Datum(static_cast<uint8_t>(rid / 1000 % 2)));
+            }
+            CHECK(writer.append_chunk(*chunk).ok());
+        }
+
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        CHECK(writer.finalize(&file_size, &index_size, &footer_position).ok());
+    }
+
+    const int64_t _fs_type;
+    const int64_t _target_column;
+    const int64_t _selectivity;
+    const bool _use_page_cache;
+
+    std::shared_ptr<LRUCacheEngine> _cache_engine;
+    std::shared_ptr<StoragePageCache> _prev_page_cache;
+    std::shared_ptr<FileSystem> _fs;
+    std::string _dir;
+    std::string _filename;
+    TabletSchemaSPtr _tablet_schema;
+    SegmentSharedPtr _segment;
+};
+
+static void BM_SegmentScan(benchmark::State& state) {
+    SegmentScanBenchSuite suite(state);
+    if (state.range(3) != 0) {
+        OlapReaderStatistics warmup_stats;
+        suite.scan(&warmup_stats);
+    }
+
+    OlapReaderStatistics stats;
+    int64_t rows = 0;
+    for (auto _ : state) {
+        rows += suite.scan(&stats);
+    }
+
+    state.SetItemsProcessed(state.iterations() * SegmentScanBenchSuite::kNumRows);
+    state.SetBytesProcessed(stats.uncompressed_bytes_read);
+    auto per_iteration_ms = [&](int64_t ns) {
+        return benchmark::Counter(ns / 1000000.0, benchmark::Counter::kAvgIterations);
+    };
+    state.counters["rows_out"] = benchmark::Counter(rows, benchmark::Counter::kAvgIterations);
+    state.counters["io_bytes"] = benchmark::Counter(stats.compressed_bytes_read, benchmark::Counter::kAvgIterations);
+    state.counters["io_ms"] = per_iteration_ms(stats.io_ns);
+    state.counters["decompress_ms"] = per_iteration_ms(stats.decompress_ns);
+    state.counters["block_load_ms"] = per_iteration_ms(stats.block_load_ns);
+    state.counters["pred_ms"] = per_iteration_ms(stats.vec_cond_evaluate_ns);
+    state.counters["late_mat_ms"] = per_iteration_ms(stats.late_materialize_ns);
+    state.counters["zonemap_ms"] = per_iteration_ms(stats.zone_map_filter_ns);
+    state.counters["cache_hits"] = benchmark::Counter(stats.cached_pages_num, benchmark::Counter::kAvgIterations);
+}
+
+static void BM_SegmentScan_Args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"fs", "column", "sel_pct", "page_cache"});
+    for (int fs_type : {0, 1, 2}) {
+        for (int column : {0, 2, 3, 4}) {
+            for (int selectivity : {1, 10, 100}) {
+                for (int page_cache : {0, 1}) {
+                    b->Args({fs_type, column, selectivity, page_cache});
+                }
+            }
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_SegmentScan)->Apply(BM_SegmentScan_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -61,6 +61,8 @@ struct CacheOptions {
     double skip_read_factor = 0;
     uint32_t inline_item_count_limit = 0;
     std::string eviction_policy;
+    // only used by the lrucache engine
+    bool enable_admission_filter = false;
 };
 
 struct WriteCacheOptions {
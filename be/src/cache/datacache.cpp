@@ -161,6 +161,7 @@ StatusOr<CacheOptions> DataCache::_init_cache_options() {
     RETURN_IF_ERROR(DataCacheUtils::parse_conf_datacache_mem_size(
             config::datacache_mem_size, _global_env->process_mem_limit(), &cache_options.mem_space_size));
     cache_options.engine = config::datacache_engine;
+    cache_options.enable_admission_filter = config::datacache_mem_admission_filter_enable;
 
     if (config::datacache_engine == "starcache") {
         for (auto& root_path : _store_paths) {
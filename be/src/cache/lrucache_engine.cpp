@@ -17,8 +17,15 @@
 #include <butil/fast_rand.h>
 
 namespace starrocks {
+
+// The frequency sketch of the admission filter is sized by the number of the data pages the cache can hold.
+static constexpr size_t kAdmissionFilterExpectedEntrySize = 64 * 1024;
+
 Status LRUCacheEngine::init(const CacheOptions& options) {
     _cache = std::make_unique<ShardedLRUCache>(options.mem_space_size);
+    if (options.enable_admission_filter) {
+        _cache->enable_admission_filter(kAdmissionFilterExpectedEntrySize);
+    }
     _initialized.store(true, std::memory_order_relaxed);
     return Status::OK();
 }
@@ -30,6 +30,7 @@
 #include "util/hash_util.hpp"
 #include "util/mysql_row_buffer.h"
 #include "util/raw_container.h"
+#include "util/utf8.h"
 
 namespace starrocks {
 template <typename T>
@@ -354,6 +355,25 @@ void BinaryColumnBase<T>::_build_slices() const {
     _slices_cache = true;
 }
 
+template <typename T>
+bool BinaryColumnBase<T>::is_ascii() const {
+    if (_ascii_prefix_size > _bytes.size()) {
+        _reset_ascii_cache();
+    }
+    if (_has_non_ascii) {
+        return false;
+    }
+    if (_ascii_prefix_size < _bytes.size()) {
+        const auto* data = reinterpret_cast<const char*>(_bytes.data()) + _ascii_prefix_size;
+        if (!validate_ascii_fast(data, _bytes.size() - _ascii_prefix_size)) {
+            _has_non_ascii = true;
+            return false;
+        }
+        _ascii_prefix_size = _bytes.size();
+    }
+    return true;
+}
+
 template <typename T>
 void BinaryColumnBase<T>::fill_default(const Filter& filter) {
     std::vector<uint32_t> indexes;
@@ -387,6 +407,7 @@ void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes
     }
 
     if (!need_resize) {
+        _reset_ascii_cache();
         auto* dest_bytes = _bytes.data();
         const auto& src_bytes = src_column.get_bytes();
         const auto& src_offsets = src_column.get_offset();
@@ -416,6 +437,7 @@ template <typename T>
 void BinaryColumnBase<T>::assign(size_t n, size_t idx) {
     std::string value = std::string((char*)_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
     _bytes.clear();
+    _reset_ascii_cache();
     _offsets.clear();
     _offsets.emplace_back(0);
     const auto* const start = reinterpret_cast<const Bytes::value_type*>(value.data());
@@ -438,6 +460,7 @@ void BinaryColumnBase<T>::remove_first_n_values(size_t count) {
     _offsets = std::move(binary_column->_offsets);
     _bytes = std::move(binary_column->_bytes);
     _slices_cache = false;
+    _reset_ascii_cache();
 }
 
 template <typename T>
@@ -471,6 +494,7 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
     auto start_offset = from;
     auto result_offset = from;
 
+    _reset_ascii_cache();
     uint8_t* data = _bytes.data();
 
 #ifdef __AVX2__
@@ -788,6 +812,7 @@ StatusOr<ColumnPtr> BinaryColumnBase<T>::upgrade_if_overflow() {
             auto new_column = BinaryColumnBase<uint64_t>::create();
             new_column->get_offset().resize(_offsets.size());
             new_column->get_bytes().swap(_bytes);
+            _reset_ascii_cache();
 
             size_t base = 0;
             size_t start = 0;
@@ -828,6 +853,7 @@ StatusOr<ColumnPtr> BinaryColumnBase<T>::downgrade() {
             auto new_column = BinaryColumn::create();
             new_column->get_offset().resize(_offsets.size());
             new_column->get_bytes().swap(_bytes);
+            _reset_ascii_cache();
 
             for (size_t i = 0; i < _offsets.size(); i++) {
                 new_column->get_offset()[i] = static_cast<uint32_t>(_offsets[i]);
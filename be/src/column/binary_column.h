@@ -164,6 +164,9 @@ public:
         _offsets.resize(n + 1, _offsets.back());
         _bytes.resize(_offsets.back());
         _slices_cache = false;
+        // the removed bytes may be the non-ASCII ones
+        _ascii_prefix_size = std::min(_ascii_prefix_size, _bytes.size());
+        _has_non_ascii = false;
     }
 
     void assign(size_t n, size_t idx) override;
@@ -300,7 +303,11 @@ public:
 
     const BinaryDataProxyContainer& get_proxy_data() const { return _immuable_container; }
 
-    Bytes& get_bytes() { return _bytes; }
+    // NOTE: the bytes may be modified in place by the caller, so the cached ASCII prefix is reset.
+    Bytes& get_bytes() {
+        _reset_ascii_cache();
+        return _bytes;
+    }
 
     const Bytes& get_bytes() const { return _bytes; }
 
@@ -325,6 +332,8 @@ public:
         swap(_offsets, r._offsets);
         swap(_slices, r._slices);
         swap(_slices_cache, r._slices_cache);
+        swap(_ascii_prefix_size, r._ascii_prefix_size);
+        swap(_has_non_ascii, r._has_non_ascii);
     }
 
     void reset_column() override {
@@ -334,9 +343,17 @@ public:
         _offsets.resize(1, 0);
         _slices.clear();
         _slices_cache = false;
+        _reset_ascii_cache();
+    }
+
+    void invalidate_slice_cache() {
+        _slices_cache = false;
+        _reset_ascii_cache();
     }
 
-    void invalidate_slice_cache() { _slices_cache = false; }
+    // Whether all the bytes of the column are ASCII. The verified ASCII prefix is cached, so the later calls only
+    // check the bytes appended since then.
+    bool is_ascii() const;
 
     std::string debug_item(size_t idx) const override;
 
@@ -361,11 +378,20 @@ public:
 private:
     void _build_slices() const;
 
+    void _reset_ascii_cache() const {
+        _ascii_prefix_size = 0;
+        _has_non_ascii = false;
+    }
+
     Bytes _bytes;
     Offsets _offsets;
 
     mutable Container _slices;
     mutable bool _slices_cache = false;
+    // the leading |_ascii_prefix_size| bytes are known to be ASCII, and |_has_non_ascii| is set once a non-ASCII
+    // byte is found after them.
+    mutable size_t _ascii_prefix_size = 0;
+    mutable bool _has_non_ascii = false;
     BinaryDataProxyContainer _immuable_container = BinaryDataProxyContainer(*this);
 };
 
@@ -107,7 +107,18 @@ void Chunk::swap_chunk(Chunk& other) {
 
 void Chunk::set_num_rows(size_t count) {
     for (ColumnPtr& c : _columns) {
-        c->resize(count);
+        if (c->use_count() > 1 && !c->is_constant()) {
+            // the column is shared with other chunks, copy the kept rows rather than resizing it in place
+            auto copy = c->clone_empty();
+            copy->append(*c, 0, std::min(count, c->size()));
+            copy->resize(count);
+            c = std::move(copy);
+        } else if (c->use_count() > 1) {
+            c = c->clone();
+            c->resize(count);
+        } else {
+            c->resize(count);
+        }
     }
 }
 
@@ -282,6 +293,18 @@ std::unique_ptr<Chunk> Chunk::clone_unique() const {
     return chunk;
 }
 
+std::unique_ptr<Chunk> Chunk::clone_shared() const {
+    std::unique_ptr<Chunk> chunk;
+    if (_columns.size() == _slot_id_to_index.size()) {
+        chunk = std::make_unique<Chunk>(_columns, _slot_id_to_index);
+    } else {
+        chunk = std::make_unique<Chunk>(_columns, _schema);
+    }
+    chunk->_owner_info = _owner_info;
+    chunk->_extra_data = _extra_data;
+    return chunk;
+}
+
 void Chunk::append_selective(const Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
     DCHECK_EQ(_columns.size(), src.columns().size());
     for (size_t i = 0; i < _columns.size(); ++i) {
@@ -300,7 +323,31 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
-    if (!force && SIMD::count_zero(selection) == 0) {
+    const size_t num_selected = SIMD::count_nonzero(selection);
+    if (!force && num_selected == selection.size()) {
+        return num_rows();
+    }
+    // When only a few rows are kept from a wide chunk, scan the selection only once and gather the kept rows
+    // of every column, instead of scanning the whole selection and compacting every column in place.
+    static constexpr size_t kSparseSelectionRatio = 8;
+    if (_columns.size() > 1 && num_selected * kSparseSelectionRatio <= selection.size() &&
+        selection.size() == num_rows()) {
+        std::vector<uint32_t> indexes;
+        indexes.reserve(num_selected);
+        for (uint32_t i = 0; i < selection.size(); i++) {
+            if (selection[i]) {
+                indexes.emplace_back(i);
+            }
+        }
+        for (auto& column : _columns) {
+            if (column->is_constant()) {
+                column->filter(selection);
+                continue;
+            }
+            auto dst = column->clone_empty();
+            dst->append_selective(*column, indexes.data(), 0, num_selected);
+            column = std::move(dst);
+        }
         return num_rows();
     }
     for (auto& column : _columns) {
@@ -167,6 +167,9 @@ public:
     ChunkUniquePtr clone_empty_with_slot(size_t size) const;
     ChunkUniquePtr clone_empty_with_schema(size_t size) const;
     ChunkUniquePtr clone_unique() const;
+    // Create a chunk sharing the columns with this chunk, e.g. for the consumers of multi cast exchange. The shared
+    // columns are copied on the first write instead of up front, see set_num_rows.
+    ChunkUniquePtr clone_shared() const;
 
     void append(const Chunk& src) { append(src, 0, src.num_rows()); }
     void merge(Chunk&& src);
@@ -251,10 +251,10 @@ void FixedLengthColumnBase<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
-            uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[i]);
-            hash[i] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
+            uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
         } else {
-            hash[i] = HashUtil::zlib_crc_hash(&_data[i], sizeof(ValueType), hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(ValueType)>(&_data[i], hash[i]);
         }
     }
 }
@@ -271,10 +271,10 @@ void FixedLengthColumnBase<T>::crc32_hash_with_selection(uint32_t* hash, uint8_t
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
-            uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[i]);
-            hash[i] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
+            uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
         } else {
-            hash[i] = HashUtil::zlib_crc_hash(&_data[i], sizeof(ValueType), hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(ValueType)>(&_data[i], hash[i]);
         }
     }
 }
@@ -288,10 +288,10 @@ void FixedLengthColumnBase<T>::crc32_hash_selective(uint32_t* hash, uint16_t* se
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[sel[i]].int_value();
             int32_t frac_val = _data[sel[i]].frac_value();
-            uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[sel[i]]);
-            hash[sel[i]] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
+            uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[sel[i]]);
+            hash[sel[i]] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
         } else {
-            hash[sel[i]] = HashUtil::zlib_crc_hash(&_data[sel[i]], sizeof(ValueType), hash[sel[i]]);
+            hash[sel[i]] = HashUtil::zlib_crc_hash_fixed<sizeof(ValueType)>(&_data[sel[i]], hash[sel[i]]);
         }
     }
 }
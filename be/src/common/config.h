@@ -227,6 +227,13 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// Whether to hand over the serialized chunk data to the brpc attachment of exchange without copying it.
+CONF_mBool(enable_exchange_zero_copy_attachment, "true");
+// Whether to hand over the shuffled chunks to the pass through buffer of a local destination without cloning them.
+CONF_mBool(enable_exchange_pass_through_without_clone, "true");
+// The number of rows sampled by each hash shuffle exchange sink to report the ratio of its hottest key in the profile.
+// 0 means disable the sampling.
+CONF_mInt64(exchange_shuffle_skew_sample_rows, "65536");
 // Acceleration of LZ4 Compression, the larger the acceleration value, the faster the algorithm, but also the lesser the compression.
 // Default 1, MIN=1, MAX=65537
 CONF_mInt32(lz4_acceleration, "1");
@@ -262,16 +269,30 @@ CONF_mInt32(max_scan_key_num, "1024");
 // The max number of push down values of a single column.
 // if exceed, no conditions will be pushed down for that column.
 CONF_mInt32(max_pushdown_conditions_per_column, "1024");
+// The min number of the integer values of an IN list to be tested with a bitset instead of the hash set, if the
+// values are dense enough that the bitset takes no more memory than the values.
+CONF_mInt32(in_predicate_bitset_min_values, "16");
 // (Advanced) Maximum size of per-query receive-side buffer.
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
+// Whether the exchange source coalesces the small chunks already received into one chunk of up to chunk_size rows.
+CONF_mBool(enable_exchange_source_coalesce_chunks, "true");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Whether to sort the fixed-width sort keys by radix sort over their normalized composite keys.
+CONF_mBool(enable_radix_sort, "true");
+// The min rows to sort by radix sort, comparison sort is faster for fewer rows.
+CONF_mInt32(radix_sort_min_rows, "1024");
+// Whether to sort the leading fixed-width sort keys at once by their normalized prefix key.
+CONF_mBool(enable_sort_key_prefix, "true");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// The number of rowsets of a tablet converted at the same time by a sorting or directly schema change. The memory
+// limitation of the task is shared by them. Schema changes evaluating expressions always convert one at a time.
+CONF_mInt32(schema_change_max_parallel_rowsets, "1");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
@@ -318,6 +339,13 @@ CONF_mBool(enable_bitmap_index_memory_page_cache, "true");
 CONF_mBool(enable_zonemap_index_memory_page_cache, "true");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "true");
+// A compressed data page whose uncompressed size is at least this times of its compressed size is cached in its
+// compressed form when it is read from the file at first, and is cached in its decompressed form when it is read
+// again. `0` disables the compressed form and always caches the decompressed pages.
+CONF_mDouble(storage_page_cache_compressed_ratio_threshold, "0");
+// The number of data pages a column iterator advises the local file to read ahead when it moves to the next page,
+// so that the disk I/O overlaps the decoding. `0` disables the read-ahead.
+CONF_mInt32(column_data_page_prefetch_num, "4");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -335,6 +363,9 @@ CONF_mInt64(max_cumulative_compaction_num_singleton_deltas, "500");
 // This config is to limit the max concurrency of running cumulative compaction tasks.
 // -1 means no limit if enable event_based_compaction_framework, and the max concurrency will be:
 CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
+// When the max io util of the disks reaches this percent, base compactions are not scheduled and cumulative
+// compactions can't exceed cumulative_compaction_num_threads_per_disk, 0 means no throttle.
+CONF_mInt32(compaction_throttle_disk_io_util_percent, "0");
 // CONF_Int32(cumulative_compaction_write_mbytes_per_sec, "100");
 
 // This config is to limit the max candidate of compaction queue to avoid
@@ -357,6 +388,10 @@ CONF_mInt64(update_compaction_size_threshold, "268435456");
 CONF_mInt64(update_compaction_result_bytes, "1073741824");
 // This config controls the io amp ratio of delvec files.
 CONF_mInt32(update_compaction_delvec_file_io_amp_ratio, "2");
+// A rowset whose segments have more delta column files of the column mode partial updates than this per segment on
+// average gets a compaction score per extra file, so the compaction folds the delta columns back into the segments
+// before the reads open too many files. 0 disables it.
+CONF_mInt32(update_compaction_max_dcg_files_per_segment, "0");
 // This config defines the maximum percentage of data allowed per compaction
 CONF_mDouble(update_compaction_ratio_threshold, "0.5");
 // This config controls max memory that we can use for partial update.
@@ -440,6 +475,11 @@ CONF_mInt64(max_queueing_memtable_per_tablet, "2");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 // 0 means disable
 CONF_mInt64(stale_memtable_flush_time_sec, "0");
+// When the memory usage of a load exceeds 70% of its limit, flush the largest memtables of each tablets channel
+// until the usage is expected to drop to this percentage of the limit. The memory to free is shared by the channels
+// in proportion to their memtable bytes. Otherwise the memtable flushed under memory pressure is the one of
+// whichever tablet is written next, which is often tiny when a load writes to many tablets. 0 means disable.
+CONF_mInt32(load_memtable_arbitration_target_ratio, "60");
 
 // delta writer hang after this time, be will exit since storage is in error state
 CONF_Int32(be_exit_after_disk_write_hang_second, "60");
@@ -464,6 +504,14 @@ CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
+// Whether compaction picks the codec of each scalar column from its first data page, instead of the codec of the
+// table. The column is stored uncompressed if neither LZ4_FRAME nor ZSTD saves `compression_min_space_saving`,
+// and with ZSTD only if it is at least `compaction_compression_tuning_min_gain` smaller than LZ4_FRAME.
+CONF_mBool(enable_compaction_compression_tuning, "false");
+CONF_mDouble(compaction_compression_tuning_min_gain, "0.2");
+// Whether the integer, date and datetime columns without an explicit encoding use FOR_ENCODING, the delta of the
+// ascending values bit packed, if the rows sampled for the encoding speculation are in ascending order.
+CONF_mBool(enable_for_encoding_speculation, "false");
 
 // Whether to use special thread pool for streaming load to avoid deadlock for
 // concurrent streaming loads. The maximum number of threads and queue size are
@@ -553,6 +601,24 @@ CONF_Bool(use_mmap_allocate_chunk, "false");
 
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
+// The always-on sampling cpu profiler, which tags every sample with the query id and the workgroup id of the
+// thread and keeps hourly aggregates in memory. They are exported by /api/query_cpu_profile.
+CONF_Bool(enable_query_cpu_profiler, "false");
+// The samples per second of a busy thread.
+CONF_Int32(query_cpu_profiler_frequency, "19");
+// How many hours of aggregates are kept.
+CONF_Int32(query_cpu_profiler_retention_hours, "24");
+// The max number of distinct (query, workgroup, stack) kept per hour.
+CONF_Int64(query_cpu_profiler_max_stacks_per_hour, "100000");
+// Sampled read accounting per (query, tablet, column) of the column pages read from the files, exported by
+// information_schema.be_io_heatmap.
+CONF_mBool(enable_io_heatmap, "false");
+// One in `io_heatmap_sample_rate` page reads of a thread is sampled.
+CONF_mInt32(io_heatmap_sample_rate, "16");
+// The max number of distinct (query, tablet, column), the samples beyond it are dropped.
+CONF_mInt64(io_heatmap_max_entries, "100000");
+// An entry is removed this long after its last read.
+CONF_mInt32(io_heatmap_retention_seconds, "3600");
 
 // to forward compatibility, will be removed later
 CONF_mBool(enable_token_check, "true");
@@ -578,7 +644,8 @@ CONF_String(scratch_dirs, "/tmp");
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
 // Linux transparent huge page.
-CONF_Bool(madvise_huge_pages, "false");
+// If true, the large random access buffers (e.g. the buckets of join hash tables) are advised to use huge pages.
+CONF_mBool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
 CONF_Bool(mmap_buffers, "false");
@@ -591,6 +658,10 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// For duplicate keys tables, sort the rows buffered in a memtable into a sorted run every time they reach
+// this number, and merge the runs at flush, which spreads the sort cost over the inserts. 0 means sort all
+// the rows at flush.
+CONF_mInt64(memtable_sorted_run_rows, "0");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -729,6 +800,12 @@ CONF_mInt32(flush_thread_num_per_store, "2");
 // Default value is cpu cores * 2
 CONF_mInt32(lake_flush_thread_num_per_store, "0");
 
+// Max number of threads to encode the columns of a segment in parallel with the flush thread, 0 means the
+// columns are encoded in the flush thread only.
+CONF_mInt32(segment_encode_thread_pool_num_max, "0");
+// Only the segments with at least this number of columns are encoded in parallel.
+CONF_mInt32(segment_encode_parallel_min_columns, "64");
+
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
 CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
@@ -775,6 +852,10 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// The olap scan reads fewer rows than chunk_size per chunk for wide rows, so that a chunk stays within this many
+// bytes. The row width is estimated from the rowset metadata of the columns read. 0 disables it.
+CONF_mInt64(scan_chunk_max_bytes, "16777216");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -785,6 +866,11 @@ CONF_Int32(late_materialization_ratio, "10");
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// Whether to reorder the AND-ed vectorized column predicates of a segment scan by their observed cost and
+// selectivity, sampled over the first `predicate_reorder_sample_chunks` chunks.
+CONF_mBool(enable_predicate_adaptive_reorder, "true");
+CONF_mInt64(predicate_reorder_sample_chunks, "8");
+
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
 // max chunk size for each tablet write request. (512MB)
@@ -853,6 +939,12 @@ CONF_mInt64(pipeline_poller_timeout_guard_ms, "-1");
 CONF_mInt64(pipeline_prepare_timeout_guard_ms, "-1");
 // whether to enable large column detection in the pipeline execution framework.
 CONF_mBool(pipeline_enable_large_column_checker, "false");
+// Whether to count hardware events (cycles, instructions, LLC/dTLB/branch misses) by perf_event_open(2)
+// around each pull_chunk/push_chunk call and report them per operator in the query profile.
+// It takes effect on the operators prepared after it is changed.
+CONF_mBool(enable_pipeline_operator_perf_counters, "false");
+// The max bytes of the freed column buffers that each pipeline driver keeps for reuse, 0 means disabled.
+CONF_mInt64(pipeline_driver_column_pool_bytes, "0");
 
 // The number of scan threads pipeline engine.
 CONF_Int64(pipeline_scan_thread_pool_thread_num, "0");
@@ -874,6 +966,17 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// Whether to shrink the in-flight rpc window of a destination when its receiver holds the responses because of
+// its full buffer, and grow the window back when the receiver responds in time.
+CONF_mBool(enable_pipeline_sink_adaptive_window, "true");
+// The receiver is regarded as busy if it takes longer than this to respond a transmit request.
+CONF_mInt64(pipeline_sink_receiver_busy_threshold_ms, "100");
+// The requests queued for the same destination instance, e.g. the last partial requests of the sinkers at eos, are
+// merged into one rpc up to this size of attachment. 0 means disabled.
+CONF_mInt64(pipeline_sink_merge_request_max_bytes, "1048576");
+// Whether the adaptive DOP also reduces the DOP of the downstream pipeline when the remaining memory of the query or
+// the process cannot afford every driver holding the collected input.
+CONF_mBool(enable_adaptive_dop_memory_aware, "true");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
@@ -883,11 +986,21 @@ CONF_mBool(pipeline_print_profile, "false");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// Whether to use the per-thread sharded driver queue with work stealing, instead of the single-lock
+// QuerySharedDriverQueue. It only takes effect when resource group is disabled.
+CONF_Bool(pipeline_driver_queue_enable_work_stealing, "false");
+// Whether to pin the pipeline execution threads to NUMA nodes in a round-robin way. Each thread allocates memory
+// from a jemalloc arena of its node, and the driver queue prefers the drivers put back by the threads of the same node.
+// It only takes effect when there are multiple NUMA nodes, and the driver queue locality only applies when
+// resource group is disabled.
+CONF_Bool(pipeline_enable_numa_aware_executor, "false");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_mBool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Whether to evaluate min/max over a sliding rows frame with a monotonic queue of the candidate rows.
+CONF_mBool(pipeline_analytic_enable_sliding_extreme_queue, "true");
 CONF_Int32(pipline_limit_max_delivery, "4096");
 
 CONF_mBool(use_default_dop_when_shared_scan, "true");
@@ -903,6 +1016,10 @@ CONF_mInt64(tablet_internal_parallel_max_splitted_scan_bytes, "536870912");
 // Only when scan_dop is not less than min_scan_dop, this table can use tablet internal parallel,
 // where scan_dop = estimated_scan_rows / splitted_scan_rows.
 CONF_mInt64(tablet_internal_parallel_min_scan_dop, "4");
+// Once the rows left in a physical split morsel queue are fewer than `tail_splits_per_driver` splits per scan
+// driver, the splits shrink towards min_splitted_scan_rows, so that the drivers finish at about the same time
+// instead of idling behind the last large split. 0 disables it.
+CONF_mInt64(tablet_internal_parallel_tail_splits_per_driver, "4");
 
 // Only the num rows of lake tablet less than lake_tablet_rows_splitted_ratio * splitted_scan_rows, than the lake tablet can be splitted.
 CONF_mDouble(lake_tablet_rows_splitted_ratio, "1.5");
@@ -947,6 +1064,28 @@ CONF_Int64(object_storage_connect_timeout_ms, "-1");
 // value is greater than 0 and less than 1000.
 // When it's 0, low speed limit check will be disabled.
 CONF_mInt64(object_storage_request_timeout_ms, "-1");
+// A read from S3 of at least two parts of this size is split into concurrent ranged GETs, which are written into
+// the caller's buffer directly, because a single connection is limited to about 100MB/s. 0 disables the split.
+CONF_mInt64(object_storage_parallel_read_part_size, "8388608");
+// The max number of the concurrent ranged GETs of a read, the parts are enlarged to keep within it.
+CONF_mInt32(object_storage_parallel_read_max_parts, "8");
+// Hedge a ranged read from S3 with a duplicate request once it takes longer than this percentile of the recent read
+// latencies, and take the response which returns first. 0 disables the hedged reads.
+CONF_mInt32(object_storage_hedged_read_percentile, "0");
+// The min delay before a hedged request is sent.
+CONF_mInt64(object_storage_hedged_read_min_delay_ms, "100");
+// The max number of ranges of an object storage input stream that are prefetched asynchronously ahead of reading.
+CONF_mInt32(object_storage_max_prefetch_ranges, "4");
+// The max number of concurrent object storage reads and writes issued through the io scheduler, the requests beyond
+// it are queued by io class and dispatched by weight. 0 means no limit and the scheduler is bypassed.
+CONF_mInt32(io_scheduler_max_concurrency, "0");
+// The dispatch weights of the io classes, the share of the concurrency an io class gets when all classes are busy.
+CONF_mInt32(io_scheduler_query_weight, "8");
+CONF_mInt32(io_scheduler_spill_weight, "4");
+CONF_mInt32(io_scheduler_load_weight, "2");
+CONF_mInt32(io_scheduler_background_weight, "1");
+// A request queued longer than this is dispatched before the others regardless of weight, to avoid starvation.
+CONF_mInt64(io_scheduler_max_wait_ms, "1000");
 // Request timeout for object storage specialized for rename_file operation.
 // if this parameter is 0, use object_storage_request_timeout_ms instead.
 CONF_Int64(object_storage_rename_file_request_timeout_ms, "30000");
@@ -994,10 +1133,26 @@ CONF_mBool(parquet_cache_aware_dict_decoder_enable, "true");
 CONF_mBool(parquet_reader_enable_adpative_bloom_filter, "true");
 CONF_Double(parquet_page_cache_decompress_threshold, "1.5");
 CONF_mBool(enable_adjustment_page_cache_skip, "true");
+// Capacity in bytes of the cache of the deletion bitmaps decoded from the iceberg position delete files and
+// the paimon deletion vectors, 0 means disabled.
+CONF_Int64(deletion_bitmap_cache_capacity, "268435456");
+
+// parquet writer
+// Max threads encoding the column chunks of a parquet row group in parallel for the file sinks,
+// 0 means the columns are encoded by the sink driver one by one.
+CONF_mInt32(parquet_writer_encode_thread_pool_num_max, "0");
+// Only the chunks with at least this many columns are encoded in parallel.
+CONF_mInt32(parquet_writer_parallel_min_columns, "8");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Learn the coalescing distance of shared buffered reads from the observed latency and bandwidth of each kind of
+// storage, instead of always using io_coalesce_read_max_distance_size.
+CONF_mBool(io_coalesce_adaptive_distance_enable, "false");
+// The number of coalesced buffers after the one being read that are prefetched by shared buffered reads, so a scan
+// thread keeps several remote reads in flight instead of waiting on one at a time. 0 means no prefetch.
+CONF_mInt32(io_coalesce_prefetch_buffers, "0");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -1006,6 +1161,10 @@ CONF_Int32(connector_io_tasks_adjust_step, "1");
 CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
+// The scan of a bucket-sequence (colocate group execution) pipeline may pick up the morsels of the next bucket once
+// it has read all the chunks of the current one, instead of waiting for the downstream operators to consume them,
+// as long as its chunk buffer holds less than this many bytes. 0 disables the prefetch.
+CONF_mInt64(group_execution_prefetch_buffer_bytes, "67108864");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
 
 // hdfs hedged read
@@ -1016,6 +1175,10 @@ CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
 CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
 CONF_Int32(hdfs_client_max_cache_size, "64");
 CONF_Int32(hdfs_client_io_read_retry, "0");
+// Keep the closed hdfs read-only files open for reuse for at most this many seconds, which saves the NameNode
+// round trips of opening the same small files again and again. 0 means disabled.
+CONF_mInt32(hdfs_client_file_handle_cache_ttl_sec, "0");
+CONF_mInt32(hdfs_client_max_cached_file_handles, "1024");
 
 // Enable output trace logs in aws-sdk-cpp for diagnosis purpose.
 // Once logging is enabled in your application, the SDK will generate log files in your current working directory
@@ -1039,6 +1202,10 @@ CONF_Bool(enable_poco_client_for_aws_sdk, "true");
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The max number of parts of a multipart upload that are uploading concurrently. Each part holds a buffer of
+// `experimental_s3_min_upload_part_size` bytes until its upload finishes, and the writer blocks when the limit
+// is reached.
+CONF_mInt32(experimental_s3_max_inflight_upload_parts, "4");
 
 CONF_Int64(max_load_dop, "16");
 
@@ -1056,6 +1223,14 @@ CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
+// Whether to compress the serialized global runtime filters by zstd before transmitting them.
+// Only enable it after all the BEs are upgraded, the older BEs can't deserialize the compressed runtime filters.
+CONF_mBool(enable_runtime_filter_compression, "false");
+// The serialized global runtime filters smaller than this are not compressed.
+CONF_mInt64(runtime_filter_compression_min_bytes, "65536");
+// Whether the hash join on a single string key keeps the key hashes computed when building the hash table,
+// to fill the runtime bloom filters of the key without hashing the build keys again.
+CONF_mBool(enable_join_runtime_filter_reuse_key_hashes, "true");
 
 // -1: unlimited, 0: limit by memory use, >0: limit by queue_size
 CONF_mInt64(runtime_filter_queue_limit, "-1");
@@ -1126,10 +1301,17 @@ CONF_mInt32(starlet_filesystem_instance_cache_ttl_sec, "86400");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// The max number of threads to prefetch the tablet metadata of the lake scan ranges when a fragment is prepared.
+// 0 means disable the prefetch.
+CONF_Int32(lake_metadata_prefetch_thread_num, "16");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
 CONF_mInt32(lake_compaction_check_valid_interval_minutes, "10"); // 10 minutes
+// The tablets of a compaction request whose input rowsets are not larger than this size, and which share the same
+// data directory, write their output segments into one bundle data file instead of a small file per tablet.
+// Only the horizontal compaction of non primary key tablets is bundled. 0 means disabled.
+CONF_mInt64(lake_compaction_bundle_max_input_bytes, "0");
 // Used to ensure service availability in extreme situations by sacrificing a certain degree of correctness
 CONF_mBool(experimental_lake_ignore_lost_segment, "false");
 CONF_mInt64(experimental_lake_wait_per_put_ms, "0");
@@ -1144,6 +1326,11 @@ CONF_mInt64(lake_vacuum_retry_min_delay_ms, "100");
 CONF_mInt64(lake_max_garbage_version_distance, "100");
 CONF_mBool(enable_primary_key_recover, "false");
 CONF_mBool(lake_enable_compaction_async_write, "false");
+// With data file bundling enabled, a memtable flush of a lake tablet whose chunk is not larger than this is written
+// into the shared bundle file of the partition, instead of only the single segment flushed at the end of the load.
+// Small flushes forced by the memory pressure of a load over many tablets would otherwise write one object each.
+// 0 means only the segment flushed at the end of the load is bundled.
+CONF_mInt64(lake_bundle_data_file_max_flush_bytes, "8388608");
 CONF_mInt64(lake_pk_compaction_max_input_rowsets, "500");
 CONF_mInt64(lake_pk_compaction_min_input_segments, "5");
 // Used for control memory usage of update state cache and compaction state cache
@@ -1212,9 +1399,17 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
 // min bytes size of spill read buffer. if the buffer size is less than this value, we will disable buffer read
 CONF_Int64(spill_read_buffer_min_bytes, "1048576");
+// The max bytes of the spilled blocks of one query that will be kept in memory before writing to disk.
+// The blocks are already encoded by the spill serde, so they are much smaller than the spilled data.
+// 0 means spill blocks are always written to disk.
+CONF_mInt64(spill_mem_block_max_bytes_per_query, "0");
 CONF_mInt64(mem_limited_chunk_queue_block_size, "8388608");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
+// Lower the priority of the queued transmit_chunk tasks of a query in the query rpc pool by the number of its tasks
+// already queued, so that a large shuffle neither delays the chunks of the other queries nor the control rpcs
+// like exec_plan_fragment and cancel_plan_fragment.
+CONF_mBool(internal_service_fair_transmit_chunk, "true");
 CONF_Int32(internal_service_datacache_rpc_thread_num, "-1");
 // The retry times of rpc request to report exec rpc request to FE. The default value is 10,
 // which means that the rpc request will be retried 10 times if it fails if it's fragment instatnce finish rpc.
@@ -1262,6 +1457,9 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// The max number of blocks read ahead from the remote storage and populated to the datacache, when the cache misses
+// of a stream are sequential. 0 means disable the read ahead.
+CONF_mInt32(datacache_read_ahead_max_blocks, "0");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1278,6 +1476,9 @@ CONF_Bool(datacache_persistence_enable, "true");
 // Set the default value empty to indicate whether it is manually configured by users.
 // If not, we need to adjust the default engine based on build switches like "WITH_STARCACHE".
 CONF_String_enum(datacache_engine, "", ",starcache,lrucache");
+// Whether the lrucache engine admits a new entry into a full cache only when it is accessed more frequently than
+// the entry it evicts (TinyLFU), which keeps the frequently accessed pages from being flushed by large scans.
+CONF_Bool(datacache_mem_admission_filter_enable, "false");
 // The interval time (millisecond) for agent report datacache metrics to FE.
 CONF_mInt32(report_datacache_metrics_interval_ms, "60000");
 
@@ -1371,6 +1572,8 @@ CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "true");
+// prefetch all the pages of a batch lookup in persistent index before reading them one by one
+CONF_mBool(enable_pindex_page_prefetch, "true");
 
 // check need to rebuild pindex or not
 CONF_mBool(enable_rebuild_pindex_check, "true");
@@ -1428,8 +1631,23 @@ CONF_Int64(rocksdb_max_write_buffer_memory_bytes, "1073741824");
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
+// The number of chunks whose group by keys NDV is estimated to choose the initial mode of auto streaming
+// aggregation, 0 means disable the sampling.
+CONF_mInt32(streaming_agg_ndv_sample_chunks, "8");
 // mem limit for partition hash join probe side buffer
 CONF_mInt64(partition_hash_join_probe_limit_size, "134217728");
+// max partition num of partition hash join. Partitions are doubled up to this limit when the build side
+// exceeds the L3 cache, should be a power of two.
+CONF_mInt32(partition_hash_join_max_partition_num, "64");
+// Whether to prefetch the bucket heads and build keys when probing a fixed-size key hash table that is much
+// larger than the cache.
+CONF_mBool(enable_hash_join_probe_prefetch, "true");
+// Whether the fragment instances of one query on a backend share the hash table of a broadcast join. The first
+// instance finishing its build publishes the table, the others reference it instead of building their own one.
+CONF_mBool(enable_shared_broadcast_hash_table, "true");
+// Whether an inner nested loop join with a band condition (`probe >= lo AND probe <= hi` on the build columns)
+// sorts the build rows by `lo` and only permutes every probe row with its candidate build rows.
+CONF_mBool(enable_nljoin_range_index, "true");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
@@ -1446,6 +1664,9 @@ CONF_mInt32(update_cache_evict_internal_sec, "11");
 CONF_mBool(enable_auto_evict_update_cache, "true");
 
 CONF_mInt64(load_tablet_timeout_seconds, "60");
+// The number of threads of each data dir to construct the tablets from their metas at startup, while the metas are
+// scanned from rocksdb by one thread. 1 means the tablets are constructed by the scanning thread.
+CONF_Int32(load_tablet_threads_per_data_dir, "4");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
 
@@ -1470,6 +1691,10 @@ CONF_mInt64(primary_key_batch_get_index_memory_limit, "104857600"); // 100MB
 // otherwise, StarRocks will use zone map for one column filter
 CONF_mBool(enable_short_key_for_one_column_filter, "false");
 
+// Narrow the short key index search by interpolation search on the 8 bytes prefix of the encoded keys,
+// which needs fewer key comparisons than binary search for the point lookups.
+CONF_mBool(enable_short_key_interpolation_search, "true");
+
 CONF_mBool(enable_index_segment_level_zonemap_filter, "true");
 CONF_mBool(enable_index_page_level_zonemap_filter, "true");
 CONF_mBool(enable_index_bloom_filter, "true");
@@ -1490,6 +1715,9 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// The batch size of the vacuum deletions grows from lake_vacuum_min_batch_delete_size up to this value while the
+// object storage does not throttle them, and falls back once a deletion is throttled.
+CONF_mInt64(lake_vacuum_max_batch_delete_size, "1000");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1499,6 +1727,10 @@ CONF_mInt32(desc_hint_split_range, "10");
 CONF_mInt64(lake_local_pk_index_unused_threshold_seconds, "86400"); // 1 day
 
 CONF_mBool(lake_enable_vertical_compaction_fill_data_cache, "true");
+// The segments written by a lake compaction are populated into the local datacache only if the tablet's latest
+// version was published within this many seconds, so that the outputs of cold partitions do not evict hot data.
+// -1 means always populating the outputs, 0 means never.
+CONF_mInt64(lake_compaction_fill_data_cache_max_idle_sec, "-1");
 
 CONF_mInt32(dictionary_cache_refresh_timeout_ms, "60000"); // 1 min
 CONF_mInt32(dictionary_cache_refresh_threadpool_size, "8");
@@ -1535,6 +1767,12 @@ CONF_mInt32(json_flat_column_max, "100");
 // for whitelist on flat json remain data, max set 1kb
 CONF_mInt32(json_flat_remain_filter_max_bytes, "1024");
 
+// record the flat json paths accessed by queries, compaction flattens the hot paths into sub columns
+CONF_mBool(enable_json_flat_access_stats, "true");
+
+// a json path accessed at least this many times by queries of a tablet is a hot path for compaction
+CONF_mInt32(json_flat_hot_path_min_access, "16");
+
 // Allowable intervals for continuous generation of pk dumps
 // Disable when pk_dump_interval_seconds <= 0
 CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
@@ -1572,6 +1810,12 @@ CONF_mBool(apply_del_vec_after_all_index_filter, "true");
 CONF_mDouble(connector_sink_mem_high_watermark_ratio, "0.3");
 CONF_mDouble(connector_sink_mem_low_watermark_ratio, "0.1");
 CONF_mDouble(connector_sink_mem_urgent_space_ratio, "0.1");
+// Once a connector sink has more than this many partitions open, it no longer keeps one writer per partition:
+// it buffers the chunks by partition and writes the buffered partitions one after another in the order of their
+// keys, each into a file of its own, whenever the buffer reaches connector_sink_partition_buffer_bytes.
+// 0 disables it.
+CONF_mInt32(connector_sink_max_open_writers, "256");
+CONF_mInt64(connector_sink_partition_buffer_bytes, "268435456");
 
 // .crm file can be removed after 1day.
 CONF_mInt32(unused_crm_file_threshold_second, "86400" /** 1day **/);
@@ -1587,6 +1831,9 @@ CONF_Bool(python_worker_reuse, "true");
 CONF_Int32(python_worker_expire_time_sec, "300");
 CONF_mBool(enable_pk_strict_memcheck, "true");
 CONF_mBool(skip_pk_preload, "true");
+// The max number of threads to preload the primary keys of the next txn log, while the batch publish of a lake
+// primary key tablet applies the current one. 0 means disable the preload.
+CONF_Int32(lake_pk_publish_preload_thread_num, "8");
 // Reduce core file size by not dumping jemalloc retain pages
 CONF_mBool(enable_core_file_size_optimization, "true");
 // Current supported modules:
@@ -46,6 +46,7 @@
 #endif
 #include "fs/encrypt_file.h"
 #include "gutil/cpu.h"
+#include "io/io_heatmap.h"
 #include "jemalloc/jemalloc.h"
 #include "runtime/time_types.h"
 #include "runtime/user_function_cache.h"
@@ -54,6 +55,7 @@
 #include "storage/options.h"
 #include "storage/storage_engine.h"
 #include "util/cpu_info.h"
+#include "util/debug/query_cpu_profiler.h"
 #include "util/debug_util.h"
 #include "util/disk_info.h"
 #include "util/logging.h"
@@ -208,6 +210,36 @@ void jemalloc_tracker_daemon(void* arg_this) {
     }
 }
 
+// Move the samples of the query cpu profiler into its hourly aggregates
+void query_cpu_profiler_daemon(void* arg_this) {
+    auto* daemon = static_cast<Daemon*>(arg_this);
+    QueryCpuProfiler::Options options;
+    options.frequency = config::query_cpu_profiler_frequency;
+    options.retention_hours = config::query_cpu_profiler_retention_hours;
+    options.max_stacks_per_hour = config::query_cpu_profiler_max_stacks_per_hour;
+    auto st = QueryCpuProfiler::instance()->start(options);
+    if (!st.ok()) {
+        LOG(WARNING) << "start query cpu profiler failed: " << st;
+        return;
+    }
+    while (!daemon->stopped()) {
+        QueryCpuProfiler::instance()->aggregate();
+        nap_sleep(1, [daemon] { return daemon->stopped(); });
+    }
+    QueryCpuProfiler::instance()->stop();
+}
+
+// Drain the sampled reads of the io heatmap into its entries
+void io_heatmap_daemon(void* arg_this) {
+    auto* daemon = static_cast<Daemon*>(arg_this);
+    while (!daemon->stopped()) {
+        if (config::enable_io_heatmap) {
+            IOHeatmap::instance()->aggregate();
+        }
+        nap_sleep(1, [daemon] { return daemon->stopped(); });
+    }
+}
+
 static void init_starrocks_metrics(const std::vector<StorePath>& store_paths) {
     bool init_system_metrics = config::enable_system_metrics;
     std::set<std::string> disk_devices;
@@ -324,6 +356,16 @@ void Daemon::init(bool as_cn, const std::vector<StorePath>& paths) {
         _daemon_threads.emplace_back(std::move(jemalloc_tracker_thread));
     }
 
+    if (config::enable_query_cpu_profiler) {
+        std::thread query_cpu_profiler_thread(query_cpu_profiler_daemon, this);
+        Thread::set_thread_name(query_cpu_profiler_thread, "query_cpu_profiler_daemon");
+        _daemon_threads.emplace_back(std::move(query_cpu_profiler_thread));
+    }
+
+    std::thread io_heatmap_thread(io_heatmap_daemon, this);
+    Thread::set_thread_name(io_heatmap_thread, "io_heatmap_daemon");
+    _daemon_threads.emplace_back(std::move(io_heatmap_thread));
+
     init_signals();
     init_minidump();
 #if defined(__SANITIZE_ADDRESS__) || defined(ADDRESS_SANITIZER)
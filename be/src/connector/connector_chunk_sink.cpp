@@ -15,6 +15,7 @@
 #include "connector_chunk_sink.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "connector/sink_memory_manager.h"
 #include "formats/file_writer.h"
@@ -45,6 +46,55 @@ Status ConnectorChunkSink::init() {
 
 Status ConnectorChunkSink::write_partition_chunk(const std::string& partition,
                                                  const std::vector<int8_t>& partition_field_null_list, Chunk* chunk) {
+    auto partition_key = std::make_pair(partition, partition_field_null_list);
+    if (!_buffer_partitions && config::connector_sink_max_open_writers > 0 &&
+        _writer_stream_pairs.size() >= static_cast<size_t>(config::connector_sink_max_open_writers) &&
+        _writer_stream_pairs.find(partition_key) == _writer_stream_pairs.end()) {
+        // Too many partitions to keep a writer open for each of them, close them and buffer the chunks from now on.
+        for (auto& [key, writer_and_stream] : _writer_stream_pairs) {
+            _commit_writer(key, writer_and_stream.first.get());
+        }
+        _writer_stream_pairs.clear();
+        _buffer_partitions = true;
+    }
+    if (!_buffer_partitions) {
+        return _write_partition_chunk(partition, partition_field_null_list, chunk);
+    }
+
+    _buffered_bytes += chunk->memory_usage();
+    _buffered_chunks[partition_key].emplace_back(chunk->clone_unique());
+    if (_buffered_bytes >= config::connector_sink_partition_buffer_bytes) {
+        RETURN_IF_ERROR(_flush_buffered_partitions());
+    }
+    return Status::OK();
+}
+
+Status ConnectorChunkSink::_flush_buffered_partitions() {
+    for (auto& [partition_key, chunks] : _buffered_chunks) {
+        for (auto& chunk : chunks) {
+            RETURN_IF_ERROR(_write_partition_chunk(partition_key.first, partition_key.second, chunk.get()));
+            chunk.reset();
+        }
+        auto it = _writer_stream_pairs.find(partition_key);
+        if (it != _writer_stream_pairs.end()) {
+            _commit_writer(partition_key, it->second.first.get());
+            _writer_stream_pairs.erase(it);
+        }
+    }
+    _buffered_chunks.clear();
+    _buffered_bytes = 0;
+    return Status::OK();
+}
+
+void ConnectorChunkSink::_commit_writer(const PartitionKey& partition_key, Writer* writer) {
+    std::string null_fingerprint(partition_key.second.size(), '0');
+    std::transform(partition_key.second.begin(), partition_key.second.end(), null_fingerprint.begin(),
+                   [](int8_t b) { return b + '0'; });
+    callback_on_commit(writer->commit().set_extra_data(null_fingerprint));
+}
+
+Status ConnectorChunkSink::_write_partition_chunk(const std::string& partition,
+                                                  const std::vector<int8_t>& partition_field_null_list, Chunk* chunk) {
     // partition_field_null_list is used to distinguish with the secenario like NULL and string "null"
     // They are under the same dir path, but should not in the same data file.
     // We should record them in different files so that each data file could has its own meta info.
@@ -53,10 +103,7 @@ Status ConnectorChunkSink::write_partition_chunk(const std::string& partition,
     if (it != _writer_stream_pairs.end()) {
         Writer* writer = it->second.first.get();
         if (writer->get_written_bytes() >= _max_file_size) {
-            string null_fingerprint(partition_field_null_list.size(), '0');
-            std::transform(partition_field_null_list.begin(), partition_field_null_list.end(), null_fingerprint.begin(),
-                           [](int8_t b) { return b + '0'; });
-            callback_on_commit(writer->commit().set_extra_data(null_fingerprint));
+            _commit_writer(it->first, writer);
             _writer_stream_pairs.erase(it);
             auto path =
                     !_partition_column_names.empty() ? _location_provider->get(partition) : _location_provider->get();
@@ -100,11 +147,9 @@ Status ConnectorChunkSink::add(Chunk* chunk) {
 }
 
 Status ConnectorChunkSink::finish() {
+    RETURN_IF_ERROR(_flush_buffered_partitions());
     for (auto& [partition_key, writer_and_stream] : _writer_stream_pairs) {
-        string extra_data(partition_key.second.size(), '0');
-        std::transform(partition_key.second.begin(), partition_key.second.end(), extra_data.begin(),
-                       [](int8_t b) { return b + '0'; });
-        callback_on_commit(writer_and_stream.first->commit().set_extra_data(extra_data));
+        _commit_writer(partition_key, writer_and_stream.first.get());
     }
     return Status::OK();
 }
@@ -64,6 +64,15 @@ public:
     Status write_partition_chunk(const std::string& partition, const vector<int8_t>& partition_field_null_list,
                                  Chunk* chunk);
 
+private:
+    Status _write_partition_chunk(const std::string& partition, const vector<int8_t>& partition_field_null_list,
+                                  Chunk* chunk);
+
+    void _commit_writer(const PartitionKey& partition_key, Writer* writer);
+
+    // Write the buffered chunks partition by partition, committing the writer of a partition before the next one.
+    Status _flush_buffered_partitions();
+
 protected:
     AsyncFlushStreamPoller* _io_poller = nullptr;
     SinkOperatorMemoryManager* _op_mem_mgr = nullptr;
@@ -78,6 +87,11 @@ protected:
     std::vector<std::function<void()>> _rollback_actions;
 
     std::map<PartitionKey, WriterStreamPair> _writer_stream_pairs;
+    // Set once the sink has more than config::connector_sink_max_open_writers partitions open, then the chunks are
+    // buffered in `_buffered_chunks`, sorted by the partition keys, instead of being written on arrival.
+    bool _buffer_partitions = false;
+    std::map<PartitionKey, std::vector<ChunkUniquePtr>> _buffered_chunks;
+    int64_t _buffered_bytes = 0;
     inline static std::string DEFAULT_PARTITION = "__DEFAULT_PARTITION__";
 };
 
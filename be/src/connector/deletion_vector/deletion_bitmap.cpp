@@ -63,4 +63,12 @@ void DeletionBitmap::add_value(uint64_t val) {
     roaring64_bitmap_add(_bitmap, val);
 }
 
+void DeletionBitmap::add_bitmap(const DeletionBitmap& other) {
+    roaring64_bitmap_or_inplace(_bitmap, other._bitmap);
+}
+
+size_t DeletionBitmap::serialized_size() const {
+    return roaring64_bitmap_portable_size_in_bytes(_bitmap);
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -38,6 +38,10 @@ public:
     void add_value(uint64_t val);
     uint64_t get_cardinality() const;
     void to_array(std::vector<uint64_t>& array) const;
+    // Add all the values of `other` into this bitmap.
+    void add_bitmap(const DeletionBitmap& other);
+    // Size in bytes of the portable roaring serialization, used as the memory charge of the bitmap.
+    size_t serialized_size() const;
 
 private:
     static const uint64_t kBatchSize = 256;
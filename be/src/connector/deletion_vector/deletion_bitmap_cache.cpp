@@ -0,0 +1,78 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connector/deletion_vector/deletion_bitmap_cache.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static void bitmap_deleter(const CacheKey& key, void* value) {
+    delete static_cast<DeletionBitmapPtr*>(value);
+}
+
+DeletionBitmapCache* DeletionBitmapCache::instance() {
+    static DeletionBitmapCache cache(std::max<int64_t>(0, config::deletion_bitmap_cache_capacity));
+    return &cache;
+}
+
+DeletionBitmapCache::DeletionBitmapCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache = new_lru_cache(capacity);
+    }
+}
+
+DeletionBitmapCache::~DeletionBitmapCache() {
+    delete _cache;
+}
+
+std::string DeletionBitmapCache::make_key(std::string_view delete_file_path, int64_t offset, int64_t length,
+                                          std::string_view data_file_path) {
+    std::string key;
+    key.reserve(delete_file_path.size() + sizeof(offset) + sizeof(length) + data_file_path.size());
+    key.append(delete_file_path);
+    key.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    key.append(data_file_path);
+    return key;
+}
+
+DeletionBitmapPtr DeletionBitmapCache::lookup(const std::string& key) {
+    if (_cache == nullptr) {
+        return nullptr;
+    }
+    Cache::Handle* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    DeletionBitmapPtr bitmap = *static_cast<DeletionBitmapPtr*>(_cache->value(handle));
+    _cache->release(handle);
+    return bitmap;
+}
+
+void DeletionBitmapCache::insert(const std::string& key, const DeletionBitmapPtr& bitmap) {
+    if (_cache == nullptr) {
+        return;
+    }
+    auto* value = new DeletionBitmapPtr(bitmap);
+    Cache::Handle* handle = _cache->insert(CacheKey(key), value, bitmap->serialized_size(), bitmap_deleter);
+    if (handle != nullptr) {
+        _cache->release(handle);
+    }
+}
+
+} // namespace starrocks
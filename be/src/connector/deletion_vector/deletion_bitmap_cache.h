@@ -0,0 +1,54 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "connector/deletion_vector/deletion_bitmap.h"
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+class Cache;
+
+// A BE level LRU cache of the deletion bitmaps decoded from the iceberg position delete files and
+// the paimon deletion vectors, so that the same delete file is not re-read by each scan of its data file.
+// The cached bitmaps are shared by the scanners and must not be modified.
+class DeletionBitmapCache {
+public:
+    static DeletionBitmapCache* instance();
+
+    explicit DeletionBitmapCache(size_t capacity);
+    ~DeletionBitmapCache();
+
+    DISALLOW_COPY(DeletionBitmapCache);
+
+    // Build the key of the bitmap decoded from [offset, offset + length) of the delete file, for the rows of
+    // `data_file_path`. The delete files are immutable, so the path and the length identify the content.
+    static std::string make_key(std::string_view delete_file_path, int64_t offset, int64_t length,
+                                std::string_view data_file_path);
+
+    // Return nullptr if the key is not cached or the cache is disabled.
+    DeletionBitmapPtr lookup(const std::string& key);
+
+    // The bitmap is charged with its roaring serialized size.
+    void insert(const std::string& key, const DeletionBitmapPtr& bitmap);
+
+private:
+    Cache* _cache = nullptr;
+};
+
+} // namespace starrocks
@@ -29,6 +29,7 @@
 #include "storage/rowset/short_key_range_option.h"
 #include "storage/runtime_range_pruner.hpp"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 
 namespace starrocks::connector {
 
@@ -799,6 +800,31 @@ Status LakeDataSourceProvider::init(ObjectPool* pool, RuntimeState* state) {
     return Status::OK();
 }
 
+void LakeDataSourceProvider::peek_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) {
+#ifndef BE_TEST
+    auto* pool = ExecEnv::GetInstance()->lake_metadata_prefetch_pool();
+    if (pool == nullptr || scan_ranges.size() <= 1) {
+        return;
+    }
+    auto* tablet_manager = ExecEnv::GetInstance()->lake_tablet_manager();
+    for (const auto& scan_range : scan_ranges) {
+        if (!scan_range.scan_range.__isset.internal_scan_range) {
+            continue;
+        }
+        const auto& internal_scan_range = scan_range.scan_range.internal_scan_range;
+        int64_t tablet_id = internal_scan_range.tablet_id;
+        int64_t version = std::stoll(internal_scan_range.version);
+        // The metadata is only filled into the metacache, the error will be reported by the data source.
+        auto st = pool->submit_func([tablet_manager, tablet_id, version]() {
+            (void)tablet_manager->get_tablet_metadata(tablet_id, version);
+        });
+        if (!st.ok()) {
+            break;
+        }
+    }
+#endif
+}
+
 const TupleDescriptor* LakeDataSourceProvider::tuple_descriptor(RuntimeState* state) const {
     return state->desc_tbl().get_tuple_descriptor(_t_lake_scan_node.tuple_id);
 }
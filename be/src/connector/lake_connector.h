@@ -198,6 +198,10 @@ public:
     Status init(ObjectPool* pool, RuntimeState* state) override;
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
+    // Prefetch the tablet metadata of the scan ranges in background, so that the data sources needn't wait for
+    // the object storage one tablet after another.
+    void peek_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
+
     // always enable shared scan for cloud native table
     bool always_shared_scan() const override { return true; }
 
@@ -30,6 +30,7 @@
 #include "exec/aggregate/agg_profile.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
@@ -59,6 +60,9 @@ template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
 using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+// the codes of a low cardinality global dictionary, indexed directly without hashing
+template <PhmapSeed seed>
+using DictCodeAggHashMap = SmallFixedSizeHashMap<DictId, AggDataPtr, seed, DICT_DECODE_MAX_SIZE + 1>;
 template <PhmapSeed seed>
 using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
@@ -87,15 +91,17 @@ using FixedSize16SliceAggHashMap =
 // =====================
 // two level agg hash map
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>,
+                                      phmap::priv::hash_default_eq<int32_t>,
+                                      phmap::priv::Allocator<phmap::priv::Pair<const int32_t, AggDataPtr>>,
+                                      two_level_phmap_n<seed>>;
 
-// The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
-// The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
-static constexpr uint8_t PHMAPN = 4;
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashMap =
         phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
-                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
+                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>,
+                                      two_level_phmap_n<seed>>;
 
 static_assert(sizeof(AggDataPtr) == sizeof(size_t));
 #define AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, prefetch_dist)              \
@@ -304,8 +310,12 @@ struct AggHashMapWithOneNumberKeyWithNullable
                     _find_key((*agg_states)[i], (*not_founds)[i], key, hash_values[i]);
                 }
             } else if constexpr (HTBuildOp::allocate) {
-                _emplace_key_with_hash(key, hash_values[i], (*agg_states)[i], allocate_func,
-                                       FillNotFounds<HTBuildOp::fill_not_found>(not_founds, i));
+                if (i > 0 && key == column->get_data()[i - 1]) {
+                    (*agg_states)[i] = (*agg_states)[i - 1];
+                } else {
+                    _emplace_key_with_hash(key, hash_values[i], (*agg_states)[i], allocate_func,
+                                           FillNotFounds<HTBuildOp::fill_not_found>(not_founds, i));
+                }
             } else if constexpr (HTBuildOp::fill_not_found) {
                 DCHECK(not_founds);
                 _find_key((*agg_states)[i], (*not_founds)[i], key, hash_values[i]);
@@ -329,8 +339,13 @@ struct AggHashMapWithOneNumberKeyWithNullable
                     _find_key((*agg_states)[i], (*not_founds)[i], key);
                 }
             } else if constexpr (HTBuildOp::allocate) {
-                _emplace_key(key, (*agg_states)[i], allocate_func,
-                             FillNotFounds<HTBuildOp::fill_not_found>(not_founds, i));
+                // the keys of sorted input come in runs, a repeated key reuses the state of the previous row
+                if (i > 0 && key == column->get_data()[i - 1]) {
+                    (*agg_states)[i] = (*agg_states)[i - 1];
+                } else {
+                    _emplace_key(key, (*agg_states)[i], allocate_func,
+                                 FillNotFounds<HTBuildOp::fill_not_found>(not_founds, i));
+                }
             } else if constexpr (HTBuildOp::fill_not_found) {
                 DCHECK(not_founds);
                 _find_key((*agg_states)[i], (*not_founds)[i], key);
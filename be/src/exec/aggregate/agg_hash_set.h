@@ -21,6 +21,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/aggregate/agg_profile.h"
 #include "gutil/casts.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "util/fixed_hash_map.h"
@@ -57,6 +58,8 @@ using Int8AggHashSet = SmallFixedSizeHashSet<int8_t, seed>;
 template <PhmapSeed seed>
 using Int16AggHashSet = phmap::flat_hash_set<int16_t, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
+using DictCodeAggHashSet = SmallFixedSizeHashSet<DictId, seed, DICT_DECODE_MAX_SIZE + 1>;
+template <PhmapSeed seed>
 using Int32AggHashSet = phmap::flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
 using Int64AggHashSet = phmap::flat_hash_set<int64_t, StdHashWithSeed<int64_t, seed>>;
@@ -83,13 +86,25 @@ using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSli
 
 // =====================
 // two level agg hash set
+// The phase1 two level hash map/set will have 2 ^ 4 = 16 sub map,
+// The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
+static constexpr uint8_t PHMAPN = 4;
+// The phase2 (merging) hash map/set holds the whole group-by cardinality of its partition, so it is split into
+// 2 ^ 8 = 256 sub maps keyed by the high hash bits. Each sub map then stays small enough to be rehashed
+// and scanned within the cache, and a resize only moves 1/256 of the groups.
+static constexpr uint8_t PHASE2_PHMAPN = 8;
+template <PhmapSeed seed>
+constexpr uint8_t two_level_phmap_n = seed == PhmapSeed2 ? PHASE2_PHMAPN : PHMAPN;
+
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashSet =
+        phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>, phmap::priv::hash_default_eq<int32_t>,
+                                      phmap::priv::Allocator<int32_t>, two_level_phmap_n<seed>>;
 
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashSet =
         phmap::parallel_flat_hash_set<TSliceWithHash<seed>, THashOnSliceWithHash<seed>, TEqualOnSliceWithHash<seed>,
-                                      phmap::priv::Allocator<Slice>, 4>;
+                                      phmap::priv::Allocator<Slice>, two_level_phmap_n<seed>>;
 
 // ==============================================================
 
@@ -115,6 +130,8 @@ template <typename T>
 struct no_prefetch_set : std::false_type {};
 template <PhmapSeed seed>
 struct no_prefetch_set<Int8AggHashSet<seed>> : std::true_type {};
+template <PhmapSeed seed>
+struct no_prefetch_set<DictCodeAggHashSet<seed>> : std::true_type {};
 
 template <class T>
 constexpr bool is_no_prefetch_set = no_prefetch_set<T>::value;
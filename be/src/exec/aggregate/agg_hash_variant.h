@@ -102,7 +102,12 @@ enum AggrPhase { AggrPhase1, AggrPhase2 };
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+                                     \
+    M(phase1_dict_code)              \
+    M(phase1_null_dict_code)         \
+    M(phase2_dict_code)              \
+    M(phase2_null_dict_code)
 
 // Aggregate Hash maps
 
@@ -114,6 +119,8 @@ using Int8AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_TINYINT,
 template <PhmapSeed seed>
 using Int16AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_SMALLINT, Int16AggHashMap<seed>>;
 template <PhmapSeed seed>
+using DictCodeAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
+template <PhmapSeed seed>
 using Int32AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, Int32AggHashMap<seed>>;
 template <PhmapSeed seed>
 using Int64AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_BIGINT, Int64AggHashMap<seed>>;
@@ -139,6 +146,8 @@ using NullInt8AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TY
 template <PhmapSeed seed>
 using NullInt16AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_SMALLINT, Int16AggHashMap<seed>>;
 template <PhmapSeed seed>
+using NullDictCodeAggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_INT, DictCodeAggHashMap<seed>>;
+template <PhmapSeed seed>
 using NullInt32AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_INT, Int32AggHashMap<seed>>;
 template <PhmapSeed seed>
 using NullInt64AggHashMapWithOneNumberKey = AggHashMapWithOneNullableNumberKey<TYPE_BIGINT, Int64AggHashMap<seed>>;
@@ -196,6 +205,8 @@ using Int8AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_TINYINT, Int8
 template <PhmapSeed seed>
 using Int16AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_SMALLINT, Int16AggHashSet<seed>>;
 template <PhmapSeed seed>
+using DictCodeAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
+template <PhmapSeed seed>
 using Int32AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, Int32AggHashSet<seed>>;
 template <PhmapSeed seed>
 using Int64AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_BIGINT, Int64AggHashSet<seed>>;
@@ -222,6 +233,8 @@ using NullInt8AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_T
 template <PhmapSeed seed>
 using NullInt16AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_SMALLINT, Int16AggHashSet<seed>>;
 template <PhmapSeed seed>
+using NullDictCodeAggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_INT, DictCodeAggHashSet<seed>>;
+template <PhmapSeed seed>
 using NullInt32AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_INT, Int32AggHashSet<seed>>;
 template <PhmapSeed seed>
 using NullInt64AggHashSetOfOneNumberKey = AggHashSetOfOneNullableNumberKey<TYPE_BIGINT, Int64AggHashSet<seed>>;
@@ -373,7 +386,11 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringTwoLevelAggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DictCodeAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDictCodeAggHashMapWithOneNumberKey<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -441,7 +458,11 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>,
+        std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DictCodeAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDictCodeAggHashSetOfOneNumberKey<PhmapSeed2>>>;
 } // namespace detail
 struct AggHashMapVariant {
     enum class Type {
@@ -517,6 +538,10 @@ struct AggHashMapVariant {
         phase2_slice_fx8,
         phase2_slice_fx16,
 
+        phase1_dict_code,
+        phase1_null_dict_code,
+        phase2_dict_code,
+        phase2_null_dict_code,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -630,6 +655,10 @@ struct AggHashSetVariant {
         phase2_slice_fx8,
         phase2_slice_fx16,
 
+        phase1_dict_code,
+        phase1_null_dict_code,
+        phase2_dict_code,
+        phase2_null_dict_code,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
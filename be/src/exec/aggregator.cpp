@@ -34,12 +34,14 @@
 #include "exprs/agg/agg_state_merge.h"
 #include "exprs/agg/agg_state_union.h"
 #include "exprs/agg/aggregate_state_allocator.h"
+#include "exprs/column_ref.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/memory/roaring_hook.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
+#include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -117,6 +119,25 @@ bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chun
     return agg_count <= LowReduction * chunk_size;
 }
 
+bool AggrAutoContext::sample_ndv(const Columns& group_by_columns, const size_t chunk_size, size_t sample_chunks) {
+    std::vector<uint32_t> hash_values(chunk_size, HashUtil::FNV_SEED);
+    for (const auto& column : group_by_columns) {
+        column->fnv_hash(hash_values.data(), 0, chunk_size);
+    }
+    for (uint32_t hash_value : hash_values) {
+        ndv_sketch.update(HashUtil::murmur_hash64A(&hash_value, sizeof(hash_value), HashUtil::MURMUR_SEED));
+    }
+    ndv_sampled_rows += chunk_size;
+    return ++ndv_sampled_chunks >= sample_chunks;
+}
+
+double AggrAutoContext::sampled_ndv_ratio() const {
+    if (ndv_sampled_rows == 0) {
+        return 0;
+    }
+    return std::min(1.0, ndv_sketch.estimate_cardinality() * 1.0 / ndv_sampled_rows);
+}
+
 Status init_udaf_context(int64_t fid, const std::string& url, const std::string& checksum, const std::string& symbol,
                          FunctionContext* context);
 
@@ -1310,12 +1331,37 @@ bool is_group_columns_fixed_size(std::vector<ExprContext*>& group_by_expr_ctxs,
     return true;
 }
 
+// Whether the group by column is the codes of a low cardinality global dictionary, which could be indexed
+// directly by a fixed size table instead of being hashed.
+static bool is_group_column_dict_code(RuntimeState* state, ExprContext* ctx, LogicalType ltype) {
+    if (ltype != LowCardDictType || !ctx->root()->is_slotref()) {
+        return false;
+    }
+    const auto& global_dicts = state->get_query_global_dict_map();
+    auto iter = global_dicts.find(down_cast<ColumnRef*>(ctx->root())->slot_id());
+    if (iter == global_dicts.end()) {
+        return false;
+    }
+    const RGlobalDictMap& codes = iter->second.second;
+    return std::all_of(codes.begin(), codes.end(),
+                       [](const auto& entry) { return entry.first >= 0 && entry.first <= DICT_DECODE_MAX_SIZE; });
+}
+
 template <typename HashVariantType>
 void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
     auto type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice : HashVariantType::Type::phase2_slice;
     if (_group_by_expr_ctxs.size() == 1) {
         type = HashVariantResolver<HashVariantType>::instance().get_unary_type(
                 _aggr_phase, _group_by_types[0].result_type.type, _has_nullable_key);
+        if (is_group_column_dict_code(_state, _group_by_expr_ctxs[0], _group_by_types[0].result_type.type)) {
+            if (_aggr_phase == AggrPhase1) {
+                type = _has_nullable_key ? HashVariantType::Type::phase1_null_dict_code
+                                         : HashVariantType::Type::phase1_dict_code;
+            } else {
+                type = _has_nullable_key ? HashVariantType::Type::phase2_null_dict_code
+                                         : HashVariantType::Type::phase2_dict_code;
+            }
+        }
     }
 
     bool has_null_column = false;
@@ -47,6 +47,7 @@
 #include "runtime/memory/counting_allocator.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "types/hll.h"
 #include "util/defer_op.h"
 
 namespace starrocks {
@@ -178,11 +179,23 @@ struct AggrAutoContext {
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
+    // NDV / rows of the sampled chunks, above HighNdvRatio the keys are nearly unique and below LowNdvRatio
+    // the keys are highly duplicated.
+    static constexpr double LowNdvRatio = 0.1;
+    static constexpr double HighNdvRatio = 0.9;
     std::string get_auto_state_string(const AggrAutoState& state);
     size_t get_continuous_limit();
     void update_continuous_limit();
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
     bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
+    // Add the group by keys of a chunk to the NDV sketch, return true once sample_chunks chunks are sampled.
+    bool sample_ndv(const Columns& group_by_columns, size_t chunk_size, size_t sample_chunks);
+    double sampled_ndv_ratio() const;
+    HyperLogLog ndv_sketch;
+    size_t ndv_sampled_rows = 0;
+    size_t ndv_sampled_chunks = 0;
+    // the sampled keys are highly duplicated, expand the hash table without checking the reduction
+    bool low_ndv = false;
     size_t init_preagg_count = 0;
     size_t adjust_count = 0;
     size_t pass_through_count = 0;
@@ -275,6 +288,7 @@ public:
 
     const MemPool* mem_pool() const { return _mem_pool.get(); }
     bool is_none_group_by_exprs() { return _group_by_expr_ctxs.empty(); }
+    const Columns& group_by_columns() const { return _group_by_columns; }
     bool only_group_by_exprs() { return _is_only_group_by_columns; }
     const std::vector<ExprContext*>& conjunct_ctxs() { return _conjunct_ctxs; }
     const std::vector<ExprContext*>& group_by_expr_ctxs() { return _group_by_expr_ctxs; }
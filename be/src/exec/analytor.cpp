@@ -140,6 +140,7 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
 
     size_t agg_size = analytic_node.analytic_functions.size();
     _is_lead_lag_functions.resize(agg_size);
+    _sliding_extreme_queues.resize(agg_size);
     _agg_fn_ctxs.resize(agg_size);
     _agg_functions.resize(agg_size);
     _agg_expr_ctxs.resize(agg_size);
@@ -151,6 +152,10 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
     bool has_outer_join_child = analytic_node.__isset.has_outer_join_child && analytic_node.has_outer_join_child;
 
     _should_set_partition_size = false;
+    const bool is_sliding_rows_frame =
+            config::pipeline_analytic_enable_sliding_extreme_queue && analytic_node.__isset.window &&
+            analytic_node.window.type == TAnalyticWindowType::ROWS && analytic_node.window.__isset.window_start &&
+            analytic_node.window.__isset.window_end;
     for (int i = 0; i < agg_size; ++i) {
         const TExpr& desc = analytic_node.analytic_functions[i];
         const TFunction& fn = desc.nodes[0].fn;
@@ -260,6 +265,12 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
 
         DCHECK(_agg_functions[i] != nullptr);
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
+
+        const auto& fname = fn.name.function_name;
+        if (is_sliding_rows_frame && !_is_merge_funcs && (fname == "max" || fname == "min")) {
+            _sliding_extreme_queues[i] = std::make_unique<SlidingExtremeQueue>();
+            _sliding_extreme_queues[i]->is_max = fname == "max";
+        }
     }
 
     // Compute agg state total size and offsets.
@@ -967,7 +978,9 @@ void Analytor::_update_window_batch(int64_t partition_start, int64_t partition_e
             // instead of _partition.end to refer to the current right boundary.
             current_frame_end = std::min<int64_t>(current_frame_end, _partition.end);
         }
-        if (_is_merge_funcs) {
+        if (_sliding_extreme_queues[i] != nullptr) {
+            _update_window_by_sliding_extreme_queue(i, frame_start, frame_end);
+        } else if (_is_merge_funcs) {
             for (size_t j = current_frame_start; j < current_frame_end; j++) {
                 _agg_functions[i]->merge(_agg_fn_ctxs[i], data_columns[0],
                                          _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], j);
@@ -983,6 +996,11 @@ void Analytor::_update_window_batch(int64_t partition_start, int64_t partition_e
 void Analytor::_update_window_batch_removable_cumulatively() {
     SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(_allocator.get());
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        if (_sliding_extreme_queues[i] != nullptr) {
+            const FrameRange frame = _get_frame_range();
+            _update_window_by_sliding_extreme_queue(i, frame.start, frame.end);
+            continue;
+        }
         const Column* agg_column = _agg_intput_columns[i][0].get();
         _agg_functions[i]->update_state_removable_cumulatively(
                 _agg_fn_ctxs[i], _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], &agg_column,
@@ -991,6 +1009,47 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_update_window_by_sliding_extreme_queue(size_t i, int64_t frame_start, int64_t frame_end) {
+    auto& queue = *_sliding_extreme_queues[i];
+    const Column* column = _agg_intput_columns[i][0].get();
+    const int64_t partition_start = _get_global_position(_partition.start);
+    if (queue.partition_start != partition_start) {
+        queue.partition_start = partition_start;
+        queue.next_position = partition_start;
+        queue.candidates.clear();
+    }
+    const int64_t global_frame_start = _get_global_position(std::max<int64_t>(frame_start, _partition.start));
+    const int64_t global_frame_end = _get_global_position(std::min<int64_t>(frame_end, _partition.end));
+
+    // The frame only slides forward, so push the new rows into the tail, and the rows out of the frame are popped
+    // from the head.
+    const int sign = queue.is_max ? 1 : -1;
+    for (; queue.next_position < global_frame_end; queue.next_position++) {
+        const int64_t position = queue.next_position - _removed_from_buffer_rows;
+        if (column->is_null(position)) {
+            continue;
+        }
+        while (!queue.candidates.empty() &&
+               sign * column->compare_at(queue.candidates.back() - _removed_from_buffer_rows, position, *column, 1) <=
+                       0) {
+            queue.candidates.pop_back();
+        }
+        queue.candidates.push_back(queue.next_position);
+    }
+    while (!queue.candidates.empty() && queue.candidates.front() < global_frame_start) {
+        queue.candidates.pop_front();
+    }
+
+    // Both min and max are idempotent, so the state of the frame is the state of its extreme row.
+    AggDataPtr state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+    _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], state);
+    if (!queue.candidates.empty()) {
+        const int64_t position = queue.candidates.front() - _removed_from_buffer_rows;
+        _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], state, &column, _partition.start,
+                                                                _partition.end, position, position + 1);
+    }
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
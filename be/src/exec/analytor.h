@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <deque>
 #include <queue>
 #include <string>
 
@@ -58,6 +59,18 @@ class Analytor final : public pipeline::ContextWithDependency {
         int64_t end;
     };
 
+    // For `min`/`max` over a sliding rows frame, the rows which may still be the extreme value of a later frame are
+    // kept in a monotonic queue. Each row is pushed and popped at most once per partition, instead of rescanning the
+    // frame whenever the extreme value slides out of it.
+    struct SlidingExtremeQueue {
+        bool is_max = false;
+        // Global position of the current partition start and of the next row to push.
+        int64_t partition_start = -1;
+        int64_t next_position = 0;
+        // Global positions of the candidate rows, whose values are strictly decreasing for max.
+        std::deque<int64_t> candidates;
+    };
+
     struct Segment {
         // Start position of current partition/peer group.
         int64_t start = 0;
@@ -213,6 +226,7 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    void _update_window_by_sliding_extreme_queue(size_t i, int64_t frame_start, int64_t frame_end);
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -285,6 +299,8 @@ private:
     // The max align size for all window aggregate state
     size_t _max_agg_state_align_size = 1;
     std::vector<bool> _is_lead_lag_functions;
+    // Not null only for the min/max functions evaluated by the monotonic queue.
+    std::vector<std::unique_ptr<SlidingExtremeQueue>> _sliding_extreme_queues;
     std::vector<FunctionContext*> _agg_fn_ctxs;
     std::vector<const AggregateFunction*> _agg_functions;
     std::vector<ManagedFunctionStatesPtr<Analytor>> _managed_fn_states;
@@ -36,7 +36,8 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    _evaluate_key_columns(chunk, exprs, buffer_state);
+    size_t cur_max_one_row_size = _get_max_serialize_size(buffer_state);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -44,16 +45,23 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
                                                                SLICE_MEMEQUAL_OVERFLOW_PADDING);
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(chunk_size, buffer_state);
+    _compute_hashes(chunk_size, buffer_state);
 
+    const bool prefetch = _hash_set->bucket_count() >= prefetch_threhold;
+    const auto& hashes = buffer_state->hashes;
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (prefetch && i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(hashes[i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST]);
+        }
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
-        _hash_set->lazy_emplace(key, [&](const auto& ctor) {
+        _hash_set->lazy_emplace_with_hash(key, hashes[i], [&](const auto& ctor) {
             uint8_t* pos = pool->allocate_with_reserve(key.slice.size, SLICE_MEMEQUAL_OVERFLOW_PADDING);
             memcpy(pos, key.slice.data, key.slice.size);
             ctor(pos, key.slice.size);
         });
     }
+    buffer_state->key_columns.clear();
 }
 
 template <typename HashSet>
@@ -68,7 +76,8 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    _evaluate_key_columns(chunk, exprs, buffer_state);
+    size_t cur_max_one_row_size = _get_max_serialize_size(buffer_state);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -79,15 +88,22 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
         RETURN_IF_LIMIT_EXCEEDED(state, "Except, while probe hash table.");
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(chunk_size, buffer_state);
+    _compute_hashes(chunk_size, buffer_state);
 
+    const bool prefetch = _hash_set->bucket_count() >= prefetch_threhold;
+    const auto& hashes = buffer_state->hashes;
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (prefetch && i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(hashes[i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST]);
+        }
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
-        auto iter = _hash_set->find(key);
+        auto iter = _hash_set->find(key, hashes[i]);
         if (iter != _hash_set->end()) {
             iter->deleted = true;
         }
     }
+    buffer_state->key_columns.clear();
 
     return Status::OK();
 }
@@ -123,10 +139,18 @@ int64_t ExceptHashSet<HashSet>::mem_usage(BufferState* buffer_state) {
 }
 
 template <typename HashSet>
-size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+void ExceptHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
+                                                   BufferState* buffer_state) {
+    buffer_state->key_columns.clear();
     for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
+        buffer_state->key_columns.emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get()));
+    }
+}
+
+template <typename HashSet>
+size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const BufferState* buffer_state) {
+    size_t max_size = 0;
+    for (const auto& key_column : buffer_state->key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -136,11 +160,8 @@ size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, co
 }
 
 template <typename HashSet>
-void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
-                                                size_t chunk_size, BufferState* buffer_state) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
-
+void ExceptHashSet<HashSet>::_serialize_columns(size_t chunk_size, BufferState* buffer_state) {
+    for (const auto& key_column : buffer_state->key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(buffer_state->buffer, buffer_state->slice_sizes, chunk_size,
@@ -152,6 +173,15 @@ void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std
     }
 }
 
+template <typename HashSet>
+void ExceptHashSet<HashSet>::_compute_hashes(size_t chunk_size, BufferState* buffer_state) {
+    buffer_state->hashes.resize(chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+        ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
+        buffer_state->hashes[i] = _hash_set->hash(key);
+    }
+}
+
 template class ExceptHashSet<phmap::flat_hash_set<ExceptSliceFlag, ExceptSliceFlagHash, ExceptSliceFlagEqual>>;
 
 } // namespace starrocks
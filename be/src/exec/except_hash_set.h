@@ -64,6 +64,10 @@ public:
     public:
         size_t max_one_row_size{8};
         Buffer<uint32_t> slice_sizes;
+        // The key columns of the current chunk, evaluated once for both sizing and serializing.
+        Columns key_columns;
+        // The hash of each serialized key of the current chunk, computed in a batch before probing the set.
+        Buffer<size_t> hashes;
 
         MemPool mem_pool;
         uint8_t* buffer{nullptr};
@@ -89,9 +93,11 @@ public:
     int64_t mem_usage(BufferState* buffer_state);
 
 private:
-    size_t _get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
-    void _serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, size_t chunk_size,
-                            BufferState* buffer_state);
+    void _evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
+                               BufferState* buffer_state);
+    size_t _get_max_serialize_size(const BufferState* buffer_state);
+    void _serialize_columns(size_t chunk_size, BufferState* buffer_state);
+    void _compute_hashes(size_t chunk_size, BufferState* buffer_state);
 
 private:
     std::unique_ptr<HashSet> _hash_set;
@@ -396,6 +396,13 @@ void SingleHashJoinBuilder::clone_readable(HashJoinBuilder* builder) {
     other->_ht = _ht.clone_readable_table();
 }
 
+void SingleHashJoinBuilder::reference_hash_table(JoinHashTable* ht) {
+    // the appended build rows are released here, the referenced table holds the same ones.
+    _key_columns.clear();
+    _ht = ht->clone_readable_table();
+    _ready = true;
+}
+
 ChunkPtr SingleHashJoinBuilder::convert_to_spill_schema(const ChunkPtr& chunk) const {
     return _ht.convert_to_spill_schema(chunk);
 }
@@ -443,10 +450,14 @@ private:
 
     void _init_partition_nums(const HashTableParam& param);
     Status _convert_to_single_partition();
+    bool _can_split_partitions() const;
+    Status _split_partitions();
+    Status _calc_partition_ids(Chunk* chunk, size_t num_partitions, std::vector<uint32_t>* partition_ids) const;
     Status _append_chunk_to_partitions(const ChunkPtr& chunk);
 
 private:
     std::vector<std::unique_ptr<SingleHashJoinBuilder>> _builders;
+    HashTableParam _param;
 
     size_t _partition_num = 0;
     size_t _partition_join_min_rows = 0;
@@ -567,6 +578,7 @@ void AdaptivePartitionHashJoinBuilder::_init_partition_nums(const HashTableParam
 }
 
 void AdaptivePartitionHashJoinBuilder::create(const HashTableParam& param) {
+    _param = param;
     _init_partition_nums(param);
     for (size_t i = 0; i < _partition_num; ++i) {
         _builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
@@ -635,31 +647,101 @@ Status AdaptivePartitionHashJoinBuilder::_convert_to_single_partition() {
     return Status::OK();
 }
 
-Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const ChunkPtr& chunk) {
+// Splitting moves the rows that already live in the build chunks, so the partition keys must be evaluable on the
+// build chunk (column refs only) and the build columns must be plain columns rather than column views.
+bool AdaptivePartitionHashJoinBuilder::_can_split_partitions() const {
+    if (_partition_num * 2 > config::partition_hash_join_max_partition_num) {
+        return false;
+    }
+    if (_param.column_view_concat_rows_limit >= 0 || _param.column_view_concat_bytes_limit >= 0) {
+        return false;
+    }
+    return std::all_of(_param.join_keys.begin(), _param.join_keys.end(),
+                       [](const JoinKeyDesc& key) { return key.col_ref != nullptr; });
+}
+
+// Double the number of partitions. The partition id is the low bits of the row hash, so the rows of
+// partition i either stay in partition i or move to partition i + old partition num.
+Status AdaptivePartitionHashJoinBuilder::_split_partitions() {
+    size_t old_partition_num = _partition_num;
+    size_t new_partition_num = old_partition_num * 2;
+
+    std::vector<std::unique_ptr<SingleHashJoinBuilder>> builders;
+    for (size_t i = 0; i < new_partition_num; ++i) {
+        builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
+        builders.back()->create(_param);
+    }
+
+    std::vector<uint32_t> partition_ids;
+    std::vector<uint32_t> selection;
+    for (size_t i = 0; i < old_partition_num; ++i) {
+        auto& ht = _builders[i]->hash_table();
+        const ChunkPtr& build_chunk = ht.get_build_chunk();
+        // the first row of build chunk is a placeholder
+        size_t num_rows = build_chunk->num_rows();
+        if (num_rows > 1) {
+            RETURN_IF_ERROR(_calc_partition_ids(build_chunk.get(), new_partition_num, &partition_ids));
+
+            selection.resize(num_rows - 1);
+            uint32_t low = 0;
+            uint32_t high = num_rows - 1;
+            for (uint32_t row = 1; row < num_rows; ++row) {
+                if (partition_ids[row] == i) {
+                    selection[low++] = row;
+                }
+            }
+            for (uint32_t row = num_rows - 1; row >= 1; --row) {
+                if (partition_ids[row] != i) {
+                    selection[--high] = row;
+                }
+            }
+            DCHECK_EQ(low, high);
+
+            TRY_CATCH_BAD_ALLOC(builders[i]->hash_table().append_selective_ht(ht, selection.data(), 0, low));
+            TRY_CATCH_BAD_ALLOC(builders[i + old_partition_num]->hash_table().append_selective_ht(
+                    ht, selection.data(), low, num_rows - 1 - low));
+        }
+        // release the memory of the old partition as soon as possible
+        _builders[i]->close();
+    }
+
+    _builders = std::move(builders);
+    _partition_num = new_partition_num;
+    _partition_join_max_rows = _fit_L3_cache_max_rows * _partition_num;
+    COUNTER_SET(_hash_joiner.build_metrics().partition_nums, (int64_t)_partition_num);
+    return Status::OK();
+}
+
+Status AdaptivePartitionHashJoinBuilder::_calc_partition_ids(Chunk* chunk, size_t num_partitions,
+                                                             std::vector<uint32_t>* partition_ids) const {
     const std::vector<ExprContext*>& build_partition_keys = _hash_joiner.build_expr_ctxs();
 
     size_t num_rows = chunk->num_rows();
-    size_t num_partitions = _builders.size();
     size_t num_partition_cols = build_partition_keys.size();
 
     Columns partition_columns(num_partition_cols);
     for (size_t i = 0; i < num_partition_cols; ++i) {
-        ASSIGN_OR_RETURN(partition_columns[i], build_partition_keys[i]->evaluate(chunk.get()));
+        ASSIGN_OR_RETURN(partition_columns[i], build_partition_keys[i]->evaluate(chunk));
     }
-    std::vector<uint32_t> hash_values;
-    {
-        hash_values.assign(num_rows, HashUtil::FNV_SEED);
 
-        for (const ColumnPtr& column : partition_columns) {
-            column->fnv_hash(hash_values.data(), 0, num_rows);
-        }
-        // find partition id
-        for (size_t i = 0; i < hash_values.size(); ++i) {
-            hash_values[i] = HashUtil::fmix32(hash_values[i]) & (num_partitions - 1);
-        }
+    auto& hash_values = *partition_ids;
+    hash_values.assign(num_rows, HashUtil::FNV_SEED);
+
+    for (const ColumnPtr& column : partition_columns) {
+        column->fnv_hash(hash_values.data(), 0, num_rows);
+    }
+    // find partition id
+    for (size_t i = 0; i < hash_values.size(); ++i) {
+        hash_values[i] = HashUtil::fmix32(hash_values[i]) & (num_partitions - 1);
     }
+    return Status::OK();
+}
 
-    const auto& partitions = hash_values;
+Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const ChunkPtr& chunk) {
+    size_t num_partitions = _builders.size();
+
+    std::vector<uint32_t> partitions;
+    RETURN_IF_ERROR(_calc_partition_ids(chunk.get(), num_partitions, &partitions));
 
     std::vector<uint32_t> selection;
     selection.resize(chunk->num_rows());
@@ -696,7 +778,13 @@ Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const Chunk
 
 Status AdaptivePartitionHashJoinBuilder::do_append_chunk(const ChunkPtr& chunk) {
     if (_partition_num > 1 && hash_table_row_count() > _partition_join_max_rows) {
-        RETURN_IF_ERROR(_convert_to_single_partition());
+        // Keep each partition fit in L3 cache by doubling the partition num, and fall back to a single
+        // hash table only when the partitions can't be split any more.
+        if (_can_split_partitions()) {
+            RETURN_IF_ERROR(_split_partitions());
+        } else {
+            RETURN_IF_ERROR(_convert_to_single_partition());
+        }
     }
 
     if (_partition_num > 1 && ++_pushed_chunks % 8 == 0) {
@@ -171,6 +171,9 @@ public:
 
     void clone_readable(HashJoinBuilder* builder) override;
 
+    // Reference a hash table built by another builder with the same build rows instead of building one.
+    void reference_hash_table(JoinHashTable* ht);
+
     ChunkPtr convert_to_spill_schema(const ChunkPtr& chunk) const override;
 
 private:
@@ -16,6 +16,7 @@
 
 #include <runtime/runtime_state.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/column_helper.h"
@@ -25,6 +26,7 @@
 #include "common/statusor.h"
 #include "exec/hash_join_components.h"
 #include "exec/join_hash_map.h"
+#include "exec/pipeline/query_context.h"
 #include "exec/spill/spiller.hpp"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
@@ -60,6 +62,7 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     partial_runtime_bloom_filter_bytes =
             ADD_COUNTER(runtime_profile, "PartialRuntimeMembershipFilterBytes", TUnit::BYTES);
     partition_nums = ADD_COUNTER(runtime_profile, "PartitionNums", TUnit::UNIT);
+    shared_hash_table_counter = ADD_COUNTER(runtime_profile, "SharedHashTable", TUnit::UNIT);
 }
 
 HashJoiner::HashJoiner(const HashJoinerParam& param)
@@ -80,7 +83,9 @@ HashJoiner::HashJoiner(const HashJoinerParam& param)
           _probe_output_slots(param._probe_output_slots),
           _build_runtime_filters(param._build_runtime_filters.begin(), param._build_runtime_filters.end()),
           _enable_late_materialization(param._enable_late_materialization),
-          _is_skew_join(param._is_skew_join) {
+          _is_skew_join(param._is_skew_join),
+          _plan_node_id(param._plan_node_id),
+          _distribution_mode(param._distribution_mode) {
     _is_push_down = param._hash_join_node.is_push_down;
     if (_join_type == TJoinOp::LEFT_ANTI_JOIN && param._hash_join_node.is_rewritten_from_not_in) {
         _join_type = TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN;
@@ -152,6 +157,11 @@ void HashJoiner::_init_hash_table_param(HashTableParam* param, RuntimeState* sta
     param->build_output_slots = _build_output_slots;
     param->probe_output_slots = _probe_output_slots;
     param->enable_late_materialization = _enable_late_materialization;
+    // The hashes of a single string key are kept to fill its runtime bloom filters.
+    param->keep_key_hashes = config::enable_join_runtime_filter_reuse_key_hashes && _build_expr_ctxs.size() == 1 &&
+                             is_string_type(_build_expr_ctxs[0]->root()->type().type) &&
+                             std::any_of(_build_runtime_filters.begin(), _build_runtime_filters.end(),
+                                         [](const RuntimeFilterBuildDescriptor* rf) { return rf->has_consumer(); });
     param->column_view_concat_rows_limit = state->column_view_concat_rows_limit();
     param->column_view_concat_bytes_limit = state->column_view_concat_bytes_limit();
     std::set<SlotId> predicate_slots;
@@ -213,7 +223,10 @@ Status HashJoiner::append_spill_task(RuntimeState* state, std::function<StatusOr
 
 Status HashJoiner::build_ht(RuntimeState* state) {
     if (_phase == HashJoinPhase::BUILD) {
-        RETURN_IF_ERROR(_hash_join_builder->build(state));
+        if (!_reference_shared_broadcast_hash_table(state)) {
+            RETURN_IF_ERROR(_hash_join_builder->build(state));
+            _publish_shared_broadcast_hash_table(state);
+        }
 
         size_t bucket_size = 0;
         float avg_keys_per_bucket = 0;
@@ -225,6 +238,39 @@ Status HashJoiner::build_ht(RuntimeState* state) {
     return Status::OK();
 }
 
+bool HashJoiner::_could_share_broadcast_hash_table(RuntimeState* state) const {
+    // Only the plain hash table of a broadcast join is identical among the fragment instances. Joins with
+    // post probe mark the matched build rows, so each instance must own its table.
+    return config::enable_shared_broadcast_hash_table && _distribution_mode == TJoinDistributionMode::BROADCAST &&
+           !_is_skew_join && _spiller == nullptr && !has_post_probe(_join_type) && state->query_ctx() != nullptr &&
+           dynamic_cast<SingleHashJoinBuilder*>(_hash_join_builder) != nullptr;
+}
+
+bool HashJoiner::_reference_shared_broadcast_hash_table(RuntimeState* state) {
+    if (!_could_share_broadcast_hash_table(state)) {
+        return false;
+    }
+    auto shared_ht = state->query_ctx()->get_broadcast_hash_table(_plan_node_id);
+    auto* builder = down_cast<SingleHashJoinBuilder*>(_hash_join_builder);
+    // the build side of each instance receives the same rows, the row count is checked for safety.
+    if (shared_ht == nullptr || shared_ht->get_row_count() != builder->hash_table().get_row_count()) {
+        return false;
+    }
+    builder->reference_hash_table(shared_ht.get());
+    _shared_broadcast_hash_table = std::move(shared_ht);
+    COUNTER_SET(build_metrics().shared_hash_table_counter, 1);
+    return true;
+}
+
+void HashJoiner::_publish_shared_broadcast_hash_table(RuntimeState* state) {
+    if (!_could_share_broadcast_hash_table(state)) {
+        return;
+    }
+    auto* builder = down_cast<SingleHashJoinBuilder*>(_hash_join_builder);
+    _shared_broadcast_hash_table = std::make_shared<JoinHashTable>(builder->hash_table().clone_readable_table());
+    state->query_ctx()->publish_broadcast_hash_table(_plan_node_id, _shared_broadcast_hash_table);
+}
+
 bool HashJoiner::need_input() const {
     // when _buffered_chunk accumulates several chunks to form into a large enough chunk, it is moved into
     // _probe_chunk for probe operations.
@@ -577,11 +623,13 @@ Status HashJoiner::_create_runtime_bloom_filters(RuntimeState* state, int64_t li
         bool eq_null = _is_null_safes[expr_order];
         bool is_empty = false;
         Columns columns;
+        std::vector<KeyHashesPtr> key_hashes;
 
         for (auto* ht : hash_tables) {
             ColumnPtr column = ht->get_key_columns()[expr_order];
             is_empty |= column == nullptr || column->empty();
             columns.push_back(column);
+            key_hashes.push_back(ht->get_key_hashes());
         }
 
         TypeDescriptor type_descriptor = _build_expr_ctxs[expr_order]->root()->type();
@@ -598,12 +646,13 @@ Status HashJoiner::_create_runtime_bloom_filters(RuntimeState* state, int64_t li
                 continue;
             }
             filter->get_membership_filter()->init(ht_row_count);
-            RETURN_IF_ERROR(RuntimeFilterHelper::fill_runtime_filter(columns, build_type, filter.get(),
+            RETURN_IF_ERROR(RuntimeFilterHelper::fill_runtime_filter(columns, key_hashes, build_type, filter.get(),
                                                                      kHashJoinKeyColumnOffset, eq_null));
         }
 
         _runtime_bloom_filter_build_params.emplace_back(pipeline::RuntimeMembershipFilterBuildParam(
                 multi_partitioned, eq_null, is_empty, std::move(columns), std::move(filter), type_descriptor));
+        _runtime_bloom_filter_build_params.back()->key_hashes = std::move(key_hashes);
     }
     return Status::OK();
 }
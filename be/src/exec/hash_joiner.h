@@ -72,7 +72,7 @@ struct HashJoinerParam {
                     bool build_conjunct_ctxs_is_empty, std::list<RuntimeFilterBuildDescriptor*> build_runtime_filters,
                     std::set<SlotId> build_output_slots, std::set<SlotId> probe_output_slots,
                     const TJoinDistributionMode::type distribution_mode, bool enable_late_materialization,
-                    bool enable_partition_hash_join, bool is_skew_join)
+                    bool enable_partition_hash_join, bool is_skew_join, int32_t plan_node_id)
             : _pool(pool),
               _hash_join_node(hash_join_node),
               _is_null_safes(std::move(is_null_safes)),
@@ -91,7 +91,8 @@ struct HashJoinerParam {
               _distribution_mode(distribution_mode),
               _enable_late_materialization(enable_late_materialization),
               _enable_partition_hash_join(enable_partition_hash_join),
-              _is_skew_join(is_skew_join) {}
+              _is_skew_join(is_skew_join),
+              _plan_node_id(plan_node_id) {}
 
     HashJoinerParam(HashJoinerParam&&) = default;
     HashJoinerParam(HashJoinerParam&) = default;
@@ -117,6 +118,7 @@ struct HashJoinerParam {
     const bool _enable_late_materialization;
     const bool _enable_partition_hash_join;
     const bool _is_skew_join;
+    const int32_t _plan_node_id;
 };
 
 inline bool could_short_circuit(TJoinOp::type join_type) {
@@ -161,6 +163,7 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
     RuntimeProfile::Counter* partial_runtime_bloom_filter_bytes = nullptr;
     RuntimeProfile::Counter* partition_nums = nullptr;
+    RuntimeProfile::Counter* shared_hash_table_counter = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
@@ -414,6 +417,11 @@ private:
 
     Status _create_runtime_bloom_filters(RuntimeState* state, int64_t limit);
 
+    bool _could_share_broadcast_hash_table(RuntimeState* state) const;
+    // Reference the hash table published by another fragment instance, return false if there is none.
+    bool _reference_shared_broadcast_hash_table(RuntimeState* state);
+    void _publish_shared_broadcast_hash_table(RuntimeState* state);
+
 private:
     const THashJoinNode& _hash_join_node;
     ObjectPool* _pool;
@@ -483,6 +491,12 @@ private:
     pipeline::Observable _probe_observable;
 
     bool _is_skew_join = false;
+
+    int32_t _plan_node_id;
+    TJoinDistributionMode::type _distribution_mode;
+    // The readable hash table published to the QueryContext, it keeps the built table alive for the fragment
+    // instances of the same query which reference it.
+    std::shared_ptr<JoinHashTable> _shared_broadcast_hash_table;
 };
 
 } // namespace starrocks
@@ -296,6 +296,11 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
     shared_buffered_input_stream->set_coalesce_options(shared_options);
+    if (config::io_coalesce_adaptive_distance_enable) {
+        // the data cache sits above the shared buffered stream, so the reads here always miss the cache
+        shared_buffered_input_stream->set_coalesce_model(
+                io::SharedBufferedInputStream::CoalesceModel::get(options.fs->type(), false));
+    }
     input_stream = shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -100,6 +100,8 @@ struct HdfsScanStats {
     int64_t footer_cache_write_count = 0;
     int64_t footer_cache_write_bytes = 0;
     int64_t footer_cache_write_fail_count = 0;
+    int64_t page_index_cache_read_count = 0;
+    int64_t page_index_cache_write_count = 0;
     int64_t column_reader_init_ns = 0;
     // dict filter
     int64_t group_chunk_read_ns = 0;
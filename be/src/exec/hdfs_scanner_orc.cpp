@@ -366,6 +366,7 @@ Status HdfsOrcScanner::build_stripes(orc::Reader* reader, std::vector<DiskRange>
             int64_t length = stripeInfo.datalength() + stripeInfo.indexlength() + stripeInfo.footerlength();
             stripes->emplace_back(offset, length);
             _app_stats.orc_stripe_sizes.push_back(length);
+            _scan_range_num_rows += stripeInfo.numberofrows();
         }
     }
     return Status::OK();
@@ -583,6 +584,17 @@ Status HdfsOrcScanner::do_get_next(RuntimeState* runtime_state, ChunkPtr* chunk)
 }
 
 StatusOr<size_t> HdfsOrcScanner::_do_get_next_count(ChunkPtr* chunk) {
+    // no row can be filtered or deleted, so the rows are counted from the stripe information in the footer
+    // without reading any stripe.
+    if (_scanner_ctx.min_max_conjunct_ctxs.empty() && (_skip_rows_ctx == nullptr || !_skip_rows_ctx->has_skip_rows())) {
+        if (_scan_range_num_rows == 0) {
+            return Status::EndOfFile("No more rows to read");
+        }
+        _scanner_ctx.append_or_update_count_column_to_chunk(chunk, _scan_range_num_rows);
+        _scan_range_num_rows = 0;
+        return 1;
+    }
+
     size_t read_num_values = 0;
     Status st = Status::OK();
     while (true) {
@@ -69,6 +69,8 @@ private:
     Filter _chunk_filter;
     SkipRowsContextPtr _skip_rows_ctx;
     std::unique_ptr<ORCHdfsFileStream> _input_stream;
+    // rows of the stripes in the scan range, used to answer the count from the footer.
+    int64_t _scan_range_num_rows = 0;
 };
 
 } // namespace starrocks
@@ -89,6 +89,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     RuntimeProfile::Counter* footer_cache_write_fail_counter = nullptr;
     RuntimeProfile::Counter* footer_cache_read_counter = nullptr;
     RuntimeProfile::Counter* footer_cache_read_timer = nullptr;
+    RuntimeProfile::Counter* page_index_cache_write_counter = nullptr;
+    RuntimeProfile::Counter* page_index_cache_read_counter = nullptr;
     RuntimeProfile::Counter* column_reader_init_timer = nullptr;
 
     // dict filter
@@ -135,6 +137,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     footer_cache_read_counter =
             ADD_CHILD_COUNTER(root, "FooterCacheReadCount", TUnit::UNIT, kParquetProfileSectionPrefix);
     footer_cache_read_timer = ADD_CHILD_TIMER(root, "FooterCacheReadTimer", kParquetProfileSectionPrefix);
+    page_index_cache_write_counter =
+            ADD_CHILD_COUNTER(root, "PageIndexCacheWriteCount", TUnit::UNIT, kParquetProfileSectionPrefix);
+    page_index_cache_read_counter =
+            ADD_CHILD_COUNTER(root, "PageIndexCacheReadCount", TUnit::UNIT, kParquetProfileSectionPrefix);
 
     level_decode_timer = ADD_CHILD_TIMER(root, "LevelDecodeTime", kParquetProfileSectionPrefix);
     value_decode_timer = ADD_CHILD_TIMER(root, "ValueDecodeTime", kParquetProfileSectionPrefix);
@@ -198,6 +204,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(footer_cache_write_fail_counter, _app_stats.footer_cache_write_fail_count);
     COUNTER_UPDATE(footer_cache_read_counter, _app_stats.footer_cache_read_count);
     COUNTER_UPDATE(footer_cache_read_timer, _app_stats.footer_cache_read_ns);
+    COUNTER_UPDATE(page_index_cache_write_counter, _app_stats.page_index_cache_write_count);
+    COUNTER_UPDATE(page_index_cache_read_counter, _app_stats.page_index_cache_read_count);
     COUNTER_UPDATE(column_reader_init_timer, _app_stats.column_reader_init_ns);
     COUNTER_UPDATE(group_chunk_read_timer, _app_stats.group_chunk_read_ns);
     COUNTER_UPDATE(group_dict_filter_timer, _app_stats.group_dict_filter_ns);
@@ -17,6 +17,7 @@
 #include <storage/chunk_helper.h>
 
 #include "column/vectorized_fwd.h"
+#include "connector/deletion_vector/deletion_bitmap_cache.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "formats/orc/orc_input_stream.h"
@@ -63,18 +64,41 @@ StatusOr<std::unique_ptr<RandomAccessFile>> IcebergDeleteBuilder::open_random_ac
     return file;
 }
 
-Status IcebergDeleteBuilder::fill_skip_rowids(const ChunkPtr& chunk) const {
+Status IcebergDeleteBuilder::fill_skip_rowids(const ChunkPtr& chunk, DeletionBitmap* bitmap) const {
     const ColumnPtr& file_path = chunk->get_column_by_slot_id(k_delete_file_path.id);
     const ColumnPtr& pos = chunk->get_column_by_slot_id(k_delete_file_pos.id);
     for (int i = 0; i < chunk->num_rows(); i++) {
         if (file_path->get(i).get_slice() == _params.path) {
-            _deletion_bitmap->add_value(pos->get(i).get_int64());
+            bitmap->add_value(pos->get(i).get_int64());
         }
     }
     return Status::OK();
 }
 
+bool IcebergDeleteBuilder::merge_cached_bitmap(const std::string& cache_key) const {
+    DeletionBitmapPtr bitmap = DeletionBitmapCache::instance()->lookup(cache_key);
+    if (bitmap == nullptr) {
+        return false;
+    }
+    _deletion_bitmap->add_bitmap(*bitmap);
+    _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
+    return true;
+}
+
+void IcebergDeleteBuilder::merge_bitmap(const std::string& cache_key, const DeletionBitmapPtr& bitmap) const {
+    DeletionBitmapCache::instance()->insert(cache_key, bitmap);
+    _deletion_bitmap->add_bitmap(*bitmap);
+    _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
+}
+
 Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file) const {
+    const std::string cache_key =
+            DeletionBitmapCache::make_key(delete_file.full_path, 0, delete_file.length, _params.path);
+    if (merge_cached_bitmap(cache_key)) {
+        return Status::OK();
+    }
+    auto bitmap = std::make_shared<DeletionBitmap>(roaring64_bitmap_create());
+
     HdfsScanStats app_scan_stats;
     HdfsScanStats fs_scan_stats;
     std::shared_ptr<io::SharedBufferedInputStream> shared_buffered_input_stream = nullptr;
@@ -145,15 +169,22 @@ Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file
         }
 
         RETURN_IF_ERROR(status);
-        RETURN_IF_ERROR(fill_skip_rowids(chunk));
+        RETURN_IF_ERROR(fill_skip_rowids(chunk, bitmap.get()));
     }
-    _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
+    merge_bitmap(cache_key, bitmap);
     update_delete_file_io_counter(_params.profile->runtime_profile, app_scan_stats, fs_scan_stats, cache_input_stream,
                                   shared_buffered_input_stream);
     return Status::OK();
 }
 
 Status IcebergDeleteBuilder::build_orc(const TIcebergDeleteFile& delete_file) const {
+    const std::string cache_key =
+            DeletionBitmapCache::make_key(delete_file.full_path, 0, delete_file.length, _params.path);
+    if (merge_cached_bitmap(cache_key)) {
+        return Status::OK();
+    }
+    auto bitmap = std::make_shared<DeletionBitmap>(roaring64_bitmap_create());
+
     std::vector slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                  &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
 
@@ -198,9 +229,9 @@ Status IcebergDeleteBuilder::build_orc(const TIcebergDeleteFile& delete_file) co
         if (!ret.ok()) {
             return ret.status();
         }
-        RETURN_IF_ERROR(fill_skip_rowids(ret.value()));
+        RETURN_IF_ERROR(fill_skip_rowids(ret.value(), bitmap.get()));
     }
-    _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
+    merge_bitmap(cache_key, bitmap);
     update_delete_file_io_counter(_params.profile->runtime_profile, app_scan_stats, fs_scan_stats, cache_input_stream,
                                   shared_buffered_input_stream);
     return Status::OK();
@@ -45,7 +45,10 @@ private:
             RuntimeProfile* parent_profile, const HdfsScanStats& app_stats, const HdfsScanStats& fs_stats,
             const std::shared_ptr<io::CacheInputStream>& cache_input_stream,
             const std::shared_ptr<io::SharedBufferedInputStream>& shared_buffered_input_stream);
-    Status fill_skip_rowids(const ChunkPtr& chunk) const;
+    Status fill_skip_rowids(const ChunkPtr& chunk, DeletionBitmap* bitmap) const;
+    // Merge the cached bitmap of the delete file into the deletion bitmap, return false if it's not cached.
+    bool merge_cached_bitmap(const std::string& cache_key) const;
+    void merge_bitmap(const std::string& cache_key, const DeletionBitmapPtr& bitmap) const;
 
     SkipRowsContextPtr _skip_rows_ctx;
     const HdfsScannerParams& _params;
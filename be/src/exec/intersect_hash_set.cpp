@@ -34,24 +34,31 @@ void IntersectHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& c
     size_t chunk_size = chunkPtr->num_rows();
 
     _slice_sizes.assign(state->chunk_size(), 0);
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunkPtr, exprs);
+    _evaluate_key_columns(chunkPtr, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size();
     if (UNLIKELY(cur_max_one_row_size > _max_one_row_size)) {
         _max_one_row_size = cur_max_one_row_size;
         _mem_pool->clear();
         _buffer = _mem_pool->allocate(_max_one_row_size * state->chunk_size() + SLICE_MEMEQUAL_OVERFLOW_PADDING);
     }
 
-    _serialize_columns(chunkPtr, exprs, chunk_size);
+    _serialize_columns(chunk_size);
+    _compute_hashes(chunk_size);
 
+    const bool prefetch = _hash_set->bucket_count() >= prefetch_threhold;
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (prefetch && i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(_hashes[i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST]);
+        }
         IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
-        _hash_set->lazy_emplace(key, [&](const auto& ctor) {
+        _hash_set->lazy_emplace_with_hash(key, _hashes[i], [&](const auto& ctor) {
             // we must persist the slice before insert
             uint8_t* pos = pool->allocate_with_reserve(key.slice.size, SLICE_MEMEQUAL_OVERFLOW_PADDING);
             memcpy(pos, key.slice.data, key.slice.size);
             ctor(pos, key.slice.size);
         });
     }
+    _key_columns.clear();
 }
 
 template <typename HashSet>
@@ -59,7 +66,8 @@ Status IntersectHashSet<HashSet>::refine_intersect_row(RuntimeState* state, cons
                                                        const std::vector<ExprContext*>& exprs, const int hit_times) {
     size_t chunk_size = chunkPtr->num_rows();
     _slice_sizes.assign(state->chunk_size(), 0);
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunkPtr, exprs);
+    _evaluate_key_columns(chunkPtr, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size();
     if (UNLIKELY(cur_max_one_row_size > _max_one_row_size)) {
         _max_one_row_size = cur_max_one_row_size;
         _mem_pool->clear();
@@ -70,15 +78,21 @@ Status IntersectHashSet<HashSet>::refine_intersect_row(RuntimeState* state, cons
         RETURN_IF_LIMIT_EXCEEDED(state, "Intersect, while probe hash table.");
     }
 
-    _serialize_columns(chunkPtr, exprs, chunk_size);
+    _serialize_columns(chunk_size);
+    _compute_hashes(chunk_size);
 
+    const bool prefetch = _hash_set->bucket_count() >= prefetch_threhold;
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (prefetch && i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(_hashes[i + AGG_HASH_MAP_DEFAULT_PREFETCH_DIST]);
+        }
         IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
-        auto iter = _hash_set->find(key);
+        auto iter = _hash_set->find(key, _hashes[i]);
         if (iter != _hash_set->end() && iter->hit_times == hit_times - 1) {
             iter->hit_times = hit_times;
         }
     }
+    _key_columns.clear();
     return Status::OK();
 }
 
@@ -112,11 +126,18 @@ int64_t IntersectHashSet<HashSet>::mem_usage() const {
 }
 
 template <typename HashSet>
-size_t IntersectHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunkPtr,
-                                                          const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+void IntersectHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunkPtr,
+                                                      const std::vector<ExprContext*>& exprs) {
+    _key_columns.clear();
     for (auto* expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get());
+        _key_columns.emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get()));
+    }
+}
+
+template <typename HashSet>
+size_t IntersectHashSet<HashSet>::_get_max_serialize_size() {
+    size_t max_size = 0;
+    for (const auto& key_column : _key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -126,11 +147,8 @@ size_t IntersectHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunkP
 }
 
 template <typename HashSet>
-void IntersectHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs,
-                                                   size_t chunk_size) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get());
-
+void IntersectHashSet<HashSet>::_serialize_columns(size_t chunk_size) {
+    for (const auto& key_column : _key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(_buffer, _slice_sizes, chunk_size, _max_one_row_size);
@@ -141,6 +159,15 @@ void IntersectHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunkPtr, con
     }
 }
 
+template <typename HashSet>
+void IntersectHashSet<HashSet>::_compute_hashes(size_t chunk_size) {
+    _hashes.resize(chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+        IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
+        _hashes[i] = _hash_set->hash(key);
+    }
+}
+
 // instantiation
 template class IntersectHashSet<
         phmap::flat_hash_set<IntersectSliceFlag, IntersectSliceFlagHash, IntersectSliceFlagEqual>>;
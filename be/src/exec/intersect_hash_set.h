@@ -75,12 +75,20 @@ public:
     int64_t mem_usage() const;
 
 private:
-    void _serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs, size_t chunk_size);
+    void _evaluate_key_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
 
-    size_t _get_max_serialize_size(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
+    void _serialize_columns(size_t chunk_size);
+
+    size_t _get_max_serialize_size();
+
+    void _compute_hashes(size_t chunk_size);
 
     std::unique_ptr<HashSet> _hash_set;
 
+    // The key columns of the current chunk, evaluated once for both sizing and serializing.
+    Columns _key_columns;
+    // The hash of each serialized key of the current chunk, computed in a batch before probing the set.
+    Buffer<size_t> _hashes;
     Buffer<uint32_t> _slice_sizes;
     size_t _max_one_row_size = 8;
     std::unique_ptr<MemPool> _mem_pool;
@@ -75,8 +75,8 @@ void HashTableProbeState::consider_probe_time_locality() {
 
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_random_access_buffer(&table_items->first, table_items->bucket_size, 0u);
+    resize_random_access_buffer(&table_items->next, table_items->row_count + 1, 0u);
     table_items->build_slice.resize(table_items->row_count + 1);
     table_items->build_pool = std::make_unique<MemPool>();
 }
@@ -340,6 +340,9 @@ void JoinHashTable::create(const HashTableParam& param) {
     _table_items->with_other_conjunct = param.with_other_conjunct;
     _table_items->join_type = param.join_type;
     _table_items->enable_late_materialization = param.enable_late_materialization;
+    if (param.keep_key_hashes) {
+        _table_items->key_hashes = std::make_shared<Buffer<uint64_t>>();
+    }
 
     if (_table_items->join_type == TJoinOp::RIGHT_SEMI_JOIN || _table_items->join_type == TJoinOp::RIGHT_ANTI_JOIN ||
         _table_items->join_type == TJoinOp::RIGHT_OUTER_JOIN) {
@@ -523,6 +526,9 @@ int64_t JoinHashTable::mem_usage() const {
         usage += _table_items->build_key_column->memory_usage();
     }
     usage += _table_items->build_slice.size() * sizeof(Slice);
+    if (_table_items->key_hashes != nullptr) {
+        usage += _table_items->key_hashes->capacity() * sizeof(uint64_t);
+    }
     return usage;
 }
 
@@ -656,6 +662,22 @@ void JoinHashTable::merge_ht(const JoinHashTable& ht) {
     }
 }
 
+void JoinHashTable::append_selective_ht(const JoinHashTable& ht, const uint32_t* indexes, uint32_t from,
+                                        uint32_t size) {
+    _table_items->row_count += size;
+
+    auto& columns = _table_items->build_chunk->columns();
+    auto& other_columns = ht._table_items->build_chunk->columns();
+
+    for (size_t i = 0; i < _table_items->build_column_count; i++) {
+        if (!columns[i]->is_nullable() && !columns[i]->is_view() && other_columns[i]->is_nullable()) {
+            // upgrade to nullable column
+            columns[i] = NullableColumn::create(columns[i], NullColumn::create(columns[i]->size(), 0));
+        }
+        columns[i]->append_selective(*other_columns[i], indexes, from, size);
+    }
+}
+
 ChunkPtr JoinHashTable::convert_to_spill_schema(const ChunkPtr& chunk) const {
     DCHECK(chunk != nullptr && chunk->num_rows() > 0);
     ChunkPtr output = std::make_shared<Chunk>();
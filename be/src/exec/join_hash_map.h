@@ -29,6 +29,8 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "runtime/memory/huge_page.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -115,6 +117,9 @@ struct JoinHashTableItems {
     Buffer<uint32_t> next;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column = nullptr;
+    // The hashes of the single string key of each build row, kept by the build for the runtime bloom filters
+    // of the key, see JoinKeyHash<Slice>. nullptr if they are not needed.
+    std::shared_ptr<Buffer<uint64_t>> key_hashes = nullptr;
     uint32_t bucket_size = 0;
     uint32_t log_bucket_size = 0;
     uint32_t row_count = 0; // real row count
@@ -290,6 +295,7 @@ struct HashTableParam {
     bool with_other_conjunct = false;
     bool enable_late_materialization = false;
     bool enable_partition_hash_join = false;
+    bool keep_key_hashes = false;
     long column_view_concat_rows_limit = -1L;
     long column_view_concat_bytes_limit = -1L;
 
@@ -340,12 +346,20 @@ struct JoinKeyHash<T, 8> {
     }
 };
 
+/// The hash of a string key is the one of its runtime bloom filter, so the hashes computed by the build could
+/// fill the bloom filter as well. The low bits of crc are poorly distributed, they are multiplied out to the
+/// high bits to pick the bucket.
 template <>
 struct JoinKeyHash<Slice> {
-    static const uint32_t CRC_SEED = 0x811C9DC5;
+    static uint64_t hash(const Slice& slice) { return SliceHash()(slice); }
+
+    static uint32_t bucket(uint64_t hash, uint32_t num_log_buckets) {
+        static constexpr uint64_t a = 11400714819323198485ull;
+        return (hash * a) >> (64 - num_log_buckets);
+    }
+
     uint32_t operator()(const Slice& slice, uint32_t num_buckets, uint32_t num_log_buckets) const {
-        const size_t hash = crc_hash_32(slice.data, slice.size, CRC_SEED);
-        return hash & (num_buckets - 1);
+        return bucket(hash(slice), num_log_buckets);
     }
 };
 
@@ -379,6 +393,37 @@ public:
         }
     }
 
+    static constexpr uint32_t PROBE_PREFETCH_DIST = 16;
+
+    // Fetch the chain head of each probe row from `first` in two prefetching rounds, used when the hash table
+    // is much larger than the cache. The first round prefetches `first[buckets[i + dist]]` before loading
+    // `first[buckets[i]]`, the second round prefetches the build key of the chain heads, so that the key
+    // comparisons of the probe loop mostly hit the cache. Rows with `is_nulls[i] != 0` get an empty chain.
+    template <typename CppType>
+    static void lookup_first_with_prefetch(const Buffer<uint32_t>& first, const Buffer<uint32_t>& buckets,
+                                           const Buffer<CppType>& build_data, const uint8_t* is_nulls,
+                                           uint32_t count, Buffer<uint32_t>* next) {
+        const uint32_t* bucket_data = buckets.data();
+        const uint32_t* first_data = first.data();
+        uint32_t* next_data = next->data();
+
+        for (uint32_t i = 0; i < count; i++) {
+            if (i + PROBE_PREFETCH_DIST < count) {
+                __builtin_prefetch(first_data + bucket_data[i + PROBE_PREFETCH_DIST], 0, 1);
+            }
+            next_data[i] = first_data[bucket_data[i]];
+        }
+        if (is_nulls != nullptr) {
+            for (uint32_t i = 0; i < count; i++) {
+                next_data[i] = is_nulls[i] == 0 ? next_data[i] : 0;
+            }
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            // next_data[i] == 0 points to the placeholder row, prefetching it is harmless
+            __builtin_prefetch(build_data.data() + next_data[i], 0, 1);
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -416,6 +461,10 @@ public:
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
+
+private:
+    template <typename BucketFunc>
+    static void _construct_hash_table(JoinHashTableItems* table_items, BucketFunc&& bucket_of);
 };
 
 template <LogicalType LT>
@@ -514,6 +563,11 @@ public:
     static bool equal(const CppType& x, const CppType& y) { return x == y; }
 
 private:
+    // prefetching only pays off when the hash table is much larger than the cache
+    static bool _enable_probe_prefetch(const JoinHashTableItems& table_items) {
+        return config::enable_hash_join_probe_prefetch && table_items.ht_cache_miss_serious();
+    }
+
     static void _probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                               const Columns& data_columns);
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
@@ -854,12 +908,15 @@ public:
 
     void append_chunk(const ChunkPtr& chunk, const Columns& key_columns);
     void merge_ht(const JoinHashTable& ht);
+    // append the build rows of ht selected by indexes[from, from + size), used to split a partition
+    void append_selective_ht(const JoinHashTable& ht, const uint32_t* indexes, uint32_t from, uint32_t size);
     // convert input column to spill schema order
     ChunkPtr convert_to_spill_schema(const ChunkPtr& chunk) const;
 
     const ChunkPtr& get_build_chunk() const { return _table_items->build_chunk; }
     Columns& get_key_columns() { return _table_items->key_columns; }
     const Columns& get_key_columns() const { return _table_items->key_columns; }
+    const std::shared_ptr<Buffer<uint64_t>>& get_key_hashes() const { return _table_items->key_hashes; }
     uint32_t get_row_count() const { return _table_items->row_count; }
     size_t get_probe_column_count() const { return _table_items->probe_column_count; }
     size_t get_output_probe_column_count() const { return _table_items->output_probe_column_count; }
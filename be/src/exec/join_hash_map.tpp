@@ -29,8 +29,8 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->log_bucket_size = __builtin_ctz(table_items->bucket_size);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_random_access_buffer(&table_items->first, table_items->bucket_size, 0u);
+    resize_random_access_buffer(&table_items->next, table_items->row_count + 1, 0u);
 }
 
 template <LogicalType LT>
@@ -59,13 +59,34 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
+    if constexpr (lt_is_string<LT>) {
+        if (table_items->key_hashes != nullptr) {
+            auto& key_hashes = *table_items->key_hashes;
+            key_hashes.resize(table_items->row_count + 1);
+            for (size_t i = 1; i < table_items->row_count + 1; i++) {
+                key_hashes[i] = JoinKeyHash<Slice>::hash(data[i]);
+            }
+            const uint32_t log_bucket_size = table_items->log_bucket_size;
+            _construct_hash_table(table_items,
+                                  [&](size_t i) { return JoinKeyHash<Slice>::bucket(key_hashes[i], log_bucket_size); });
+            return;
+        }
+    }
+    _construct_hash_table(table_items, [&](size_t i) {
+        return JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size,
+                                                           table_items->log_bucket_size);
+    });
+}
+
+template <LogicalType LT>
+template <typename BucketFunc>
+void JoinBuildFunc<LT>::_construct_hash_table(JoinHashTableItems* table_items, BucketFunc&& bucket_of) {
     if (table_items->key_columns[0]->is_nullable() && table_items->key_columns[0]->has_null()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         const auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             if (null_array[i] == 0) {
-                const uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(
-                        data[i], table_items->bucket_size, table_items->log_bucket_size);
+                const uint32_t bucket_num = bucket_of(i);
                 table_items->next[i] = table_items->first[bucket_num];
                 table_items->first[bucket_num] = i;
             }
@@ -73,10 +94,8 @@ void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableI
     } else {
         auto* __restrict next = table_items->next.data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            const uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size,
-                                                                                    table_items->log_bucket_size);
             // Use `next` stores `bucket_num` temporarily.
-            next[i] = bucket_num;
+            next[i] = bucket_of(i);
         }
 
         auto* __restrict first = table_items->first.data();
@@ -96,8 +115,8 @@ void DirectMappingJoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTabl
             (int64_t)(RunTimeTypeLimits<LT>::max_value()) - (int64_t)(RunTimeTypeLimits<LT>::min_value()) + 1L;
     table_items->bucket_size = BUCKET_SIZE;
     table_items->log_bucket_size = __builtin_ctz(table_items->bucket_size);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_random_access_buffer(&table_items->first, table_items->bucket_size, 0u);
+    resize_random_access_buffer(&table_items->next, table_items->row_count + 1, 0u);
 }
 
 template <LogicalType LT>
@@ -141,8 +160,8 @@ template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->log_bucket_size = __builtin_ctz(table_items->bucket_size);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    resize_random_access_buffer(&table_items->first, table_items->bucket_size, 0u);
+    resize_random_access_buffer(&table_items->next, table_items->row_count + 1, 0u);
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
@@ -365,6 +384,12 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, table_items.log_bucket_size,
                                                  &probe_state->buckets, 0, row_count);
     probe_state->null_array = nullptr;
+    if (_enable_probe_prefetch(table_items)) {
+        JoinHashMapHelper::lookup_first_with_prefetch<CppType>(table_items.first, probe_state->buckets,
+                                                               FixedSizeJoinBuildFunc<LT>().get_key_data(table_items),
+                                                               nullptr, row_count, &probe_state->next);
+        return;
+    }
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -391,6 +416,12 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, table_items.log_bucket_size,
                                                  &probe_state->buckets, 0, row_count);
+    if (_enable_probe_prefetch(table_items)) {
+        JoinHashMapHelper::lookup_first_with_prefetch<CppType>(
+                table_items.first, probe_state->buckets, FixedSizeJoinBuildFunc<LT>().get_key_data(table_items),
+                probe_state->is_nulls.data(), row_count, &probe_state->next);
+        return;
+    }
 
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
@@ -776,6 +776,12 @@ Status ChunkPredicateBuilder<E, Type>::normalize_join_runtime_filter(const SlotD
             rt_ranger_params.add_unarrived_rf(desc, &slot, _opts.driver_sequence);
             continue;
         }
+        // The bound of a topn filter keeps tightening while the topn consumes its input, the range normalized here is
+        // only a snapshot. Also hand it to the runtime range pruner, which pushes every newer version down to the
+        // zone maps, page indexes and row group stats of the data still to be read.
+        if (desc->is_stream_build_filter()) {
+            rt_ranger_params.add_unarrived_rf(desc, &slot, _opts.driver_sequence);
+        }
 
         // If this column doesn't have other filter, we use join runtime filter
         // to fast comput row range in storage engine
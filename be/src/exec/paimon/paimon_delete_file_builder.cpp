@@ -20,6 +20,7 @@
 #include <bitset>
 
 #include "connector/deletion_vector/deletion_bitmap.h"
+#include "connector/deletion_vector/deletion_bitmap_cache.h"
 #include "util/raw_container.h"
 
 namespace starrocks {
@@ -30,6 +31,13 @@ Status PaimonDeleteFileBuilder::build(const TPaimonDeletionFile* paimon_deletion
     auto& offset = paimon_deletion_file->offset;
     auto serialized_bitmap_length = length - MAGIC_NUMBER_LENGTH;
 
+    // Each deletion vector in the deletion file belongs to one data file, so the range identifies it.
+    const std::string cache_key = DeletionBitmapCache::make_key(path, offset, length, {});
+    if (auto cached = DeletionBitmapCache::instance()->lookup(cache_key); cached != nullptr) {
+        _skip_rows_ctx->deletion_bitmap = std::move(cached);
+        return Status::OK();
+    }
+
     std::shared_ptr<RandomAccessFile> raw_deletion_vector;
     ASSIGN_OR_RETURN(raw_deletion_vector, _fs->new_random_access_file(path));
 
@@ -60,6 +68,7 @@ Status PaimonDeleteFileBuilder::build(const TPaimonDeletionFile* paimon_deletion
             roaring_bitmap_portable_deserialize_safe(deletion_vector.get(), serialized_bitmap_length);
     roaring64_bitmap_t* bitmap64 = roaring64_bitmap_move_from_roaring32(bitmap);
     _skip_rows_ctx->deletion_bitmap = std::make_shared<DeletionBitmap>(bitmap64);
+    DeletionBitmapCache::instance()->insert(cache_key, _skip_rows_ctx->deletion_bitmap);
 
     roaring_bitmap_free(bitmap);
     return Status::OK();
@@ -14,13 +14,17 @@
 
 #include "exec/pipeline/adaptive/collect_stats_context.h"
 
+#include <limits>
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/adaptive_dop_param.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/adaptive/utils.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
 
@@ -35,6 +39,7 @@ bool BlockState::need_input(int32_t driver_seq) const {
 
 Status BlockState::push_chunk(int32_t driver_seq, ChunkPtr chunk) {
     size_t num_chunk_rows = chunk->num_rows();
+    _num_bytes += chunk->memory_usage();
     _ctx->_buffer_chunk_queue(driver_seq).emplace(std::move(chunk));
     size_t prev_num_rows = _num_rows.fetch_add(num_chunk_rows);
 
@@ -65,12 +70,36 @@ Status BlockState::set_finishing(int32_t driver_seq) {
     adjusted_dop = compute_max_le_power2(adjusted_dop);
     adjusted_dop = std::max<size_t>(1, adjusted_dop);
     adjusted_dop = std::min<size_t>(adjusted_dop, _ctx->_upstream_dop);
+    if (config::enable_adaptive_dop_memory_aware) {
+        adjusted_dop = _cap_dop_by_memory(adjusted_dop);
+    }
 
     _ctx->_transform_state(CollectStatsStateEnum::ROUND_ROBIN, adjusted_dop);
 
     return Status::OK();
 }
 
+size_t BlockState::_cap_dop_by_memory(size_t dop) const {
+    const size_t num_bytes = _num_bytes;
+    MemTracker* tracker = _ctx->_runtime_state->query_mem_tracker_ptr().get();
+    if (dop <= 1 || num_bytes == 0 || tracker == nullptr) {
+        return dop;
+    }
+    // The hash tables of aggregation and join are built per driver, and each of them may hold all the distinct keys
+    // in the worst case.
+    int64_t headroom = std::numeric_limits<int64_t>::max();
+    for (; tracker != nullptr; tracker = tracker->parent()) {
+        if (tracker->has_limit()) {
+            headroom = std::min(headroom, tracker->limit() - tracker->consumption());
+        }
+    }
+    if (headroom >= static_cast<int64_t>(num_bytes * dop)) {
+        return dop;
+    }
+    size_t affordable_dop = headroom > 0 ? headroom / num_bytes : 1;
+    return std::max<size_t>(1, compute_max_le_power2(std::min(affordable_dop, dop)));
+}
+
 bool BlockState::is_downstream_finished(int32_t driver_seq) const {
     return false;
 }
@@ -153,8 +153,12 @@ public:
     Status set_finishing(int32_t driver_seq) override;
 
 private:
+    // Cap the DOP, so that each downstream driver can hold all the collected input within the remaining memory.
+    size_t _cap_dop_by_memory(size_t dop) const;
+
     std::atomic<int> _num_finished_seqs = 0;
     std::atomic<size_t> _num_rows = 0;
+    std::atomic<size_t> _num_bytes = 0;
     const size_t _max_buffer_rows;
 };
 
@@ -130,6 +130,15 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const Chun
     _aggregator->update_num_input_rows(chunk_size);
     RETURN_IF_ERROR(_aggregator->check_has_error());
 
+    // Without any aggregate function, the groups are the whole output and the rest of the input can only hit them,
+    // so finish the sink to let the driver short-circuit the upstream operators.
+    if (_agg_group_by_with_limit && _aggregator->agg_fn_ctxs().empty() &&
+        (_aggregator->hash_map_variant().size() >= _aggregator->limit() ||
+         (_aggregator->params()->enable_pipeline_share_limit &&
+          _shared_limit_countdown.load(std::memory_order_relaxed) <= 0))) {
+        (void)set_finishing(state);
+    }
+
     return Status::OK();
 }
 
@@ -29,6 +29,12 @@ Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::LIMITED_MEM) {
         _limited_mem_state.limited_memory_size = config::streaming_agg_limited_memory_size;
     }
+    _ndv_sampling = config::streaming_agg_ndv_sample_chunks > 0 && !_aggregator->is_none_group_by_exprs() &&
+                    (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::AUTO ||
+                     _aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::LIMITED_MEM);
+    if (_ndv_sampling) {
+        _sampled_ndv_counter = ADD_COUNTER(_unique_metrics, "SampledKeyNDV", TUnit::UNIT);
+    }
     RETURN_IF_ERROR(_aggregator->open(state));
     _aggregator->attach_sink_observer(state, this->_observer);
     return Status::OK();
@@ -174,14 +180,48 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  *
  * SELECTIVE_PREAGG state aggregates continuous_limit chunks, then shifting to ADJUST state.
  */
+/* Before the state machine gets its first measurement, the NDV of group by keys is estimated by a HLL sketch over
+ * the first config::streaming_agg_ndv_sample_chunks chunks, and the initial state is committed by the NDV ratio:
+ * (1) nearly unique keys shift to PASS_THROUGH, so no memory is wasted on them;
+ * (2) highly duplicated keys stay in INIT_PREAGG and expand the hash table up to MaxHtSize;
+ * (3) otherwise shift to SELECTIVE_PREAGG, only the hot keys already in the hash table are aggregated.
+ */
+void AggregateStreamingSinkOperator::_sample_ndv(const size_t chunk_size) {
+    if (!_auto_context.sample_ndv(_aggregator->group_by_columns(), chunk_size,
+                                  config::streaming_agg_ndv_sample_chunks)) {
+        return;
+    }
+    _ndv_sampling = false;
+
+    double ndv_ratio = _auto_context.sampled_ndv_ratio();
+    if (ndv_ratio >= AggrAutoContext::HighNdvRatio) {
+        _auto_state = AggrAutoState::PASS_THROUGH;
+        _auto_context.pass_through_count = 0;
+    } else if (ndv_ratio <= AggrAutoContext::LowNdvRatio) {
+        _auto_context.low_ndv = true;
+    } else {
+        _auto_state = AggrAutoState::SELECTIVE_PREAGG;
+        _auto_context.selective_preagg_count = 0;
+    }
+    COUNTER_SET(_sampled_ndv_counter, _auto_context.ndv_sketch.estimate_cardinality());
+    _unique_metrics->add_info_string("SampledKeyNDVRatio", std::to_string(ndv_ratio));
+    _unique_metrics->add_info_string("SampledAutoState", _auto_context.get_auto_state_string(_auto_state));
+    VLOG_ROW << "auto agg: sampled ndv ratio " << ndv_ratio << " in " << _auto_context.ndv_sampled_rows << " rows "
+             << _auto_context.get_auto_state_string(AggrAutoState::INIT_PREAGG) << " -> "
+             << _auto_context.get_auto_state_string(_auto_state);
+}
+
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
+    if (_ndv_sampling && _auto_state == AggrAutoState::INIT_PREAGG) {
+        _sample_ndv(chunk_size);
+    }
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
     const size_t continuous_limit = _auto_context.get_continuous_limit();
     switch (_auto_state) {
     case AggrAutoState::INIT_PREAGG: {
         bool ht_needs_expansion = _aggregator->hash_map_variant().need_expand(chunk_size);
         _auto_context.init_preagg_count++;
-        if (!ht_needs_expansion ||
+        if (!ht_needs_expansion || (_auto_context.low_ndv && allocated_bytes < AggrAutoContext::MaxHtSize) ||
             _aggregator->should_expand_preagg_hash_tables(_aggregator->num_input_rows(), chunk_size, allocated_bytes,
                                                           _aggregator->hash_map_variant().size())) {
             // hash table is not full or allow to expand the hash table according reduction rate
@@ -70,6 +70,9 @@ private:
 
     Status _push_chunk_by_selective_preaggregation(const ChunkPtr& chunk, const size_t chunk_size, bool need_build);
 
+    // Sample the NDV of group by keys over the first chunks, and commit the auto state by the NDV ratio.
+    void _sample_ndv(const size_t chunk_size);
+
     // Invoked by push_chunk  if current mode is TStreamingPreaggregationMode::LIMITED
     Status _push_chunk_by_limited_memory(const ChunkPtr& chunk, const size_t chunk_size);
 
@@ -84,6 +87,8 @@ private:
     AggrAutoState _auto_state{};
     AggrAutoContext _auto_context;
     LimitedMemAggState _limited_mem_state;
+    bool _ndv_sampling = false;
+    RuntimeProfile::Counter* _sampled_ndv_counter = nullptr;
 
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 };
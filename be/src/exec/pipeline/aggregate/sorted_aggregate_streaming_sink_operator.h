@@ -60,6 +60,8 @@ public:
 
     ~SortedAggregateStreamingSinkOperatorFactory() override = default;
 
+    bool support_event_scheduler() const override { return true; }
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
 private:
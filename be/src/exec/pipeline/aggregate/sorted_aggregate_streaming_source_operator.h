@@ -29,6 +29,7 @@ public:
     Status set_finishing(RuntimeState* state) override;
     Status set_finished(RuntimeState* state) override;
 
+    Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
@@ -47,6 +48,8 @@ public:
 
     ~SortedAggregateStreamingSourceOperatorFactory() override = default;
 
+    bool support_event_scheduler() const override { return true; }
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
 private:
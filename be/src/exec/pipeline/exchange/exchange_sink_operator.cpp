@@ -71,6 +71,9 @@ public:
     Status send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence, bool eos,
                           bool* is_real_sent);
 
+    // Hand over the chunk to the pass through buffer without cloning it, only used when the channel uses pass through.
+    Status send_one_chunk(RuntimeState* state, ChunkUniquePtr chunk, int32_t driver_sequence);
+
     // Channel will sent input request directly without batch it.
     // This function is only used when broadcast, because request can be reused
     // by all the channels.
@@ -106,6 +109,7 @@ private:
 
     bool _check_use_pass_through();
     void _prepare_pass_through();
+    void _update_pass_through_bytes(size_t chunk_size);
 
     ExchangeSinkOperator* _parent;
 
@@ -197,9 +201,16 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t d
     }
 
     if (_chunks[driver_sequence]->num_rows() + size > state->chunk_size()) {
-        RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
-        // we only clear column data, because we need to reuse column schema
-        _chunks[driver_sequence]->set_num_rows(0);
+        if (_use_pass_through && config::enable_exchange_pass_through_without_clone) {
+            // hand over the batched chunk to the pass through buffer, and batch the following rows in a new one
+            ChunkUniquePtr batched_chunk = std::move(_chunks[driver_sequence]);
+            _chunks[driver_sequence] = batched_chunk->clone_empty_with_slot(size);
+            RETURN_IF_ERROR(send_one_chunk(state, std::move(batched_chunk), driver_sequence));
+        } else {
+            RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
+            // we only clear column data, because we need to reuse column schema
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
     }
 
     {
@@ -242,9 +253,7 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
             TRY_CATCH_BAD_ALLOC(
                     _pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
                                                        _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
-            _current_request_bytes += chunk_size;
-            COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
-            COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
+            _update_pass_through_bytes(chunk_size);
         } else {
             if (_parent->_is_pipeline_level_shuffle) {
                 _chunk_request->add_driver_sequences(driver_sequence);
@@ -273,6 +282,27 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
     return Status::OK();
 }
 
+Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, ChunkUniquePtr chunk,
+                                                     int32_t driver_sequence) {
+    DCHECK(_use_pass_through);
+    if (_ignore_local_data) {
+        return Status::OK();
+    }
+    size_t chunk_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
+    // -1 means disable pipeline level shuffle
+    TRY_CATCH_BAD_ALLOC(_pass_through_context.append_chunk(_parent->_sender_id, std::move(chunk), chunk_size,
+                                                           _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
+    _update_pass_through_bytes(chunk_size);
+    // the chunk is already in the pass through buffer, only try to send the request
+    return send_one_chunk(state, nullptr, driver_sequence, false);
+}
+
+void ExchangeSinkOperator::Channel::_update_pass_through_bytes(size_t chunk_size) {
+    _current_request_bytes += chunk_size;
+    COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
+    COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
+}
+
 Status ExchangeSinkOperator::Channel::send_chunk_request(RuntimeState* state, PTransmitChunkParamsPtr chunk_request,
                                                          const butil::IOBuf& attachment,
                                                          int64_t attachment_physical_bytes) {
@@ -307,7 +337,12 @@ Status ExchangeSinkOperator::Channel::_close_internal(RuntimeState* state, Fragm
 
     if (!fragment_ctx->is_canceled()) {
         for (auto driver_sequence = 0; driver_sequence < _chunks.size(); ++driver_sequence) {
-            if (_chunks[driver_sequence] != nullptr) {
+            if (_chunks[driver_sequence] == nullptr) {
+                continue;
+            }
+            if (_use_pass_through && config::enable_exchange_pass_through_without_clone) {
+                RETURN_IF_ERROR(res = send_one_chunk(state, std::move(_chunks[driver_sequence]), driver_sequence));
+            } else {
                 RETURN_IF_ERROR(res = send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
             }
         }
@@ -434,6 +469,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _unique_metrics->add_info_string("ShuffleNumPerChannel", std::to_string(_num_shuffles_per_channel));
         _unique_metrics->add_info_string("TotalShuffleNum", std::to_string(_num_shuffles));
         _unique_metrics->add_info_string("PipelineLevelShuffle", _is_pipeline_level_shuffle ? "Yes" : "No");
+        if (_part_type == TPartitionType::HASH_PARTITIONED && config::exchange_shuffle_skew_sample_rows > 0) {
+            _skew_detector = std::make_unique<ShuffleSkewDetector>(kShuffleSkewDetectorCapacity);
+        }
     }
 
     // Randomize the order we open/transmit to channels to avoid thundering herd problems.
@@ -591,6 +629,11 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
                 }
             }
 
+            if (_skew_detector != nullptr &&
+                static_cast<int64_t>(_skew_detector->num_rows()) < config::exchange_shuffle_skew_sample_rows) {
+                _skew_detector->update(_hash_values, num_rows);
+            }
+
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
@@ -662,6 +705,11 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
         }
     }
 
+    if (_skew_detector != nullptr && _skew_detector->num_rows() > 0) {
+        _unique_metrics->add_info_string("ShuffleSkewSampledRows", std::to_string(_skew_detector->num_rows()));
+        _unique_metrics->add_info_string("ShuffleHotKeyRatio", fmt::format("{:.2f}", _skew_detector->hot_key_ratio()));
+    }
+
     _buffer->set_finishing();
     return status;
 }
@@ -763,9 +811,16 @@ int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkPara
         auto chunk = chunk_request->mutable_chunks(i);
         chunk->set_data_size(chunk->data().size());
 
-        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
-        attachment.append(chunk->data());
-        attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+        if (config::enable_exchange_zero_copy_attachment && chunk->data().size() >= kZeroCopyAttachmentMinBytes) {
+            // Move the data into the attachment as user data, it's released once brpc doesn't reference it.
+            auto* data = new std::string(std::move(*chunk->mutable_data()));
+            attachment_physical_bytes += data->capacity();
+            attachment.append_user_data(data->data(), data->size(), [data](void*) { delete data; });
+        } else {
+            int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+            attachment.append(chunk->data());
+            attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+        }
 
         chunk->clear_data();
         // If the request is too big, free the memory in order to avoid OOM
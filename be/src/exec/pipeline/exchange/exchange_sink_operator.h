@@ -83,11 +83,15 @@ public:
     Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
 
     // Return the physical bytes of attachment.
+    // The chunk data no less than kZeroCopyAttachmentMinBytes is moved into the attachment without copying.
     int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
 
     std::string get_name() const override;
 
 private:
+    // Copying is cheaper than a user data block of IOBuf for the small data.
+    static constexpr size_t kZeroCopyAttachmentMinBytes = 8192;
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -207,6 +211,9 @@ private:
     // channel 0's row first, then channel 1's row indexes, then put channel 2's row indexes in
     // the last.
     std::vector<uint32_t> _row_indexes;
+    // Samples the hash values of the first rows to report the hot keys of the shuffle.
+    static constexpr size_t kShuffleSkewDetectorCapacity = 32;
+    std::unique_ptr<ShuffleSkewDetector> _skew_detector;
 
     FragmentContext* const _fragment_ctx;
 
@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/exchange/exchange_source_operator.h"
 
+#include "common/config.h"
 #include "glog/logging.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/data_stream_recvr.h"
@@ -28,27 +29,75 @@ Status ExchangeSourceOperator::prepare(RuntimeState* state) {
     _stream_recvr->bind_profile(_driver_sequence, _unique_metrics);
     _stream_recvr->attach_observer(state, observer());
     _stream_recvr->attach_query_ctx(state->query_ctx());
+    _coalesce_input_chunks_counter = ADD_COUNTER(_unique_metrics, "CoalesceInputChunks", TUnit::UNIT);
+    _coalesce_output_chunks_counter = ADD_COUNTER(_unique_metrics, "CoalesceOutputChunks", TUnit::UNIT);
     return Status::OK();
 }
 
 bool ExchangeSourceOperator::has_output() const {
-    return _stream_recvr->has_output_for_pipeline(_driver_sequence);
+    return _pending_chunk != nullptr || _stream_recvr->has_output_for_pipeline(_driver_sequence);
 }
 
 bool ExchangeSourceOperator::is_finished() const {
-    return _stream_recvr->is_finished();
+    return _pending_chunk == nullptr && _stream_recvr->is_finished();
 }
 
 Status ExchangeSourceOperator::set_finishing(RuntimeState* state) {
     _is_finishing = true;
+    _pending_chunk.reset();
     _stream_recvr->short_circuit_for_pipeline(_driver_sequence);
     static_cast<ExchangeSourceOperatorFactory*>(_factory)->close_stream_recvr();
     return Status::OK();
 }
 
+// Only the chunks whose columns are all materialized could be appended to each other.
+static bool can_coalesce_chunk(const Chunk& chunk) {
+    if (chunk.has_extra_data()) {
+        return false;
+    }
+    for (const auto& column : chunk.columns()) {
+        if (column->is_constant()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status ExchangeSourceOperator::_coalesce_small_chunks(RuntimeState* state, ChunkUniquePtr* chunk) {
+    const size_t chunk_size = state->chunk_size();
+    if (*chunk == nullptr || (*chunk)->num_rows() >= chunk_size / 2 || !can_coalesce_chunk(**chunk)) {
+        return Status::OK();
+    }
+    // only the chunks already in the queue are coalesced, so it never waits for the senders.
+    size_t num_input_chunks = 1;
+    while ((*chunk)->num_rows() < chunk_size / 2) {
+        ChunkUniquePtr next_chunk;
+        RETURN_IF_ERROR(_stream_recvr->get_chunk_for_pipeline(&next_chunk, _driver_sequence));
+        if (next_chunk == nullptr) {
+            break;
+        }
+        if ((*chunk)->num_rows() + next_chunk->num_rows() > chunk_size ||
+            (*chunk)->num_columns() != next_chunk->num_columns() || !can_coalesce_chunk(*next_chunk)) {
+            _pending_chunk = std::move(next_chunk);
+            break;
+        }
+        (*chunk)->append_safe(*next_chunk);
+        num_input_chunks++;
+    }
+    COUNTER_UPDATE(_coalesce_input_chunks_counter, num_input_chunks);
+    COUNTER_UPDATE(_coalesce_output_chunks_counter, 1);
+    return Status::OK();
+}
+
 StatusOr<ChunkPtr> ExchangeSourceOperator::pull_chunk(RuntimeState* state) {
-    auto chunk = std::make_unique<Chunk>();
-    RETURN_IF_ERROR(_stream_recvr->get_chunk_for_pipeline(&chunk, _driver_sequence));
+    auto chunk = std::move(_pending_chunk);
+    if (chunk == nullptr) {
+        chunk = std::make_unique<Chunk>();
+        RETURN_IF_ERROR(_stream_recvr->get_chunk_for_pipeline(&chunk, _driver_sequence));
+    }
+    if (config::enable_exchange_source_coalesce_chunks) {
+        RETURN_IF_ERROR(_coalesce_small_chunks(state, &chunk));
+    }
     RETURN_IF_ERROR(eval_no_eq_join_runtime_in_filters(chunk.get()));
     eval_runtime_bloom_filters(chunk.get());
     return std::move(chunk);
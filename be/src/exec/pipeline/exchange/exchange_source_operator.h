@@ -42,8 +42,16 @@ public:
     std::string get_name() const override;
 
 private:
+    // Coalesce the following small chunks that are already received into `chunk`, up to chunk_size rows.
+    Status _coalesce_small_chunks(RuntimeState* state, ChunkUniquePtr* chunk);
+
     std::shared_ptr<DataStreamRecvr> _stream_recvr = nullptr;
     std::atomic<bool> _is_finishing = false;
+
+    // The received chunk that doesn't fit into the last coalesced chunk, it's returned by the next pull_chunk.
+    ChunkUniquePtr _pending_chunk;
+    RuntimeProfile::Counter* _coalesce_input_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _coalesce_output_chunks_counter = nullptr;
 };
 
 class ExchangeSourceOperatorFactory final : public SourceOperatorFactory {
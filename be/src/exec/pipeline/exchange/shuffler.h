@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "gen_cpp/Partitions_types.h"
@@ -102,4 +104,57 @@ private:
     const size_t _num_channels;
     const size_t _num_shuffles_per_channel;
 };
+
+// Detects the hot keys of a hash shuffle with the Misra-Gries heavy hitter sketch on the hash values of the
+// sampled rows. A key is only counted when its hash value is tracked by one of the `capacity` counters, so the
+// frequency is a lower bound, which underestimates by at most num_rows / (capacity + 1).
+class ShuffleSkewDetector {
+public:
+    explicit ShuffleSkewDetector(size_t capacity) : _capacity(capacity) { _counters.reserve(capacity); }
+
+    void update(const std::vector<uint32_t>& hash_values, size_t num_rows) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            _update(hash_values[i]);
+        }
+        _num_rows += num_rows;
+    }
+
+    size_t num_rows() const { return _num_rows; }
+
+    // The ratio of the rows of the hottest key among all the sampled rows.
+    double hot_key_ratio() const {
+        if (_num_rows == 0) {
+            return 0;
+        }
+        size_t max_count = 0;
+        for (const auto& [_, count] : _counters) {
+            max_count = std::max(max_count, count);
+        }
+        return static_cast<double>(max_count) / _num_rows;
+    }
+
+private:
+    void _update(uint32_t hash_value) {
+        for (auto& [value, count] : _counters) {
+            if (value == hash_value) {
+                ++count;
+                return;
+            }
+        }
+        if (_counters.size() < _capacity) {
+            _counters.emplace_back(hash_value, 1);
+            return;
+        }
+        for (auto& counter : _counters) {
+            --counter.second;
+        }
+        _counters.erase(std::remove_if(_counters.begin(), _counters.end(),
+                                       [](const auto& counter) { return counter.second == 0; }),
+                        _counters.end());
+    }
+
+    const size_t _capacity;
+    std::vector<std::pair<uint32_t, size_t>> _counters;
+    size_t _num_rows = 0;
+};
 } // namespace starrocks::pipeline
@@ -17,6 +17,7 @@
 #include <bthread/bthread.h>
 
 #include <chrono>
+#include <iterator>
 #include <mutex>
 #include <string_view>
 
@@ -52,6 +53,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             ctx.max_continuous_acked_seqs = -1;
             ctx.num_finished_rpcs = 0;
             ctx.num_in_flight_rpcs = 0;
+            ctx.in_flight_window = config::pipeline_sink_brpc_dop;
             ctx.dest_addrs = dest.brpc_server;
 
             PUniqueId finst_id;
@@ -108,14 +110,14 @@ Status SinkBuffer::add_request(TransmitChunkInfo& request) {
         auto& instance_id = request.fragment_instance_id;
         auto& context = sink_ctx(instance_id.lo);
 
-        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { context.buffer.push(request); }));
+        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { context.buffer.push_back(request); }));
     }
 
     return Status::OK();
 }
 
 bool SinkBuffer::is_full() const {
-    // std::queue' read is concurrent safe without mutex
+    // std::list's size is concurrent safe without mutex
     // Judgement may not that accurate because we do not known in advance which
     // instance the data to be sent corresponds to
     size_t max_buffer_size = config::pipeline_sink_buffer_size * _sink_ctxs.size();
@@ -255,6 +257,75 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+void SinkBuffer::_update_in_flight_window(const TUniqueId& instance_id, const int64_t receiver_post_process_time) {
+    if (_is_dest_merge) {
+        return;
+    }
+    auto& context = sink_ctx(instance_id.lo);
+    const int64_t max_window = config::pipeline_sink_brpc_dop;
+    if (!config::enable_pipeline_sink_adaptive_window) {
+        context.in_flight_window = max_window;
+        return;
+    }
+    if (receiver_post_process_time > config::pipeline_sink_receiver_busy_threshold_ms * 1000000L) {
+        context.in_flight_window = std::max<int64_t>(1, std::min(context.in_flight_window, max_window) / 2);
+    } else {
+        context.in_flight_window = std::min(context.in_flight_window + 1, max_window);
+    }
+}
+
+void SinkBuffer::_merge_buffered_requests(SinkContext& context, TransmitChunkInfo& request, int64_t num_sinkers) {
+    const int64_t max_bytes = config::pipeline_sink_merge_request_max_bytes;
+    auto& params = *request.params;
+    // The chunks of a pass through request are in the local buffer, not in the request.
+    if (max_bytes <= 0 || params.eos() || params.use_pass_through()) {
+        return;
+    }
+    auto& buffer = context.buffer;
+    DCHECK(!buffer.empty() && &buffer.front() == &request);
+    while (buffer.size() > 1) {
+        auto it = std::next(buffer.begin());
+        auto& next_params = *it->params;
+        if (next_params.use_pass_through() || next_params.sender_id() != params.sender_id() ||
+            next_params.be_number() != params.be_number() ||
+            next_params.is_pipeline_level_shuffle() != params.is_pipeline_level_shuffle() ||
+            (next_params.has_query_statistics() && params.has_query_statistics()) ||
+            request.attachment.size() + it->attachment.size() > static_cast<size_t>(max_bytes)) {
+            break;
+        }
+        if (next_params.eos()) {
+            // Only the eos of the last sinker is sent, the eos requests of the others only carry their chunks.
+            if (num_sinkers <= 1) {
+                break;
+            }
+            --num_sinkers;
+            --context.num_sinker;
+            // Can not be the last eos, the eos of the last sinker of this instance is still not sent.
+            --_num_remaining_eos;
+        }
+
+        if (!it->attachment.empty()) {
+            incr_sent_bytes(static_cast<int64_t>(it->attachment.size()));
+            _request_sent++;
+        }
+        for (auto& chunk : *next_params.mutable_chunks()) {
+            params.add_chunks()->Swap(&chunk);
+        }
+        for (auto driver_sequence : next_params.driver_sequences()) {
+            params.add_driver_sequences(driver_sequence);
+        }
+        if (next_params.has_query_statistics()) {
+            params.mutable_query_statistics()->Swap(next_params.mutable_query_statistics());
+        }
+        request.attachment.append(it->attachment);
+        request.attachment_physical_bytes += it->attachment_physical_bytes;
+
+        // The request memory is acquired by ExchangeSinkOperator, release it by the instance_mem_tracker.
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        buffer.erase(it);
+    }
+}
+
 Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works) {
     auto& context = sink_ctx(instance_id.lo);
     std::lock_guard guard(context.mutex);
@@ -278,7 +349,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             int64_t discontinuous_acked_window_size = context.request_seq - context.max_continuous_acked_seqs;
             too_much_brpc_process = discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
         } else {
-            too_much_brpc_process = context.num_in_flight_rpcs >= config::pipeline_sink_brpc_dop;
+            too_much_brpc_process =
+                    context.num_in_flight_rpcs >= std::min(context.in_flight_window, config::pipeline_sink_brpc_dop);
         }
         if (buffer.empty() || too_much_brpc_process) {
             return Status::OK();
@@ -295,7 +367,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             // so use the instance_mem_tracker passed from ExchangeSinkOperator to release memory.
             // This must be invoked before decrease_defer desctructed to avoid sink_buffer and fragment_ctx released.
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
-            buffer.pop();
+            buffer.pop_front();
         });
 
         // The order of data transmiting in IO level may not be strictly the same as
@@ -306,6 +378,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             return Status::OK();
         }
 
+        bool is_sinker_eos = false;
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
                 if (need_wait) {
@@ -325,6 +398,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                     continue;
                 } else {
                     request.params->set_eos(false);
+                    is_sinker_eos = true;
                 }
             } else {
                 // The order of data transmiting in IO level may not be strictly the same as
@@ -354,6 +428,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             }
         }
 
+        _merge_buffered_requests(context, request, context.num_sinker - (is_sinker_eos ? 1 : 0));
+
         *request.params->mutable_finst_id() = context.finst_id;
         request.params->set_sequence(++context.request_seq);
 
@@ -405,6 +481,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
                     _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
                     _process_send_window(ctx.instance_id, ctx.sequence);
+                    _update_in_flight_window(ctx.instance_id, result.receiver_post_process_time());
                 }));
             }
         });
@@ -123,6 +123,16 @@ private:
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
+    // Adjust the in-flight rpc window of the destination by its receiver's pressure. The receiver holds the response
+    // while its buffer is full, so a long receiver_post_process_time halves the window, otherwise it grows by one
+    // up to pipeline_sink_brpc_dop.
+    void _update_in_flight_window(const TUniqueId& instance_id, const int64_t receiver_post_process_time);
+
+    struct SinkContext;
+    // Merge the requests queued behind `request`, the front of the buffer of `context`, into it, so that they are
+    // sent by one rpc. `num_sinkers` is the number of sinkers that have not sent eos, excluding the one of `request`
+    // if it is an eos, the eos of the last sinker is not merged.
+    void _merge_buffered_requests(SinkContext& context, TransmitChunkInfo& request, int64_t num_sinkers);
 
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
@@ -168,11 +178,13 @@ private:
         // The request needs the reference to the allocated finst id,
         // so cache finst id for each dest fragment instance.
         PUniqueId finst_id;
-        std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>> buffer;
+        std::list<TransmitChunkInfo> buffer;
         Mutex request_mutex;
 
         std::atomic_size_t num_finished_rpcs;
         std::atomic_size_t num_in_flight_rpcs;
+        // The max number of in-flight rpcs, only used if the receiver is not ExchangeMergeSortSourceOperator
+        int64_t in_flight_window;
         TimeTrace network_time;
 
         Mutex mutex;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "exec/partition/chunks_partitioner.h"
+#include "exec/pipeline/schedule/observer.h"
 #include "storage/chunk_helper.h"
 #include "util/runtime_profile.h"
 
@@ -50,6 +51,8 @@ public:
 
     int32_t num_partitions() const { return _chunks_partitioner->num_partitions(); }
 
+    PipeObservable& observable() { return _observable; }
+
 private:
     bool _has_nullable_key = false;
     const std::vector<TExpr>& _t_partition_exprs;
@@ -63,6 +66,8 @@ private:
     std::unique_ptr<MemPool> _mem_pool;
 
     ChunkPipelineAccumulator _acc;
+
+    PipeObservable _observable;
 };
 
 class HashPartitionContextFactory {
@@ -19,6 +19,7 @@ namespace starrocks::pipeline {
 Status HashPartitionSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _partition_num = ADD_COUNTER(_unique_metrics, "PartitionNumber", TUnit::UNIT);
+    _hash_partition_ctx->observable().attach_sink_observer(state, observer());
     return _hash_partition_ctx->prepare(state, _unique_metrics.get());
 }
 
@@ -27,11 +28,13 @@ StatusOr<ChunkPtr> HashPartitionSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status HashPartitionSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    auto notify = _hash_partition_ctx->observable().defer_notify_source();
     return _hash_partition_ctx->push_one_chunk_to_partitioner(state, chunk);
 }
 
 Status HashPartitionSinkOperator::set_finishing(RuntimeState* state) {
     ONCE_DETECT(_set_finishing_once);
+    auto notify = _hash_partition_ctx->observable().defer_notify_source();
     _hash_partition_ctx->sink_complete();
     COUNTER_UPDATE(_partition_num, _hash_partition_ctx->num_partitions());
     _is_finished = true;
@@ -16,6 +16,12 @@
 
 namespace starrocks::pipeline {
 
+Status HashPartitionSourceOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(SourceOperator::prepare(state));
+    _hash_partition_ctx->observable().attach_source_observer(state, observer());
+    return Status::OK();
+}
+
 bool HashPartitionSourceOperator::has_output() const {
     return _hash_partition_ctx->has_output();
 }
@@ -28,6 +28,8 @@ public:
 
     ~HashPartitionSourceOperator() override = default;
 
+    Status prepare(RuntimeState* state) override;
+
     bool has_output() const override;
 
     bool is_finished() const override;
@@ -45,6 +47,8 @@ public:
 
     ~HashPartitionSourceOperatorFactory() override = default;
 
+    bool support_event_scheduler() const override { return true; }
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
 private:
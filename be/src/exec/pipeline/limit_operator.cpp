@@ -36,9 +36,9 @@ Status LimitOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
 
     if (num_consume_rows != chunk->num_rows()) {
         // In case of multi cast exchange chunks could be used in multiple pipelines with different limits and should
-        // not be updated in place.
+        // not be updated in place. The columns are shared and only the kept rows are copied.
         if (!_limit_chunk_in_place) {
-            _cur_chunk = chunk->clone_unique();
+            _cur_chunk = chunk->clone_shared();
         }
         _cur_chunk->set_num_rows(num_consume_rows);
     }
@@ -237,6 +237,12 @@ Status NLJoinContext::finish_one_right_sinker(int32_t sinker_id, RuntimeState* s
 
         if (!_build_stream_builder.has_spilled()) {
             _build_chunks = _build_stream_builder.build();
+            if (_range_spec.has_value() && _num_build_rows > 0) {
+                ChunkPtr sorted_chunk;
+                ASSIGN_OR_RETURN(_range_index, NLJoinRangeIndex::build(*_range_spec, _range_build_slots,
+                                                                       _build_chunks, &sorted_chunk));
+                _build_chunks = {std::move(sorted_chunk)};
+            }
             RETURN_IF_ERROR(_init_runtime_filter(state));
         } else {
             _notify_runtime_filter_collector(state);
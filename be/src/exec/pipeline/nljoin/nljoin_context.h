@@ -17,12 +17,14 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/serde.h"
@@ -167,6 +169,14 @@ public:
 
     int get_build_chunk_size() const { return _build_chunk_desired_size; }
 
+    // Set by the probe factory of an inner join before any build, the build chunks are then replaced by the single
+    // chunk sorted by the range index when the build side has not spilled.
+    void set_range_join_spec(const NLJoinRangeSpec& spec, std::vector<SlotDescriptor*> build_slots) {
+        _range_spec = spec;
+        _range_build_slots = std::move(build_slots);
+    }
+    const NLJoinRangeIndex* range_index() const { return _range_index.get(); }
+
     Status append_build_chunk(int32_t sinker_id, const ChunkPtr& build_chunk);
     size_t channel_num_rows(int32_t sinker_id);
     NJJoinBuildInputChannel& input_channel(int32_t sinker_id) { return *_input_channel[sinker_id]; }
@@ -220,6 +230,9 @@ private:
     int _build_chunk_desired_size = 0;
     int _num_post_probers = 0;
     Filter _shared_build_match_flag;
+    std::optional<NLJoinRangeSpec> _range_spec;
+    std::vector<SlotDescriptor*> _range_build_slots;
+    std::unique_ptr<NLJoinRangeIndex> _range_index;
 
     // conjuncts in cross join, used for generate runtime_filter
     std::vector<ExprContext*> _rf_conjuncts_ctx;
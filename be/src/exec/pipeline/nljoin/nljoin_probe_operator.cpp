@@ -18,6 +18,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -500,6 +501,48 @@ ChunkPtr NLJoinProbeOperator::_permute_chunk_for_inner_join(size_t chunk_size) {
     return result_chunk;
 }
 
+// Permute every probe row with its candidate rows of the sorted build chunk only, the join conjuncts are still
+// evaluated on the result. A probe row with more candidates than `chunk_size` is continued by the next call.
+ChunkPtr NLJoinProbeOperator::_permute_chunk_for_range_join(size_t chunk_size) {
+    ChunkPtr result_chunk = _init_output_chunk(chunk_size);
+    const NLJoinRangeIndex* range_index = _cross_join_context->range_index();
+    const Column& probe_column = *_probe_chunk->get_column_by_slot_id(range_index->spec().probe_slot);
+    const size_t probe_rows = _probe_chunk->num_rows();
+
+    _range_probe_selection.clear();
+    _range_build_selection.clear();
+    while (_probe_row_current < probe_rows && _range_build_selection.size() < chunk_size) {
+        if (!_range_candidates_ready) {
+            auto [first, end] = range_index->candidates(probe_column, _probe_row_current);
+            _build_row_current = first;
+            _range_build_end = std::max(first, end);
+            _range_candidates_ready = true;
+        }
+        size_t num_rows = std::min(_range_build_end - _build_row_current, chunk_size - _range_build_selection.size());
+        _range_probe_selection.insert(_range_probe_selection.end(), num_rows, _probe_row_current);
+        for (size_t i = 0; i < num_rows; i++) {
+            _range_build_selection.emplace_back(_build_row_current + i);
+        }
+        _build_row_current += num_rows;
+        if (_build_row_current >= _range_build_end) {
+            _probe_row_current++;
+            _range_candidates_ready = false;
+        }
+    }
+
+    const size_t num_rows = _range_build_selection.size();
+    for (size_t i = 0; i < _col_types.size(); i++) {
+        SlotId slot_id = _col_types[i]->id();
+        bool is_probe = i < _probe_column_count;
+        const auto& selection = is_probe ? _range_probe_selection : _range_build_selection;
+        Chunk* src_chunk = is_probe ? _probe_chunk.get() : _curr_build_chunk;
+        result_chunk->get_column_by_slot_id(slot_id)->append_selective(*src_chunk->get_column_by_slot_id(slot_id),
+                                                                        selection.data(), 0, num_rows);
+    }
+    COUNTER_UPDATE(_permute_rows_counter, num_rows);
+    return result_chunk;
+}
+
 void NLJoinProbeOperator::_permute_chunk_base_left(ChunkPtr* chunk) {
     for (size_t i = 0; i < _probe_column_count; i++) {
         SlotId slot_id = _col_types[i]->id();
@@ -728,8 +771,10 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_inner_join(size_t chunk_
         return chunk;
     }
 
+    const bool use_range_index = _cross_join_context->range_index() != nullptr;
     while (!_is_curr_probe_chunk_finished()) {
-        ChunkPtr chunk = _permute_chunk_for_inner_join(chunk_size);
+        ChunkPtr chunk =
+                use_range_index ? _permute_chunk_for_range_join(chunk_size) : _permute_chunk_for_inner_join(chunk_size);
         DCHECK(chunk);
         RETURN_IF_ERROR(_probe_for_inner_join(chunk));
         RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
@@ -762,6 +807,7 @@ Status NLJoinProbeOperator::push_chunk(RuntimeState* state, const ChunkPtr& chun
     _probe_row_current = 0;
     _probe_row_matched = false;
     _probe_row_finished = false;
+    _range_candidates_ready = false;
     _reset_build_chunk_index();
 
     return Status::OK();
@@ -817,6 +863,13 @@ Status NLJoinProbeOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
 
+    if (_join_op == TJoinOp::INNER_JOIN && config::enable_nljoin_range_index) {
+        if (auto spec = NLJoinRangeSpec::extract(_join_conjuncts, _col_types, _probe_column_count)) {
+            std::vector<SlotDescriptor*> build_slots(_col_types.begin() + _probe_column_count, _col_types.end());
+            _cross_join_context->set_range_join_spec(*spec, std::move(build_slots));
+        }
+    }
+
     return Status::OK();
 }
 
@@ -90,6 +90,7 @@ private:
     Status _permute_probe_row(const ChunkPtr& chunk);
     StatusOr<ChunkPtr> _permute_chunk_for_other_join(size_t chunk_size);
     ChunkPtr _permute_chunk_for_inner_join(size_t chunk_size);
+    ChunkPtr _permute_chunk_for_range_join(size_t chunk_size);
     void _permute_chunk_base_left(ChunkPtr* chunk);
     void _permute_chunk_base_right(ChunkPtr* chunk);
     Status _permute_right_join(size_t chunk_size);
@@ -129,6 +130,12 @@ private:
     size_t _build_row_current = 0;
     mutable Filter _self_build_match_flag;
 
+    // Range join states, the candidate build rows of the current probe row end at `_range_build_end`
+    bool _range_candidates_ready = false;
+    size_t _range_build_end = 0;
+    Buffer<uint32_t> _range_probe_selection;
+    Buffer<uint32_t> _range_build_selection;
+
     // Probe states
     ChunkPtr _probe_chunk = nullptr;
     bool _probe_row_matched = false;  // For multi build-chunk, whether this probe row matched any join conjuncts
@@ -0,0 +1,236 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/const_column.h"
+#include "column/type_traits.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/Exprs_types.h"
+#include "runtime/descriptors.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+
+namespace starrocks::pipeline {
+
+static bool is_supported_type(LogicalType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::optional<NLJoinRangeSpec> NLJoinRangeSpec::extract(const std::vector<ExprContext*>& join_conjuncts,
+                                                        const std::vector<SlotDescriptor*>& col_types,
+                                                        size_t probe_column_count) {
+    auto is_probe_slot = [&](SlotId slot_id) {
+        return std::any_of(col_types.begin(), col_types.begin() + probe_column_count,
+                           [&](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+    };
+    auto is_build_slot = [&](SlotId slot_id) {
+        return std::any_of(col_types.begin() + probe_column_count, col_types.end(),
+                           [&](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+    };
+
+    // (probe slot, build slot) of `probe >= build` and `probe <= build`, the strict ones included
+    std::vector<std::pair<SlotId, SlotId>> lower_bounds;
+    std::vector<std::pair<SlotId, SlotId>> upper_bounds;
+    for (ExprContext* ctx : join_conjuncts) {
+        const Expr* root = ctx->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+            continue;
+        }
+        const Expr* left = root->get_child(0);
+        const Expr* right = root->get_child(1);
+        if (!left->is_slotref() || !right->is_slotref() || left->type().type != right->type().type ||
+            !is_supported_type(left->type().type)) {
+            continue;
+        }
+        SlotId left_slot = down_cast<const ColumnRef*>(left)->slot_id();
+        SlotId right_slot = down_cast<const ColumnRef*>(right)->slot_id();
+        TExprOpcode::type op = root->op();
+        // normalize to `probe op build`
+        if (is_build_slot(left_slot) && is_probe_slot(right_slot)) {
+            std::swap(left_slot, right_slot);
+            switch (op) {
+            case TExprOpcode::LT:
+                op = TExprOpcode::GT;
+                break;
+            case TExprOpcode::LE:
+                op = TExprOpcode::GE;
+                break;
+            case TExprOpcode::GT:
+                op = TExprOpcode::LT;
+                break;
+            case TExprOpcode::GE:
+                op = TExprOpcode::LE;
+                break;
+            default:
+                break;
+            }
+        } else if (!is_probe_slot(left_slot) || !is_build_slot(right_slot)) {
+            continue;
+        }
+        if (op == TExprOpcode::GE || op == TExprOpcode::GT) {
+            lower_bounds.emplace_back(left_slot, right_slot);
+        } else if (op == TExprOpcode::LE || op == TExprOpcode::LT) {
+            upper_bounds.emplace_back(left_slot, right_slot);
+        }
+    }
+
+    for (const auto& [probe_slot, lo_slot] : lower_bounds) {
+        for (const auto& [upper_probe_slot, hi_slot] : upper_bounds) {
+            if (probe_slot != upper_probe_slot) {
+                continue;
+            }
+            auto it = std::find_if(col_types.begin(), col_types.end(),
+                                   [&](const SlotDescriptor* slot) { return slot->id() == probe_slot; });
+            return NLJoinRangeSpec{probe_slot, lo_slot, hi_slot, (*it)->type().type};
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+static int64_t to_ordered_int64(const T& v) {
+    return static_cast<int64_t>(v);
+}
+
+static int64_t to_ordered_int64(const DateValue& v) {
+    return v.julian();
+}
+
+static int64_t to_ordered_int64(const TimestampValue& v) {
+    return v.timestamp();
+}
+
+template <LogicalType LT>
+static int64_t value_at(const Column& column, size_t row) {
+    return to_ordered_int64(ColumnHelper::get_data_column_by_type<LT>(&column)->get_data()[row]);
+}
+
+bool NLJoinRangeIndex::to_int64(LogicalType type, const Column& column, size_t row, int64_t* value) {
+    if (column.only_null() || column.is_null(row)) {
+        return false;
+    }
+    if (column.is_constant()) {
+        return to_int64(type, *down_cast<const ConstColumn&>(column).data_column(), 0, value);
+    }
+    switch (type) {
+    case TYPE_TINYINT:
+        *value = value_at<TYPE_TINYINT>(column, row);
+        return true;
+    case TYPE_SMALLINT:
+        *value = value_at<TYPE_SMALLINT>(column, row);
+        return true;
+    case TYPE_INT:
+        *value = value_at<TYPE_INT>(column, row);
+        return true;
+    case TYPE_BIGINT:
+        *value = value_at<TYPE_BIGINT>(column, row);
+        return true;
+    case TYPE_DATE:
+        *value = value_at<TYPE_DATE>(column, row);
+        return true;
+    case TYPE_DATETIME:
+        *value = value_at<TYPE_DATETIME>(column, row);
+        return true;
+    default:
+        return false;
+    }
+}
+
+StatusOr<std::unique_ptr<NLJoinRangeIndex>> NLJoinRangeIndex::build(const NLJoinRangeSpec& spec,
+                                                                    const std::vector<SlotDescriptor*>& build_slots,
+                                                                    const std::vector<ChunkPtr>& build_chunks,
+                                                                    ChunkPtr* sorted_chunk) {
+    auto merged = std::make_shared<Chunk>();
+    for (const SlotDescriptor* slot : build_slots) {
+        bool nullable = slot->is_nullable();
+        for (const auto& chunk : build_chunks) {
+            nullable |= chunk->is_column_nullable(slot->id());
+        }
+        merged->append_column(ColumnHelper::create_column(slot->type(), nullable), slot->id());
+    }
+    for (const auto& chunk : build_chunks) {
+        for (const SlotDescriptor* slot : build_slots) {
+            merged->get_column_by_slot_id(slot->id())->append(*chunk->get_column_by_slot_id(slot->id()));
+        }
+    }
+
+    const size_t num_rows = merged->num_rows();
+    const Column& lo_column = *merged->get_column_by_slot_id(spec.lo_slot);
+    const Column& hi_column = *merged->get_column_by_slot_id(spec.hi_slot);
+    std::vector<int64_t> lo(num_rows);
+    std::vector<int64_t> hi(num_rows);
+    std::vector<uint32_t> rows;
+    rows.reserve(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (!to_int64(spec.type, lo_column, i, &lo[i]) || !to_int64(spec.type, hi_column, i, &hi[i])) {
+            continue;
+        }
+        if (lo[i] <= hi[i]) {
+            rows.emplace_back(i);
+        }
+    }
+    std::stable_sort(rows.begin(), rows.end(), [&](uint32_t lhs, uint32_t rhs) { return lo[lhs] < lo[rhs]; });
+
+    std::unique_ptr<NLJoinRangeIndex> index(new NLJoinRangeIndex(spec));
+    index->_lo.reserve(rows.size());
+    index->_prefix_max_hi.reserve(rows.size());
+    int64_t max_hi = std::numeric_limits<int64_t>::min();
+    for (uint32_t row : rows) {
+        max_hi = std::max(max_hi, hi[row]);
+        index->_lo.emplace_back(lo[row]);
+        index->_prefix_max_hi.emplace_back(max_hi);
+    }
+
+    ChunkPtr sorted = merged->clone_empty(rows.size());
+    sorted->append_selective(*merged, rows.data(), 0, rows.size());
+    *sorted_chunk = std::move(sorted);
+    return index;
+}
+
+std::pair<uint32_t, uint32_t> NLJoinRangeIndex::candidates(int64_t value) const {
+    // the rows with lo <= value
+    auto end = std::upper_bound(_lo.begin(), _lo.end(), value) - _lo.begin();
+    // skip the rows whose hi, and the hi of all the rows before them, are less than value
+    auto begin = std::lower_bound(_prefix_max_hi.begin(), _prefix_max_hi.begin() + end, value) -
+                 _prefix_max_hi.begin();
+    return {static_cast<uint32_t>(begin), static_cast<uint32_t>(end)};
+}
+
+std::pair<uint32_t, uint32_t> NLJoinRangeIndex::candidates(const Column& probe_column, size_t row) const {
+    int64_t value = 0;
+    if (!to_int64(_spec.type, probe_column, row, &value)) {
+        return {0, 0};
+    }
+    return candidates(value);
+}
+
+} // namespace starrocks::pipeline
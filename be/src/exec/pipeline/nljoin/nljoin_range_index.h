@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "common/statusor.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+class ExprContext;
+class SlotDescriptor;
+} // namespace starrocks
+
+namespace starrocks::pipeline {
+
+// A band join condition of the join conjuncts, `probe >= lo AND probe <= hi` where `lo` and `hi` are build columns,
+// e.g. `a.ts BETWEEN b.start AND b.end` or `a.ip >= b.ip_from AND a.ip < b.ip_to`. Strict comparisons are treated
+// as inclusive, the conjuncts are still evaluated on the candidate rows.
+struct NLJoinRangeSpec {
+    SlotId probe_slot = -1;
+    SlotId lo_slot = -1;
+    SlotId hi_slot = -1;
+    LogicalType type = TYPE_UNKNOWN;
+
+    // Extract the band condition from the conjuncts of an inner join, the first `probe_column_count` slots of
+    // `col_types` are of the probe side. Only the integer and date types are supported.
+    static std::optional<NLJoinRangeSpec> extract(const std::vector<ExprContext*>& join_conjuncts,
+                                                  const std::vector<SlotDescriptor*>& col_types,
+                                                  size_t probe_column_count);
+};
+
+// The build rows of a band join sorted by `lo`, with the prefix max of `hi`. The candidate rows of a probe value `p`
+// are the rows with `lo <= p` (a prefix of the sorted rows) whose prefix max `hi` is not less than `p` (a suffix
+// of it). For the mostly disjoint intervals of IP ranges or sessions the candidates are a handful of rows, instead
+// of the whole build side of the nested loop.
+class NLJoinRangeIndex {
+public:
+    // Sort the rows of `build_chunks` into `sorted_chunk`, whose columns are of `build_slots`. The rows with a null
+    // bound never match and are dropped.
+    static StatusOr<std::unique_ptr<NLJoinRangeIndex>> build(const NLJoinRangeSpec& spec,
+                                                             const std::vector<SlotDescriptor*>& build_slots,
+                                                             const std::vector<ChunkPtr>& build_chunks,
+                                                             ChunkPtr* sorted_chunk);
+
+    const NLJoinRangeSpec& spec() const { return _spec; }
+
+    // The candidate rows [first, second) of `sorted_chunk` for the row `row` of the probe column.
+    std::pair<uint32_t, uint32_t> candidates(const Column& probe_column, size_t row) const;
+
+    std::pair<uint32_t, uint32_t> candidates(int64_t value) const;
+
+    // Map the value of an integer or date column to int64_t with its order kept, return false for a null value.
+    static bool to_int64(LogicalType type, const Column& column, size_t row, int64_t* value);
+
+private:
+    explicit NLJoinRangeIndex(NLJoinRangeSpec spec) : _spec(spec) {}
+
+    NLJoinRangeSpec _spec;
+    std::vector<int64_t> _lo;
+    std::vector<int64_t> _prefix_max_hi;
+};
+
+} // namespace starrocks::pipeline
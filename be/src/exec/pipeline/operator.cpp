@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
@@ -85,6 +86,12 @@ Status Operator::prepare(RuntimeState* state) {
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
     _pull_chunk_bytes_counter = ADD_COUNTER(_common_metrics, "OutputChunkBytes", TUnit::UNIT);
+    if (config::enable_pipeline_operator_perf_counters) {
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+            auto event = static_cast<PerfEventCounters::Event>(i);
+            _perf_event_counters[i] = ADD_COUNTER(_common_metrics, PerfEventCounters::event_name(event), TUnit::UNIT);
+        }
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
@@ -99,6 +106,13 @@ void Operator::set_prepare_time(int64_t cost_ns) {
     _prepare_timer->set(cost_ns);
 }
 
+void Operator::update_perf_event_counters(const PerfEventCounters::Values& begin,
+                                          const PerfEventCounters::Values& end) {
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+        COUNTER_UPDATE(_perf_event_counters[i], end[i] - begin[i]);
+    }
+}
+
 void Operator::set_precondition_ready(RuntimeState* state) {
     _runtime_in_filters = _factory->get_colocate_runtime_in_filters(_driver_sequence);
     _factory->prepare_runtime_in_filters(state);
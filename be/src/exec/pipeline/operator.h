@@ -24,6 +24,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -202,6 +203,10 @@ public:
 
     void set_prepare_time(int64_t cost_ns);
 
+    // Whether the hardware events of the pull_chunk/push_chunk calls are attributed to this operator.
+    bool has_perf_event_counters() const { return _perf_event_counters[0] != nullptr; }
+    void update_perf_event_counters(const PerfEventCounters::Values& begin, const PerfEventCounters::Values& end);
+
     // INCREMENTAL MV Methods
     //
     // The operator will run periodically which is triggered by FE from PREPARED to EPOCH_FINISHED in one Epoch,
@@ -325,6 +330,8 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    // Only created when config::enable_pipeline_operator_perf_counters is on.
+    std::array<RuntimeProfile::Counter*, PerfEventCounters::NUM_EVENTS> _perf_event_counters{};
 
     // only used in spillable operator to record peak revocable memory bytes,
     // each operator should initialize it before use
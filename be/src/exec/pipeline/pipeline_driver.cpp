@@ -36,16 +36,38 @@
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/column_allocator.h"
 #include "runtime/runtime_state.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::pipeline {
 DEFINE_FAIL_POINT(operator_return_large_column);
 
+// Attribute the hardware events of the calling thread within the scope to the operator.
+class ScopedOperatorPerfEvents {
+public:
+    explicit ScopedOperatorPerfEvents(Operator* op) {
+        if (op->has_perf_event_counters() && PerfEventCounters::thread_local_instance()->read(&_begin)) {
+            _op = op;
+        }
+    }
+    ~ScopedOperatorPerfEvents() {
+        PerfEventCounters::Values end;
+        if (_op != nullptr && PerfEventCounters::thread_local_instance()->read(&end)) {
+            _op->update_perf_event_counters(_begin, end);
+        }
+    }
+
+private:
+    Operator* _op = nullptr;
+    PerfEventCounters::Values _begin;
+};
+
 PipelineDriver::~PipelineDriver() noexcept {
     if (_workgroup != nullptr) {
         _workgroup->decr_num_running_drivers();
@@ -82,6 +104,9 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     });
 
     _runtime_state = runtime_state;
+    if (config::pipeline_driver_column_pool_bytes > 0) {
+        _column_pool_allocator = std::make_unique<ColumnPoolAllocator>(config::pipeline_driver_column_pool_bytes);
+    }
 
     auto* prepare_timer = ADD_TIMER_WITH_THRESHOLD(_runtime_profile, "DriverPrepareTime", 1_ms);
     SCOPED_TIMER(prepare_timer);
@@ -264,6 +289,9 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
         scan->begin_driver_process();
     }
 
+    ThreadLocalColumnAllocatorSetter column_allocator_setter(
+            _column_pool_allocator != nullptr ? _column_pool_allocator.get() : tls_column_allocator);
+
     while (true) {
         RETURN_IF_LIMIT_EXCEEDED(runtime_state, "Pipeline");
 
@@ -323,6 +351,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
+                    ScopedOperatorPerfEvents perf_events(curr_op);
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
                 return_status = maybe_chunk.status();
@@ -368,6 +397,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         {
                             SCOPED_TIMER(next_op->_push_timer);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
+                            ScopedOperatorPerfEvents perf_events(next_op);
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
@@ -706,6 +736,8 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state) {
     DCHECK(state == DriverState::FINISH || state == DriverState::CANCELED || state == DriverState::INTERNAL_ERROR);
     QUERY_TRACE_BEGIN("finalize", _driver_name);
     _close_operators(runtime_state);
+    // free the pooled buffers while the mem tracker of the fragment is still installed
+    _column_pool_allocator.reset();
 
     set_driver_state(state);
 
@@ -36,6 +36,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "fmt/printf.h"
 #include "runtime/mem_tracker.h"
+#include "runtime/memory/column_pool_allocator.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks {
@@ -468,6 +469,8 @@ public:
     void set_in_queue(DriverQueue* in_queue) { _in_queue = in_queue; }
     size_t get_driver_queue_level() const { return _driver_queue_level; }
     void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
+    size_t get_driver_queue_shard() const { return _driver_queue_shard; }
+    void set_driver_queue_shard(size_t driver_queue_shard) { _driver_queue_shard = driver_queue_shard; }
 
     inline bool is_in_ready() const { return _in_ready.load(std::memory_order_acquire); }
     void set_in_ready(bool v) {
@@ -584,6 +587,8 @@ protected:
     DriverQueue* _in_queue = nullptr;
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
+    // The index of WorkStealingDriverQueue._shards which this driver belongs to.
+    size_t _driver_queue_shard = 0;
     // Indicates whether it is in a ready queue.
     std::atomic<bool> _in_ready{false};
     // Indicates whether it is in a block states. Only used when enable event scheduler mode.
@@ -599,6 +604,9 @@ protected:
 
     std::unique_ptr<PipelineTimerTask> _global_rf_timer;
 
+    // reuse the column buffers of the chunks processed by this driver, see `pipeline_driver_column_pool_bytes`
+    std::unique_ptr<ColumnPoolAllocator> _column_pool_allocator;
+
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
     RuntimeProfile::Counter* _active_timer = nullptr;
@@ -22,6 +22,7 @@
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -37,10 +38,9 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
                                            bool enable_resource_group, const CpuUtil::CpuIds& cpuids,
                                            PipelineExecutorMetrics* metrics)
         : Base("pip_exec_" + name),
-          _driver_queue(enable_resource_group
-                                ? std::unique_ptr<DriverQueue>(
-                                          std::make_unique<WorkGroupDriverQueue>(metrics->get_driver_queue_metrics()))
-                                : std::make_unique<QuerySharedDriverQueue>(metrics->get_driver_queue_metrics())),
+          _numa_node_cpuids(_split_numa_node_cpuids(cpuids)),
+          _driver_queue(_create_driver_queue(enable_resource_group, thread_pool->max_threads(),
+                                             _numa_node_cpuids.size(), metrics->get_driver_queue_metrics())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(
                   new PipelineDriverPoller(name, _driver_queue.get(), cpuids, metrics->get_poller_metrics())),
@@ -48,6 +48,37 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
           _audit_statistics_reporter(new AuditStatisticsReporter()),
           _metrics(metrics->get_driver_executor_metrics()) {}
 
+DriverQueuePtr GlobalDriverExecutor::_create_driver_queue(bool enable_resource_group, int num_threads,
+                                                          size_t num_numa_nodes, DriverQueueMetrics* metrics) {
+    if (enable_resource_group) {
+        // The fairness among workgroups is kept by WorkGroupDriverQueue.
+        return std::make_unique<WorkGroupDriverQueue>(metrics);
+    }
+    if (config::pipeline_driver_queue_enable_work_stealing || num_numa_nodes > 1) {
+        return std::make_unique<WorkStealingDriverQueue>(metrics, std::max(1, num_threads),
+                                                         std::max<size_t>(1, num_numa_nodes));
+    }
+    return std::make_unique<QuerySharedDriverQueue>(metrics);
+}
+
+std::vector<CpuUtil::CpuIds> GlobalDriverExecutor::_split_numa_node_cpuids(const CpuUtil::CpuIds& cpuids) {
+    std::vector<CpuUtil::CpuIds> numa_node_cpuids;
+    if (!config::pipeline_enable_numa_aware_executor || CpuInfo::get_max_num_numa_nodes() <= 1) {
+        return numa_node_cpuids;
+    }
+    auto node_cpuids = CpuUtil::split_by_numa_node(cpuids.empty() ? CpuInfo::get_core_ids() : cpuids);
+    for (auto& ids : node_cpuids) {
+        if (!ids.empty()) {
+            numa_node_cpuids.emplace_back(std::move(ids));
+        }
+    }
+    // There is nothing to do when all the cpus are on a single node.
+    if (numa_node_cpuids.size() <= 1) {
+        numa_node_cpuids.clear();
+    }
+    return numa_node_cpuids;
+}
+
 void GlobalDriverExecutor::close() {
     _driver_queue->close();
     _thread_pool->wait();
@@ -82,6 +113,12 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    if (!_numa_node_cpuids.empty()) {
+        // Each worker thread is pinned to the cpus of one NUMA node in a round-robin way, so the drivers
+        // taken from the node-local shards of the driver queue run on, and allocate from, the same node.
+        const auto& cpuids = _numa_node_cpuids[worker_id % _numa_node_cpuids.size()];
+        CpuUtil::bind_current_thread_to_numa_node(CpuInfo::get_numa_node_for_core(cpuids[0]), cpuids);
+    }
     std::queue<DriverRawPtr> local_driver_queue;
     while (true) {
         if (local_driver_queue.empty() && _num_threads_setter.should_shrink()) {
@@ -91,6 +128,7 @@ void GlobalDriverExecutor::_worker_thread() {
         CurrentThread::current().set_query_id({});
         CurrentThread::current().set_fragment_instance_id({});
         CurrentThread::current().set_pipeline_driver_id(0);
+        CurrentThread::current().set_workgroup_id(-1);
 
         if (current_thread != nullptr) {
             current_thread->set_idle(true);
@@ -117,6 +155,7 @@ void GlobalDriverExecutor::_worker_thread() {
         _metrics->driver_schedule_count.increment(1);
 
         SCOPED_SET_TRACE_INFO(driver->driver_id(), query_ctx->query_id(), fragment_ctx->fragment_instance_id());
+        CurrentThread::current().set_workgroup_id(driver->workgroup() != nullptr ? driver->workgroup()->id() : -1);
 
         SET_THREAD_LOCAL_QUERY_TRACE_CONTEXT(query_ctx->query_trace(), fragment_ctx->fragment_instance_id(), driver);
 
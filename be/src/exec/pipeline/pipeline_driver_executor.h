@@ -97,6 +97,10 @@ public:
 
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
+    static DriverQueuePtr _create_driver_queue(bool enable_resource_group, int num_threads, size_t num_numa_nodes,
+                                               DriverQueueMetrics* metrics);
+    // Return the non-empty cpuids of each NUMA node, or empty if NUMA-aware executor is disabled or unnecessary.
+    static std::vector<CpuUtil::CpuIds> _split_numa_node_cpuids(const CpuUtil::CpuIds& cpuids);
     void _worker_thread();
     StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
@@ -110,6 +114,8 @@ private:
     static constexpr int64_t LOCAL_MAX_WAIT_TIME_SPENT_NS = 1'000'000L;
 
     LimitSetter _num_threads_setter;
+    // The cpuids of each NUMA node the worker threads are pinned to, only used in NUMA-aware mode.
+    const std::vector<CpuUtil::CpuIds> _numa_node_cpuids;
     std::unique_ptr<DriverQueue> _driver_queue;
     // _thread_pool must be placed after _driver_queue, because worker threads in _thread_pool use _driver_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
@@ -18,6 +18,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::pipeline {
 
@@ -211,6 +212,225 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
     return nullptr;
 }
 
+/// WorkStealingDriverQueue.
+WorkStealingDriverQueue::WorkStealingDriverQueue(DriverQueueMetrics* metrics, size_t num_shards,
+                                                 size_t num_numa_nodes)
+        : FactoryMethod(metrics), _num_numa_nodes(std::max<size_t>(1, std::min(num_shards, num_numa_nodes))) {
+    num_shards = std::max<size_t>(1, num_shards);
+    _shards.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; ++i) {
+        auto shard = std::make_unique<Shard>();
+        for (auto& queue : shard->queues) {
+            queue.set_metrics(metrics);
+        }
+        _shards.emplace_back(std::move(shard));
+    }
+
+    double factor = 1;
+    for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
+        _level_factors[i] = factor;
+        factor *= RATIO_OF_ADJACENT_QUEUE;
+    }
+
+    int64_t time_slice = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        time_slice += LEVEL_TIME_SLICE_BASE_NS * (i + 1);
+        _level_time_slices[i] = time_slice;
+        _level_accu_time[i] = 0;
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    std::lock_guard<std::mutex> lock(_park_mutex);
+    _is_closed = true;
+    _park_cv.notify_all();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    size_t shard_idx = _next_put_shard.fetch_add(1, std::memory_order_relaxed) % _shards.size();
+    _put_back_to_shard(shard_idx, driver);
+    _notify_parked();
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (const auto driver : drivers) {
+        size_t shard_idx = _next_put_shard.fetch_add(1, std::memory_order_relaxed) % _shards.size();
+        _put_back_to_shard(shard_idx, driver);
+    }
+    _notify_parked();
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    // Keep the driver in the home shard of the executor thread, which is likely to take it again
+    // with the warm cache, unless it is stolen by an idle thread.
+    _put_back_to_shard(_home_shard(), driver);
+    _notify_parked();
+}
+
+void WorkStealingDriverQueue::_put_back_to_shard(size_t shard_idx, const DriverRawPtr driver) {
+    int level = _compute_driver_level(driver);
+    driver->set_driver_queue_level(level);
+    auto& shard = *_shards[shard_idx];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        DCHECK(!driver->is_in_ready());
+        driver->update_peak_driver_queue_size_counter(_num_drivers.load(std::memory_order_relaxed));
+        shard.queues[level].put(driver);
+        driver->set_driver_queue_shard(shard_idx);
+        driver->set_in_ready(true);
+        driver->set_in_queue(this);
+        shard.num_drivers.fetch_add(1, std::memory_order_release);
+    }
+    _num_drivers.fetch_add(1);
+    _metrics->driver_queue_len.increment(1);
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    const size_t home_idx = _home_shard();
+    const size_t num_shards = _shards.size();
+    while (true) {
+        if (_is_closed.load(std::memory_order_acquire)) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        if (auto* driver = _take_from_shard(home_idx, false); driver != nullptr) {
+            return driver;
+        }
+        // Steal from the other shards, the shards of the same NUMA node first.
+        // Skip the busy ones at the first round to avoid contention.
+        const size_t home_node = home_idx % _num_numa_nodes;
+        const int num_passes = _num_numa_nodes > 1 ? 2 : 1;
+        for (int pass = 0; pass < num_passes; ++pass) {
+            for (int round = 0; round < 2; ++round) {
+                for (size_t i = 1; i < num_shards; ++i) {
+                    const size_t idx = (home_idx + i) % num_shards;
+                    if (num_passes > 1 && ((idx % _num_numa_nodes == home_node) != (pass == 0))) {
+                        continue;
+                    }
+                    if (auto* driver = _take_from_shard(idx, round == 0); driver != nullptr) {
+                        return driver;
+                    }
+                }
+            }
+        }
+
+        if (!block) {
+            return nullptr;
+        }
+
+        std::unique_lock<std::mutex> lock(_park_mutex);
+        // _num_parked must be increased before checking _num_drivers, which pairs with _notify_parked().
+        _num_parked.fetch_add(1);
+        _park_cv.wait(lock, [this] { return _is_closed.load() || _num_drivers.load() > 0; });
+        _num_parked.fetch_sub(1);
+    }
+}
+
+DriverRawPtr WorkStealingDriverQueue::_take_from_shard(size_t shard_idx, bool try_lock) {
+    auto& shard = *_shards[shard_idx];
+    if (shard.num_drivers.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (try_lock) {
+        if (!lock.try_lock()) {
+            return nullptr;
+        }
+    } else {
+        lock.lock();
+    }
+
+    // Find the queue with the smallest execution time.
+    int queue_idx = -1;
+    double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        if (!shard.queues[i].empty()) {
+            double local_target_time = _level_accu_time[i].load(std::memory_order_relaxed) / _level_factors[i];
+            if (queue_idx < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                queue_idx = i;
+            }
+        }
+    }
+    if (queue_idx < 0) {
+        return nullptr;
+    }
+
+    DriverRawPtr driver = shard.queues[queue_idx].take(false);
+    driver->set_in_ready(false);
+    shard.num_drivers.fetch_sub(1, std::memory_order_release);
+    _num_drivers.fetch_sub(1);
+    _metrics->driver_queue_len.increment(-1);
+    return driver;
+}
+
+void WorkStealingDriverQueue::_notify_parked() {
+    if (_num_parked.load() > 0) {
+        std::lock_guard<std::mutex> lock(_park_mutex);
+        _park_cv.notify_one();
+    }
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    if (_is_closed.load(std::memory_order_acquire)) {
+        return;
+    }
+    if (!driver->is_in_ready()) {
+        return;
+    }
+    auto& shard = *_shards[driver->get_driver_queue_shard() % _shards.size()];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        // The driver may be taken or moved to another shard before the lock is acquired.
+        if (!driver->is_in_ready() || _shards[driver->get_driver_queue_shard()].get() != &shard) {
+            return;
+        }
+        shard.queues[driver->get_driver_queue_level()].cancel(driver);
+    }
+    _notify_parked();
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _level_accu_time[driver->get_driver_queue_level()].fetch_add(driver->driver_acct().get_last_time_spent(),
+                                                                 std::memory_order_relaxed);
+}
+
+int WorkStealingDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
+    int time_spent = driver->driver_acct().get_accumulated_time_spent();
+    for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
+        if (time_spent < _level_time_slices[i]) {
+            return i;
+        }
+    }
+
+    return QUEUE_SIZE - 1;
+}
+
+size_t WorkStealingDriverQueue::_home_shard() {
+    // An executor thread only serves one driver queue, but the queue may be recreated in the tests,
+    // so the owner is recorded together with the shard index.
+    struct HomeShard {
+        const WorkStealingDriverQueue* owner = nullptr;
+        size_t idx = 0;
+    };
+    static thread_local HomeShard home;
+    if (home.owner != this) {
+        home.owner = this;
+        const size_t seq = _next_home_shard.fetch_add(1, std::memory_order_relaxed);
+        const size_t num_shards = _shards.size();
+        if (_num_numa_nodes <= 1) {
+            home.idx = seq % num_shards;
+        } else {
+            // Pick a shard belonging to the NUMA node where the thread is running.
+            const size_t node = CpuInfo::get_current_numa_node() % _num_numa_nodes;
+            const size_t num_node_shards = (num_shards - node + _num_numa_nodes - 1) / _num_numa_nodes;
+            home.idx = node + _num_numa_nodes * (seq % num_node_shards);
+        }
+    }
+    return home.idx;
+}
+
 /// WorkGroupDriverQueue.
 bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
         const WorkGroupDriverSchedEntityPtr& lhs_ptr, const WorkGroupDriverSchedEntityPtr& rhs_ptr) const {
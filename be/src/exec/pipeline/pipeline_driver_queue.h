@@ -150,6 +150,81 @@ private:
     bool _is_closed = false;
 };
 
+// WorkStealingDriverQueue keeps the multilevel feedback semantics of QuerySharedDriverQueue,
+// but splits the ready drivers into several shards, each guarded by its own mutex.
+// - Each executor thread is bound to a home shard on its first take(). The drivers put back by
+//   an executor thread go to its home shard, and the drivers from the poller are spread round-robin.
+// - take() looks at the home shard first, and steals from the other shards when it is empty.
+// - If there are multiple NUMA nodes, the i-th shard belongs to the (i % num_numa_nodes)-th node.
+//   The home shard is picked from the node the thread is running on, and the shards of the same node
+//   are stolen from before the remote ones.
+// - The accumulated time of each level is shared by all the shards, so the level selection is
+//   the same as QuerySharedDriverQueue.
+// - Idle threads park on a single condition variable, which is only touched when there are parked threads.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    WorkStealingDriverQueue(DriverQueueMetrics* metrics, size_t num_shards, size_t num_numa_nodes = 1);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    size_t size() const override { return _num_drivers.load(std::memory_order_acquire); }
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
+
+    size_t num_shards() const { return _shards.size(); }
+
+    static constexpr size_t QUEUE_SIZE = QuerySharedDriverQueue::QUEUE_SIZE;
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        SubQuerySharedDriverQueue queues[QUEUE_SIZE];
+        // Only read without lock as a hint by the thieves.
+        std::atomic<size_t> num_drivers = 0;
+    };
+
+    int _compute_driver_level(const DriverRawPtr driver) const;
+    size_t _home_shard();
+    void _put_back_to_shard(size_t shard_idx, const DriverRawPtr driver);
+    // Take a driver from the shard, return nullptr if the shard is empty.
+    // If *try_lock* is true, give up when the mutex of the shard is held by the others.
+    DriverRawPtr _take_from_shard(size_t shard_idx, bool try_lock);
+    void _notify_parked();
+
+private:
+    const int64_t LEVEL_TIME_SLICE_BASE_NS = config::pipeline_driver_queue_level_time_slice_base_ns;
+    const double RATIO_OF_ADJACENT_QUEUE = QuerySharedDriverQueue::ratio_of_adjacent_queue();
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    const size_t _num_numa_nodes;
+    // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns.
+    int64_t _level_time_slices[QUEUE_SIZE];
+    // The accumulated time of the i-th level, which is shared by all the shards.
+    std::atomic<int64_t> _level_accu_time[QUEUE_SIZE];
+    double _level_factors[QUEUE_SIZE];
+
+    std::atomic<size_t> _num_drivers = 0;
+    std::atomic<size_t> _next_put_shard = 0;
+    std::atomic<size_t> _next_home_shard = 0;
+
+    std::mutex _park_mutex;
+    std::condition_variable _park_cv;
+    std::atomic<int> _num_parked = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 // WorkGroupDriverQueue contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class WorkGroupDriverQueue : public FactoryMethod<DriverQueue, WorkGroupDriverQueue> {
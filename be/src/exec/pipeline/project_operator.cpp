@@ -14,20 +14,63 @@
 
 #include "exec/pipeline/project_operator.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/json_column.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
+#include "exprs/column_ref.h"
 #include "exprs/expr.h"
+#include "exprs/jsonpath.h"
+#include "exprs/literal.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
+#include "util/json_flattener.h"
 
 namespace starrocks::pipeline {
+
+ProjectOperator::~ProjectOperator() = default;
+
 Status ProjectOperator::prepare(RuntimeState* state) {
     _expr_compute_timer = ADD_TIMER(_unique_metrics, "ExprComputeTime");
     _common_sub_expr_compute_timer = ADD_TIMER(_unique_metrics, "CommonSubExprComputeTime");
+    if (!_json_flat_slots.empty()) {
+        _json_flatten_timer = ADD_TIMER(_unique_metrics, "JsonFlattenTime");
+    }
+    for (const auto& slot : _json_flat_slots) {
+        _json_flatteners.emplace_back(std::make_unique<JsonFlattener>(slot.paths, slot.types, false));
+    }
     return Operator::prepare(state);
 }
 
+ColumnPtr ProjectOperator::_flatten_json(size_t idx, const ColumnPtr& column) {
+    if (column->is_constant()) {
+        return nullptr;
+    }
+    const auto* json_column = down_cast<const JsonColumn*>(ColumnHelper::get_data_column(column.get()));
+    if (json_column->is_flat_json()) {
+        return nullptr;
+    }
+
+    SCOPED_TIMER(_json_flatten_timer);
+    const auto& slot = _json_flat_slots[idx];
+    _json_flatteners[idx]->flatten(column.get());
+    auto flat_column = JsonColumn::create();
+    flat_column->set_flat_columns(slot.paths, slot.types, _json_flatteners[idx]->mutable_result());
+    if (column->is_nullable()) {
+        return NullableColumn::create(std::move(flat_column),
+                                      down_cast<const NullableColumn*>(column.get())->null_column());
+    }
+    return flat_column;
+}
+
 void ProjectOperator::close(RuntimeState* state) {
     _cur_chunk.reset();
     Operator::close(state);
@@ -53,11 +96,33 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         }
     }
 
+    // the flat json columns are only visible to the json path exprs of their slots
+    Columns json_flat_columns(_json_flat_slots.size());
+    for (size_t i = 0; i < _json_flat_slots.size(); ++i) {
+        json_flat_columns[i] = _flatten_json(i, chunk->get_column_by_slot_id(_json_flat_slots[i].slot_id));
+    }
+
     Columns result_columns(_column_ids.size());
     {
         SCOPED_TIMER(_expr_compute_timer);
         for (size_t i = 0; i < _column_ids.size(); ++i) {
-            ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
+            // the result is copied rather than shared, since the downstream operators may modify a column in place.
+            if (_same_expr_output_idx[i] != -1) {
+                result_columns[i] = result_columns[_same_expr_output_idx[i]]->clone();
+                continue;
+            } else if (_same_expr_common_sub_column_ids[i] != -1) {
+                result_columns[i] = chunk->get_column_by_slot_id(_same_expr_common_sub_column_ids[i])->clone();
+            } else if (_json_flat_slot_idx[i] != -1 && json_flat_columns[_json_flat_slot_idx[i]] != nullptr) {
+                const int32_t idx = _json_flat_slot_idx[i];
+                ColumnPtr& json_column = chunk->get_column_by_slot_id(_json_flat_slots[idx].slot_id);
+                ColumnPtr origin_column = std::move(json_column);
+                json_column = json_flat_columns[idx];
+                auto res = _expr_ctxs[i]->evaluate(chunk.get());
+                json_column = std::move(origin_column);
+                ASSIGN_OR_RETURN(result_columns[i], std::move(res));
+            } else {
+                ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
+            }
 
             if (result_columns[i]->only_null()) {
                 result_columns[i] = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), true);
@@ -108,9 +173,134 @@ Status ProjectOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::open(_common_sub_expr_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_expr_ctxs, state));
 
+    _init_same_exprs();
+    _init_json_flat_slots();
     return Status::OK();
 }
 
+void ProjectOperatorFactory::_init_same_exprs() {
+    _same_expr_output_idx.assign(_expr_ctxs.size(), -1);
+    _same_expr_common_sub_column_ids.assign(_expr_ctxs.size(), -1);
+
+    std::unordered_map<std::string, int32_t> common_sub_exprs;
+    for (size_t i = 0; i < _common_sub_expr_ctxs.size(); ++i) {
+        std::string fingerprint = _common_sub_expr_ctxs[i]->root()->fingerprint();
+        if (!fingerprint.empty()) {
+            common_sub_exprs.emplace(std::move(fingerprint), _common_sub_column_ids[i]);
+        }
+    }
+    std::unordered_map<std::string, int32_t> output_exprs;
+    for (size_t i = 0; i < _expr_ctxs.size(); ++i) {
+        const Expr* root = _expr_ctxs[i]->root();
+        // slot refs and literals are cheaper to evaluate than to copy.
+        if (root->is_slotref() || root->is_literal()) {
+            continue;
+        }
+        std::string fingerprint = root->fingerprint();
+        if (fingerprint.empty()) {
+            continue;
+        }
+        if (auto it = common_sub_exprs.find(fingerprint); it != common_sub_exprs.end()) {
+            _same_expr_common_sub_column_ids[i] = it->second;
+        } else if (auto it = output_exprs.find(fingerprint);
+                   it != output_exprs.end() && _type_is_nullable[it->second] == _type_is_nullable[i]) {
+            _same_expr_output_idx[i] = it->second;
+        } else {
+            output_exprs.emplace(std::move(fingerprint), i);
+        }
+    }
+}
+
+// Return the flat path of a json path with only object keys, e.g. "a.b" of "$.a.b", or empty if it can't be flattened.
+static std::string to_flat_json_path(const JsonPath& json_path) {
+    std::string flat_path;
+    for (const auto& piece : json_path.paths) {
+        if (piece.array_selector->type != NONE) {
+            return "";
+        }
+        if (piece.key == "$") {
+            continue;
+        }
+        if (piece.key.empty() || piece.key.find('.') != std::string::npos) {
+            return "";
+        }
+        flat_path += flat_path.empty() ? piece.key : "." + piece.key;
+    }
+    return flat_path;
+}
+
+void ProjectOperatorFactory::_init_json_flat_slots() {
+    _json_flat_slot_idx.assign(_expr_ctxs.size(), -1);
+    // the flat json functions read the flat columns of any layout only in the lazy mode
+    if (!config::enable_lazy_dynamic_flat_json) {
+        return;
+    }
+
+    static const std::unordered_set<std::string> JSON_PATH_FUNCTIONS = {
+            "json_query", "get_json_bool", "get_json_int", "get_json_bigint", "get_json_double", "get_json_string"};
+    std::map<SlotId, std::vector<std::pair<size_t, std::string>>> slot_exprs;
+    for (size_t i = 0; i < _expr_ctxs.size(); ++i) {
+        if (_same_expr_output_idx[i] != -1 || _same_expr_common_sub_column_ids[i] != -1) {
+            continue;
+        }
+        const Expr* root = _expr_ctxs[i]->root();
+        if (root->node_type() != TExprNodeType::FUNCTION_CALL || root->get_num_children() != 2 ||
+            !JSON_PATH_FUNCTIONS.contains(root->fn().name.function_name)) {
+            continue;
+        }
+        const Expr* json = root->get_child(0);
+        const Expr* path = root->get_child(1);
+        if (!json->is_slotref() || json->type().type != TYPE_JSON || !path->is_literal()) {
+            continue;
+        }
+        const ColumnPtr& path_column = down_cast<const VectorizedLiteral*>(path)->value();
+        if (path_column->only_null()) {
+            continue;
+        }
+        auto json_path = JsonPath::parse(ColumnHelper::get_const_value<TYPE_VARCHAR>(path_column));
+        if (!json_path.ok()) {
+            continue;
+        }
+        std::string flat_path = to_flat_json_path(json_path.value());
+        if (!flat_path.empty()) {
+            slot_exprs[down_cast<const ColumnRef*>(json)->slot_id()].emplace_back(i, std::move(flat_path));
+        }
+    }
+
+    for (const auto& [slot_id, exprs] : slot_exprs) {
+        std::set<std::string> paths;
+        for (const auto& [i, path] : exprs) {
+            paths.insert(path);
+        }
+        // one traversal only pays off for several paths
+        if (paths.size() < 2) {
+            continue;
+        }
+        ProjectJsonFlatSlot slot;
+        slot.slot_id = slot_id;
+        for (const auto& path : paths) {
+            // a path can't be flattened together with its parent path
+            bool overlapped = std::any_of(paths.begin(), paths.end(), [&](const std::string& other) {
+                return (other.size() > path.size() && other.starts_with(path) && other[path.size()] == '.') ||
+                       (path.size() > other.size() && path.starts_with(other) && path[other.size()] == '.');
+            });
+            if (!overlapped) {
+                slot.paths.emplace_back(path);
+                slot.types.emplace_back(TYPE_JSON);
+            }
+        }
+        if (slot.paths.size() < 2) {
+            continue;
+        }
+        for (const auto& [i, path] : exprs) {
+            if (std::find(slot.paths.begin(), slot.paths.end(), path) != slot.paths.end()) {
+                _json_flat_slot_idx[i] = _json_flat_slots.size();
+            }
+        }
+        _json_flat_slots.emplace_back(std::move(slot));
+    }
+}
+
 void ProjectOperatorFactory::close(RuntimeState* state) {
     Expr::close(_expr_ctxs, state);
     Expr::close(_common_sub_expr_ctxs, state);
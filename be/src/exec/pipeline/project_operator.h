@@ -19,21 +19,39 @@
 
 namespace starrocks {
 class ExprContext;
+class JsonFlattener;
 namespace pipeline {
+
+// The constant json paths extracted from the same json slot by several output exprs. The slot is flattened into
+// these paths with one traversal per row, then the exprs read the flat sub columns instead of walking the json again.
+struct ProjectJsonFlatSlot {
+    SlotId slot_id;
+    std::vector<std::string> paths;
+    std::vector<LogicalType> types;
+};
+
 class ProjectOperator final : public Operator {
 public:
     ProjectOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                     std::vector<int32_t>& column_ids, const std::vector<ExprContext*>& expr_ctxs,
                     const std::vector<bool>& type_is_nullable, const std::vector<int32_t>& common_sub_column_ids,
-                    const std::vector<ExprContext*>& common_sub_expr_ctxs)
+                    const std::vector<ExprContext*>& common_sub_expr_ctxs,
+                    const std::vector<int32_t>& same_expr_output_idx,
+                    const std::vector<int32_t>& same_expr_common_sub_column_ids,
+                    const std::vector<ProjectJsonFlatSlot>& json_flat_slots,
+                    const std::vector<int32_t>& json_flat_slot_idx)
             : Operator(factory, id, "project", plan_node_id, false, driver_sequence),
               _column_ids(column_ids),
               _expr_ctxs(expr_ctxs),
               _type_is_nullable(type_is_nullable),
               _common_sub_column_ids(common_sub_column_ids),
-              _common_sub_expr_ctxs(common_sub_expr_ctxs) {}
+              _common_sub_expr_ctxs(common_sub_expr_ctxs),
+              _same_expr_output_idx(same_expr_output_idx),
+              _same_expr_common_sub_column_ids(same_expr_common_sub_column_ids),
+              _json_flat_slots(json_flat_slots),
+              _json_flat_slot_idx(json_flat_slot_idx) {}
 
-    ~ProjectOperator() override = default;
+    ~ProjectOperator() override;
 
     Status prepare(RuntimeState* state) override;
 
@@ -59,18 +77,27 @@ public:
     Status reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
 private:
+    // Return nullptr if the json column can not be flattened, e.g. it's already flat json.
+    ColumnPtr _flatten_json(size_t idx, const ColumnPtr& column);
+
     const std::vector<int32_t>& _column_ids;
     const std::vector<ExprContext*>& _expr_ctxs;
     const std::vector<bool>& _type_is_nullable;
 
     const std::vector<int32_t>& _common_sub_column_ids;
     const std::vector<ExprContext*>& _common_sub_expr_ctxs;
+    const std::vector<int32_t>& _same_expr_output_idx;
+    const std::vector<int32_t>& _same_expr_common_sub_column_ids;
+    const std::vector<ProjectJsonFlatSlot>& _json_flat_slots;
+    const std::vector<int32_t>& _json_flat_slot_idx;
+    std::vector<std::unique_ptr<JsonFlattener>> _json_flatteners;
 
     bool _is_finished = false;
     ChunkPtr _cur_chunk = nullptr;
 
     RuntimeProfile::Counter* _expr_compute_timer = nullptr;
     RuntimeProfile::Counter* _common_sub_expr_compute_timer = nullptr;
+    RuntimeProfile::Counter* _json_flatten_timer = nullptr;
 };
 
 class ProjectOperatorFactory final : public OperatorFactory {
@@ -90,19 +117,34 @@ public:
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         return std::make_shared<ProjectOperator>(this, _id, _plan_node_id, driver_sequence, _column_ids, _expr_ctxs,
-                                                 _type_is_nullable, _common_sub_column_ids, _common_sub_expr_ctxs);
+                                                 _type_is_nullable, _common_sub_column_ids, _common_sub_expr_ctxs,
+                                                 _same_expr_output_idx, _same_expr_common_sub_column_ids,
+                                                 _json_flat_slots, _json_flat_slot_idx);
     }
 
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
 private:
+    void _init_same_exprs();
+    void _init_json_flat_slots();
+
     std::vector<int32_t> _column_ids;
     std::vector<ExprContext*> _expr_ctxs;
     std::vector<bool> _type_is_nullable;
 
     std::vector<int32_t> _common_sub_column_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
+
+    // The exprs with the same fingerprint as an earlier output expr or a common sub expr are not evaluated again,
+    // their results are copied from the earlier output (by its index) or the common sub expr column (by its id).
+    // -1 means the expr is evaluated.
+    std::vector<int32_t> _same_expr_output_idx;
+    std::vector<int32_t> _same_expr_common_sub_column_ids;
+
+    // index in _json_flat_slots of the json slot an output expr extracts from, -1 means the expr isn't flattened.
+    std::vector<ProjectJsonFlatSlot> _json_flat_slots;
+    std::vector<int32_t> _json_flat_slot_idx;
 };
 
 } // namespace pipeline
@@ -303,6 +303,24 @@ void QueryContext::update_scan_stats(int64_t table_id, int64_t scan_rows_num, in
     stats->delta_scan_bytes += scan_bytes;
 }
 
+std::shared_ptr<JoinHashTable> QueryContext::get_broadcast_hash_table(int32_t plan_node_id) {
+    std::lock_guard l(_broadcast_hash_tables_lock);
+    auto iter = _broadcast_hash_tables.find(plan_node_id);
+    if (iter == _broadcast_hash_tables.end()) {
+        return nullptr;
+    }
+    return iter->second.lock();
+}
+
+void QueryContext::publish_broadcast_hash_table(int32_t plan_node_id,
+                                                const std::shared_ptr<JoinHashTable>& hash_table) {
+    std::lock_guard l(_broadcast_hash_tables_lock);
+    auto& published = _broadcast_hash_tables[plan_node_id];
+    if (published.expired()) {
+        published = hash_table;
+    }
+}
+
 void QueryContext::init_node_exec_stats(const std::vector<int32_t>& exec_stats_node_ids) {
     std::call_once(_node_exec_stats_init_flag, [this, &exec_stats_node_ids]() {
         for (int32_t node_id : exec_stats_node_ids) {
@@ -38,6 +38,7 @@
 
 namespace starrocks {
 
+class JoinHashTable;
 class StreamEpochManager;
 
 namespace pipeline {
@@ -293,6 +294,12 @@ public:
         return _connector_scan_operator_mem_share_arbitrator;
     }
 
+    // Broadcast join hash tables shared by the fragment instances of this query, keyed by the plan node id of the
+    // join. Only weak references are kept here, a table lives as long as one of its referencing instances.
+    std::shared_ptr<JoinHashTable> get_broadcast_hash_table(int32_t plan_node_id);
+    // Publish the hash table unless a live one has already been published for the join.
+    void publish_broadcast_hash_table(int32_t plan_node_id, const std::shared_ptr<JoinHashTable>& hash_table);
+
 public:
     static constexpr int DEFAULT_EXPIRE_SECONDS = 300;
 
@@ -383,6 +390,9 @@ private:
 
     int64_t _static_query_mem_limit = 0;
     ConnectorScanOperatorMemShareArbitrator* _connector_scan_operator_mem_share_arbitrator = nullptr;
+
+    SpinLock _broadcast_hash_tables_lock;
+    std::unordered_map<int32_t, std::weak_ptr<JoinHashTable>> _broadcast_hash_tables;
 };
 
 // TODO: use brpc::TimerThread refactor QueryContext
@@ -62,6 +62,8 @@ struct RuntimeMembershipFilterBuildParam {
     bool eq_null;
     bool is_empty;
     Columns columns;
+    // The hashes of the rows of `columns` kept by the join hash tables, empty if they are not kept.
+    std::vector<KeyHashesPtr> key_hashes;
     MutableRuntimeFilterPtr runtime_filter;
     // used for skew join
     TypeDescriptor _type_descriptor;
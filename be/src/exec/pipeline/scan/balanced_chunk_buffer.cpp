@@ -109,12 +109,16 @@ void BalancedChunkBuffer::update_limiter(Chunk* chunk) {
     LimiterContext& ctx = _limiter_context;
     ctx.local_sum_row_bytes += chunk->memory_usage();
     ctx.local_num_rows += chunk->num_rows();
-    ctx.local_max_chunk_rows = std::max(ctx.local_max_chunk_rows, chunk->num_rows());
+    ctx.local_num_chunks++;
 
     if (ctx.local_sum_chunks++ % UPDATE_AVG_ROW_BYTES_FREQUENCY == 0) {
-        _limiter->update_avg_row_bytes(ctx.local_sum_row_bytes, ctx.local_num_rows, ctx.local_max_chunk_rows);
+        // The chunks of a selective or narrow scan are usually much smaller than the chunk size, so the buffered
+        // bytes are estimated by the rows of the chunks actually produced rather than the largest chunk.
+        size_t avg_chunk_rows = ctx.local_num_rows / ctx.local_num_chunks;
+        _limiter->update_avg_row_bytes(ctx.local_sum_row_bytes, ctx.local_num_rows, avg_chunk_rows);
         ctx.local_sum_row_bytes = 0;
         ctx.local_num_rows = 0;
+        ctx.local_num_chunks = 0;
     }
 }
 
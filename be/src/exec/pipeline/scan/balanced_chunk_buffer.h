@@ -54,8 +54,8 @@ private:
         // Local counters for row-size estimation, will be reset after a batch
         size_t local_sum_row_bytes = 0;
         size_t local_num_rows = 0;
+        size_t local_num_chunks = 0;
         size_t local_sum_chunks = 0;
-        size_t local_max_chunk_rows = 0;
     };
 
     using ChunkWithToken = std::pair<ChunkPtr, ChunkBufferTokenPtr>;
@@ -21,20 +21,26 @@
 namespace starrocks::pipeline {
 
 void DynamicChunkBufferLimiter::update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows,
-                                                     size_t max_chunk_rows) {
+                                                     size_t chunk_rows) {
+    // Decay the history, so that the capacity follows the recent rows, e.g. when the scan moves to wider rows.
+    static constexpr size_t DECAY_NUM_ROWS = 1 << 20;
     std::lock_guard<std::mutex> lock(_mutex);
 
+    if (_num_rows >= DECAY_NUM_ROWS) {
+        _sum_row_bytes /= 2;
+        _num_rows /= 2;
+    }
     _sum_row_bytes += added_sum_row_bytes;
     _num_rows += added_num_rows;
     size_t avg_row_bytes = 0;
     if (_num_rows > 0) {
         avg_row_bytes = _sum_row_bytes / _num_rows;
     }
-    if (avg_row_bytes == 0) {
+    if (avg_row_bytes == 0 || chunk_rows == 0) {
         return;
     }
 
-    size_t chunk_mem_usage = avg_row_bytes * max_chunk_rows;
+    size_t chunk_mem_usage = avg_row_bytes * chunk_rows;
     size_t new_capacity = std::max<size_t>(_mem_limit.load() / chunk_mem_usage, 1);
     _capacity = std::min(new_capacity, _max_capacity);
 }
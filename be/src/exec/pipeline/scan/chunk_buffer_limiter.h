@@ -43,7 +43,8 @@ public:
     // Update the chunk memory usage statistics.
     // `added_sum_row_bytes` is the bytes of the new reading rows.
     // `added_num_rows` is the number of the new read rows.
-    virtual void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t max_chunk_rows) {}
+    // `chunk_rows` is the average number of rows of the new read chunks.
+    virtual void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t chunk_rows) {}
 
     // Pin a position in the buffer and return a token.
     // When desctructing the token, the position will be unpinned.
@@ -121,7 +122,7 @@ public:
 
     ~DynamicChunkBufferLimiter() override = default;
 
-    void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t max_chunk_rows) override;
+    void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t chunk_rows) override;
 
     ChunkBufferTokenPtr pin(int num_chunks) override;
     void unpin(int num_chunks);
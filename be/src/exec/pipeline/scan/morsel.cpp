@@ -16,9 +16,11 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
@@ -319,12 +321,23 @@ void PhysicalSplitMorselQueue::set_key_ranges(TabletReaderParams::RangeStartOper
     _range_end_key = range_end_key;
 }
 
+int64_t PhysicalSplitMorselQueue::_split_rows() const {
+    const int64_t splits_per_driver = config::tablet_internal_parallel_tail_splits_per_driver;
+    if (splits_per_driver <= 0) {
+        return _splitted_scan_rows;
+    }
+    const int64_t rest_rows = _num_uninit_segment_rows + static_cast<int64_t>(_num_segment_rest_rows);
+    const int64_t min_rows = std::min(config::tablet_internal_parallel_min_splitted_scan_rows, _splitted_scan_rows);
+    return std::clamp(rest_rows / (splits_per_driver * _degree_of_parallelism), min_rows, _splitted_scan_rows);
+}
+
 StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_single_tablet() {
+    const size_t split_rows = std::max<int64_t>(1, _split_rows());
     size_t num_taken_rows = 0;
     RowidRangeOptionPtr rowid_range = nullptr;
     auto has_taken_from_tablet = [&rowid_range]() { return rowid_range != nullptr; };
 
-    while (num_taken_rows < _splitted_scan_rows) {
+    while (num_taken_rows < split_rows) {
         if (_tablet_idx >= _tablets.size()) {
             return rowid_range;
         }
@@ -356,11 +369,11 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
         }
 
         SparseRange<> taken_range;
-        _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        _segment_range_iter.next_range(split_rows, &taken_range);
         _num_segment_rest_rows -= taken_range.span_size();
-        if (_num_segment_rest_rows < _splitted_scan_rows) {
+        if (_num_segment_rest_rows < split_rows) {
             // If there are too few rows left in the segment, take them all this time.
-            _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+            _segment_range_iter.next_range(split_rows, &taken_range);
             _num_segment_rest_rows = 0;
         }
 
@@ -393,6 +406,15 @@ StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get() {
     DCHECK(!_tablet_rowsets.empty());
     DCHECK_EQ(_tablets.size(), _tablet_rowsets.size());
 
+    if (!_has_counted_rows) {
+        _has_counted_rows = true;
+        for (const auto& rowsets : _tablet_rowsets) {
+            for (const auto& rowset : rowsets) {
+                _num_uninit_segment_rows += rowset->num_rows();
+            }
+        }
+    }
+
     ASSIGN_OR_RETURN(auto rowid_range, _try_get_split_from_single_tablet());
     if (rowid_range == nullptr) {
         return nullptr;
@@ -530,6 +552,7 @@ Status PhysicalSplitMorselQueue::_init_segment() {
     if (segment == nullptr || segment->num_rows() == 0) {
         return Status::OK();
     }
+    _num_uninit_segment_rows = std::max<int64_t>(0, _num_uninit_segment_rows - segment->num_rows());
 
     // Find the rowid range of each key range in this segment.
     if (_tablet_seek_ranges.empty()) {
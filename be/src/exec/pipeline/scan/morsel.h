@@ -494,8 +494,11 @@ private:
     // and find the rowid range of each key range in this segment.
     Status _init_segment();
     // Obtain row id ranges from multiple segments of multiple rowsets within a single tablet,
-    // until _splitted_scan_rows rows are retrieved.
+    // until _split_rows() rows are retrieved.
     StatusOr<RowidRangeOptionPtr> _try_get_split_from_single_tablet();
+    // The number of rows of the next split, which is _splitted_scan_rows until the tail of the queue,
+    // and then shrinks with the rest rows.
+    int64_t _split_rows() const;
 
 private:
     std::mutex _mutex;
@@ -517,6 +520,9 @@ private:
     SparseRangeIterator<> _segment_range_iter;
     // The number of unprocessed rows of the current segment.
     size_t _num_segment_rest_rows = 0;
+    // The number of rows of the segments which haven't been initialized, counted at the first try_get().
+    bool _has_counted_rows = false;
+    int64_t _num_uninit_segment_rows = 0;
 
     MemPool _mempool;
 };
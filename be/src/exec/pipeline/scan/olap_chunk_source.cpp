@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/scan/olap_chunk_source.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <string_view>
 #include <unordered_map>
@@ -21,6 +22,7 @@
 #include "column/column.h"
 #include "column/column_access_path.h"
 #include "column/field.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -36,6 +38,7 @@
 #include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/flat_json_access_stats.h"
 #include "storage/index/vector/vector_search_option.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
@@ -139,6 +142,7 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _raw_rows_counter = ADD_COUNTER(_runtime_profile, "RawRowsRead", TUnit::UNIT);
     _read_pages_num_counter = ADD_COUNTER(_runtime_profile, "ReadPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "CachedPagesNum", TUnit::UNIT);
+    _cached_compressed_pages_num_counter = ADD_COUNTER(_runtime_profile, "CachedCompressedPagesNum", TUnit::UNIT);
     _pushdown_predicates_counter =
             ADD_COUNTER_SKIP_MERGE(_runtime_profile, "PushdownPredicates", TUnit::UNIT, TCounterMergeType::SKIP_ALL);
     _pushdown_access_paths_counter =
@@ -219,13 +223,63 @@ Status OlapChunkSource::_get_tablet(const TInternalScanRange* scan_range) {
     return Status::OK();
 }
 
-void OlapChunkSource::_decide_chunk_size(bool has_predicate) {
+void OlapChunkSource::_decide_chunk_size(bool has_predicate, const std::vector<uint32_t>& scanner_columns) {
     if (!has_predicate && _limit != -1 && _limit < _runtime_state->chunk_size()) {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
-    } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        return;
+    }
+    _params.chunk_size = _runtime_state->chunk_size();
+
+    // Only shrink the chunks of wide rows, the operators size their states by the chunk_size of the query.
+    if (config::scan_chunk_max_bytes <= 0) {
+        return;
+    }
+    const size_t row_bytes = _estimate_row_bytes(scanner_columns);
+    const auto max_bytes = static_cast<size_t>(config::scan_chunk_max_bytes);
+    if (row_bytes * _params.chunk_size > max_bytes) {
+        constexpr int kMinChunkSize = 64;
+        _params.chunk_size = std::max<int>(kMinChunkSize, max_bytes / std::max<size_t>(row_bytes, 1));
+        _runtime_profile->add_info_string("AdaptiveChunkSize", std::to_string(_params.chunk_size));
+    }
+}
+
+// The fixed length columns take their type sizes, and the bytes of a row in the rowsets beyond the fixed length
+// columns are spread evenly over the variable length ones.
+size_t OlapChunkSource::_estimate_row_bytes(const std::vector<uint32_t>& scanner_columns) const {
+    int64_t num_rows = 0;
+    int64_t total_row_size = 0;
+    for (const auto& base_rowset : _morsel->rowsets()) {
+        auto rowset = std::dynamic_pointer_cast<Rowset>(base_rowset);
+        if (rowset == nullptr) {
+            continue;
+        }
+        num_rows += rowset->num_rows();
+        total_row_size += rowset->total_row_size();
+    }
+    if (num_rows <= 0) {
+        return 0;
+    }
+
+    size_t fixed_row_bytes = 0;
+    size_t num_variable_columns = 0;
+    for (const auto& column : _tablet_schema->columns()) {
+        size_t size = column.estimate_field_size(0);
+        fixed_row_bytes += size;
+        num_variable_columns += (size == 0);
+    }
+    size_t variable_bytes = 0;
+    if (num_variable_columns > 0 && total_row_size / num_rows > static_cast<int64_t>(fixed_row_bytes)) {
+        variable_bytes = (total_row_size / num_rows - fixed_row_bytes) / num_variable_columns;
+    }
+
+    size_t row_bytes = 0;
+    for (uint32_t index : scanner_columns) {
+        if (index < _tablet_schema->num_columns()) {
+            row_bytes += _tablet_schema->column(index).estimate_field_size(variable_bytes);
+        }
     }
+    return row_bytes;
 }
 
 Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges,
@@ -280,7 +334,7 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
         ASSIGN_OR_RETURN(_params.runtime_filter_preds,
                          _scan_ctx->conjuncts_manager().get_runtime_filter_predicates(&_obj_pool, parser));
     }
-    _decide_chunk_size(!pred_tree.empty());
+    _decide_chunk_size(!pred_tree.empty(), scanner_columns);
     PredicateAndNode pushdown_pred_root;
     PredicateAndNode non_pushdown_pred_root;
     pred_tree.root().partition_copy([parser](const auto& node) { return parser->can_pushdown(node); },
@@ -389,6 +443,9 @@ Status OlapChunkSource::_init_column_access_paths(Schema* schema) {
             if (LIKELY(res.ok())) {
                 _column_access_paths.emplace_back(std::move(res.value()));
                 leaf_size += path->leaf_size();
+                if (config::enable_json_flat_access_stats && field->type()->type() == LogicalType::TYPE_JSON) {
+                    FlatJsonAccessStats::instance()->record(_tablet->tablet_id(), _column_access_paths.back().get());
+                }
             } else {
                 LOG(WARNING) << "failed to convert column access path: " << res.status();
             }
@@ -549,7 +606,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
 }
 
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
-    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size()));
+    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _params.chunk_size));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
     return _read_chunk_from_storage(_runtime_state, (*chunk).get());
 }
@@ -695,6 +752,7 @@ void OlapChunkSource::_update_counter() {
 
     COUNTER_UPDATE(_read_pages_num_counter, _reader->stats().total_pages_num);
     COUNTER_UPDATE(_cached_pages_num_counter, _reader->stats().cached_pages_num);
+    COUNTER_UPDATE(_cached_compressed_pages_num_counter, _reader->stats().cached_compressed_pages_num);
 
     COUNTER_UPDATE(_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
@@ -17,6 +17,7 @@
 #include <util/time.h>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "common/statusor.h"
 #include "exec/olap_scan_node.h"
@@ -192,7 +193,7 @@ bool ScanOperator::has_output() const {
     // Can pick up more morsels or submit more tasks
     if (!_morsel_queue->empty()) {
         std::shared_lock guard(_task_mutex);
-        auto status_or_is_ready = _morsel_queue->ready_for_next();
+        auto status_or_is_ready = _is_morsel_queue_ready();
         if (status_or_is_ready.ok() && status_or_is_ready.value()) {
             return true;
         }
@@ -368,7 +369,7 @@ Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
     }
 
     // pick up new chunk source.
-    ASSIGN_OR_RETURN(auto morsel_ready, _morsel_queue->ready_for_next());
+    ASSIGN_OR_RETURN(auto morsel_ready, _is_morsel_queue_ready());
     if (size > 0 && morsel_ready) {
         for (int i = 0; i < size; i++) {
             int idx = to_sched[i];
@@ -443,6 +444,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             // set driver_id/query_id/fragment_instance_id to thread local
             // driver_id will be used in some Expr such as regex_replace
             SCOPED_SET_TRACE_INFO(driver_id, state->query_id(), state->fragment_instance_id());
+            CurrentThread::current().set_workgroup_id(_workgroup != nullptr ? _workgroup->id() : -1);
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
 
             auto& chunk_source = _chunk_sources[chunk_source_index];
@@ -519,6 +521,27 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
     return Status::OK();
 }
 
+StatusOr<bool> ScanOperator::_is_morsel_queue_ready() const {
+    ASSIGN_OR_RETURN(bool ready, _morsel_queue->ready_for_next());
+    // Only a bucket-sequence morsel queue holds back the next bucket, until all the chunks of the current bucket are
+    // pulled. The chunks of the next bucket could be produced ahead, once the ones of the current bucket are all in
+    // the buffer, since the buffer of a non-shared scan keeps them in order. The number of buckets scanned ahead is
+    // bounded by the memory of the buffered chunks.
+    if (ready || config::group_execution_prefetch_buffer_bytes <= 0 || has_shared_chunk_source() ||
+        _lane_arbiter != nullptr) {
+        return ready;
+    }
+    if (buffer_memory_usage() >= static_cast<size_t>(config::group_execution_prefetch_buffer_bytes)) {
+        return false;
+    }
+    for (int i = 0; i < _io_tasks_per_scan_operator; i++) {
+        if (_is_io_task_running[i] || (_chunk_sources[i] != nullptr && _chunk_sources[i]->has_next_chunk())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status ScanOperator::_pickup_morsel(RuntimeState* state, int chunk_source_index) {
     DCHECK(_morsel_queue != nullptr);
     _close_chunk_source(state, chunk_source_index);
@@ -533,7 +556,7 @@ Status ScanOperator::_pickup_morsel(RuntimeState* state, int chunk_source_index)
     });
 
     // if current morsel not ready for get next. we should wait current bucket finish. just return directly
-    ASSIGN_OR_RETURN(auto ready, _morsel_queue->ready_for_next());
+    ASSIGN_OR_RETURN(auto ready, _is_morsel_queue_ready());
     RETURN_IF(!ready, Status::OK());
 
     ASSIGN_OR_RETURN(auto morsel, _morsel_queue->try_get());
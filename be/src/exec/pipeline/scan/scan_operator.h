@@ -149,6 +149,9 @@ protected:
     virtual Status _pickup_morsel(RuntimeState* state, int chunk_source_index);
     Status _trigger_next_scan(RuntimeState* state, int chunk_source_index);
     Status _try_to_trigger_next_scan(RuntimeState* state);
+    // Whether the morsel queue is ready for a new morsel, or the next bucket of a bucket-sequence queue could be
+    // prefetched.
+    StatusOr<bool> _is_morsel_queue_ready() const;
     virtual void _close_chunk_source_unlocked(RuntimeState* state, int index);
     void _close_chunk_source(RuntimeState* state, int index);
     virtual void _finish_chunk_source_task(RuntimeState* state, int chunk_source_index, int64_t cpu_time_ns,
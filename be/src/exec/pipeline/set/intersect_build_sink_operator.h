@@ -89,6 +89,7 @@ public:
               _intersect_partition_ctx_factory(std::move(intersect_partition_ctx_factory)),
               _dst_exprs(dst_exprs),
               _has_outer_join_child(has_outer_join_child) {}
+    bool support_event_scheduler() const override { return true; }
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         return std::make_shared<IntersectBuildSinkOperator>(
@@ -132,7 +132,9 @@ Status ExportSinkIOBuffer::_gen_file_name(std::string* file_name) {
 
 Status ExportSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
-    return _export_sink_buffer->prepare(state, _unique_metrics.get());
+    RETURN_IF_ERROR(_export_sink_buffer->prepare(state, _unique_metrics.get()));
+    _export_sink_buffer->attach_observer(state, observer());
+    return Status::OK();
 }
 
 void ExportSinkOperator::close(RuntimeState* state) {
@@ -126,7 +126,9 @@ void FileSinkIOBuffer::_add_chunk(const ChunkPtr& chunk) {
 
 Status FileSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
-    return _file_sink_buffer->prepare(state, _unique_metrics.get());
+    RETURN_IF_ERROR(_file_sink_buffer->prepare(state, _unique_metrics.get()));
+    _file_sink_buffer->attach_observer(state, observer());
+    return Status::OK();
 }
 
 void FileSinkOperator::close(RuntimeState* state) {
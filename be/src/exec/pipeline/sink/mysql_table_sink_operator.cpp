@@ -87,7 +87,9 @@ Status MysqlTableSinkIOBuffer::_open_mysql_table_writer() {
 
 Status MysqlTableSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
-    return _mysql_table_sink_buffer->prepare(state, _unique_metrics.get());
+    RETURN_IF_ERROR(_mysql_table_sink_buffer->prepare(state, _unique_metrics.get()));
+    _mysql_table_sink_buffer->attach_observer(state, observer());
+    return Status::OK();
 }
 
 void MysqlTableSinkOperator::close(RuntimeState* state) {
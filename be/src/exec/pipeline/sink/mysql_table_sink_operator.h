@@ -66,6 +66,8 @@ public:
 
     ~MysqlTableSinkOperatorFactory() override = default;
 
+    bool support_event_scheduler() const override { return true; }
+
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         return std::make_shared<MysqlTableSinkOperator>(this, _id, _plan_node_id, driver_sequence,
                                                         _mysql_table_sink_buffer);
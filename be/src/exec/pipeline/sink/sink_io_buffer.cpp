@@ -14,11 +14,19 @@
 
 #include "exec/pipeline/sink/sink_io_buffer.h"
 
+#include "exec/pipeline/query_context.h"
+
 namespace starrocks::pipeline {
 
 int SinkIOBuffer::_process_chunk(bthread::TaskIterator<QueueItemPtr>& iter) {
     // Is it possible the mem_tracker in _state is invalid due to the whole object is in destructing?
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_state->query_mem_tracker_ptr().get());
+    // The observers are owned by the drivers, so the query context should be alive until notified.
+    std::shared_ptr<QueryContext> query_ctx_guard;
+    if (_observable.num_observers() > 0 && _state->query_ctx() != nullptr) {
+        query_ctx_guard = _state->query_ctx()->shared_from_this();
+    }
+    auto notify = DeferOp([this]() { _observable.notify_sink_observers(); });
     bool fast_skip = false;
     for (; iter; ++iter) {
         if (_is_finished) {
@@ -19,6 +19,7 @@
 
 #include "bthread/execution_queue.h"
 #include "column/chunk.h"
+#include "exec/pipeline/schedule/observer.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
@@ -101,6 +102,9 @@ public:
         return _io_status;
     }
 
+    // Non-thread-safe, only called in the prepare phase of the sink operators.
+    void attach_observer(RuntimeState* state, PipelineObserver* observer) { _observable.add_observer(state, observer); }
+
 private:
     // A wrapper of the payload to the item in the execution queue, so the end-of-queue marker can be distinguished from the nullptr payload.
     // That is, calling append_chunk() with a nullptr, won't accidentially stop the entire queue.
@@ -137,6 +141,9 @@ private:
     std::atomic_bool _is_prepared = false;
     std::atomic_bool _is_cancelled = false;
     std::atomic_bool _is_finished = false;
+
+    // Notify the sink drivers when need_input() or is_finished() may be changed by the io thread.
+    Observable _observable;
 };
 
 } // namespace starrocks::pipeline
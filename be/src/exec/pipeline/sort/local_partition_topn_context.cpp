@@ -180,9 +180,13 @@ Status LocalPartitionTopnContext::push_one_chunk_to_partitioner(RuntimeState* st
     RETURN_IF_ERROR(_chunks_partitioner->offer<true>(
             chunk,
             [this, state](size_t partition_idx) {
+                size_t max_buffered_rows = ChunksSorterTopn::kDefaultMaxBufferRows;
+                if (partition_idx >= kNumBufferedPartitions) {
+                    max_buffered_rows = _offset + _partition_limit;
+                }
                 _chunks_sorters.emplace_back(std::make_shared<ChunksSorterTopn>(
                         state, &_sort_exprs, &_is_asc_order, &_is_null_first, _sort_keys, _offset, _partition_limit,
-                        _topn_type, ChunksSorterTopn::kDefaultMaxBufferRows, ChunksSorterTopn::kDefaultMaxBufferBytes,
+                        _topn_type, max_buffered_rows, ChunksSorterTopn::kDefaultMaxBufferBytes,
                         ChunksSorterTopn::max_buffered_chunks(_partition_limit)));
                 // create agg state for new partition
                 if (_enable_pre_agg) {
@@ -114,6 +114,12 @@ public:
     PipeObservable& observable() { return _observable; }
 
 private:
+    // The sorters of the first partitions buffer several chunks between two sorts, which keeps the sort cost low
+    // when the partitions are few and large. Beyond them the partitions are many and mostly small, e.g.
+    // `ROW_NUMBER() OVER (PARTITION BY user ORDER BY ts) <= 3`, so every sorter trims itself to its top rows as
+    // soon as more are buffered, and the memory stays bounded by the number of partitions times the limit.
+    static constexpr size_t kNumBufferedPartitions = 64;
+
     // Pull one chunk from one of the sorters
     // The output chunk stream is unordered
     StatusOr<ChunkPtr> pull_one_chunk_from_sorters();
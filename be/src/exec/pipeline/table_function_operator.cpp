@@ -125,7 +125,8 @@ StatusOr<ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* state) {
         output_columns.emplace_back(_table_function_result.first[i]->clone_empty());
     }
 
-    while (output_columns[0]->size() < max_chunk_size) {
+    _outer_row_indexes.clear();
+    while (_outer_row_indexes.size() < max_chunk_size) {
         if (!_table_function_result.first.empty() && _table_function_result.second->size() > 1 &&
             _next_output_row < _table_function_result.second->get_data().back()) {
             _copy_result(output_columns, max_chunk_size);
@@ -138,6 +139,12 @@ StatusOr<ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* state) {
         }
     }
 
+    // Gather the outer columns once for the whole output chunk
+    for (size_t i = 0; i < _outer_slots.size(); ++i) {
+        const ColumnPtr& input_column = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+        output_columns[i]->append_selective(*input_column, _outer_row_indexes.data(), 0, _outer_row_indexes.size());
+    }
+
     // Just return the chunk whether its full or not in order to keep the semantics of pipeline
     return _build_chunk(output_columns);
 }
@@ -204,7 +211,7 @@ void TableFunctionOperator::_copy_result(Columns& columns, uint32_t max_output_s
     DCHECK(_table_function_result.second->size() > 1 &&
            _next_output_row < _table_function_result.second->get_data().back());
     DCHECK_LT(_next_output_row_offset, _table_function_result.second->size());
-    uint32_t curr_output_size = columns[0]->size();
+    uint32_t curr_output_size = _outer_row_indexes.size();
     const auto& fn_result_cols = _table_function_result.first;
     const auto& offsets_col = _table_function_result.second;
     while (curr_output_size < max_output_size && _next_output_row < offsets_col->get_data().back()) {
@@ -219,17 +226,9 @@ void TableFunctionOperator::_copy_result(Columns& columns, uint32_t max_output_s
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
         if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
-            for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
-            }
+            // Repeat the input row of the outer data, which is gathered by pull_chunk
+            _outer_row_indexes.insert(_outer_row_indexes.end(), copy_rows,
+                                      _input_index_of_first_result + _next_output_row_offset);
 
             // Build table function result
             if (_fn_result_required) {
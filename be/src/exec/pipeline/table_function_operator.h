@@ -73,6 +73,9 @@ private:
     size_t _next_output_row_offset = 0;
     // table function result
     std::pair<Columns, UInt32Column::Ptr> _table_function_result;
+    // The input rows of the outer columns of the output chunk being built, the outer columns are gathered by them
+    // at once instead of being appended value by value.
+    std::vector<uint32_t> _outer_row_indexes;
     bool _fn_result_required = true;
     // table function param and return offset
     TableFunctionState* _table_function_state = nullptr;
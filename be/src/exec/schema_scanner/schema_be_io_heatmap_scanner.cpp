@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/schema_scanner/schema_be_io_heatmap_scanner.h"
+
+#include "agent/master_info.h"
+#include "exec/schema_scanner/schema_helper.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/string_value.h"
+#include "types/logical_type.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+SchemaScanner::ColumnDesc SchemaBeIOHeatmapScanner::_s_columns[] = {
+        {"BE_ID", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"TABLET_ID", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"COLUMN_UNIQUE_ID", TypeDescriptor::from_logical_type(TYPE_INT), sizeof(int32_t), false},
+        {"QUERY_ID", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), false},
+        {"READ_OPS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"READ_BYTES", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"READ_TIME_NS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"LAST_READ_TIME", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+};
+
+SchemaBeIOHeatmapScanner::SchemaBeIOHeatmapScanner()
+        : SchemaScanner(_s_columns, sizeof(_s_columns) / sizeof(SchemaScanner::ColumnDesc)) {}
+
+SchemaBeIOHeatmapScanner::~SchemaBeIOHeatmapScanner() = default;
+
+Status SchemaBeIOHeatmapScanner::start(RuntimeState* state) {
+    auto o_id = get_backend_id();
+    _be_id = o_id.has_value() ? o_id.value() : -1;
+    _infos = IOHeatmap::instance()->entries();
+    _cur_idx = 0;
+    return Status::OK();
+}
+
+Status SchemaBeIOHeatmapScanner::fill_chunk(ChunkPtr* chunk) {
+    const auto& slot_id_to_index_map = (*chunk)->get_slot_id_to_index_map();
+    auto end = _cur_idx + 1;
+    for (; _cur_idx < end; _cur_idx++) {
+        auto& info = _infos[_cur_idx];
+        for (const auto& [slot_id, index] : slot_id_to_index_map) {
+            if (slot_id < 1 || slot_id > 8) {
+                return Status::InternalError(strings::Substitute("invalid slot id:$0", slot_id));
+            }
+            ColumnPtr column = (*chunk)->get_column_by_slot_id(slot_id);
+            switch (slot_id) {
+            case 1: {
+                // be id
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&_be_id);
+                break;
+            }
+            case 2: {
+                // tablet id
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.key.tablet_id);
+                break;
+            }
+            case 3: {
+                // column unique id
+                fill_column_with_slot<TYPE_INT>(column.get(), (void*)&info.key.column_unique_id);
+                break;
+            }
+            case 4: {
+                // query id, empty for the reads out of a query
+                std::string query_id;
+                if (info.key.query_hi != 0 || info.key.query_lo != 0) {
+                    TUniqueId id;
+                    id.hi = info.key.query_hi;
+                    id.lo = info.key.query_lo;
+                    query_id = print_id(id);
+                }
+                Slice v(query_id);
+                fill_column_with_slot<TYPE_VARCHAR>(column.get(), (void*)&v);
+                break;
+            }
+            case 5: {
+                // read ops
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.read_ops);
+                break;
+            }
+            case 6: {
+                // read bytes
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.read_bytes);
+                break;
+            }
+            case 7: {
+                // read time
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.read_time_ns);
+                break;
+            }
+            case 8: {
+                // last read time, seconds since epoch
+                fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.last_read_time);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status SchemaBeIOHeatmapScanner::get_next(ChunkPtr* chunk, bool* eos) {
+    if (!_is_init) {
+        return Status::InternalError("call this before initial.");
+    }
+    if (_cur_idx >= _infos.size()) {
+        *eos = true;
+        return Status::OK();
+    }
+    if (nullptr == chunk || nullptr == eos) {
+        return Status::InternalError("invalid parameter.");
+    }
+    *eos = false;
+    return fill_chunk(chunk);
+}
+
+} // namespace starrocks
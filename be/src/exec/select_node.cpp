@@ -37,6 +37,7 @@
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/select_operator.h"
+#include "exprs/compound_predicate.h"
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
 
@@ -53,6 +54,7 @@ SelectNode::~SelectNode() {
 
 Status SelectNode::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::init(tnode, state));
+    RETURN_IF_ERROR(_fuse_compilable_conjuncts(state));
     if (tnode.__isset.select_node && tnode.select_node.__isset.common_slot_map) {
         for (const auto& [key, val] : tnode.select_node.common_slot_map) {
             ExprContext* context;
@@ -63,6 +65,54 @@ Status SelectNode::init(const TPlanNode& tnode, RuntimeState* state) {
     return Status::OK();
 }
 
+Status SelectNode::_fuse_compilable_conjuncts(RuntimeState* state) {
+#ifdef STARROCKS_JIT_ENABLE
+    if (state == nullptr || !state->is_jit_enabled()) {
+        return Status::OK();
+    }
+    std::vector<Expr*> compilable_conjuncts;
+    std::vector<ExprContext*> other_conjunct_ctxs;
+    for (auto* ctx : _conjunct_ctxs) {
+        if (ctx->root()->is_compilable(state)) {
+            compilable_conjuncts.emplace_back(ctx->root());
+        } else {
+            other_conjunct_ctxs.emplace_back(ctx);
+        }
+    }
+    if (compilable_conjuncts.size() < 2) {
+        return Status::OK();
+    }
+
+    // a row passes the conjuncts only if all of them are true, which is the same as their AND.
+    Expr* root = compilable_conjuncts.back();
+    for (auto it = compilable_conjuncts.rbegin() + 1; it != compilable_conjuncts.rend(); ++it) {
+        TExprNode and_pred_node;
+        and_pred_node.node_type = TExprNodeType::COMPOUND_PRED;
+        and_pred_node.num_children = 2;
+        and_pred_node.is_nullable = (*it)->is_nullable() || root->is_nullable();
+        and_pred_node.__set_opcode(TExprOpcode::COMPOUND_AND);
+        and_pred_node.__set_child_type(TPrimitiveType::BOOLEAN);
+        and_pred_node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        Expr* and_pred = _pool->add(VectorizedCompoundPredicateFactory::from_thrift(and_pred_node));
+        and_pred->add_child(*it);
+        and_pred->add_child(root);
+        root = and_pred;
+    }
+
+    bool replaced = false;
+    auto st = root->replace_compilable_exprs(&root, _pool, state, replaced);
+    if (!st.ok() || !replaced) {
+        // Fall back to evaluating the conjuncts one by one.
+        return Status::OK();
+    }
+    // the compiled conjuncts are the cheapest, evaluate them first to prune the chunk for the others.
+    _conjunct_ctxs.clear();
+    _conjunct_ctxs.emplace_back(_pool->add(new ExprContext(root)));
+    _conjunct_ctxs.insert(_conjunct_ctxs.end(), other_conjunct_ctxs.begin(), other_conjunct_ctxs.end());
+#endif
+    return Status::OK();
+}
+
 Status SelectNode::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::prepare(state));
     _conjunct_evaluate_timer = ADD_TIMER(_runtime_profile, "ConjunctEvaluateTime");
@@ -56,6 +56,10 @@ public:
             pipeline::PipelineBuilderContext* context) override;
 
 private:
+    // Fuse the compilable conjuncts into one JIT function, so they're evaluated into one filter by a single pass
+    // over the chunk rather than one boolean column and one filter pass per conjunct.
+    Status _fuse_compilable_conjuncts(RuntimeState* state);
+
     std::map<SlotId, ExprContext*> _common_expr_ctxs;
 
     RuntimeProfile::Counter* _conjunct_evaluate_timer = nullptr;
@@ -17,6 +17,8 @@
 
 #include "exec/short_circuit_hybrid.h"
 
+#include <numeric>
+
 #include "column/column_helper.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -186,54 +188,68 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
 
     std::vector<int> key_idx_to_value_idx(_num_rows, -1);
     int value_chunk_idx = 0;
+    // keys that no tablet has returned a value for yet, a key lives in exactly one tablet, so the
+    // later tablets only need to be probed with the keys left over by the former ones
+    std::vector<uint32_t> pending_key_idxes(_num_rows);
+    std::iota(pending_key_idxes.begin(), pending_key_idxes.end(), 0);
 
-    for (int i = 0; i < _tablets.size(); ++i) {
+    for (int i = 0; i < _tablets.size() && !pending_key_idxes.empty(); ++i) {
         LocalTableReaderParams params;
         params.version = std::stoi(_versions[i]);
         params.tablet_id = _tablets[i]->get_tablet_info().tablet_id;
         _table_reader = std::make_shared<TableReader>();
         RETURN_IF_ERROR(_table_reader->init(params));
 
-        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
-        // current tablet will return all key_chunk mapping whether has value
-        // true , means vector idx of key_chunk have value
+        Chunk* keys = _key_chunk.get();
+        ChunkUniquePtr pending_keys;
+        if (pending_key_idxes.size() < _num_rows) {
+            pending_keys = _key_chunk->clone_empty(pending_key_idxes.size());
+            pending_keys->append_selective(*_key_chunk, pending_key_idxes.data(), 0, pending_key_idxes.size());
+            keys = pending_keys.get();
+        }
+
+        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), keys->num_rows());
+        // current tablet will return found flags of all probed keys, in the order of probed keys
+        // true , means vector idx of probed keys have value
         std::vector<bool> curent_found;
-        Status status =
-                _table_reader->multi_get(*(_key_chunk.get()), value_field_names, curent_found, *(current_chunk.get()));
+        Status status = _table_reader->multi_get(*keys, value_field_names, curent_found, *(current_chunk.get()));
         if (!status.ok()) {
             // todo retry
             LOG(WARNING) << "fail to execute multi get: " << status.detailed_message();
             return status;
         }
+        if (UNLIKELY(curent_found.size() != pending_key_idxes.size())) {
+            return Status::InternalError(fmt::format("multi get found size not match, tablet_id: {}, {} != {}",
+                                                     params.tablet_id, curent_found.size(),
+                                                     pending_key_idxes.size()));
+        }
 
-        // merge all tablet result
-        bool has_found_value = false;
-        for (int key_idx = 0; key_idx < curent_found.size(); ++key_idx) {
-            // 1 tablet will have many value hit predicate, so here need foreach end
-            if (curent_found[key_idx] && key_idx_to_value_idx[key_idx] == -1) {
-                // make sure found order is same between key_chunk and value_chunk
-                key_idx_to_value_idx[key_idx] = value_chunk_idx;
-                value_chunk_idx++;
-                if (UNLIKELY(found[key_idx])) {
-                    return Status::Corruption(
-                            fmt::format("one key can't be found twice in short circuit, tablet_id: {}, key_idx: {}",
-                                        params.tablet_id, key_idx));
-                }
+        // merge all tablet result, make sure found order is same between key_chunk and value_chunk
+        size_t num_pending = 0;
+        for (size_t j = 0; j < curent_found.size(); ++j) {
+            uint32_t key_idx = pending_key_idxes[j];
+            if (curent_found[j]) {
+                key_idx_to_value_idx[key_idx] = value_chunk_idx++;
                 found[key_idx] = true;
-                has_found_value = true;
+            } else {
+                pending_key_idxes[num_pending++] = key_idx;
             }
         }
-        if (has_found_value) {
+        pending_key_idxes.resize(num_pending);
+        if (current_chunk->num_rows() > 0) {
             value_chunk->append(*(current_chunk.get()));
         }
     }
 
-    // transform  value
-    for (int key_idx = 0; key_idx < key_idx_to_value_idx.size(); ++key_idx) {
-        if (key_idx_to_value_idx[key_idx] != -1) {
-            _value_chunk->append(*(value_chunk.get()), key_idx_to_value_idx[key_idx], 1);
+    // transform value
+    std::vector<uint32_t> value_idxes;
+    value_idxes.reserve(value_chunk_idx);
+    for (int value_idx : key_idx_to_value_idx) {
+        if (value_idx != -1) {
+            value_idxes.emplace_back(value_idx);
         }
     }
+    _value_chunk->append_selective(*(value_chunk.get()), value_idxes.data(), 0, value_idxes.size());
 
     return Status::OK();
 }
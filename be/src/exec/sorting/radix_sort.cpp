@@ -0,0 +1,274 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "column/array_column.h"
+#include "column/binary_column.h"
+#include "column/column.h"
+#include "column/column_visitor_adapter.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/json_column.h"
+#include "column/map_column.h"
+#include "column/nullable_column.h"
+#include "column/object_column.h"
+#include "column/struct_column.h"
+#include "exec/sorting/sorting.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+
+namespace starrocks {
+
+// Width in bytes of the normalized key of a fixed length type, 0 means the type is not supported.
+template <class T>
+static constexpr size_t radix_key_width() {
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(int64_t)) {
+        return sizeof(T);
+    } else if constexpr (std::is_same_v<T, DateValue>) {
+        return sizeof(int32_t);
+    } else if constexpr (std::is_same_v<T, TimestampValue>) {
+        return sizeof(int64_t);
+    } else {
+        return 0;
+    }
+}
+
+// Normalize the value into an unsigned integer, whose order is the same as the value's.
+template <class T>
+static inline uint64_t radix_normalize(const T& value) {
+    if constexpr (std::is_same_v<T, DateValue>) {
+        return radix_normalize<int32_t>(value.julian());
+    } else if constexpr (std::is_same_v<T, TimestampValue>) {
+        return radix_normalize<int64_t>(value.timestamp());
+    } else {
+        using U = std::make_unsigned_t<T>;
+        U u = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>) {
+            u ^= U(1) << (sizeof(T) * 8 - 1);
+        }
+        return u;
+    }
+}
+
+// Encode the sort key columns into the byte-comparable composite keys, the first sort key takes the most significant
+// bytes. A nullable key with nulls takes an extra null flag byte before its value.
+// If `keys` is nullptr, only the width of the composite key is calculated.
+template <class KeyType>
+class RadixKeyEncoder final : public ColumnVisitorAdapter<RadixKeyEncoder<KeyType>> {
+public:
+    RadixKeyEncoder(const SortDesc& sort_desc, Buffer<KeyType>* keys)
+            : ColumnVisitorAdapter<RadixKeyEncoder<KeyType>>(this), _sort_desc(sort_desc), _keys(keys) {}
+
+    size_t key_width() const { return _key_width; }
+
+    Status do_visit(const NullableColumn& column) {
+        if (!column.has_null()) {
+            return column.data_column_ref().accept(this);
+        }
+        _null_data = column.immutable_null_column_data().data();
+        if (_keys != nullptr) {
+            const uint8_t null_flag = _sort_desc.is_null_first() ? 0 : 1;
+            _append_code(sizeof(uint8_t), [&](size_t i) -> uint64_t { return _null_data[i] ? null_flag : !null_flag; });
+        }
+        _key_width += sizeof(uint8_t);
+        return column.data_column_ref().accept(this);
+    }
+
+    Status do_visit(const ConstColumn& column) {
+        // a constant key never changes the order
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        constexpr size_t width = radix_key_width<T>();
+        if constexpr (width == 0) {
+            return Status::NotSupported("not support radix sort");
+        } else {
+            if (_keys != nullptr) {
+                const auto& data = column.get_data();
+                const uint64_t mask = width == sizeof(uint64_t) ? ~0ULL : (1ULL << (width * 8)) - 1;
+                const bool asc = _sort_desc.asc_order();
+                const uint8_t* null_data = _null_data;
+                _append_code(width, [&](size_t i) -> uint64_t {
+                    if (null_data != nullptr && null_data[i]) {
+                        return 0;
+                    }
+                    uint64_t code = radix_normalize<T>(data[i]);
+                    return asc ? code : ~code & mask;
+                });
+            }
+            _key_width += width;
+            return Status::OK();
+        }
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        return Status::NotSupported("not support radix sort");
+    }
+
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("not support radix sort");
+    }
+
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("not support radix sort"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("not support radix sort"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("not support radix sort"); }
+    Status do_visit(const JsonColumn& column) { return Status::NotSupported("not support radix sort"); }
+
+private:
+    template <class CodeFunc>
+    void _append_code(size_t width, CodeFunc&& code_func) {
+        auto& keys = *_keys;
+        if (width == sizeof(KeyType)) {
+            for (size_t i = 0; i < keys.size(); i++) {
+                keys[i] = code_func(i);
+            }
+        } else {
+            for (size_t i = 0; i < keys.size(); i++) {
+                keys[i] = (keys[i] << (width * 8)) | code_func(i);
+            }
+        }
+    }
+
+    const SortDesc& _sort_desc;
+    Buffer<KeyType>* _keys;
+    const uint8_t* _null_data = nullptr;
+    size_t _key_width = 0;
+};
+
+template <class KeyType>
+struct RadixSortItem {
+    KeyType key;
+    uint32_t index_in_chunk;
+};
+
+// LSD radix sort by bytes, the passes whose bytes are the same for all the items are skipped.
+template <class KeyType>
+static Status lsd_radix_sort(const std::atomic<bool>& cancel, std::vector<RadixSortItem<KeyType>>* items,
+                             size_t key_bytes) {
+    const size_t num_rows = items->size();
+    using Histogram = std::array<uint32_t, 256>;
+    std::vector<Histogram> histograms(key_bytes, Histogram{});
+    for (const auto& item : *items) {
+        for (size_t b = 0; b < key_bytes; b++) {
+            histograms[b][static_cast<uint8_t>(item.key >> (b * 8))]++;
+        }
+    }
+
+    std::vector<RadixSortItem<KeyType>> buffer(num_rows);
+    for (size_t b = 0; b < key_bytes; b++) {
+        if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+            return Status::Cancelled("Sort cancelled");
+        }
+        Histogram& offsets = histograms[b];
+        if (std::find(offsets.begin(), offsets.end(), num_rows) != offsets.end()) {
+            continue;
+        }
+        uint32_t sum = 0;
+        for (auto& offset : offsets) {
+            uint32_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (const auto& item : *items) {
+            buffer[offsets[static_cast<uint8_t>(item.key >> (b * 8))]++] = item;
+        }
+        items->swap(buffer);
+    }
+    return Status::OK();
+}
+
+template <class KeyType>
+static Status radix_sort_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                                 size_t key_bytes, Permutation* permutation) {
+    const size_t num_rows = columns[0]->size();
+    Buffer<KeyType> keys(num_rows, 0);
+    for (size_t col = 0; col < columns.size(); col++) {
+        RadixKeyEncoder<KeyType> encoder(sort_desc.descs[col], &keys);
+        RETURN_IF_ERROR(columns[col]->accept(&encoder));
+    }
+
+    std::vector<RadixSortItem<KeyType>> items(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        items[i] = {keys[i], i};
+    }
+    keys = Buffer<KeyType>();
+    RETURN_IF_ERROR(lsd_radix_sort(cancel, &items, key_bytes));
+
+    permutation->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        (*permutation)[i] = PermutationItem(0, items[i].index_in_chunk);
+    }
+    return Status::OK();
+}
+
+StatusOr<bool> radix_sort_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                                  Permutation* permutation) {
+    if (columns.empty()) {
+        return false;
+    }
+    size_t key_bytes = 0;
+    for (size_t col = 0; col < columns.size(); col++) {
+        RadixKeyEncoder<__uint128_t> encoder(sort_desc.descs[col], nullptr);
+        if (!columns[col]->accept(&encoder).ok()) {
+            return false;
+        }
+        key_bytes += encoder.key_width();
+    }
+
+    if (key_bytes == 0 || key_bytes > sizeof(__uint128_t)) {
+        return false;
+    }
+    if (key_bytes <= sizeof(uint64_t)) {
+        RETURN_IF_ERROR(radix_sort_columns<uint64_t>(cancel, columns, sort_desc, key_bytes, permutation));
+    } else {
+        RETURN_IF_ERROR(radix_sort_columns<__uint128_t>(cancel, columns, sort_desc, key_bytes, permutation));
+    }
+    return true;
+}
+
+ColumnPtr encode_sort_key_prefix(const Columns& columns, const SortDescs& sort_desc, size_t* num_encoded_columns) {
+    *num_encoded_columns = 0;
+    size_t key_bytes = 0;
+    size_t num_columns = 0;
+    for (; num_columns < columns.size(); num_columns++) {
+        RadixKeyEncoder<uint64_t> encoder(sort_desc.descs[num_columns], nullptr);
+        if (!columns[num_columns]->accept(&encoder).ok() || key_bytes + encoder.key_width() > sizeof(uint64_t)) {
+            break;
+        }
+        key_bytes += encoder.key_width();
+    }
+    // a single key is already sorted with its inlined value
+    if (num_columns < 2 || key_bytes == 0) {
+        return nullptr;
+    }
+
+    auto prefix = UInt64Column::create(columns[0]->size(), 0);
+    for (size_t col = 0; col < num_columns; col++) {
+        RadixKeyEncoder<uint64_t> encoder(sort_desc.descs[col], &prefix->get_data());
+        if (!columns[col]->accept(&encoder).ok()) {
+            return nullptr;
+        }
+    }
+    *num_encoded_columns = num_columns;
+    return prefix;
+}
+
+} // namespace starrocks
@@ -27,9 +27,12 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
+#include "gutil/strings/fastmem.h"
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks {
@@ -96,6 +99,32 @@ static Status sort_and_tie_helper_nullable(const std::atomic<bool>& cancel, cons
     return sort_and_tie_column(cancel, data_column.get(), sort_desc, permutation, tie, std::move(ranges), build_tie);
 }
 
+// A string with its first 8 bytes inlined in big-endian order, like the prefix of a German string.
+// Strings whose prefix differ are compared by the integer prefix without dereferencing the string data,
+// since zero padding never reverses the order of two byte strings.
+struct PrefixedSlice {
+    PrefixedSlice() = default;
+    PrefixedSlice(const Slice& s) : slice(s) {
+        if (s.size >= sizeof(uint64_t)) {
+            prefix = BigEndian::Load64(s.data);
+        } else {
+            uint64_t value = 0;
+            strings::memcpy_inlined(&value, s.data, s.size);
+            prefix = BigEndian::ToHost64(value);
+        }
+    }
+
+    int compare(const PrefixedSlice& rhs) const {
+        if (prefix != rhs.prefix) {
+            return prefix < rhs.prefix ? -1 : 1;
+        }
+        return slice.compare(rhs.slice);
+    }
+
+    uint64_t prefix = 0;
+    Slice slice;
+};
+
 // Sort a column by permtuation
 template <RangeOrRanges R>
 class ColumnSorter final : public ColumnVisitorAdapter<ColumnSorter<R>> {
@@ -170,12 +199,12 @@ public:
             DCHECK_GE(column.size(), _permutation.size());
         }
 
-        using ItemType = InlinePermuteItem<Slice>;
+        using ItemType = InlinePermuteItem<PrefixedSlice>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice, IS_RANGES>(_permutation, column.get_proxy_data());
+        auto inlined = create_inline_permutation<PrefixedSlice, IS_RANGES>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp,
                                             _range_or_ranges, _build_tie));
         restore_inline_permutation(inlined, _permutation);
@@ -503,11 +532,28 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
         return Status::OK();
     }
     size_t num_rows = columns[0]->size();
+    if (config::enable_radix_sort && num_rows >= static_cast<size_t>(config::radix_sort_min_rows)) {
+        ASSIGN_OR_RETURN(bool sorted, radix_sort_columns(cancel, columns, sort_desc, permutation));
+        if (sorted) {
+            return Status::OK();
+        }
+    }
     Tie tie(num_rows, 1);
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    // Sort the leading fixed-width columns at once by their normalized key, the rest columns only break the ties.
+    size_t first_column = 0;
+    if (config::enable_sort_key_prefix && columns.size() > 1) {
+        ColumnPtr prefix = encode_sort_key_prefix(columns, sort_desc, &first_column);
+        if (prefix != nullptr) {
+            bool build_tie = first_column != columns.size();
+            RETURN_IF_ERROR(sort_and_tie_column(cancel, prefix, SortDesc(true, true), small_perm, tie, range,
+                                                build_tie));
+        }
+    }
+
+    for (int col_index = first_column; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool build_tie = col_index != columns.size() - 1;
         RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), small_perm, tie,
@@ -20,6 +20,7 @@
 #include "column/datum.h"
 #include "column/nullable_column.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exec/sorting/sort_permute.h"
 #include "runtime/chunk_cursor.h"
 
@@ -43,6 +44,16 @@ Status sort_and_tie_column(const std::atomic<bool>& cancel, const ColumnPtr& col
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                             Permutation* permutation);
 
+// Sort multiple fixed-width columns by LSD radix sort over their byte-comparable composite keys, output the order in
+// permutation array. Return false and leave permutation untouched if the keys can't be encoded into 16 bytes.
+StatusOr<bool> radix_sort_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                                  Permutation* permutation);
+
+// Encode the leading fixed-width sort columns which fit into 8 bytes into a memcmp-able normalized key column, whose
+// order is the same as the order of these columns. Return nullptr if less than two columns could be encoded.
+// @param num_encoded_columns output the number of the encoded leading columns
+ColumnPtr encode_sort_key_prefix(const Columns& columns, const SortDescs& sort_desc, size_t* num_encoded_columns);
+
 /// Usually used to sort array columns.
 ///
 /// Sort each part of key columns, and write the result to perm. perm corresponds to src_offsets. The range of the i-th
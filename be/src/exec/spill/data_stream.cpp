@@ -81,6 +81,12 @@ Status BlockSpillOutputDataStream::append(RuntimeState* state, const std::vector
                                           size_t write_num_rows) {
     // acquire block if current block is nullptr or full
     RETURN_IF_ERROR(_prepare_block(state, total_write_size));
+    if (!_cur_block->try_acquire_sizes(total_write_size)) {
+        // the space of the current block is used up, switch to a new block,
+        // which may be allocated from another dir or from the remote storage.
+        RETURN_IF_ERROR(flush());
+        RETURN_IF_ERROR(_prepare_block(state, total_write_size));
+    }
     _append_rows += write_num_rows;
     {
         auto write_io_timer = GET_METRICS(_cur_block->is_remote(), _spiller->metrics(), write_io_timer);
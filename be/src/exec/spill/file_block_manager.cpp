@@ -135,6 +135,8 @@ Status FileBlockContainer::flush() {
 StatusOr<std::unique_ptr<io::InputStreamWrapper>> FileBlockContainer::get_readable() {
     std::string file_path = path();
     ASSIGN_OR_RETURN(auto f, _dir->fs()->new_sequential_file(file_path));
+    // the whole block will be restored sequentially, let the disk load it while the former chunks are deserialized
+    f->prefetch(0, _data_size);
     return f;
 }
 
@@ -171,6 +171,8 @@ StatusOr<std::unique_ptr<io::InputStreamWrapper>> LogBlockContainer::get_readabl
     std::string file_path = path();
     ASSIGN_OR_RETURN(auto f, _dir->fs()->new_sequential_file(file_path));
     RETURN_IF_ERROR(f->skip(offset));
+    // the whole block will be restored sequentially, let the disk load it while the former chunks are deserialized
+    f->prefetch(offset, length);
     return f;
 }
 
@@ -0,0 +1,165 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/memory_block_manager.h"
+
+#include <algorithm>
+#include <string>
+
+#include "exec/spill/common.h"
+#include "fmt/format.h"
+#include "io/array_input_stream.h"
+
+namespace starrocks::spill {
+
+// The quota is shared by the manager and the blocks, since the blocks may be released after the manager.
+class MemoryBlockQuota {
+public:
+    MemoryBlockQuota(size_t max_bytes) : _max_bytes(max_bytes) {}
+
+    bool try_acquire(size_t size) {
+        size_t used = _used_bytes.load(std::memory_order_relaxed);
+        do {
+            if (used + size > _max_bytes) {
+                return false;
+            }
+        } while (!_used_bytes.compare_exchange_weak(used, used + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    void force_acquire(size_t size) { _used_bytes.fetch_add(size, std::memory_order_relaxed); }
+
+    void release(size_t size) { _used_bytes.fetch_sub(size, std::memory_order_relaxed); }
+
+    size_t used_bytes() const { return _used_bytes.load(std::memory_order_relaxed); }
+
+private:
+    const size_t _max_bytes;
+    std::atomic<size_t> _used_bytes = 0;
+};
+
+class MemoryBlockReader final : public BlockReader {
+public:
+    MemoryBlockReader(const Block* block, const BlockReaderOptions& options) : BlockReader(block, options) {
+        // the data is already in memory, there is no need to copy it into another buffer
+        _options.enable_buffer_read = false;
+    }
+
+    ~MemoryBlockReader() override = default;
+
+    std::string debug_string() override { return _block->debug_string(); }
+
+    const Block* block() const override { return _block; }
+};
+
+class MemoryBlock final : public Block {
+public:
+    MemoryBlock(MemoryBlockQuotaPtr quota, size_t acquired_size)
+            : _quota(std::move(quota)), _acquired_size(acquired_size) {}
+
+    ~MemoryBlock() override { _quota->release(_acquired_size); }
+
+    Status append(const std::vector<Slice>& data) override {
+        size_t total_size = 0;
+        std::for_each(data.begin(), data.end(), [&](const Slice& slice) { total_size += slice.size; });
+        if (_size + total_size > _acquired_size) {
+            // the block is already in memory, it's cheaper to exceed the quota a little than to rewrite it to disk
+            size_t extra_size = _size + total_size - _acquired_size;
+            _quota->force_acquire(extra_size);
+            _acquired_size += extra_size;
+        }
+        for (const auto& slice : data) {
+            _data.append(slice.data, slice.size);
+        }
+        _size += total_size;
+        return Status::OK();
+    }
+
+    Status flush() override {
+        _data.shrink_to_fit();
+        return Status::OK();
+    }
+
+    StatusOr<std::unique_ptr<io::InputStreamWrapper>> get_readable() const override {
+        return std::make_unique<io::InputStreamWrapper>(std::make_unique<io::ArrayInputStream>(_data.data(), _size));
+    }
+
+    std::shared_ptr<BlockReader> get_reader(const BlockReaderOptions& options) override {
+        return std::make_shared<MemoryBlockReader>(this, options);
+    }
+
+    std::string debug_string() const override { return fmt::format("MemoryBlock:{}[len={}]", (void*)this, _size); }
+
+    bool try_acquire_sizes(size_t size) override {
+        if (_size + size <= _acquired_size) {
+            return true;
+        }
+        size_t extra_size = _size + size - _acquired_size;
+        if (_quota->try_acquire(extra_size)) {
+            _acquired_size += extra_size;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    MemoryBlockQuotaPtr _quota;
+    size_t _acquired_size;
+    std::string _data;
+};
+
+MemoryBlockManager::MemoryBlockManager(const TUniqueId& query_id, size_t max_bytes,
+                                       std::unique_ptr<BlockManager> spill_block_manager)
+        : _quota(std::make_shared<MemoryBlockQuota>(max_bytes)),
+          _spill_block_manager(std::move(spill_block_manager)) {}
+
+MemoryBlockManager::~MemoryBlockManager() {
+    _spill_block_manager.reset();
+}
+
+Status MemoryBlockManager::open() {
+    return _spill_block_manager->open();
+}
+
+void MemoryBlockManager::close() {
+    _spill_block_manager->close();
+}
+
+StatusOr<BlockPtr> MemoryBlockManager::acquire_block(const AcquireBlockOptions& opts) {
+    if (!opts.force_remote && _quota->try_acquire(opts.block_size)) {
+        auto block = std::make_shared<MemoryBlock>(_quota, opts.block_size);
+        block->set_affinity_group(opts.affinity_group);
+        TRACE_SPILL_LOG << "allocate memory block: " << block->debug_string();
+        return block;
+    }
+    return _spill_block_manager->acquire_block(opts);
+}
+
+Status MemoryBlockManager::release_block(BlockPtr block) {
+    if (dynamic_cast<MemoryBlock*>(block.get()) != nullptr) {
+        // the memory is released when the block is destroyed
+        return Status::OK();
+    }
+    return _spill_block_manager->release_block(std::move(block));
+}
+
+Status MemoryBlockManager::release_affinity_group(const BlockAffinityGroup affinity_group) {
+    return _spill_block_manager->release_affinity_group(affinity_group);
+}
+
+size_t MemoryBlockManager::memory_usage() const {
+    return _quota->used_bytes();
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,53 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "exec/spill/block_manager.h"
+#include "gen_cpp/Types_types.h"
+
+namespace starrocks::spill {
+
+class MemoryBlockQuota;
+using MemoryBlockQuotaPtr = std::shared_ptr<MemoryBlockQuota>;
+
+// MemoryBlockManager is an in-memory tier in front of another BlockManager.
+// The data written to a spill block has already been serialized and encoded by the spill serde
+// (with LZ4 for the binary columns if the encode level enables it), so keeping the blocks in memory
+// costs much less than keeping the original hash table partitions or chunks.
+// Blocks are kept in memory until the quota of the query (`spill_mem_block_max_bytes`) is used up,
+// then the later blocks are allocated from the underlying BlockManager and written to disk.
+// NOTE: the quota is only checked when a block is acquired, so a block may exceed it by one flush.
+class MemoryBlockManager : public BlockManager {
+public:
+    MemoryBlockManager(const TUniqueId& query_id, size_t max_bytes, std::unique_ptr<BlockManager> spill_block_manager);
+    ~MemoryBlockManager() override;
+
+    Status open() override;
+    void close() override;
+    StatusOr<BlockPtr> acquire_block(const AcquireBlockOptions& opts) override;
+    Status release_block(BlockPtr block) override;
+    Status release_affinity_group(const BlockAffinityGroup affinity_group) override;
+
+    size_t memory_usage() const;
+
+private:
+    MemoryBlockQuotaPtr _quota;
+    std::unique_ptr<BlockManager> _spill_block_manager;
+};
+
+} // namespace starrocks::spill
@@ -17,16 +17,27 @@
 #include <cstdint>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/spill/dir_manager.h"
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
+#include "exec/spill/memory_block_manager.h"
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::spill {
 
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
+    RETURN_IF_ERROR(_init_spill_block_manager(query_options));
+    if (config::spill_mem_block_max_bytes_per_query > 0) {
+        _block_manager = std::make_unique<MemoryBlockManager>(_uid, config::spill_mem_block_max_bytes_per_query,
+                                                              std::move(_block_manager));
+    }
+    return Status::OK();
+}
+
+Status QuerySpillManager::_init_spill_block_manager(const TQueryOptions& query_options) {
     const TSpillOptions& spill_options = query_options.spill_options;
     bool enable_spill_to_remote_storage =
             spill_options.__isset.enable_spill_to_remote_storage && spill_options.enable_spill_to_remote_storage;
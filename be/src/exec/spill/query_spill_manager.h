@@ -42,6 +42,9 @@ public:
     BlockManager* block_manager() const { return _block_manager.get(); }
 
 private:
+    // create the block manager that writes the spilled blocks to local disk or remote storage
+    Status _init_spill_block_manager(const TQueryOptions& query_options);
+
     TUniqueId _uid;
     std::unique_ptr<BlockManager> _block_manager;
     std::unique_ptr<DirManager> _remote_dir_manager;
@@ -353,7 +353,7 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
         for (const auto& [pid, partition] : _id_to_partitions) {
             const auto& mem_table = partition->spill_writer->mem_table();
             // partition not in memory
-            if (!partition->in_mem && partition->level < config::spill_max_partition_level &&
+            if (!partition->in_mem && !partition->is_skewed && partition->level < config::spill_max_partition_level &&
                 mem_table->mem_usage() + partition->bytes > options().spill_mem_table_bytes_size) {
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -526,7 +526,6 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     auto io_task = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
     auto& flush_ctx = std::static_pointer_cast<PartitionedFlushContext>(io_task)->split_stage_ctx;
 
-    // TODO: check skew data here
     for (; flush_ctx.spliting_idx < splitting_partitions.size(); flush_ctx.spliting_idx++) {
         // split stage
         auto partition = splitting_partitions[flush_ctx.spliting_idx];
@@ -569,6 +568,13 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
         DCHECK_EQ(flush_ctx.left->spill_writer->block_group_num_rows(), flush_ctx.left->num_rows);
         DCHECK_EQ(flush_ctx.right->spill_writer->block_group_num_rows(), flush_ctx.right->num_rows);
 
+        // check skew data: if the split moved all rows to one side, the other hash bits won't help either
+        if (partition->num_rows > 0 && (flush_ctx.left->empty() || flush_ctx.right->empty())) {
+            auto& skewed = flush_ctx.left->empty() ? flush_ctx.right : flush_ctx.left;
+            skewed->is_skewed = true;
+            TRACE_SPILL_LOG << "skewed partition detected: " << skewed->debug_string();
+        }
+
         _add_partition(std::move(flush_ctx.right));
         _add_partition(std::move(flush_ctx.left));
 
@@ -217,11 +217,14 @@ struct SpilledPartition : public SpillPartitionInfo {
     }
 
     std::string debug_string() {
-        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={}]", partition_id, bytes,
-                           mem_size, num_rows, in_mem, is_spliting);
+        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={},is_skewed={}]",
+                           partition_id, bytes, mem_size, num_rows, in_mem, is_spliting, is_skewed);
     }
 
     bool is_spliting = false;
+    // all the rows of the parent partition went into this partition when it was split, which usually means
+    // the rows share a few hot keys. Splitting it again only rewrites the same data, so it won't be split.
+    bool is_skewed = false;
     std::unique_ptr<RawSpillerWriter> spill_writer;
     BlockGroupPtr block_group;
     SpillOutputDataStreamPtr spill_output_stream;
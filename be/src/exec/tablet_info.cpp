@@ -14,12 +14,18 @@
 
 #include "exec/tablet_info.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "column/binary_column.h"
 #include "column/chunk.h"
+#include "column/type_traits.h"
 #include "exprs/expr.h"
 #include "runtime/mem_pool.h"
 #include "storage/tablet_schema.h"
 #include "types/constexpr.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
 #include "util/string_parser.hpp"
 
 namespace starrocks {
@@ -477,6 +483,7 @@ Status OlapTablePartitionParam::_create_partition_keys(const std::vector<TExprNo
 }
 
 Status OlapTablePartitionParam::add_partitions(const std::vector<TOlapTablePartition>& partitions) {
+    _int64_range_bounds_built = false;
     for (auto& t_part : partitions) {
         if (_partitions.count(t_part.id) != 0) {
             continue;
@@ -558,6 +565,7 @@ Status OlapTablePartitionParam::add_partitions(const std::vector<TOlapTableParti
 }
 
 Status OlapTablePartitionParam::remove_partitions(const std::vector<int64_t>& partition_ids) {
+    _int64_range_bounds_built = false;
     for (auto& id : partition_ids) {
         auto it = _partitions.find(id);
         if (it == _partitions.end()) {
@@ -685,6 +693,178 @@ Status OlapTablePartitionParam::_find_tablets_with_range_partition(
     return Status::OK();
 }
 
+template <typename T>
+static int64_t partition_key_to_int64(const T& v) {
+    return static_cast<int64_t>(v);
+}
+
+static int64_t partition_key_to_int64(const DateValue& v) {
+    return v.julian();
+}
+
+static int64_t partition_key_to_int64(const TimestampValue& v) {
+    return v.timestamp();
+}
+
+template <LogicalType LT>
+static bool flatten_partition_keys(const Column* data_column, size_t from, size_t size, int64_t* keys) {
+    const auto* column = dynamic_cast<const RunTimeColumnType<LT>*>(data_column);
+    if (column == nullptr) {
+        return false;
+    }
+    const auto* data = column->get_data().data() + from;
+    for (size_t i = 0; i < size; ++i) {
+        keys[i] = partition_key_to_int64(data[i]);
+    }
+    return true;
+}
+
+// Map the values of an integer or date column to int64_t with their order kept, return false for other types.
+static bool flatten_partition_keys(LogicalType type, const Column* data_column, size_t from, size_t size,
+                                   int64_t* keys) {
+    switch (type) {
+    case TYPE_TINYINT:
+        return flatten_partition_keys<TYPE_TINYINT>(data_column, from, size, keys);
+    case TYPE_SMALLINT:
+        return flatten_partition_keys<TYPE_SMALLINT>(data_column, from, size, keys);
+    case TYPE_INT:
+        return flatten_partition_keys<TYPE_INT>(data_column, from, size, keys);
+    case TYPE_BIGINT:
+        return flatten_partition_keys<TYPE_BIGINT>(data_column, from, size, keys);
+    case TYPE_DATE:
+        return flatten_partition_keys<TYPE_DATE>(data_column, from, size, keys);
+    case TYPE_DATETIME:
+        return flatten_partition_keys<TYPE_DATETIME>(data_column, from, size, keys);
+    default:
+        return false;
+    }
+}
+
+bool OlapTablePartitionParam::_build_int64_range_bounds() {
+    _int64_range_ends.clear();
+    _int64_range_parts.clear();
+    if (_partition_slot_descs.size() != 1) {
+        return false;
+    }
+    const LogicalType type = _partition_slot_descs[0]->type().type;
+    bool has_max = false;
+    for (const auto& [end_key, part_ids] : _partitions_map) {
+        // MAXVALUE is the max key, so it is the last one
+        if (has_max) {
+            return false;
+        }
+        if (end_key->columns == nullptr) {
+            has_max = true;
+        } else {
+            const ColumnPtr& column = (*end_key->columns)[0];
+            int64_t end = 0;
+            if (column->is_null(end_key->index) ||
+                !flatten_partition_keys(type, ColumnHelper::get_data_column(column.get()), end_key->index, 1, &end)) {
+                return false;
+            }
+            _int64_range_ends.emplace_back(end);
+        }
+
+        auto& parts = _int64_range_parts.emplace_back();
+        for (int64_t part_id : part_ids) {
+            auto it = _partitions.find(part_id);
+            if (it == _partitions.end() || it->second == nullptr) {
+                return false;
+            }
+            OlapTablePartition* part = it->second;
+            Int64RangePart range_part{part, false, 0};
+            if (part->start_key.columns != nullptr) {
+                const ColumnPtr& column = (*part->start_key.columns)[0];
+                // a null lower bound is the min value, as boundless
+                if (!column->is_null(part->start_key.index)) {
+                    if (!flatten_partition_keys(type, ColumnHelper::get_data_column(column.get()),
+                                                part->start_key.index, 1, &range_part.start)) {
+                        return false;
+                    }
+                    range_part.has_start = true;
+                }
+            }
+            parts.emplace_back(range_part);
+        }
+    }
+    return true;
+}
+
+Status OlapTablePartitionParam::_find_tablets_with_int64_range_partition(
+        Chunk* chunk, const Columns& partition_columns, const std::vector<uint32_t>& hashes,
+        std::vector<OlapTablePartition*>* partitions, std::vector<uint8_t>* selection,
+        std::vector<int>* invalid_row_indexs, std::vector<std::vector<std::string>>* partition_not_exist_row_values) {
+    if (!_int64_range_bounds_built) {
+        _int64_range_bounds_usable = _build_int64_range_bounds();
+        _int64_range_bounds_built = true;
+    }
+    size_t num_rows = chunk->num_rows();
+    const Column* column = partition_columns[0].get();
+    _int64_partition_keys.resize(num_rows);
+    if (!_int64_range_bounds_usable ||
+        !flatten_partition_keys(_partition_slot_descs[0]->type().type, ColumnHelper::get_data_column(column), 0,
+                                num_rows, _int64_partition_keys.data())) {
+        return _find_tablets_with_range_partition(chunk, partition_columns, hashes, partitions, selection,
+                                                  invalid_row_indexs, partition_not_exist_row_values);
+    }
+
+    const bool has_null = column->has_null();
+    const size_t num_bounds = _int64_range_parts.size();
+    // The rows of a load are often ordered by the partition column, so the bound of the previous row is tried first.
+    size_t bound = num_bounds;
+    int64_t bound_low = 0;
+    int64_t bound_high = 0;
+    // the rows which are null or not found, they are left to the generic lookup which reports them
+    std::vector<uint8_t> unresolved;
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (!(*selection)[i]) {
+            continue;
+        }
+        if (has_null && column->is_null(i)) {
+            unresolved.resize(num_rows, 0);
+            unresolved[i] = 1;
+            continue;
+        }
+        const int64_t key = _int64_partition_keys[i];
+        if (bound == num_bounds || key < bound_low || key >= bound_high) {
+            // the first end key greater than the key
+            bound = std::upper_bound(_int64_range_ends.begin(), _int64_range_ends.end(), key) -
+                    _int64_range_ends.begin();
+            bound_low = bound == 0 ? std::numeric_limits<int64_t>::min() : _int64_range_ends[bound - 1];
+            bound_high = bound < _int64_range_ends.size() ? _int64_range_ends[bound]
+                                                          : std::numeric_limits<int64_t>::max();
+        }
+        OlapTablePartition* part = nullptr;
+        if (bound < num_bounds && !_int64_range_parts[bound].empty()) {
+            const auto& parts = _int64_range_parts[bound];
+            const auto& range_part = parts[hashes[i] % parts.size()];
+            if (!range_part.has_start || key >= range_part.start) {
+                part = range_part.part;
+            }
+        }
+        if (part != nullptr) {
+            (*partitions)[i] = part;
+        } else {
+            unresolved.resize(num_rows, 0);
+            unresolved[i] = 1;
+        }
+    }
+    if (unresolved.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<uint8_t> unresolved_selection = unresolved;
+    RETURN_IF_ERROR(_find_tablets_with_range_partition(chunk, partition_columns, hashes, partitions,
+                                                       &unresolved_selection, invalid_row_indexs,
+                                                       partition_not_exist_row_values));
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (unresolved[i] && !unresolved_selection[i]) {
+            (*selection)[i] = 0;
+        }
+    }
+    return Status::OK();
+}
+
 Status OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTablePartition*>* partitions,
                                              std::vector<uint32_t>* hashes, std::vector<uint8_t>* selection,
                                              std::vector<int>* invalid_row_indexs, int64_t txn_id,
@@ -713,6 +893,9 @@ Status OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTable
         if (is_list_partition) {
             return _find_tablets_with_list_partition(chunk, partition_columns, *hashes, partitions, selection,
                                                      invalid_row_indexs, partition_not_exist_row_values);
+        } else if (partition_columns.size() == 1) {
+            return _find_tablets_with_int64_range_partition(chunk, partition_columns, *hashes, partitions, selection,
+                                                            invalid_row_indexs, partition_not_exist_row_values);
         } else {
             return _find_tablets_with_range_partition(chunk, partition_columns, *hashes, partitions, selection,
                                                       invalid_row_indexs, partition_not_exist_row_values);
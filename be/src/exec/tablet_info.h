@@ -305,6 +305,22 @@ private:
                                              std::vector<uint8_t>* selection, std::vector<int>* invalid_row_indexs,
                                              std::vector<std::vector<std::string>>* partition_not_exist_row_values);
 
+    /**
+     * @brief  find tablets with range partition table of a single integer or date partition column, which
+     *         binary searches the flattened partition bounds rather than _partitions_map with a virtual
+     *         compare_at() per row. The rows it can not resolve are left to _find_tablets_with_range_partition
+     * @return Status
+     */
+    Status _find_tablets_with_int64_range_partition(
+            Chunk* chunk, const Columns& partition_columns, const std::vector<uint32_t>& hashes,
+            std::vector<OlapTablePartition*>* partitions, std::vector<uint8_t>* selection,
+            std::vector<int>* invalid_row_indexs,
+            std::vector<std::vector<std::string>>* partition_not_exist_row_values);
+
+    // Flatten _partitions_map into _int64_range_ends and _int64_range_parts, return false if the partitions are
+    // not supported by _find_tablets_with_int64_range_partition().
+    bool _build_int64_range_bounds();
+
     Status _create_partition_keys(const std::vector<TExprNode>& t_exprs, ChunkRow* part_key);
 
     void _compute_hashes(const Chunk* chunk, std::vector<uint32_t>* hashes);
@@ -333,6 +349,22 @@ private:
     // one partition have multi sub partition
     std::map<ChunkRow*, std::vector<int64_t>, PartionKeyComparator> _partitions_map;
 
+    struct Int64RangePart {
+        OlapTablePartition* part;
+        // false if the lower bound is boundless or null
+        bool has_start;
+        int64_t start;
+    };
+    // Whether the bounds below are built from the current _partitions_map, they are rebuilt lazily after the
+    // partitions change.
+    bool _int64_range_bounds_built = false;
+    bool _int64_range_bounds_usable = false;
+    // the sorted end keys of the range partitions, except MAXVALUE
+    std::vector<int64_t> _int64_range_ends;
+    // the partitions of each end key, and one more entry at the end for MAXVALUE if there is such a partition
+    std::vector<std::vector<Int64RangePart>> _int64_range_parts;
+    std::vector<int64_t> _int64_partition_keys;
+
     Random _rand{(uint32_t)time(nullptr)};
 };
 
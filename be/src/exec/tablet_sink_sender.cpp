@@ -14,6 +14,7 @@
 
 #include "exec/tablet_sink_sender.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/chunk.h"
@@ -87,40 +88,61 @@ Status TabletSinkSender::_send_chunk_by_node(Chunk* chunk, IndexChannel* channel
 
     DCHECK(_index_id_to_tablet_be_map.find(channel->index_id()) != _index_id_to_tablet_be_map.end());
     auto& tablet_to_be = _index_id_to_tablet_be_map.find(channel->index_id())->second;
+
+    _send_nodes.clear();
     for (auto& it : channel->_node_channels) {
         NodeChannel* node = it.second.get();
         if (channel->is_failed_channel(node)) {
             // skip open fail channel
             continue;
         }
-        int64_t be_id = it.first;
-        _node_select_idx.clear();
-        _node_select_idx.reserve(selection_idx.size());
-
-        if (_enable_replicated_storage) {
-            for (unsigned short selection : selection_idx) {
-                DCHECK(tablet_to_be.find(_tablet_ids[selection]) != tablet_to_be.end());
-                std::vector<int64_t>& be_ids = tablet_to_be.find(_tablet_ids[selection])->second;
-                DCHECK_LT(0, be_ids.size());
-                // TODO(meegoo): add backlist policy
-                // first replica is primary replica, which determined by FE now
-                // only send to primary replica when enable replicated storage engine
-                if (be_ids[0] == be_id) {
-                    _node_select_idx.emplace_back(selection);
-                }
-            }
-        } else {
-            for (unsigned short selection : selection_idx) {
-                DCHECK(tablet_to_be.find(_tablet_ids[selection]) != tablet_to_be.end());
-                std::vector<int64_t>& be_ids = tablet_to_be.find(_tablet_ids[selection])->second;
-                DCHECK_LT(0, be_ids.size());
-                if (std::find(be_ids.begin(), be_ids.end(), be_id) != be_ids.end()) {
-                    _node_select_idx.emplace_back(selection);
+        _send_nodes.emplace_back(it.first, node);
+    }
+    if (_node_select_idxs.size() < _send_nodes.size()) {
+        _node_select_idxs.resize(_send_nodes.size());
+    }
+    for (size_t i = 0; i < _send_nodes.size(); ++i) {
+        _node_select_idxs[i].clear();
+        _node_select_idxs[i].reserve(selection_idx.size());
+    }
+
+    // Group the rows by tablet, keeping the order of the rows of a tablet. The receiver then appends the rows of
+    // a tablet to its memtable range by range rather than row by row, see MemTable::insert.
+    _grouped_selection_idx.assign(selection_idx.begin(), selection_idx.end());
+    std::stable_sort(_grouped_selection_idx.begin(), _grouped_selection_idx.end(),
+                     [this](uint16_t lhs, uint16_t rhs) { return _tablet_ids[lhs] < _tablet_ids[rhs]; });
+
+    // Scatter the rows to the nodes in one pass rather than one pass per node. The rows of a tablet are adjacent,
+    // so the replicas of the previous row are reused.
+    int64_t last_tablet_id = -1;
+    const std::vector<int64_t>* be_ids = nullptr;
+    for (uint16_t selection : _grouped_selection_idx) {
+        const int64_t tablet_id = _tablet_ids[selection];
+        if (be_ids == nullptr || tablet_id != last_tablet_id) {
+            DCHECK(tablet_to_be.find(tablet_id) != tablet_to_be.end());
+            be_ids = &tablet_to_be.find(tablet_id)->second;
+            DCHECK_LT(0, be_ids->size());
+            last_tablet_id = tablet_id;
+        }
+        // TODO(meegoo): add backlist policy
+        // first replica is primary replica, which determined by FE now
+        // only send to primary replica when enable replicated storage engine
+        const size_t num_targets = _enable_replicated_storage ? 1 : be_ids->size();
+        for (size_t r = 0; r < num_targets; ++r) {
+            const int64_t be_id = (*be_ids)[r];
+            for (size_t i = 0; i < _send_nodes.size(); ++i) {
+                if (_send_nodes[i].first == be_id) {
+                    _node_select_idxs[i].emplace_back(selection);
+                    break;
                 }
             }
         }
+    }
 
-        auto st = node->add_chunk(chunk, _tablet_ids, _node_select_idx, 0, _node_select_idx.size());
+    for (size_t i = 0; i < _send_nodes.size(); ++i) {
+        NodeChannel* node = _send_nodes[i].second;
+        const auto& node_select_idx = _node_select_idxs[i];
+        auto st = node->add_chunk(chunk, _tablet_ids, node_select_idx, 0, node_select_idx.size());
 
         if (!st.ok()) {
             LOG(WARNING) << node->name() << ", tablet add chunk failed, " << node->print_load_info()
@@ -102,6 +102,11 @@ protected:
     bool _close_done = false;
     // one chunk selection for BE node
     std::vector<uint32_t> _node_select_idx;
+    // the nodes of an index channel to send the chunk to, and the chunk selection of each of them
+    std::vector<std::pair<int64_t, NodeChannel*>> _send_nodes;
+    std::vector<std::vector<uint32_t>> _node_select_idxs;
+    // the chunk selection grouped by tablet
+    std::vector<uint16_t> _grouped_selection_idx;
     std::vector<int64_t> _tablet_ids;
     std::set<int64_t> _failed_channels;
     // mapping from partition id to CombinedTxnLogPB
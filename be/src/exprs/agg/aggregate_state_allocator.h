@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "column/hash_set.h"
 #include "common/config.h"
 #include "runtime/memory/allocator.h"
@@ -97,6 +99,8 @@ using SliceTwoLevelHashSetWithAggStateAllocator =
 template <typename T>
 using VectorWithAggStateAllocator = std::vector<T, AggregateStateAllocator<T>>;
 
+using StringWithAggStateAllocator = std::basic_string<char, std::char_traits<char>, AggregateStateAllocator<char>>;
+
 // Thread local aggregate state allocator setter with roaring allocator
 class ThreadLocalStateAllocatorSetter {
 public:
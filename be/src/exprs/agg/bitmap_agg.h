@@ -18,6 +18,7 @@
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/bitmap_union.h"
 #include "gutil/casts.h"
 #include "types/bitmap_value.h"
 
@@ -61,12 +62,16 @@ public:
                 return;
             }
         }
+        // collect the valid values first, so the bitmap is materialized once for the whole chunk
+        std::vector<uint64_t> valid_values;
+        valid_values.reserve(chunk_size);
         for (size_t i = 0; i < chunk_size; i++) {
             auto value = values[i];
             if (value >= 0 && value <= std::numeric_limits<uint64_t>::max()) {
-                this->data(state).add(value);
+                valid_values.push_back(value);
             }
         }
+        this->data(state).add_many(valid_values.size(), valid_values.data());
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
@@ -74,6 +79,12 @@ public:
         this->data(state) |= *(col.get_object(row_num));
     }
 
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        const auto* col = down_cast<const BitmapColumn*>(column);
+        bitmap_union_rows(&this->data(state), col, start, start + size);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state));
@@ -23,6 +23,15 @@
 
 namespace starrocks {
 
+// Union the bitmaps of rows [start, end) into dst in one batch, which avoids materializing dst once per row.
+inline void bitmap_union_rows(BitmapValue* dst, const BitmapColumn* col, size_t start, size_t end) {
+    std::vector<const BitmapValue*> values(end - start);
+    for (size_t i = start; i < end; ++i) {
+        values[i - start] = col->get_object(i);
+    }
+    dst->union_many(values.size(), values.data());
+}
+
 class BitmapUnionAggregateFunction final
         : public AggregateFunctionBatchHelper<BitmapValue, BitmapUnionAggregateFunction> {
 public:
@@ -49,13 +58,23 @@ public:
         col->append(std::move(bitmap));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
+        bitmap_union_rows(&this->data(state), col, 0, chunk_size);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        const auto* col = down_cast<const BitmapColumn*>(column);
+        bitmap_union_rows(&this->data(state), col, start, start + size);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
         const auto* col = down_cast<const BitmapColumn*>(columns[0]);
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state) |= *(col->get_object(i));
-        }
+        bitmap_union_rows(&this->data(state), col, frame_start, frame_end);
     }
 
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
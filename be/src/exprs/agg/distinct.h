@@ -173,6 +173,7 @@ struct AdaptiveSliceHashSet {
                 assert(pos != nullptr);
                 memcpy(pos, key.data, key.size);
                 ctor(pos, key.size, key.hash);
+                distinct_size++;
             });
         }
     }
@@ -425,13 +426,17 @@ public:
             cache[i] = CacheEntry{&agg_state, hash_value};
         }
         // This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
-        size_t prefetch_index = 16;
+        constexpr size_t prefetch_distance = 16;
 
+        // The bucket of a hash set can only be located after its state is loaded, so the states are prefetched
+        // one more distance ahead of the buckets, to avoid stalling on the scattered states when prefetching.
         MemPool* mem_pool = ctx->mem_pool();
         for (size_t i = 0; i < chunk_size; ++i) {
-            if (prefetch_index < chunk_size) {
-                cache[prefetch_index].agg_state->set.prefetch_hash(cache[prefetch_index].hash_value);
-                prefetch_index++;
+            if (i + 2 * prefetch_distance < chunk_size) {
+                __builtin_prefetch(cache[i + 2 * prefetch_distance].agg_state);
+            }
+            if (i + prefetch_distance < chunk_size) {
+                cache[i + prefetch_distance].agg_state->set.prefetch_hash(cache[i + prefetch_distance].hash_value);
             }
             cache[i].agg_state->update_with_hash(mem_pool, container_data[i], cache[i].hash_value);
         }
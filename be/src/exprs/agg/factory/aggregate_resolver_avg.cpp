@@ -14,6 +14,7 @@
 
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/aggregate_factory.h"
+#include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/agg/array_union_agg.h"
 #include "exprs/agg/avg.h"
 #include "exprs/agg/factory/aggregate_factory.hpp"
@@ -51,19 +52,21 @@ struct ArrayUniqueAggDispatcher {
         if constexpr (lt_is_aggregate<pt>) {
             using CppType = RunTimeCppType<pt>;
             if constexpr (lt_is_largeint<pt>) {
-                using MyHashSet = phmap::flat_hash_set<CppType, Hash128WithSeed<PhmapSeed1>>;
+                using MyHashSet =
+                        phmap::flat_hash_set<CppType, Hash128WithSeed<PhmapSeed1>, phmap::priv::hash_default_eq<CppType>,
+                                             AggregateStateAllocator<CppType>>;
                 auto func = std::make_shared<ArrayUnionAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayUnionAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
                         "array_unique_agg", false, func);
             } else if constexpr (lt_is_fixedlength<pt>) {
-                using MyHashSet = phmap::flat_hash_set<CppType, StdHash<CppType>>;
+                using MyHashSet = HashSetWithAggStateAllocator<CppType>;
                 auto func = std::make_shared<ArrayUnionAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayUnionAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
                         "array_unique_agg", false, func);
             } else if constexpr (lt_is_string<pt>) {
-                using MyHashSet = SliceHashSet;
+                using MyHashSet = SliceHashSetWithAggStateAllocator;
                 auto func = std::make_shared<ArrayUnionAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayUnionAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
@@ -81,19 +84,21 @@ struct ArrayAggDistinctDispatcher {
         if constexpr (lt_is_aggregate<pt>) {
             using CppType = RunTimeCppType<pt>;
             if constexpr (lt_is_largeint<pt>) {
-                using MyHashSet = phmap::flat_hash_set<CppType, Hash128WithSeed<PhmapSeed1>>;
+                using MyHashSet =
+                        phmap::flat_hash_set<CppType, Hash128WithSeed<PhmapSeed1>, phmap::priv::hash_default_eq<CppType>,
+                                             AggregateStateAllocator<CppType>>;
                 auto func = std::make_shared<ArrayAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
                         "array_agg_distinct", false, func);
             } else if constexpr (lt_is_fixedlength<pt>) {
-                using MyHashSet = phmap::flat_hash_set<CppType, StdHash<CppType>>;
+                using MyHashSet = HashSetWithAggStateAllocator<CppType>;
                 auto func = std::make_shared<ArrayAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
                         "array_agg_distinct", false, func);
             } else if constexpr (lt_is_string<pt>) {
-                using MyHashSet = SliceHashSet;
+                using MyHashSet = SliceHashSetWithAggStateAllocator;
                 auto func = std::make_shared<ArrayAggAggregateFunction<pt, true, MyHashSet>>();
                 using AggState = ArrayAggAggregateState<pt, true, MyHashSet>;
                 resolver->add_aggregate_mapping<pt, TYPE_ARRAY, AggState, AggregateFunctionPtr, false>(
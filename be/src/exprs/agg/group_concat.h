@@ -23,6 +23,7 @@
 #include "column/type_traits.h"
 #include "exec/sorting/sorting.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/function_context.h"
 #include "gutil/casts.h"
 #include "runtime/runtime_state.h"
@@ -35,7 +36,7 @@ inline constexpr LogicalType GroupConcatResultLT = TYPE_VARCHAR;
 struct GroupConcatAggregateState {
     // intermediate_string.
     // concat with sep_length first.
-    std::string intermediate_string{};
+    StringWithAggStateAllocator intermediate_string{};
     // is initial
     bool initial{};
 };
@@ -62,7 +63,7 @@ public:
                 const auto* column_val = down_cast<const InputColumnType*>(columns[0]);
                 const auto* column_sep = down_cast<const InputColumnType*>(columns[1]);
 
-                std::string& result = this->data(state).intermediate_string;
+                auto& result = this->data(state).intermediate_string;
 
                 Slice val = column_val->get_slice(row_num);
                 Slice sep = column_sep->get_slice(row_num);
@@ -80,7 +81,7 @@ public:
             } else {
                 auto const_column_sep = ctx->get_constant_column(1);
                 const auto* column_val = down_cast<const InputColumnType*>(columns[0]);
-                std::string& result = this->data(state).intermediate_string;
+                auto& result = this->data(state).intermediate_string;
 
                 Slice val = column_val->get_slice(row_num);
                 Slice sep = ColumnHelper::get_const_value<TYPE_VARCHAR>(const_column_sep);
@@ -99,7 +100,7 @@ public:
             }
         } else {
             const auto* column_val = down_cast<const InputColumnType*>(columns[0]);
-            std::string& result = this->data(state).intermediate_string;
+            auto& result = this->data(state).intermediate_string;
 
             Slice val = column_val->get_slice(row_num);
             //DEFAULT sep_length.
@@ -171,7 +172,7 @@ public:
         auto* column = down_cast<BinaryColumn*>(to);
         Bytes& bytes = column->get_bytes();
 
-        const std::string& value = this->data(state).intermediate_string;
+        const auto& value = this->data(state).intermediate_string;
 
         size_t old_size = bytes.size();
         size_t new_size = old_size + sizeof(uint32_t) + value.size();
@@ -280,7 +281,7 @@ public:
     }
 
     void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
-        const std::string& value = this->data(state).intermediate_string;
+        const auto& value = this->data(state).intermediate_string;
         if (value.empty()) {
             return;
         }
@@ -62,6 +62,39 @@ public:
         ctx->add_mem_usage(data(state).percentile->mem_usage() - prev_memory);
     }
 
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        if (size == 0) {
+            return;
+        }
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        const double compression = get_compression_factor(ctx);
+        int64_t prev_memory = data(state).percentile->mem_usage();
+
+        // deserialize the partial digests in batches of about kHighWater centroids, and merge each batch at once
+        std::vector<PercentileValue> src_percentiles;
+        src_percentiles.reserve(size);
+        std::vector<const PercentileValue*> batch;
+        size_t batch_centroids = 0;
+        double quantile = data(state).targetQuantile;
+        for (size_t i = start; i < start + size; ++i) {
+            Slice src = binary_column->get_slice(i);
+            memcpy(&quantile, src.data, sizeof(double));
+            auto& src_percentile = src_percentiles.emplace_back(compression);
+            src_percentile.deserialize((char*)src.data + sizeof(double));
+            batch.push_back(&src_percentile);
+            batch_centroids += src_percentile.total_size();
+            if (batch_centroids >= kHighWater || i + 1 == start + size) {
+                data(state).percentile->merge(batch);
+                batch.clear();
+                src_percentiles.clear();
+                batch_centroids = 0;
+            }
+        }
+        data(state).targetQuantile = quantile;
+        ctx->add_mem_usage(data(state).percentile->mem_usage() - prev_memory);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         size_t size = data(state).percentile->serialize_size();
         uint8_t result[size + sizeof(double)];
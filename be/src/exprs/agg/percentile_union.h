@@ -36,13 +36,31 @@ public:
         update_state(ctx, state, column->get_object(row_num));
     }
 
+    // Merge a range of values at once, see PercentileValue::merge.
+    void update_state_batch(FunctionContext* ctx, AggDataPtr state, const PercentileColumn* column, size_t start,
+                            size_t end) const {
+        if (start >= end) {
+            return;
+        }
+        std::vector<const PercentileValue*> values;
+        values.reserve(end - start);
+        for (size_t i = start; i < end; ++i) {
+            values.push_back(column->get_object(i));
+        }
+        int64_t prev_memory = this->data(state).mem_usage();
+        this->data(state).merge(values);
+        ctx->add_mem_usage(this->data(state).mem_usage() - prev_memory);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        update_state_batch(ctx, state, down_cast<const PercentileColumn*>(columns[0]), 0, chunk_size);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* column = down_cast<const PercentileColumn*>(columns[0]);
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            update_state(ctx, state, column->get_object(i));
-        }
+        update_state_batch(ctx, state, down_cast<const PercentileColumn*>(columns[0]), frame_start, frame_end);
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
@@ -52,6 +70,12 @@ public:
         update_state(ctx, state, percentile_column->get_object(row_num));
     }
 
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        DCHECK(column->is_object());
+        update_state_batch(ctx, state, down_cast<const PercentileColumn*>(column), start, start + size);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_object());
         auto* column = down_cast<PercentileColumn*>(to);
@@ -1040,7 +1040,18 @@ private:
         }
         const auto& offsets = bool_array->offsets().get_data();
 
-        ColumnViewer<TYPE_BOOLEAN> bool_elements(bool_array->elements_column());
+        const auto& elements_column = bool_array->elements_column();
+        if (!elements_column->is_constant() && !elements_column->only_null()) {
+            _array_match_flat(elements_column, offsets, array_null_map, dest_num_rows, dest_data_column->get_data(),
+                              dest_null_column->get_data());
+            ColumnPtr dest_column = NullableColumn::create(std::move(dest_data_column), std::move(dest_null_column));
+            if (is_const) {
+                dest_column = ConstColumn::create(std::move(dest_column), chunk_size);
+            }
+            return dest_column;
+        }
+
+        ColumnViewer<TYPE_BOOLEAN> bool_elements(elements_column);
 
         for (size_t i = 0; i < dest_num_rows; ++i) {
             if (array_null_map == nullptr || !array_null_map->get_data()[i]) { // array_null_map[i] is not null
@@ -1070,6 +1081,44 @@ private:
         }
         return dest_column;
     }
+
+    // Reduce the flattened boolean elements of each array without branches: a row matches if any not-null element
+    // equals to isAny, and it is null if it doesn't match but has a null element.
+    static void _array_match_flat(const ColumnPtr& elements_column, const Buffer<uint32_t>& offsets,
+                                  const NullColumn* array_null_map, size_t num_rows, Buffer<uint8_t>& dest_data,
+                                  Buffer<uint8_t>& dest_null) {
+        const uint8_t* values = down_cast<const BooleanColumn*>(ColumnHelper::get_data_column(elements_column.get()))
+                                        ->get_data()
+                                        .data();
+        const uint8_t* element_nulls = nullptr;
+        if (elements_column->is_nullable() && elements_column->has_null()) {
+            const auto* nullable_elements = down_cast<const NullableColumn*>(elements_column.get());
+            element_nulls = nullable_elements->immutable_null_column_data().data();
+        }
+        const uint8_t* array_nulls = array_null_map != nullptr ? array_null_map->get_data().data() : nullptr;
+
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (array_nulls != nullptr && array_nulls[i]) {
+                dest_null[i] = 1;
+                dest_data[i] = 0;
+                continue;
+            }
+            uint8_t matched = 0;
+            uint8_t has_null = 0;
+            if (element_nulls == nullptr) {
+                for (auto id = offsets[i]; id < offsets[i + 1]; ++id) {
+                    matched |= (values[id] != 0) == isAny;
+                }
+            } else {
+                for (auto id = offsets[i]; id < offsets[i + 1]; ++id) {
+                    matched |= ((values[id] != 0) == isAny) & !element_nulls[id];
+                    has_null |= element_nulls[id];
+                }
+            }
+            dest_data[i] = isAny ? matched : !matched;
+            dest_null[i] = !matched & (has_null != 0);
+        }
+    }
 };
 
 // by design array_filter(array, bool_array), if bool_array is null, return an empty array. We do not return null, as
@@ -218,6 +218,19 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_lambda_expr(ExprContext* context, Chu
             // if result is a const column, we should unpack it first and make it to be the elements column of array column
             column = ColumnHelper::unpack_and_duplicate_const_column(tmp_col->size(), tmp_col);
             column = ColumnHelper::align_return_type(std::move(column), type().children[0], column->size(), true);
+        } else if (cur_chunk->num_rows() <= DEFAULT_CHUNK_SIZE) {
+            // the flattened elements fit into one chunk, evaluate them in place instead of copying them into
+            // the accumulator.
+            cur_chunk->check_or_die();
+            for (auto& column : cur_chunk->columns()) {
+                if (column->is_array_view()) {
+                    column = ArrayViewColumn::to_array_column(column);
+                }
+            }
+            ASSIGN_OR_RETURN(column, context->evaluate(_children[0], cur_chunk.get()));
+            column->check_or_die();
+            column = ColumnHelper::align_return_type(std::move(column), type().children[0], cur_chunk->num_rows(),
+                                                     true);
         } else {
             ChunkAccumulator accumulator(DEFAULT_CHUNK_SIZE);
             RETURN_IF_ERROR(accumulator.push(std::move(cur_chunk)));
@@ -48,6 +48,7 @@ public:
     void for_each_slot_id(const std::function<void(SlotId)>& cb) const override;
 
     std::string debug_string() const override;
+    std::string fingerprint() const override { return debug_string(); }
 
     // vector query engine
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
@@ -16,6 +16,8 @@
 
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/like_predicate.h"
+#include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -128,7 +130,20 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    // the multi pattern matcher refers to the children of the original tree, it is built again in prepare.
+    VectorizedOrCompoundPredicate(const VectorizedOrCompoundPredicate& other) : Predicate(other) {}
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        RETURN_IF_ERROR(Expr::prepare(state, context));
+        _init_multi_pattern_matcher();
+        return Status::OK();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_multi_pattern_matcher != nullptr) {
+            return _evaluate_with_multi_pattern_matcher(context, ptr);
+        }
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -189,6 +204,99 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    static bool _is_or(const Expr* expr) {
+        return expr->node_type() == TExprNodeType::COMPOUND_PRED && expr->op() == TExprOpcode::COMPOUND_OR;
+    }
+
+    // LIKE or REGEXP with a constant not null pattern
+    static bool _is_constant_pattern_match(const Expr* expr) {
+        if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2) {
+            return false;
+        }
+        const auto& fn_name = expr->fn().name.function_name;
+        if (fn_name != "like" && fn_name != "regexp") {
+            return false;
+        }
+        const Expr* pattern = expr->get_child(1);
+        return pattern->is_literal() && !down_cast<const VectorizedLiteral*>(pattern)->value()->only_null();
+    }
+
+    static void _collect_disjuncts(Expr* expr, std::vector<Expr*>* disjuncts) {
+        if (_is_or(expr)) {
+            // the nested disjunctions are never evaluated by themselves
+            down_cast<VectorizedOrCompoundPredicate*>(expr)->_reset_multi_pattern_matcher();
+            _collect_disjuncts(expr->get_child(0), disjuncts);
+            _collect_disjuncts(expr->get_child(1), disjuncts);
+        } else {
+            disjuncts->push_back(expr);
+        }
+    }
+
+    void _reset_multi_pattern_matcher() {
+        _multi_pattern_matcher.reset();
+        _multi_pattern_value = nullptr;
+        _other_disjuncts.clear();
+    }
+
+    // Merge the LIKE and REGEXP disjuncts on the same value with constant patterns into one hyperscan database,
+    // e.g. `msg LIKE '%timeout%' OR msg LIKE '%refused%' OR msg REGEXP 'err[0-9]+'`.
+    void _init_multi_pattern_matcher() {
+        _reset_multi_pattern_matcher();
+        std::vector<Expr*> disjuncts;
+        _collect_disjuncts(_children[0], &disjuncts);
+        _collect_disjuncts(_children[1], &disjuncts);
+
+        std::string value_fingerprint;
+        auto matcher = std::make_shared<LikePredicate::MultiPatternMatcher>();
+        std::vector<Expr*> other_disjuncts;
+        for (Expr* disjunct : disjuncts) {
+            if (_is_constant_pattern_match(disjunct)) {
+                std::string fingerprint = disjunct->get_child(0)->fingerprint();
+                if (value_fingerprint.empty() && !fingerprint.empty()) {
+                    value_fingerprint = fingerprint;
+                    _multi_pattern_value = disjunct->get_child(0);
+                }
+                if (!fingerprint.empty() && fingerprint == value_fingerprint) {
+                    Slice pattern = ColumnHelper::get_const_value<TYPE_VARCHAR>(
+                            down_cast<const VectorizedLiteral*>(disjunct->get_child(1))->value());
+                    if (disjunct->fn().name.function_name == "like") {
+                        matcher->add_like_pattern(pattern);
+                    } else {
+                        matcher->add_regex_pattern(pattern);
+                    }
+                    continue;
+                }
+            }
+            other_disjuncts.push_back(disjunct);
+        }
+
+        if (matcher->num_patterns() < 2 || !matcher->compile()) {
+            _multi_pattern_value = nullptr;
+            return;
+        }
+        _multi_pattern_matcher = std::move(matcher);
+        _other_disjuncts = std::move(other_disjuncts);
+    }
+
+    StatusOr<ColumnPtr> _evaluate_with_multi_pattern_matcher(ExprContext* context, Chunk* ptr) {
+        ASSIGN_OR_RETURN(auto value, _multi_pattern_value->evaluate_checked(context, ptr));
+        ASSIGN_OR_RETURN(ColumnPtr l, _multi_pattern_matcher->match_any(value));
+        for (Expr* disjunct : _other_disjuncts) {
+            // all true and not null
+            if (ColumnHelper::count_true_with_notnull(l) == l->size()) {
+                break;
+            }
+            ASSIGN_OR_RETURN(auto r, disjunct->evaluate_checked(context, ptr));
+            l = VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(l, r);
+        }
+        return l;
+    }
+
+    std::shared_ptr<const LikePredicate::MultiPatternMatcher> _multi_pattern_matcher;
+    Expr* _multi_pattern_value = nullptr;
+    std::vector<Expr*> _other_disjuncts;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -22,6 +22,49 @@
 #include "types/logical_type.h"
 
 namespace starrocks {
+
+// Evaluate the add/sub/mul of two non-const DECIMAL128 vectors without the per-row overflow checks, the overflow is
+// detected once for the whole batch by an accumulated sign mask, so that the loops have no branches and can be
+// vectorized by the compiler. Multiplication only takes the fast path when all the operands fit in 64 bits, whose
+// products never overflow, and one 64x64=>128 multiplication is cheaper than a full 128-bit one.
+// Return false if any row may overflow, then the batch must be evaluated again with the per-row checks.
+template <typename Op>
+struct DecimalBatchArithmetics {
+    static inline bool evaluate(size_t num_rows, const int128_t* lhs, const int128_t* rhs, int128_t* result) {
+        if constexpr (is_add_op<Op> || is_sub_op<Op>) {
+            int128_t overflow = 0;
+            for (size_t i = 0; i < num_rows; ++i) {
+                const int128_t a = lhs[i];
+                const int128_t b = rhs[i];
+                int128_t c;
+                if constexpr (is_add_op<Op>) {
+                    c = static_cast<int128_t>(static_cast<uint128_t>(a) + static_cast<uint128_t>(b));
+                    overflow |= (a ^ c) & (b ^ c);
+                } else {
+                    c = static_cast<int128_t>(static_cast<uint128_t>(a) - static_cast<uint128_t>(b));
+                    overflow |= (a ^ b) & (a ^ c);
+                }
+                result[i] = c;
+            }
+            return overflow >= 0;
+        } else if constexpr (is_mul_op<Op>) {
+            bool fit_in_64 = true;
+            for (size_t i = 0; i < num_rows; ++i) {
+                fit_in_64 &= (static_cast<int64_t>(lhs[i]) == lhs[i]) & (static_cast<int64_t>(rhs[i]) == rhs[i]);
+            }
+            if (!fit_in_64) {
+                return false;
+            }
+            for (size_t i = 0; i < num_rows; ++i) {
+                result[i] = static_cast<int128_t>(static_cast<int64_t>(lhs[i])) * static_cast<int64_t>(rhs[i]);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
+};
+
 template <OverflowMode overflow_mode, typename Op>
 struct DecimalBinaryFunction {
     // Adjust the scale of lhs operand, then evaluate binary operation, the rules about operand
@@ -79,6 +122,15 @@ struct DecimalBinaryFunction {
             rhs_datum = rhs_data[0];
         }
 
+        if constexpr (check_overflow<overflow_mode> && !lhs_is_const && !rhs_is_const && !adjust_left &&
+                      std::is_same_v<LhsCppType, int128_t> && std::is_same_v<RhsCppType, int128_t> &&
+                      std::is_same_v<ResultCppType, int128_t> &&
+                      (is_add_op<Op> || is_sub_op<Op> || is_mul_op<Op>)) {
+            if (DecimalBatchArithmetics<Op>::evaluate(num_rows, lhs_data, rhs_data, result_data)) {
+                return false;
+            }
+        }
+
         for (auto i = 0; i < num_rows; ++i) {
             if constexpr (lhs_is_const && rhs_is_const) {
                 overflow = BinaryOperator::template apply<check_overflow<overflow_mode>, false, LhsCppType, RhsCppType,
@@ -614,6 +614,29 @@ std::string Expr::debug_string(const std::vector<Expr*>& exprs) {
     return out.str();
 }
 
+std::string Expr::fingerprint() const {
+    switch (_node_type) {
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::CAST_EXPR:
+        break;
+    default:
+        return {};
+    }
+    std::string result = fmt::format("{}:{}:{}(", static_cast<int>(_node_type), static_cast<int>(_opcode),
+                                     _type.debug_string());
+    for (const auto* child : _children) {
+        std::string child_fingerprint = child->fingerprint();
+        if (child_fingerprint.empty()) {
+            return {};
+        }
+        result.append(child_fingerprint).append(",");
+    }
+    result.append(")");
+    return result;
+}
+
 std::string Expr::debug_string(const std::vector<ExprContext*>& ctxs) {
     std::vector<Expr*> exprs;
     exprs.reserve(ctxs.size());
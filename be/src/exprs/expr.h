@@ -207,6 +207,11 @@ public:
     static std::string debug_string(const std::vector<Expr*>& exprs);
     static std::string debug_string(const std::vector<ExprContext*>& ctxs);
 
+    // Structural fingerprint of the expression tree, two prepared trees with the same non-empty fingerprint always
+    // evaluate to the same column on the same chunk. It's empty if the tree has a node which can't be identified
+    // this way, e.g. a function returning random values.
+    virtual std::string fingerprint() const;
+
     static Expr* copy(ObjectPool* pool, Expr* old_expr);
 
     // for vector query engine
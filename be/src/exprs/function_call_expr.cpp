@@ -14,6 +14,9 @@
 
 #include "exprs/function_call_expr.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <cstdint>
 
 #include "column/chunk.h"
@@ -172,6 +175,22 @@ void VectorizedFunctionCallExpr::close(starrocks::RuntimeState* state, starrocks
     Expr::close(state, context, scope);
 }
 
+std::string VectorizedFunctionCallExpr::fingerprint() const {
+    if (_fn_desc == nullptr || _is_returning_random_value) {
+        return {};
+    }
+    std::string result = fmt::format("fn:{}:{}:{}(", _fn.name.function_name, _fn.fid, _type.debug_string());
+    for (const auto* child : _children) {
+        std::string child_fingerprint = child->fingerprint();
+        if (child_fingerprint.empty()) {
+            return {};
+        }
+        result.append(child_fingerprint).append(",");
+    }
+    result.append(")");
+    return result;
+}
+
 bool VectorizedFunctionCallExpr::is_constant() const {
     if (_is_returning_random_value) {
         return false;
@@ -228,6 +247,10 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     return result;
 }
 
+static bool is_regexp_function(const std::string& name) {
+    return name == "REGEXP" || name == "regexp";
+}
+
 bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
                                                     const NgramBloomFilterReaderOptions& reader_options) const {
     FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
@@ -255,9 +278,14 @@ bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const
             index_useful = false;
         } else if (_fn_desc->name == "LIKE") {
             index_useful = split_like_string_to_ngram(needle, reader_options, ngram_set);
+        } else if (is_regexp_function(_fn_desc->name)) {
+            index_useful = split_regexp_string_to_ngram(needle, reader_options, ngram_set);
         } else {
             index_useful = split_normal_string_to_ngram(needle, fn_ctx, reader_options, ngram_set, _fn_desc->name);
         }
+        // a long needle often repeats grams, every distinct gram only needs to be tested once per page
+        std::sort(ngram_set.begin(), ngram_set.end());
+        ngram_set.erase(std::unique(ngram_set.begin(), ngram_set.end()), ngram_set.end());
         ngram_state->initialized = true;
         ngram_state->index_useful = index_useful;
     }
@@ -272,7 +300,7 @@ bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const
 
     // if empty, which means needle is too short, so index_valid should be false
     DCHECK(!ngram_state->ngram_set.empty());
-    if (_fn_desc->name == "LIKE") {
+    if (_fn_desc->name == "LIKE" || is_regexp_function(_fn_desc->name)) {
         for (auto& ngram : ngram_state->ngram_set) {
             // if any ngram in needle doesn't hit bf, this page has nothing to do with target,so filter it
             if (!bf->test_bytes(ngram.data(), ngram.size())) {
@@ -300,7 +328,7 @@ bool VectorizedFunctionCallExpr::support_ngram_bloom_filter(ExprContext* context
         return false;
     }
 
-    return _fn_desc->name == "LIKE" || _fn_desc->name == "ngram_search" ||
+    return _fn_desc->name == "LIKE" || is_regexp_function(_fn_desc->name) || _fn_desc->name == "ngram_search" ||
            _fn_desc->name == "ngram_search_case_insensitive";
 }
 
@@ -408,4 +436,107 @@ bool VectorizedFunctionCallExpr::split_like_string_to_ngram(const Slice& needle,
     if (ngram_set.empty()) return false;
     return true;
 }
+// Append all the ngrams of the literal |fragment| into |ngram_set|.
+static void append_fragment_ngrams(const std::string& fragment, size_t gram_num, std::vector<std::string>& ngram_set) {
+    std::vector<size_t> index;
+    size_t fragment_gram_num = get_utf8_index(Slice(fragment), &index);
+    for (size_t j = 0; j + gram_num <= fragment_gram_num; j++) {
+        size_t end = j + gram_num < fragment_gram_num ? index[j + gram_num] : fragment.size();
+        ngram_set.emplace_back(fragment.data() + index[j], end - index[j]);
+    }
+}
+
+bool VectorizedFunctionCallExpr::split_regexp_string_to_ngram(const Slice& needle,
+                                                              const NgramBloomFilterReaderOptions& reader_options,
+                                                              std::vector<std::string>& ngram_set) {
+    // Collect the maximal literal fragments outside of character classes and repetitions. The pattern is given up
+    // on alternations and groups, whose content may be optional or case insensitive, e.g. "(?i)", "(a|b)".
+    std::vector<std::string> fragments;
+    std::string fragment;
+    auto finish_fragment = [&]() {
+        if (!fragment.empty()) {
+            fragments.push_back(std::move(fragment));
+            fragment.clear();
+        }
+    };
+    // drop the last character of the fragment, which is optional because of the following quantifier
+    auto drop_last_char = [&]() {
+        size_t pos = fragment.size();
+        while (pos > 0 && (static_cast<unsigned char>(fragment[pos - 1]) & 0xC0) == 0x80) {
+            pos--;
+        }
+        fragment.resize(pos > 0 ? pos - 1 : 0);
+    };
+    size_t i = 0;
+    while (i < needle.size) {
+        char c = needle.data[i];
+        switch (c) {
+        case '|':
+        case '(':
+        case ')':
+            return false;
+        case '^':
+        case '$':
+        case '.':
+            finish_fragment();
+            i++;
+            break;
+        case '[': {
+            finish_fragment();
+            i++;
+            // a ']' right after '[' or '[^' is a literal
+            if (i < needle.size && needle.data[i] == '^') i++;
+            if (i < needle.size && needle.data[i] == ']') i++;
+            while (i < needle.size && needle.data[i] != ']') {
+                i += needle.data[i] == '\\' ? 2 : 1;
+            }
+            i++;
+            break;
+        }
+        case '*':
+        case '?':
+            drop_last_char();
+            finish_fragment();
+            i++;
+            break;
+        case '{':
+            drop_last_char();
+            finish_fragment();
+            while (i < needle.size && needle.data[i] != '}') {
+                i++;
+            }
+            i++;
+            break;
+        case '+':
+            finish_fragment();
+            i++;
+            break;
+        case '\\':
+            if (i + 1 >= needle.size) {
+                return false;
+            }
+            if (isalnum(static_cast<unsigned char>(needle.data[i + 1]))) {
+                // character classes and assertions like \d, \w, \b
+                finish_fragment();
+            } else {
+                fragment.push_back(needle.data[i + 1]);
+            }
+            i += 2;
+            break;
+        default: {
+            size_t char_size = std::min<size_t>(UTF8_BYTE_LENGTH_TABLE[static_cast<unsigned char>(c)], needle.size - i);
+            fragment.append(needle.data + i, char_size);
+            i += char_size;
+            break;
+        }
+        }
+    }
+    finish_fragment();
+
+    for (const auto& f : fragments) {
+        append_fragment_ngrams(f, reader_options.index_gram_num, ngram_set);
+    }
+    return !ngram_set.empty();
+}
+
 } // namespace starrocks
@@ -33,6 +33,8 @@ public:
 
     const FunctionDescriptor* get_function_desc() { return _fn_desc; }
 
+    std::string fingerprint() const override;
+
     bool support_ngram_bloom_filter(ExprContext* context) const override;
     bool ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
                             const NgramBloomFilterReaderOptions& reader_options) const override;
@@ -43,6 +45,11 @@ public:
     static bool split_like_string_to_ngram(const Slice& needle, const NgramBloomFilterReaderOptions& reader_options,
                                            std::vector<std::string>& ngram_set);
 
+    // Split the literal fragments every match of the regular expression |needle| must contain into ngrams.
+    // Return false if no such fragment is long enough, or the pattern has alternations or groups.
+    static bool split_regexp_string_to_ngram(const Slice& needle, const NgramBloomFilterReaderOptions& reader_options,
+                                             std::vector<std::string>& ngram_set);
+
 protected:
     Status prepare(RuntimeState* state, ExprContext* context) override;
 
@@ -20,10 +20,12 @@
 #include "column/column_viewer.h"
 #include "column/hash_set.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/function_helper.h"
 #include "exprs/literal.h"
 #include "exprs/predicate.h"
+#include "exprs/runtime_filter.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/types.h"
 #include "simd/simd.h"
@@ -78,6 +80,7 @@ public:
               _array_size(other._array_size),
               _array_buffer(other._array_buffer),
               _hash_set(other._hash_set),
+              _bitset(other._bitset),
               _string_values(other._string_values) {}
 
     ~VectorizedInConstPredicate() override = default;
@@ -89,6 +92,8 @@ public:
                Type == TYPE_BIGINT;
     }
 
+    static constexpr bool can_use_bitset() { return BitsetSupportedLogicalType<Type>; }
+
     Status prepare([[maybe_unused]] RuntimeState* state) {
         if (_is_prepare) {
             return Status::OK();
@@ -103,6 +108,7 @@ public:
         if (auto* that = dynamic_cast<typeof(this)>(predicate)) {
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
+            _bitset.reset();
             _null_in_set = _null_in_set || that->null_in_set();
             return Status::OK();
         } else {
@@ -178,6 +184,7 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+            _init_bitset();
         }
         return Status::OK();
     }
@@ -360,7 +367,10 @@ public:
         return values;
     }
 
-    void insert(const ValueType& value) { _hash_set.emplace(value); }
+    void insert(const ValueType& value) {
+        _hash_set.emplace(value);
+        _bitset.reset();
+    }
 
     void insert_array(const ValueType& value) {
         if constexpr (can_use_array()) {
@@ -375,6 +385,11 @@ public:
         if constexpr (use_array && can_use_array()) {
             return _get_array_index(value);
         } else {
+            if constexpr (can_use_bitset()) {
+                if (_bitset != nullptr) {
+                    return _bitset->template contains<true /*CheckRange*/>(value, true);
+                }
+            }
             return static_cast<uint8_t>(_hash_set.contains(value));
         }
     }
@@ -416,6 +431,21 @@ private:
         }
     }
 
+    // A long IN list of dense values, like the ids generated by a dashboard, is tested with a bitset, which is
+    // cheaper than probing the hash set. The hash set is kept for the users of hash_set().
+    void _init_bitset() {
+        _bitset.reset();
+        if constexpr (can_use_bitset()) {
+            if (is_use_array() || _hash_set.size() < config::in_predicate_bitset_min_values) {
+                return;
+            }
+            auto bitset = std::make_shared<Bitset<Type>>();
+            if (bitset->init_for_in_list(_hash_set)) {
+                _bitset = std::move(bitset);
+            }
+        }
+    }
+
     const bool _is_not_in{false};
     bool _is_prepare{false};
     bool _null_in_set{false};
@@ -425,6 +455,8 @@ private:
     std::vector<uint8_t> _array_buffer;
 
     in_const_pred_detail::LHashSetType<Type> _hash_set;
+    // shared by the cloned predicates, since it's never modified after built
+    std::shared_ptr<const MaybeBitset<Type>> _bitset;
     // Ensure the string memory don't early free
     Columns _string_values;
 };
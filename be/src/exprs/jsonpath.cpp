@@ -188,7 +188,7 @@ vpack::Slice JsonPathPiece::extract(vpack::Slice root, const std::vector<JsonPat
 
     for (int i = path_index; i < jsonpath.size(); i++) {
         auto& path_item = jsonpath[i];
-        auto item_key = path_item.key;
+        const auto& item_key = path_item.key;
         auto& array_selector = path_item.array_selector;
 
         vpack::Slice next_item = current_value;
@@ -228,8 +228,9 @@ vpack::Slice JsonPathPiece::extract(vpack::Slice root, const std::vector<JsonPat
             {
                 builder->clear();
                 vpack::ArrayBuilder ab(builder);
+                // the sub result is copied into `builder` before the next item, so one builder serves all of them
+                vpack::Builder tmpBuilder;
                 array_selector->iterate(next_item, [&](vpack::Slice array_item) {
-                    vpack::Builder tmpBuilder;
                     tmpBuilder.clear();
                     auto sub = extract(array_item, jsonpath, i + 1, &tmpBuilder);
                     if (!sub.isNone()) {
@@ -627,10 +627,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -643,7 +646,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -668,6 +671,96 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
     return re_pattern;
 }
 
+LikePredicate::MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+void LikePredicate::MultiPatternMatcher::add_like_pattern(const Slice& pattern) {
+    _patterns.emplace_back(convert_like_pattern<true>('\\', pattern));
+}
+
+void LikePredicate::MultiPatternMatcher::add_regex_pattern(const Slice& pattern) {
+    _patterns.emplace_back(pattern.to_string());
+}
+
+bool LikePredicate::MultiPatternMatcher::compile() {
+    DCHECK(_database == nullptr);
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < _patterns.size(); i++) {
+        expressions.push_back(_patterns[i].c_str());
+        flags.push_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.push_back(i);
+    }
+
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK, nullptr,
+                         &_database, &compile_err) != HS_SUCCESS) {
+        LOG(WARNING) << "Invalid hyperscan expressions: " << compile_err->message
+                     << ", so we evaluate the patterns one by one.";
+        hs_free_compile_error(compile_err);
+        _database = nullptr;
+        return false;
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        LOG(WARNING) << "ERROR: Unable to allocate scratch space, so we evaluate the patterns one by one.";
+        hs_free_database(_database);
+        _database = nullptr;
+        return false;
+    }
+    return true;
+}
+
+StatusOr<ColumnPtr> LikePredicate::MultiPatternMatcher::match_any(const ColumnPtr& value_column) const {
+    DCHECK(_database != nullptr);
+    if (value_column->only_null()) {
+        return ColumnHelper::create_const_null_column(value_column->size());
+    }
+
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        hs_error_t st;
+        if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << st;
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+
+        bool v = false;
+        auto value_size = value_viewer.value(row).size;
+        // the scan stops at the first match of any pattern
+        [[maybe_unused]] auto st = hs_scan(
+                _database, (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN, value_size,
+                0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(st == HS_SUCCESS || st == HS_SCAN_TERMINATED) << " status: " << st;
+        result.append(v);
+    }
+    return result.build(value_column->is_constant());
+}
+
 void LikePredicate::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
@@ -151,8 +151,39 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
+
     static void remove_escape_character(std::string* search_string);
 
+    // Matches the strings against several constant LIKE and REGEXP patterns with one hyperscan database,
+    // so a disjunction of the patterns scans every string only once.
+    class MultiPatternMatcher {
+    public:
+        MultiPatternMatcher() = default;
+        ~MultiPatternMatcher();
+
+        MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+        MultiPatternMatcher& operator=(const MultiPatternMatcher&) = delete;
+
+        // LIKE patterns match the whole string, REGEXP patterns match any substring.
+        void add_like_pattern(const Slice& pattern);
+        void add_regex_pattern(const Slice& pattern);
+
+        size_t num_patterns() const { return _patterns.size(); }
+
+        // Return false if hyperscan fails to compile the patterns, then they should be evaluated one by one.
+        bool compile();
+
+        // The result of a row is true if any pattern matches it, and null if the row is null.
+        StatusOr<ColumnPtr> match_any(const ColumnPtr& value_column) const;
+
+    private:
+        std::vector<std::string> _patterns;
+        hs_database_t* _database = nullptr;
+        hs_scratch_t* _scratch = nullptr;
+    };
+
 private:
     static StatusOr<ColumnPtr> _predicate_const_regex(FunctionContext* context, ColumnBuilder<TYPE_BOOLEAN>* result,
                                                       const ColumnViewer<TYPE_VARCHAR>& value_viewer,
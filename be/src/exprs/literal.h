@@ -41,6 +41,7 @@ public:
 #endif
     bool is_literal() const override { return true; }
     std::string debug_string() const override;
+    std::string fingerprint() const override { return debug_string(); }
 
     const ColumnPtr value() const { return _value; }
 
@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifdef __AVX2__
+#if defined(__AVX2__) || defined(__AVX512F__)
 #include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
 #endif
 
 #include <runtime/decimalv3.h>
@@ -1090,144 +1092,204 @@ static float sum_m256(__m256 v) {
 }
 #endif
 
-template <LogicalType TYPE, bool isNorm>
-StatusOr<ColumnPtr> MathFunctions::cosine_similarity(FunctionContext* context, const Columns& columns) {
-    DCHECK_EQ(columns.size(), 2);
-
-    const Column* base = columns[0].get();
-    const Column* target = columns[1].get();
-    size_t target_size = target->size();
-    if (base->size() != target_size) {
-        return Status::InvalidArgument(
-                fmt::format("cosine_similarity requires equal length arrays. base array size is {} and target "
-                            "array size is {}.",
-                            base->size(), target->size()));
+// Squared l2 distance of two float vectors.
+static inline float l2_distance_kernel(const float* a, const float* b, size_t dim) {
+    float sum = 0;
+    size_t j = 0;
+#if defined(__AVX512F__)
+    __m512 sum_vec512 = _mm512_setzero_ps();
+    for (; j + 15 < dim; j += 16) {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + j), _mm512_loadu_ps(b + j));
+        sum_vec512 = _mm512_fmadd_ps(diff, diff, sum_vec512);
+    }
+    sum += _mm512_reduce_add_ps(sum_vec512);
+#endif
+#ifdef __AVX2__
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (; j + 7 < dim; j += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + j), _mm256_loadu_ps(b + j));
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(diff, diff));
+    }
+    sum += sum_m256(sum_vec);
+#elif defined(__ARM_NEON)
+    float32x4_t sum_vec = vdupq_n_f32(0);
+    for (; j + 3 < dim; j += 4) {
+        float32x4_t diff = vsubq_f32(vld1q_f32(a + j), vld1q_f32(b + j));
+        sum_vec = vmlaq_f32(sum_vec, diff, diff);
+    }
+    sum += vaddvq_f32(sum_vec);
+#endif
+    for (; j < dim; j++) {
+        float diff = a[j] - b[j];
+        sum += diff * diff;
     }
-    if (base->has_null() || target->has_null()) {
-        return Status::InvalidArgument(
-                fmt::format("cosine_similarity does not support null values. {} array has null value.",
-                            base->has_null() ? "base" : "target"));
+    return sum;
+}
+
+// Inner product of two float vectors, and the squared norms of them if |with_norms|.
+template <bool with_norms>
+static inline void inner_product_kernel(const float* a, const float* b, size_t dim, float* product, float* a_norm,
+                                        float* b_norm) {
+    float sum = 0;
+    float a_sum = 0;
+    float b_sum = 0;
+    size_t j = 0;
+#ifdef __AVX2__
+    __m256 sum_vec = _mm256_setzero_ps();
+    __m256 a_sum_vec = _mm256_setzero_ps();
+    __m256 b_sum_vec = _mm256_setzero_ps();
+    for (; j + 7 < dim; j += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + j);
+        __m256 b_vec = _mm256_loadu_ps(b + j);
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(a_vec, b_vec));
+        if constexpr (with_norms) {
+            a_sum_vec = _mm256_add_ps(a_sum_vec, _mm256_mul_ps(a_vec, a_vec));
+            b_sum_vec = _mm256_add_ps(b_sum_vec, _mm256_mul_ps(b_vec, b_vec));
+        }
     }
-    if (base->is_constant()) {
-        const auto* const_column = down_cast<const ConstColumn*>(base);
-        const_column->data_column()->as_mutable_ptr()->assign(base->size(), 0);
-        base = const_column->data_column().get();
+    sum += sum_m256(sum_vec);
+    if constexpr (with_norms) {
+        a_sum += sum_m256(a_sum_vec);
+        b_sum += sum_m256(b_sum_vec);
+    }
+#elif defined(__ARM_NEON)
+    float32x4_t sum_vec = vdupq_n_f32(0);
+    float32x4_t a_sum_vec = vdupq_n_f32(0);
+    float32x4_t b_sum_vec = vdupq_n_f32(0);
+    for (; j + 3 < dim; j += 4) {
+        float32x4_t a_vec = vld1q_f32(a + j);
+        float32x4_t b_vec = vld1q_f32(b + j);
+        sum_vec = vmlaq_f32(sum_vec, a_vec, b_vec);
+        if constexpr (with_norms) {
+            a_sum_vec = vmlaq_f32(a_sum_vec, a_vec, a_vec);
+            b_sum_vec = vmlaq_f32(b_sum_vec, b_vec, b_vec);
+        }
     }
-    if (target->is_constant()) {
-        const auto* const_column = down_cast<const ConstColumn*>(target);
-        const_column->data_column()->as_mutable_ptr()->assign(target->size(), 0);
-        target = const_column->data_column().get();
+    sum += vaddvq_f32(sum_vec);
+    if constexpr (with_norms) {
+        a_sum += vaddvq_f32(a_sum_vec);
+        b_sum += vaddvq_f32(b_sum_vec);
     }
-
-    if (base->is_nullable()) {
-        base = down_cast<const NullableColumn*>(base)->data_column().get();
+#endif
+    for (; j < dim; j++) {
+        sum += a[j] * b[j];
+        if constexpr (with_norms) {
+            a_sum += a[j] * a[j];
+            b_sum += b[j] * b[j];
+        }
     }
-    if (target->is_nullable()) {
-        target = down_cast<const NullableColumn*>(target)->data_column().get();
+    *product = sum;
+    if constexpr (with_norms) {
+        *a_norm = a_sum;
+        *b_norm = b_sum;
     }
+}
 
-    // check dimension equality.
-    const Column* base_flat = down_cast<const ArrayColumn*>(base)->elements_column().get();
-    const uint32_t* base_offset = down_cast<const ArrayColumn*>(base)->offsets().get_data().data();
-    size_t base_flat_size = base_flat->size();
+// The flattened elements of an array argument of the vector distance functions. A constant argument keeps its
+// only array, which is used by every row instead of being copied for each row.
+template <LogicalType TYPE>
+struct VectorDistanceArg {
+    using CppType = RunTimeCppType<TYPE>;
 
-    const Column* target_flat = down_cast<const ArrayColumn*>(target)->elements_column().get();
-    size_t target_flat_size = target_flat->size();
-    const uint32_t* target_offset = down_cast<const ArrayColumn*>(target)->offsets().get_data().data();
+    const CppType* data = nullptr;
+    const uint32_t* offsets = nullptr;
+    bool is_const = false;
 
-    if (base_flat_size != target_flat_size) {
-        return Status::InvalidArgument("cosine_similarity requires equal length arrays");
+    size_t dim(size_t row) const {
+        size_t idx = is_const ? 0 : row;
+        return offsets[idx + 1] - offsets[idx];
     }
+    const CppType* row_data(size_t row) const { return data + offsets[is_const ? 0 : row]; }
+};
 
-    if (base_flat->has_null() || target_flat->has_null()) {
-        return Status::InvalidArgument("cosine_similarity does not support null values");
+template <LogicalType TYPE>
+static StatusOr<VectorDistanceArg<TYPE>> prepare_vector_distance_arg(const char* fn_name, const Column* column) {
+    using ColumnType = RunTimeColumnType<TYPE>;
+    VectorDistanceArg<TYPE> arg;
+    if (column->is_constant()) {
+        arg.is_const = true;
+        column = down_cast<const ConstColumn*>(column)->data_column().get();
     }
-    if (base_flat->is_nullable()) {
-        base_flat = down_cast<const NullableColumn*>(base_flat)->data_column().get();
+    if (column->is_nullable()) {
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
     }
-    if (target_flat->is_nullable()) {
-        target_flat = down_cast<const NullableColumn*>(target_flat)->data_column().get();
+    const auto* array = down_cast<const ArrayColumn*>(column);
+    const Column* flat = array->elements_column().get();
+    if (flat->has_null()) {
+        return Status::InvalidArgument(fmt::format("{} does not support null values", fn_name));
     }
+    if (flat->is_nullable()) {
+        flat = down_cast<const NullableColumn*>(flat)->data_column().get();
+    }
+    arg.data = down_cast<const ColumnType*>(flat)->get_data().data();
+    arg.offsets = array->offsets().get_data().data();
+    return arg;
+}
 
-    using CppType = RunTimeCppType<TYPE>;
-    using ColumnType = RunTimeColumnType<TYPE>;
-
-    const CppType* base_data_head = down_cast<const ColumnType*>(base_flat)->get_data().data();
-    const CppType* target_data_head = down_cast<const ColumnType*>(target_flat)->get_data().data();
-
-    // prepare result with nullable value.
-    MutableColumnPtr result = ColumnHelper::create_column(TypeDescriptor{TYPE}, false, false, target_size);
-    ColumnType* data_result = down_cast<ColumnType*>(result.get());
-    CppType* result_data = data_result->get_data().data();
+// Check the arguments of a vector distance function and get their flattened elements.
+template <LogicalType TYPE>
+static Status prepare_vector_distance_args(const char* fn_name, const Columns& columns, VectorDistanceArg<TYPE>* base,
+                                           VectorDistanceArg<TYPE>* target) {
+    DCHECK_EQ(columns.size(), 2);
+    const Column* base_column = columns[0].get();
+    const Column* target_column = columns[1].get();
+    size_t target_size = target_column->size();
+    if (base_column->size() != target_size) {
+        return Status::InvalidArgument(
+                fmt::format("{} requires equal length arrays. base array size is {} and target array size is {}.",
+                            fn_name, base_column->size(), target_size));
+    }
+    if (base_column->has_null() || target_column->has_null()) {
+        return Status::InvalidArgument(fmt::format("{} does not support null values. {} array has null value.", fn_name,
+                                                   base_column->has_null() ? "base" : "target"));
+    }
+    ASSIGN_OR_RETURN(*base, prepare_vector_distance_arg<TYPE>(fn_name, base_column));
+    ASSIGN_OR_RETURN(*target, prepare_vector_distance_arg<TYPE>(fn_name, target_column));
 
     for (size_t i = 0; i < target_size; i++) {
-        size_t t_dim_size = target_offset[i + 1] - target_offset[i];
-        size_t b_dim_size = base_offset[i + 1] - base_offset[i];
+        size_t t_dim_size = target->dim(i);
+        size_t b_dim_size = base->dim(i);
         if (t_dim_size != b_dim_size) {
             return Status::InvalidArgument(
-                    fmt::format("cosine_similarity requires equal length arrays in each row. base array dimension size "
+                    fmt::format("{} requires equal length arrays in each row. base array dimension size "
                                 "is {}, target array dimension size is {}.",
-                                b_dim_size, t_dim_size));
+                                fn_name, b_dim_size, t_dim_size));
         }
         if (t_dim_size == 0) {
-            return Status::InvalidArgument("cosine_similarity requires non-empty arrays in each row");
+            return Status::InvalidArgument(fmt::format("{} requires non-empty arrays in each row", fn_name));
         }
     }
+    return Status::OK();
+}
+
+template <LogicalType TYPE, bool isNorm>
+StatusOr<ColumnPtr> MathFunctions::cosine_similarity(FunctionContext* context, const Columns& columns) {
+    using CppType = RunTimeCppType<TYPE>;
+    using ColumnType = RunTimeColumnType<TYPE>;
+    static_assert(std::is_same_v<CppType, float>, "vector distance kernels only support float");
+
+    VectorDistanceArg<TYPE> base;
+    VectorDistanceArg<TYPE> target;
+    RETURN_IF_ERROR(prepare_vector_distance_args<TYPE>("cosine_similarity", columns, &base, &target));
+
+    size_t target_size = columns[1]->size();
+    MutableColumnPtr result = ColumnHelper::create_column(TypeDescriptor{TYPE}, false, false, target_size);
+    CppType* result_data = down_cast<ColumnType*>(result.get())->get_data().data();
 
-    const CppType* target_data = target_data_head;
-    const CppType* base_data = base_data_head;
     for (size_t i = 0; i < target_size; i++) {
         CppType sum = 0;
         CppType base_sum = 0;
         CppType target_sum = 0;
-        size_t dim_size = target_offset[i + 1] - target_offset[i];
-        CppType result_value = 0;
-        size_t j = 0;
-#ifdef __AVX2__
-        if (std::is_same_v<CppType, float>) {
-            __m256 sum_vec = _mm256_setzero_ps();
-            __m256 base_sum_vec = _mm256_setzero_ps();
-            __m256 target_sum_vec = _mm256_setzero_ps();
-            for (; j + 7 < dim_size; j += 8) {
-                __m256 base_data_vec = _mm256_loadu_ps(base_data + j);
-                __m256 target_data_vec = _mm256_loadu_ps(target_data + j);
-
-                __m256 mul_vec = _mm256_mul_ps(base_data_vec, target_data_vec);
-                sum_vec = _mm256_add_ps(sum_vec, mul_vec);
-
-                if constexpr (!isNorm) {
-                    __m256 base_mul_vec = _mm256_mul_ps(base_data_vec, base_data_vec);
-                    base_sum_vec = _mm256_add_ps(base_sum_vec, base_mul_vec);
-                    __m256 target_mul_vec = _mm256_mul_ps(target_data_vec, target_data_vec);
-                    target_sum_vec = _mm256_add_ps(target_sum_vec, target_mul_vec);
-                }
-            }
-            sum += sum_m256(sum_vec);
-            if constexpr (!isNorm) {
-                base_sum += sum_m256(base_sum_vec);
-                target_sum += sum_m256(target_sum_vec);
-            }
-        }
-#endif
-        for (; j < dim_size; j++) {
-            sum += base_data[j] * target_data[j];
-            if constexpr (!isNorm) {
-                base_sum += base_data[j] * base_data[j];
-                target_sum += target_data[j] * target_data[j];
-            }
-        }
+        inner_product_kernel<!isNorm>(base.row_data(i), target.row_data(i), target.dim(i), &sum, &base_sum,
+                                      &target_sum);
         if constexpr (!isNorm) {
             if (base_sum == 0 || target_sum == 0) {
-                result_value = 0;
+                sum = 0;
             } else {
-                result_value = sum / (std::sqrt(base_sum) * std::sqrt(target_sum));
+                sum = sum / (std::sqrt(base_sum) * std::sqrt(target_sum));
             }
-        } else {
-            result_value = sum;
         }
-        result_data[i] = result_value;
-        target_data += dim_size;
-        base_data += dim_size;
+        result_data[i] = sum;
     }
     return result;
 }
@@ -1240,101 +1302,20 @@ template StatusOr<ColumnPtr> MathFunctions::cosine_similarity<TYPE_FLOAT, false>
 
 template <LogicalType TYPE>
 StatusOr<ColumnPtr> MathFunctions::l2_distance(FunctionContext* context, const Columns& columns) {
-    DCHECK_EQ(columns.size(), 2);
-
-    const Column* base = columns[0].get();
-    const Column* target = columns[1].get();
-    size_t target_size = target->size();
-    if (base->size() != target_size) {
-        return Status::InvalidArgument(fmt::format(
-                "l2_distance requires equal length arrays. base array size is {} and target array size is {}.",
-                base->size(), target->size()));
-    }
-    if (base->has_null() || target->has_null()) {
-        return Status::InvalidArgument(fmt::format("l2_distance does not support null values. {} array has null value.",
-                                                   base->has_null() ? "base" : "target"));
-    }
-    if (base->is_constant()) {
-        auto* const_column = down_cast<const ConstColumn*>(base);
-        const_column->data_column()->as_mutable_ptr()->assign(base->size(), 0);
-        base = const_column->data_column().get();
-    }
-    if (target->is_constant()) {
-        auto* const_column = down_cast<const ConstColumn*>(target);
-        const_column->data_column()->as_mutable_ptr()->assign(target->size(), 0);
-        target = const_column->data_column().get();
-    }
-    if (base->is_nullable()) {
-        base = down_cast<const NullableColumn*>(base)->data_column().get();
-    }
-    if (target->is_nullable()) {
-        target = down_cast<const NullableColumn*>(target)->data_column().get();
-    }
-
-    // check dimension equality.
-    const Column* base_flat = down_cast<const ArrayColumn*>(base)->elements_column().get();
-    const uint32_t* base_offset = down_cast<const ArrayColumn*>(base)->offsets().get_data().data();
-    size_t base_flat_size = base_flat->size();
-
-    const Column* target_flat = down_cast<const ArrayColumn*>(target)->elements_column().get();
-    size_t target_flat_size = target_flat->size();
-    const uint32_t* target_offset = down_cast<const ArrayColumn*>(target)->offsets().get_data().data();
-
-    if (base_flat_size != target_flat_size) {
-        return Status::InvalidArgument("l2_distance requires equal length arrays");
-    }
-
-    if (base_flat->has_null() || target_flat->has_null()) {
-        return Status::InvalidArgument("l2_distance does not support null values");
-    }
-    if (base_flat->is_nullable()) {
-        base_flat = down_cast<const NullableColumn*>(base_flat)->data_column().get();
-    }
-    if (target_flat->is_nullable()) {
-        target_flat = down_cast<const NullableColumn*>(target_flat)->data_column().get();
-    }
-
     using CppType = RunTimeCppType<TYPE>;
     using ColumnType = RunTimeColumnType<TYPE>;
+    static_assert(std::is_same_v<CppType, float>, "vector distance kernels only support float");
 
-    const CppType* base_data_head = down_cast<const ColumnType*>(base_flat)->get_data().data();
-    const CppType* target_data_head = down_cast<const ColumnType*>(target_flat)->get_data().data();
+    VectorDistanceArg<TYPE> base;
+    VectorDistanceArg<TYPE> target;
+    RETURN_IF_ERROR(prepare_vector_distance_args<TYPE>("l2_distance", columns, &base, &target));
 
-    // prepare result with nullable value.
+    size_t target_size = columns[1]->size();
     MutableColumnPtr result = ColumnHelper::create_column(TypeDescriptor{TYPE}, false, false, target_size);
-    ColumnType* data_result = down_cast<ColumnType*>(result.get());
-    CppType* result_data = data_result->get_data().data();
-
+    CppType* result_data = down_cast<ColumnType*>(result.get())->get_data().data();
     for (size_t i = 0; i < target_size; i++) {
-        size_t t_dim_size = target_offset[i + 1] - target_offset[i];
-        size_t b_dim_size = base_offset[i + 1] - base_offset[i];
-        if (t_dim_size != b_dim_size) {
-            return Status::InvalidArgument(
-                    fmt::format("l2_distance requires equal length arrays in each row. base array dimension size "
-                                "is {}, target array dimension size is {}.",
-                                b_dim_size, t_dim_size));
-        }
-        if (t_dim_size == 0) {
-            return Status::InvalidArgument("l2_distance requires non-empty arrays in each row");
-        }
-    }
-
-    const CppType* target_data = target_data_head;
-    const CppType* base_data = base_data_head;
-
-    for (size_t i = 0; i < target_size; i++) {
-        CppType sum = 0;
-        size_t dim_size = target_offset[i + 1] - target_offset[i];
-        for (size_t j = 0; j < dim_size; j++) {
-            CppType distance;
-            distance = (base_data[j] - target_data[j]) * (base_data[j] - target_data[j]);
-            sum += distance;
-        }
-        result_data[i] = sum;
-        target_data += dim_size;
-        base_data += dim_size;
+        result_data[i] = l2_distance_kernel(base.row_data(i), target.row_data(i), target.dim(i));
     }
-
     return result;
 }
 
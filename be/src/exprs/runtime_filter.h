@@ -16,6 +16,7 @@
 
 #include <numeric>
 #include <sstream>
+#include <variant>
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
@@ -43,6 +44,8 @@ inline const constexpr uint8_t RF_VERSION = 0x2; // deprecated
 inline const constexpr uint8_t RF_VERSION_V2 = 0x3;
 // Serialize format: RF_VERSION (1B) | RuntimeFilterType (1B) | RuntimeFilter(LogicalType | other content)
 inline const constexpr uint8_t RF_VERSION_V3 = 0x4;
+// Serialize format: RF_COMPRESSED_MAGIC (1B) | uncompressed size (8B) | ZSTD compressed RF in one of the above formats
+inline const constexpr uint8_t RF_COMPRESSED_MAGIC = 0x80;
 enum class RuntimeFilterSerializeType : uint8_t {
     NONE = 0,
     EMPTY_FILTER = 1,
@@ -1204,6 +1207,12 @@ public:
         }
     }
 
+    void insert_hash(uint64_t hash) {
+        if (LIKELY(_bf.can_use())) {
+            _bf.insert_hash(hash);
+        }
+    }
+
     void insert_into_hash_partitions(const CppType& value) {
         DCHECK(!_hash_partition_bf.empty());
         size_t hash = compute_hash(value);
@@ -1599,6 +1608,30 @@ public:
 
     void insert(const CppType& value);
 
+    // Build the bitset of the values of an IN list. Return false if the bitset would take more memory than the values
+    // themselves, a hash set is preferred for such sparse values.
+    template <typename Container>
+    bool init_for_in_list(const Container& values) {
+        if (values.empty()) {
+            return false;
+        }
+        CppType min_value = *values.begin();
+        CppType max_value = min_value;
+        for (const auto& value : values) {
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+        }
+        set_min_max(min_value, max_value);
+        if (value_interval() / 8 >= values.size() * sizeof(CppType)) {
+            return false;
+        }
+        init();
+        for (const auto& value : values) {
+            insert(value);
+        }
+        return true;
+    }
+
     template <bool CheckRange>
     ALWAYS_INLINE bool contains(const CppType& value, uint8_t selected) const {
         bool matched = selected != 0;
@@ -1650,6 +1683,10 @@ private:
     std::vector<uint8_t> _bitset;
 };
 
+// Bitset<LT> if LT is supported by the bitset, otherwise an empty placeholder.
+template <LogicalType LT>
+using MaybeBitset = std::conditional_t<BitsetSupportedLogicalType<LT>, Bitset<LT>, std::monostate>;
+
 /// RuntimeBitsetFilter only support BROADCAST join.
 template <LogicalType LT>
 class RuntimeBitsetFilter final : public RuntimeMembershipFilter {
@@ -1754,6 +1791,13 @@ public:
         min_max_filter().insert(value);
     }
 
+    // Insert the value whose hash of the membership filter is known, e.g. computed by the join hash table build.
+    void insert_with_hash(const CppType& value, uint64_t hash) {
+        DCHECK_EQ(hash, membership_filter().compute_hash(value));
+        membership_filter().insert_hash(hash);
+        min_max_filter().insert(value);
+    }
+
     void insert_skew_values(const CppType& value) {
         _membership_filter.insert_into_hash_partitions(value);
         min_max_filter().insert(value);
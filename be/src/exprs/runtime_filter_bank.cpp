@@ -21,6 +21,7 @@
 #include <thread>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exprs/agg_in_runtime_filter.h"
 #include "exprs/dictmapping_expr.h"
@@ -38,6 +39,7 @@
 #include "simd/simd.h"
 #include "types/logical_type.h"
 #include "types/logical_type_infra.h"
+#include "util/compression/block_compression.h"
 #include "util/time.h"
 
 namespace starrocks {
@@ -266,10 +268,56 @@ size_t RuntimeFilterHelper::serialize_runtime_filter(RuntimeState* state, const
     return serialize_runtime_filter(rf_version, rf, data);
 }
 
+static constexpr size_t kCompressedRuntimeFilterHeaderSize = sizeof(uint8_t) + sizeof(uint64_t);
+
+void RuntimeFilterHelper::compress_serialized_runtime_filter(std::string* data) {
+    if (!config::enable_runtime_filter_compression ||
+        data->size() < static_cast<size_t>(config::runtime_filter_compression_min_bytes)) {
+        return;
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    if (!get_block_compression_codec(CompressionTypePB::ZSTD, &codec).ok() || codec == nullptr) {
+        return;
+    }
+
+    std::string compressed;
+    compressed.resize(kCompressedRuntimeFilterHeaderSize + codec->max_compressed_len(data->size()));
+    Slice output(compressed.data() + kCompressedRuntimeFilterHeaderSize,
+                 compressed.size() - kCompressedRuntimeFilterHeaderSize);
+    if (!codec->compress(Slice(*data), &output).ok() ||
+        kCompressedRuntimeFilterHeaderSize + output.size >= data->size()) {
+        return;
+    }
+    const uint64_t uncompressed_size = data->size();
+    compressed[0] = RF_COMPRESSED_MAGIC;
+    memcpy(compressed.data() + sizeof(uint8_t), &uncompressed_size, sizeof(uncompressed_size));
+    compressed.resize(kCompressedRuntimeFilterHeaderSize + output.size);
+    data->swap(compressed);
+}
+
 int RuntimeFilterHelper::deserialize_runtime_filter(ObjectPool* pool, RuntimeFilter** rf, const uint8_t* data,
                                                     size_t size) {
     *rf = nullptr;
 
+    if (size >= kCompressedRuntimeFilterHeaderSize && data[0] == RF_COMPRESSED_MAGIC) {
+        uint64_t uncompressed_size = 0;
+        memcpy(&uncompressed_size, data + sizeof(uint8_t), sizeof(uncompressed_size));
+        const BlockCompressionCodec* codec = nullptr;
+        if (!get_block_compression_codec(CompressionTypePB::ZSTD, &codec).ok() || codec == nullptr) {
+            LOG(WARNING) << "no codec to decompress runtime filter";
+            return 0;
+        }
+        std::string uncompressed(uncompressed_size, 0);
+        Slice output(uncompressed.data(), uncompressed.size());
+        Slice input(data + kCompressedRuntimeFilterHeaderSize, size - kCompressedRuntimeFilterHeaderSize);
+        if (Status st = codec->decompress(input, &output); !st.ok() || output.size != uncompressed_size) {
+            LOG(WARNING) << "failed to decompress runtime filter: " << st;
+            return 0;
+        }
+        return deserialize_runtime_filter(pool, rf, reinterpret_cast<const uint8_t*>(uncompressed.data()),
+                                          uncompressed.size());
+    }
+
     size_t offset = 0;
 
     // 1. rf_version
@@ -474,9 +522,56 @@ Status RuntimeFilterHelper::fill_runtime_filter(const Columns& columns, LogicalT
     return Status::OK();
 }
 
+template <LogicalType LT>
+static void fill_runtime_bloom_filter_with_hashes(const ColumnPtr& column, const Buffer<uint64_t>& hashes,
+                                                  RuntimeFilter* expr, size_t column_offset, bool eq_null) {
+    auto* filter = down_cast<ComposedRuntimeBloomFilter<LT>*>(expr);
+    const NullColumn* null_column = nullptr;
+    const Column* data_column = column.get();
+    if (column->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
+        null_column = nullable_column->has_null() ? nullable_column->null_column().get() : nullptr;
+        data_column = nullable_column->data_column().get();
+    }
+    const auto& data_array = GetContainer<LT>::get_data(data_column);
+    for (size_t j = column_offset; j < data_array.size(); j++) {
+        if (null_column != nullptr && null_column->get_data()[j]) {
+            if (eq_null) {
+                filter->insert_null();
+            }
+        } else {
+            filter->insert_with_hash(data_array[j], hashes[j]);
+        }
+    }
+}
+
+Status RuntimeFilterHelper::fill_runtime_filter(const Columns& columns, const std::vector<KeyHashesPtr>& key_hashes,
+                                                LogicalType type, RuntimeFilter* filter, size_t column_offset,
+                                                bool eq_null) {
+    // The hashes are those of the string keys, see JoinKeyHash<Slice>.
+    const bool use_key_hashes = key_hashes.size() == columns.size() && is_string_type(type) &&
+                                filter->type() == RuntimeFilterSerializeType::BLOOM_FILTER;
+    for (size_t i = 0; i < columns.size(); i++) {
+        const auto& column = columns[i];
+        if (use_key_hashes && key_hashes[i] != nullptr && key_hashes[i]->size() == column->size() &&
+            !column->has_large_column()) {
+            if (type == TYPE_CHAR) {
+                fill_runtime_bloom_filter_with_hashes<TYPE_CHAR>(column, *key_hashes[i], filter, column_offset,
+                                                                 eq_null);
+            } else {
+                fill_runtime_bloom_filter_with_hashes<TYPE_VARCHAR>(column, *key_hashes[i], filter, column_offset,
+                                                                    eq_null);
+            }
+        } else {
+            RETURN_IF_ERROR(fill_runtime_filter(column, type, filter, column_offset, eq_null));
+        }
+    }
+    return Status::OK();
+}
+
 Status RuntimeFilterHelper::fill_runtime_filter(const pipeline::RuntimeMembershipFilterBuildParam& param,
                                                 LogicalType type, RuntimeFilter* filter, size_t column_offset) {
-    return fill_runtime_filter(param.columns, type, filter, column_offset, param.eq_null);
+    return fill_runtime_filter(param.columns, param.key_hashes, type, filter, column_offset, param.eq_null);
 }
 
 StatusOr<ExprContext*> RuntimeFilterHelper::rewrite_runtime_filter_in_cross_join_node(ObjectPool* pool,
@@ -49,6 +49,10 @@ class RuntimeProfile;
 
 class HashJoinNode;
 class RuntimeFilterProbeCollector;
+
+// The hashes of the join keys kept by the hash table build, see JoinHashTableItems::key_hashes.
+using KeyHashesPtr = std::shared_ptr<Buffer<uint64_t>>;
+
 class RuntimeFilterHelper {
 public:
     // ==================================
@@ -60,6 +64,9 @@ public:
     static size_t serialize_runtime_filter(int rf_version, const RuntimeFilter* rf, uint8_t* data);
     static size_t serialize_runtime_filter_for_skew_broadcast_join(const ColumnPtr& column, bool eq_null,
                                                                    uint8_t* data);
+    // Compress the serialized runtime filter in place if it's large enough and the compression saves bytes.
+    static void compress_serialized_runtime_filter(std::string* data);
+    // Accept both the compressed and uncompressed serialized runtime filter.
     static int deserialize_runtime_filter(ObjectPool* pool, RuntimeFilter** rf, const uint8_t* data, size_t size);
     static int deserialize_runtime_filter_for_skew_broadcast_join(ObjectPool* pool, SkewBroadcastRfMaterial** material,
                                                                   const uint8_t* data, size_t size,
@@ -80,6 +87,10 @@ public:
                                       size_t column_offset, bool eq_null, bool is_skew_join = false);
     static Status fill_runtime_filter(const Columns& column, LogicalType type, RuntimeFilter* filter,
                                       size_t column_offset, bool eq_null);
+    // `key_hashes[i]`, if not null, holds the bloom filter hashes of the rows of `columns[i]`, computed when
+    // building the join hash table, which are inserted instead of hashing the rows again.
+    static Status fill_runtime_filter(const Columns& columns, const std::vector<KeyHashesPtr>& key_hashes,
+                                      LogicalType type, RuntimeFilter* filter, size_t column_offset, bool eq_null);
     static Status fill_runtime_filter(const pipeline::RuntimeMembershipFilterBuildParam& param, LogicalType type,
                                       RuntimeFilter* filter, size_t column_offset);
     static StatusOr<ExprContext*> rewrite_runtime_filter_in_cross_join_node(ObjectPool* pool, ExprContext* conjunct,
@@ -447,8 +447,7 @@ ColumnPtr substr_const_not_null(const Columns& columns, const BinaryColumn* src,
     raw::make_room(&offsets, size + 1);
     offsets[0] = 0;
 
-    auto& src_bytes = src->get_bytes();
-    auto is_ascii = validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size());
+    auto is_ascii = src->is_ascii();
     if (is_ascii) {
         if (off > 0) {
             // off_is_negative=false
@@ -494,7 +493,7 @@ ColumnPtr right_const_not_null(const Columns& columns, const BinaryColumn* src,
     bytes.reserve(reserved);
     raw::make_room(&offsets, size + 1);
     offsets[0] = 0;
-    auto is_ascii = validate_ascii_fast((const char*)src_bytes.data(), src_bytes_size);
+    auto is_ascii = src->is_ascii();
     if (is_ascii) {
         // off_is_negative=true, off=-len
         // allow_out_of_left_bound=true
@@ -684,8 +683,7 @@ static inline ColumnPtr substr_not_const(FunctionContext* context, const starroc
     NullableBinaryColumnBuilder result;
     result.resize(rows_num, src->byte_size());
 
-    const Bytes& src_bytes = src->get_bytes();
-    auto is_ascii = validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size());
+    auto is_ascii = src->is_ascii();
     if (is_ascii) {
         ascii_substr_not_const(rows_num, &str_viewer, &off_viewer, &len_viewer, &result);
     } else {
@@ -704,8 +702,7 @@ static inline ColumnPtr right_not_const(FunctionContext* context, const starrock
 
     NullableBinaryColumnBuilder result;
 
-    const Bytes& src_bytes = src->get_bytes();
-    auto is_ascii = validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size());
+    auto is_ascii = src->is_ascii();
     result.resize(rows_num, src->byte_size());
 
     if (is_ascii) {
@@ -1599,8 +1596,7 @@ static inline ColumnPtr pad_const_not_null(const Columns& columns, const BinaryC
         SubstrState state = {.is_const = true, .pos = 1, .len = len};
         return substr_const_not_null(columns, src, &state);
     }
-    auto& src_bytes = src->get_bytes();
-    auto src_is_utf8 = !validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size());
+    auto src_is_utf8 = !src->is_ascii();
     if (src_is_utf8 && pad_state->fill_is_utf8) {
         return pad_utf8_const<true, true, pad_type>(columns, src, (uint8_t*)fill.data, fill.size, len,
                                                     pad_state->fill_utf8_index);
@@ -1757,8 +1753,7 @@ ColumnPtr pad_not_const(const Columns& columns, [[maybe_unused]] const PadState*
 template <bool pad_is_const, PadType pad_type>
 ColumnPtr pad_not_const_check_ascii(const Columns& columns, [[maybe_unused]] const PadState* state) {
     auto src = ColumnHelper::get_binary_column(columns[0].get());
-    auto& bytes = src->get_bytes();
-    auto is_ascii = validate_ascii_fast((const char*)bytes.data(), bytes.size());
+    auto is_ascii = src->is_ascii();
     if (is_ascii) {
         return pad_not_const<true, pad_is_const, pad_type>(columns, state);
     } else {
@@ -1922,6 +1917,10 @@ DEFINE_UNARY_FN_WITH_IMPL(utf8LengthImpl, str) {
 }
 
 StatusOr<ColumnPtr> StringFunctions::utf8_length(FunctionContext* context, const starrocks::Columns& columns) {
+    // the number of characters of an ASCII string is the number of its bytes
+    if (!columns[0]->is_constant() && ColumnHelper::get_binary_column(columns[0].get())->is_ascii()) {
+        return VectorizedStrictUnaryFunction<lengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
+    }
     return VectorizedStrictUnaryFunction<utf8LengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
@@ -2054,7 +2053,7 @@ public:
         auto dst = RunTimeColumnType<TYPE_VARCHAR>::create();
         auto& dst_offsets = dst->get_offset();
         auto& dst_bytes = dst->get_bytes();
-        if (validate_ascii_fast(reinterpret_cast<const char*>(src_bytes.data()), src_bytes.size())) {
+        if (src->is_ascii()) {
             dst_offsets.assign(src_offsets.begin(), src_offsets.end());
             // if all characters are ascii, we process them with the fast path
             if constexpr (to_upper) {
@@ -2202,7 +2201,7 @@ struct ReverseFunction {
         dst_offsets.assign(src_offsets.begin(), src_offsets.end());
         dst_bytes.resize(src_bytes.size());
 
-        const auto is_ascii = validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size());
+        const auto is_ascii = src->is_ascii();
         if (is_ascii) {
             reverse<true>(src, &dst_bytes);
         } else {
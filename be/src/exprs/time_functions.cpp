@@ -107,6 +107,15 @@ ColumnPtr date_valid(const ColumnPtr& v1) {
     }
 }
 
+// The civil time of the unix timestamp `seconds` in the time zone of `offsets`, without a cctz lookup per row.
+static DateTimeValue unixtime_to_datetime(TimezoneOffsetCache& offsets, int64_t seconds) {
+    TimestampValue ts;
+    ts.from_unix_second(seconds + offsets.utc_offset(seconds));
+    int year, month, day, hour, minute, second, usec;
+    ts.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+    return DateTimeValue(TIME_DATETIME, year, month, day, hour, minute, second, 0);
+}
+
 #define DEFINE_TIME_CALC_FN(NAME, LTYPE, RTYPE, RESULT_TYPE)                                               \
     StatusOr<ColumnPtr> TimeFunctions::NAME(FunctionContext* context, const starrocks::Columns& columns) { \
         auto p = VectorizedStrictBinaryFunction<NAME##Impl>::evaluate<LTYPE, RTYPE, RESULT_TYPE>(          \
@@ -225,6 +234,8 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
+    TimezoneOffsetCache from_offsets(from);
+    TimezoneOffsetCache to_offsets(to);
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
@@ -233,6 +244,15 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
 
         auto datetime_value = time_viewer.value(row);
 
+        int64_t utc_seconds;
+        if (from_offsets.local_to_utc(datetime_value.to_unix_second(), &utc_seconds)) {
+            TimestampValue ts;
+            ts.from_unix_second(utc_seconds + to_offsets.utc_offset(utc_seconds),
+                                timestamp::to_time(datetime_value.timestamp()) % USECS_PER_SEC);
+            result.append(ts);
+            continue;
+        }
+
         int year, month, day, hour, minute, second, usec;
         datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
         DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
@@ -1494,6 +1514,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache offsets(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1506,11 +1527,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime(offsets, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1529,6 +1546,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache offsets(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1541,11 +1559,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime(offsets, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1676,6 +1690,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache offsets(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_column.is_null(row)) {
             result.append_null();
@@ -1689,11 +1704,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime(offsets, date);
         // use lambda to avoid adding method for TimeFunctions.
         if (format.size > DEFAULT_DATE_FORMAT_LIMIT) {
             result.append_null();
@@ -1724,6 +1735,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache offsets(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_content.empty()) {
             result.append_null();
@@ -1736,11 +1748,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime(offsets, date);
 
         char buf[128];
         if (!dtv.to_format_string((const char*)format_content.c_str(), format_content.size(), buf)) {
@@ -15,7 +15,13 @@
 #include "formats/avro/cpp/avro_reader.h"
 
 #include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
+#include <set>
+
+#include <avrocpp/Compiler.hh>
 #include <avrocpp/NodeImpl.hh>
 #include <avrocpp/Types.hh>
 #include <avrocpp/ValidSchema.hh>
@@ -91,6 +97,44 @@ bool AvroBufferInputStream::fill() {
     return true;
 }
 
+// Build the reader schema of the fields in `field_names` of the record `data_schema`, in their order in the file.
+// Decoding with it skips the other fields in the decoder, instead of materializing them into the generic datum.
+// Return false if there is nothing to skip, or the fields can not be projected, e.g. a kept field refers to a named
+// type defined by a skipped one.
+static bool project_schema(const avro::ValidSchema& data_schema, const std::set<std::string>& field_names,
+                           avro::ValidSchema* reader_schema) {
+    const auto& root = data_schema.root();
+    if (root->type() != avro::AVRO_RECORD || field_names.empty() || field_names.size() >= root->leaves()) {
+        return false;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(data_schema.toJson(false));
+    if (doc.HasParseError() || !doc.IsObject() || !doc.HasMember("fields") || !doc["fields"].IsArray()) {
+        return false;
+    }
+    auto& fields = doc["fields"];
+    for (auto it = fields.Begin(); it != fields.End();) {
+        if (it->IsObject() && it->HasMember("name") && (*it)["name"].IsString() &&
+            field_names.count((*it)["name"].GetString()) > 0) {
+            ++it;
+        } else {
+            it = fields.Erase(it);
+        }
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    try {
+        *reader_schema = avro::compileJsonSchemaFromString(buffer.GetString());
+    } catch (const avro::Exception& ex) {
+        VLOG(2) << "Avro reader can not project schema, read all fields. error: " << ex.what();
+        return false;
+    }
+    return true;
+}
+
 AvroReader::~AvroReader() {
     if (_datum != nullptr) {
         _datum.reset();
@@ -118,9 +162,28 @@ Status AvroReader::init(std::unique_ptr<avro::InputStream> input_stream, const s
     _counter = counter;
 
     try {
-        _file_reader = std::make_unique<avro::DataFileReader<avro::GenericDatum>>(std::move(input_stream));
+        auto file_reader_base = std::make_unique<avro::DataFileReaderBase>(std::move(input_stream));
+
+        std::set<std::string> field_names;
+        const auto& data_schema = file_reader_base->dataSchema();
+        for (size_t i = 0; i < _num_of_columns_from_file; ++i) {
+            const auto& desc = (*_slot_descs)[i];
+            size_t index = 0;
+            if (desc != nullptr && data_schema.root()->nameIndex(desc->col_name(), index)) {
+                field_names.insert(desc->col_name());
+            }
+        }
+
+        avro::ValidSchema reader_schema;
+        if (project_schema(data_schema, field_names, &reader_schema)) {
+            _file_reader = std::make_unique<avro::DataFileReader<avro::GenericDatum>>(std::move(file_reader_base),
+                                                                                     reader_schema);
+        } else {
+            _file_reader = std::make_unique<avro::DataFileReader<avro::GenericDatum>>(std::move(file_reader_base));
+        }
 
-        const auto& schema = _file_reader->dataSchema();
+        // The datum and the field indexes are of the fields to read, `get_schema()` still returns all of them.
+        const auto& schema = _file_reader->readerSchema();
         _datum = std::make_unique<avro::GenericDatum>(schema);
 
         _field_indexes.resize(_num_of_columns_from_file, -1);
@@ -153,7 +216,7 @@ void AvroReader::TEST_init(const std::vector<SlotDescriptor*>* slot_descs,
     _num_of_columns_from_file = _column_readers->size();
     _col_not_found_as_null = col_not_found_as_null;
 
-    const auto& schema = _file_reader->dataSchema();
+    const auto& schema = _file_reader->readerSchema();
     _datum = std::make_unique<avro::GenericDatum>(schema);
 
     _field_indexes.resize(_num_of_columns_from_file, -1);
@@ -492,6 +492,33 @@ inline void Decimal32Or64Or128ColumnReader<DecimalType>::_fill_decimal_column_ge
     }
 }
 
+// The direct encoded strings of a batch are decoded into one blob in row order, the null values take no bytes,
+// so they are appended with one memcpy. Returns false if the values are not contiguous, e.g. the dictionary
+// encoded strings point into the dictionary, then nothing is appended.
+template <typename Bytes, typename Offsets>
+static bool append_contiguous_strings(const orc::StringVectorBatch* data, size_t from, size_t size, size_t col_start,
+                                      Bytes* vb, Offsets* vo, size_t* write_pos) {
+    if (size == 0) {
+        return false;
+    }
+    const char* not_null = data->hasNulls ? data->notNull.data() : nullptr;
+    const char* start = data->data[from];
+    const char* expected = start;
+    for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
+        if (not_null == nullptr || not_null[cvb_pos]) {
+            if (data->data[cvb_pos] != expected) {
+                return false;
+            }
+            expected += data->length[cvb_pos];
+        }
+        // Need plus 1 for offset
+        (*vo)[i + 1] = *write_pos + (expected - start);
+    }
+    memcpy(&(*vb)[*write_pos], start, expected - start);
+    *write_pos += expected - start;
+    return true;
+}
+
 Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
 
@@ -518,7 +545,9 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
 
     size_t write_pos = vb.size();
-    if (cvb->hasNulls) {
+    if (_type.type != TYPE_CHAR && append_contiguous_strings(data, from, size, col_start, &vb, &vo, &write_pos)) {
+        // all the values have been copied at once
+    } else if (cvb->hasNulls) {
         if (_type.type == TYPE_CHAR) {
             // Possibly there are some zero padding characters in value, we have to strip them off.
             for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
@@ -654,7 +683,10 @@ Status VarbinaryColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& c
     vb.resize(vb.size() + len);
     raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
 
-    if (cvb->hasNulls) {
+    if (append_contiguous_strings(data, from, size, col_start, &vb, &vo, &write_pos)) {
+        // the bytes are resized by the total length of the values, trim the lengths of the null values if any
+        vb.resize(write_pos);
+    } else if (cvb->hasNulls) {
         for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
             if (cvb->notNull[cvb_pos]) {
                 strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], data->length[cvb_pos]);
@@ -14,6 +14,7 @@
 
 #include "formats/parquet/chunk_writer.h"
 
+#include <fmt/format.h>
 #include <parquet/file_writer.h>
 #include <parquet/schema.h>
 
@@ -22,10 +23,15 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/function_context.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks::parquet {
 
@@ -45,28 +51,94 @@ ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeD
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
 }
 
+// the number of leaf columns under the node, which are the columns of the row group written by it
+static int num_leaf_columns(const ::parquet::schema::Node& node) {
+    if (node.is_primitive()) {
+        return 1;
+    }
+    const auto& group = static_cast<const ::parquet::schema::GroupNode&>(node);
+    int num_leaves = 0;
+    for (int i = 0; i < group.field_count(); i++) {
+        num_leaves += num_leaf_columns(*group.field(i));
+    }
+    return num_leaves;
+}
+
 Status ChunkWriter::write(Chunk* chunk) {
     LevelBuilderContext ctx(chunk->num_rows());
 
-    // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
-    // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
-
-    auto write_leaf_column = [&](const LevelBuilderResult& result) {
-        auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
-        leaf_column_writer.write(result);
-        _estimated_buffered_bytes[leaf_column_idx] = leaf_column_writer.estimated_buffered_value_bytes();
-        ++leaf_column_idx;
-    };
-
+    // The expressions are evaluated in this thread, the column chunks are independent in a buffered row group,
+    // so the columns can be encoded in parallel.
+    Columns cols(_type_descs.size());
+    std::vector<int> first_leaf_column_idx(_type_descs.size() + 1, 0);
     for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        ASSIGN_OR_RETURN(cols[i], _eval_func(chunk, i));
+        first_leaf_column_idx[i + 1] = first_leaf_column_idx[i] + num_leaf_columns(*_schema->field(i));
+    }
+
+    // Writes out all leaf parquet columns of the i-th column to the RowGroupWriter. Each leaf column is written
+    // fully before the next column is written. Columns are written in DFS order.
+    auto write_column = [&](size_t i) -> Status {
+        int leaf_column_idx = first_leaf_column_idx[i];
+        auto write_leaf_column = [&](const LevelBuilderResult& result) {
+            auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
+            leaf_column_writer.write(result);
+            _estimated_buffered_bytes[leaf_column_idx] = leaf_column_writer.estimated_buffered_value_bytes();
+            ++leaf_column_idx;
+        };
         auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i), _timezone, _use_legacy_decimal_encoding,
                                           _use_int96_timestamp_encoding);
         RETURN_IF_ERROR(level_builder.init());
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
+        return level_builder.write(ctx, cols[i], write_leaf_column);
+    };
+    return _for_each_column(_type_descs.size(), write_column);
+}
+
+Status ChunkWriter::_for_each_column(size_t num_columns, const std::function<Status(size_t)>& func) {
+    ThreadPool* pool = ExecEnv::GetInstance()->parquet_encode_thread_pool();
+    if (pool == nullptr || config::parquet_writer_encode_thread_pool_num_max <= 0 ||
+        num_columns < config::parquet_writer_parallel_min_columns) {
+        for (size_t i = 0; i < num_columns; ++i) {
+            RETURN_IF_ERROR(func(i));
+        }
+        return Status::OK();
     }
 
+    // the calling thread takes the group 0. The parquet writer reports errors by exceptions, they are turned
+    // into status in the pool threads so that they don't escape the tasks.
+    const size_t num_groups = std::min<size_t>(num_columns, pool->max_threads() + 1);
+    std::vector<Status> statuses(num_groups);
+    auto run_group = [&](size_t group) {
+        for (size_t i = group; i < num_columns; i += num_groups) {
+            try {
+                statuses[group] = func(i);
+            } catch (const std::exception& e) {
+                statuses[group] = Status::IOError(fmt::format("encode parquet column error: {}", e.what()));
+            }
+            if (!statuses[group].ok()) {
+                return;
+            }
+        }
+    };
+    CountDownLatch latch(num_groups - 1);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t group = 1; group < num_groups; ++group) {
+        auto st = pool->submit_func([&, group]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            run_group(group);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            // the pool is shut down or its queue is full, run the group in this thread instead
+            run_group(group);
+            latch.count_down();
+        }
+    }
+    run_group(0);
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
     return Status::OK();
 }
 
@@ -74,6 +74,9 @@ public:
     int64_t estimated_buffered_bytes() const;
 
 private:
+    // Run func on each of the columns, in parallel on the parquet encode thread pool if it's enabled.
+    Status _for_each_column(size_t num_columns, const std::function<Status(size_t)>& func);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
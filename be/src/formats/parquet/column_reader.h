@@ -77,6 +77,8 @@ struct ColumnReaderOptions {
     std::string timezone;
     bool case_sensitive = false;
     bool use_file_pagecache = false;
+    // cache of the parsed file metadata and page indexes, nullptr if disabled
+    StoragePageCache* meta_cache = nullptr;
     int chunk_size = 0;
     HdfsScanStats* stats = nullptr;
     RandomAccessFile* file = nullptr;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstring>
+#include <vector>
 
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -187,46 +188,37 @@ public:
                 "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size)); \
     }
 
-        if (filter) {
-            auto* binary_column = ColumnHelper::get_binary_column(dst);
-            while (num_decoded < count && _offset < _data.size) {
-                uint32_t length = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offset);
-                _offset += sizeof(int32_t);
-                if (filter[num_decoded]) {
-                    binary_column->append(Slice(_data.data + _offset, length));
-                } else {
-                    binary_column->append_default();
-                }
-                _offset += length;
-                num_decoded++;
-            }
-            CHECK_DECODING_BOUND
-        } else {
-            std::vector<Slice> slices;
-            slices.reserve(count);
-            size_t max_size = 0;
-            while (num_decoded < count && _offset < _data.size) {
-                uint32_t length = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offset);
-                _offset += sizeof(int32_t);
-                slices.emplace_back(_data.data + _offset, length);
-                _offset += length;
+        // The values filtered out are appended as empty strings pointing to their own positions in the page, so
+        // the selected and unselected rows are appended to the column in one batch.
+        _slices.resize(count);
+        size_t max_size = 0;
+        while (num_decoded < count && _offset < _data.size) {
+            uint32_t length = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offset);
+            _offset += sizeof(int32_t);
+            if (filter == nullptr || filter[num_decoded]) {
+                _slices[num_decoded] = Slice(_data.data + _offset, length);
                 max_size = max_size > length ? max_size : length;
-                num_decoded++;
-            }
-            CHECK_DECODING_BOUND
-            bool ret = false;
-            // when last slices offset + max_size > _data.size, there is overflow on reading
-            max_size = std::max(BitUtil::next_power_of_two(max_size), 8L);
-            if (slices[count - 1].data - _data.data + max_size <= _data.size) {
-                ret = ColumnHelper::get_binary_column(dst)->append_strings_overflow(slices.data(), num_decoded,
-                                                                                    max_size);
             } else {
-                ret = ColumnHelper::get_binary_column(dst)->append_strings(slices.data(), num_decoded);
+                _slices[num_decoded] = Slice(_data.data + _offset, 0);
             }
+            _offset += length;
+            num_decoded++;
+        }
+        CHECK_DECODING_BOUND
+        if (UNLIKELY(count == 0)) {
+            return Status::OK();
+        }
+        bool ret = false;
+        // when last slices offset + max_size > _data.size, there is overflow on reading
+        max_size = std::max(BitUtil::next_power_of_two(max_size), 8L);
+        if (_slices[count - 1].data - _data.data + max_size <= _data.size) {
+            ret = ColumnHelper::get_binary_column(dst)->append_strings_overflow(_slices.data(), num_decoded, max_size);
+        } else {
+            ret = ColumnHelper::get_binary_column(dst)->append_strings(_slices.data(), num_decoded);
+        }
 
-            if (UNLIKELY(!ret)) {
-                return Status::InternalError("PlainDecoder append strings to column failed");
-            }
+        if (UNLIKELY(!ret)) {
+            return Status::InternalError("PlainDecoder append strings to column failed");
         }
 
         return Status::OK();
@@ -270,6 +262,8 @@ public:
 private:
     Slice _data;
     size_t _offset = 0;
+    // reused across batches to avoid allocating a slice array per batch
+    std::vector<Slice> _slices;
 };
 
 // plain encoding for boolean type is stored as `Bit Packed`, `LSB` first format
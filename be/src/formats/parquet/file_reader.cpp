@@ -16,6 +16,7 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
 #include <unordered_set>
@@ -186,28 +187,46 @@ bool FileReader::_filter_group(const GroupReaderPtr& group_reader) {
     return filtered;
 }
 
-StatusOr<bool> FileReader::_update_rf_and_filter_group(const GroupReaderPtr& group_reader) {
-    bool filter = false;
-    if (_rf_scan_range_pruner != nullptr) {
-        RETURN_IF_ERROR(_rf_scan_range_pruner->update_range_if_arrived(
-                _scanner_ctx->global_dictmaps,
-                [this, &filter, &group_reader](auto cid, const PredicateList& predicates) {
-                    PredicateCompoundNode<CompoundNodeType::AND> pred_tree;
-                    for (const auto& pred : predicates) {
-                        pred_tree.add_child(PredicateColumnNode{pred});
+Status FileReader::_update_rf_and_filter_groups() {
+    if (_rf_scan_range_pruner == nullptr) {
+        return Status::OK();
+    }
+    return _rf_scan_range_pruner->update_range_if_arrived(
+            _scanner_ctx->global_dictmaps,
+            [this](auto cid, const PredicateList& predicates) {
+                PredicateCompoundNode<CompoundNodeType::AND> pred_tree;
+                for (const auto& pred : predicates) {
+                    pred_tree.add_child(PredicateColumnNode{pred});
+                }
+                auto real_tree = PredicateTree::create(std::move(pred_tree));
+                // a runtime filter is only reported once when it arrives, so all the unread row groups are
+                // checked against it here. the page index and bloom filter io of these row groups has been
+                // collected, and their data pages are not collected until they are prepared.
+                for (size_t i = _cur_row_group_idx; i < _row_group_size; i++) {
+                    auto& group_reader = _row_group_readers[i];
+                    if (group_reader == nullptr) {
+                        continue;
                     }
-                    auto real_tree = PredicateTree::create(std::move(pred_tree));
-                    auto visitor = PredicateFilterEvaluator{real_tree, group_reader.get(), false, false};
+                    auto visitor = PredicateFilterEvaluator{real_tree, group_reader.get(),
+                                                            _scanner_ctx->parquet_page_index_enable,
+                                                            _scanner_ctx->parquet_bloom_filter_enable};
                     auto res = real_tree.visit(visitor);
-                    if (res.ok() && res->has_value() && res->value().span_size() == 0) {
-                        filter = true;
+                    _group_reader_param.stats->_optimzation_counter += visitor.counter;
+                    if (!res.ok() || !res->has_value()) {
+                        continue;
                     }
-                    this->_group_reader_param.stats->_optimzation_counter += visitor.counter;
-                    return Status::OK();
-                },
-                true, 0));
-    }
-    return filter;
+                    if (res->value().span_size() == 0) {
+                        // row group is filtered by runtime filter
+                        group_reader = nullptr;
+                        _group_reader_param.stats->parquet_filtered_row_groups += 1;
+                    } else if (res->value().span_size() < group_reader->get_row_group_metadata()->num_rows) {
+                        // some pages have been filtered
+                        group_reader->get_range() &= res->value();
+                    }
+                }
+                return Status::OK();
+            },
+            true, 0);
 }
 
 void FileReader::_prepare_read_columns(std::unordered_set<std::string>& existed_column_names) {
@@ -245,6 +264,17 @@ Status FileReader::_collect_row_group_io(std::shared_ptr<GroupReader>& group_rea
     return Status::OK();
 }
 
+int64_t FileReader::_get_row_group_num_rows(size_t row_group_idx, int64_t row_group_first_row) const {
+    int64_t num_rows = _file_metadata->t_metadata().row_groups[row_group_idx].num_rows;
+    // for skip rows which already deleted
+    if (_skip_rows_ctx != nullptr && _skip_rows_ctx->has_skip_rows()) {
+        uint64_t deletion_rows = _skip_rows_ctx->deletion_bitmap->get_range_cardinality(row_group_first_row,
+                                                                                        row_group_first_row + num_rows);
+        num_rows -= deletion_rows;
+    }
+    return num_rows;
+}
+
 Status FileReader::_init_group_readers() {
     const HdfsScannerContext& fd_scanner_ctx = *_scanner_ctx;
 
@@ -258,6 +288,7 @@ Status FileReader::_init_group_readers() {
     _group_reader_param.file_metadata = _file_metadata.get();
     _group_reader_param.case_sensitive = fd_scanner_ctx.case_sensitive;
     _group_reader_param.use_file_pagecache = fd_scanner_ctx.use_file_pagecache;
+    _group_reader_param.meta_cache = _cache;
     _group_reader_param.lazy_column_coalesce_counter = fd_scanner_ctx.lazy_column_coalesce_counter;
     _group_reader_param.partition_columns = &fd_scanner_ctx.partition_columns;
     _group_reader_param.partition_values = &fd_scanner_ctx.partition_values;
@@ -281,6 +312,14 @@ Status FileReader::_init_group_readers() {
             continue;
         }
 
+        // no column is read and no predicate can filter the row group, so the rows are counted from the footer
+        // without creating the row group reader.
+        if (_no_materialized_column_scan && _scanner_ctx->predicate_tree.empty()) {
+            _group_reader_param.stats->parquet_total_row_groups += 1;
+            _total_row_count += _get_row_group_num_rows(i, row_group_first_row);
+            continue;
+        }
+
         auto row_group_reader =
                 std::make_shared<GroupReader>(_group_reader_param, i, _skip_rows_ctx, row_group_first_row);
         RETURN_IF_ERROR(row_group_reader->init());
@@ -296,14 +335,7 @@ Status FileReader::_init_group_readers() {
         }
 
         _row_group_readers.emplace_back(row_group_reader);
-        int64_t num_rows = _file_metadata->t_metadata().row_groups[i].num_rows;
-        // for skip rows which already deleted
-        if (_skip_rows_ctx != nullptr && _skip_rows_ctx->has_skip_rows()) {
-            uint64_t deletion_rows = _skip_rows_ctx->deletion_bitmap->get_range_cardinality(
-                    row_group_first_row, row_group_first_row + num_rows);
-            num_rows -= deletion_rows;
-        }
-        _total_row_count += num_rows;
+        _total_row_count += _get_row_group_num_rows(i, row_group_first_row);
     }
     _row_group_size = _row_group_readers.size();
 
@@ -346,21 +378,22 @@ Status FileReader::get_next(ChunkPtr* chunk) {
                     _row_group_readers[_cur_row_group_idx] = nullptr;
                     _cur_row_group_idx++;
                     if (_cur_row_group_idx < _row_group_size) {
-                        const auto& cur_row_group = _row_group_readers[_cur_row_group_idx];
-                        auto ret = _update_rf_and_filter_group(cur_row_group);
-                        if (ret.ok() && ret.value()) {
-                            // row group is filtered by runtime filter
-                            _group_reader_param.stats->parquet_filtered_row_groups += 1;
-                            continue;
-                        } else if (ret.status().is_end_of_file()) {
+                        auto st = _update_rf_and_filter_groups();
+                        if (st.is_end_of_file()) {
                             // If rf is always false, will return eof
                             _group_reader_param.stats->parquet_filtered_row_groups +=
-                                    (_row_group_size - _cur_row_group_idx);
+                                    std::count_if(_row_group_readers.begin() + _cur_row_group_idx,
+                                                  _row_group_readers.end(),
+                                                  [](const auto& reader) { return reader != nullptr; });
                             _row_group_readers.assign(_row_group_readers.size(), nullptr);
                             _cur_row_group_idx = _row_group_size;
                             break;
-                        } else {
-                            // do nothing, ignore the error code
+                        }
+                        // ignore the other error codes
+                        const auto& cur_row_group = _row_group_readers[_cur_row_group_idx];
+                        if (cur_row_group == nullptr) {
+                            // row group is filtered by runtime filter
+                            continue;
                         }
 
                         RETURN_IF_ERROR(cur_row_group->prepare());
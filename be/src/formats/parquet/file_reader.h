@@ -99,7 +99,7 @@ private:
 
     // filter row group by conjuncts
     bool _filter_group(const GroupReaderPtr& group_reader);
-    StatusOr<bool> _update_rf_and_filter_group(const GroupReaderPtr& group_reader);
+    Status _update_rf_and_filter_groups();
 
     // get row group to read
     // if scan range contain the first byte in the row group, will be read
@@ -108,6 +108,8 @@ private:
 
     // only scan partition column + not exist column
     Status _exec_no_materialized_column_scan(ChunkPtr* chunk);
+    // rows of the row group excluding the deleted ones.
+    int64_t _get_row_group_num_rows(size_t row_group_idx, int64_t row_group_first_row) const;
 
     Status _build_split_tasks();
 
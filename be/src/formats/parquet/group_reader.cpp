@@ -301,6 +301,7 @@ Status GroupReader::_create_column_readers() {
     opts.timezone = _param.timezone;
     opts.case_sensitive = _param.case_sensitive;
     opts.use_file_pagecache = _param.use_file_pagecache;
+    opts.meta_cache = _param.meta_cache;
     opts.chunk_size = _param.chunk_size;
     opts.stats = _param.stats;
     opts.file = _param.file;
@@ -90,6 +90,7 @@ struct GroupReaderParam {
     bool case_sensitive = false;
 
     bool use_file_pagecache = false;
+    StoragePageCache* meta_cache = nullptr;
     int64_t modification_time = 0;
     uint64_t file_size = 0;
     const DataCacheOptions* datacache_options;
@@ -14,6 +14,8 @@
 
 #include "formats/parquet/scalar_column_reader.h"
 
+#include "cache/object_cache/page_cache.h"
+#include "exec/hdfs_scanner.h"
 #include "formats/parquet/column_reader.h"
 #include "formats/parquet/parquet_block_split_bloom_filter.h"
 #include "formats/parquet/predicate_filter_evaluator.h"
@@ -274,13 +276,8 @@ StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<co
     int64_t column_index_offset = chunk_meta->column_index_offset;
     uint32_t column_index_length = chunk_meta->column_index_length;
 
-    std::vector<uint8_t> page_index_data;
-    page_index_data.reserve(column_index_length);
-    RETURN_IF_ERROR(_opts.file->read_at_fully(column_index_offset, page_index_data.data(), column_index_length));
-
     tparquet::ColumnIndex column_index;
-    RETURN_IF_ERROR(deserialize_thrift_msg(page_index_data.data(), &column_index_length, TProtocolType::COMPACT,
-                                           &column_index));
+    RETURN_IF_ERROR(_read_page_index(column_index_offset, column_index_length, &column_index));
 
     ASSIGN_OR_RETURN(const tparquet::OffsetIndex* offset_index, get_offset_index(rg_first_row));
 
@@ -347,6 +344,54 @@ StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<co
     return true;
 }
 
+StatusOr<tparquet::OffsetIndex*> RawColumnReader::get_offset_index(const uint64_t rg_first_row) {
+    if (_offset_index_ctx == nullptr) {
+        _offset_index_ctx = std::make_unique<ColumnOffsetIndexCtx>();
+        _offset_index_ctx->rg_first_row = rg_first_row;
+        int64_t offset_index_offset = get_chunk_metadata()->offset_index_offset;
+        uint32_t offset_index_length = get_chunk_metadata()->offset_index_length;
+        RETURN_IF_ERROR(_read_page_index(offset_index_offset, offset_index_length, &_offset_index_ctx->offset_index));
+    }
+    return &_offset_index_ctx->offset_index;
+}
+
+template <typename T>
+Status RawColumnReader::_read_page_index(int64_t offset, uint32_t length, T* index) const {
+    StoragePageCache* cache = _opts.meta_cache;
+    std::string cache_key;
+    PageCacheHandle cache_handle;
+    if (cache != nullptr) {
+        // the indexes of different column chunks are told apart by their offsets in the file
+        cache_key = ParquetUtils::get_file_cache_key(CacheType::PAGE_INDEX, _opts.file->filename(),
+                                                     _opts.modification_time, _opts.file_size);
+        cache_key.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        if (cache->lookup(cache_key, &cache_handle)) {
+            _opts.stats->page_index_cache_read_count += 1;
+            *index = *reinterpret_cast<const T*>(cache_handle.data());
+            return Status::OK();
+        }
+    }
+
+    std::vector<uint8_t> page_index_data(length);
+    RETURN_IF_ERROR(_opts.file->read_at_fully(offset, page_index_data.data(), length));
+    RETURN_IF_ERROR(deserialize_thrift_msg(page_index_data.data(), &length, TProtocolType::COMPACT, index));
+
+    if (cache != nullptr) {
+        auto deleter = [](const starrocks::CacheKey& key, void* value) { delete (T*)value; };
+        ObjectCacheWriteOptions options;
+        options.evict_probability = _opts.datacache_options->datacache_evict_probability;
+        auto capture = std::make_unique<T>(*index);
+        // the serialized length is used as the charge, the same as the footer cache
+        Status st = cache->insert(cache_key, (void*)(capture.get()), page_index_data.size(), deleter, options,
+                                  &cache_handle);
+        if (st.ok()) {
+            _opts.stats->page_index_cache_write_count += 1;
+            capture.release();
+        }
+    }
+    return Status::OK();
+}
+
 Status RawColumnReader::_init_column_bloom_filter(int offset, int length, BloomFilter& bloom_filter) const {
     std::vector<char> bloom_filter_data;
     tparquet::BloomFilterHeader header;
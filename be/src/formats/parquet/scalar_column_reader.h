@@ -89,22 +89,7 @@ public:
 
     const tparquet::ColumnChunk* get_chunk_metadata() const override { return _chunk_metadata; }
 
-    StatusOr<tparquet::OffsetIndex*> get_offset_index(const uint64_t rg_first_row) override {
-        if (_offset_index_ctx == nullptr) {
-            _offset_index_ctx = std::make_unique<ColumnOffsetIndexCtx>();
-            _offset_index_ctx->rg_first_row = rg_first_row;
-            int64_t offset_index_offset = get_chunk_metadata()->offset_index_offset;
-            uint32_t offset_index_length = get_chunk_metadata()->offset_index_length;
-            std::vector<uint8_t> offset_index_data;
-            offset_index_data.reserve(offset_index_length);
-            RETURN_IF_ERROR(
-                    _opts.file->read_at_fully(offset_index_offset, offset_index_data.data(), offset_index_length));
-
-            RETURN_IF_ERROR(deserialize_thrift_msg(offset_index_data.data(), &offset_index_length,
-                                                   TProtocolType::COMPACT, &_offset_index_ctx->offset_index));
-        }
-        return &_offset_index_ctx->offset_index;
-    }
+    StatusOr<tparquet::OffsetIndex*> get_offset_index(const uint64_t rg_first_row) override;
 
     void select_offset_index(const SparseRange<uint64_t>& range, const uint64_t rg_first_row) override;
 
@@ -114,6 +99,11 @@ public:
 private:
     Status _init_column_bloom_filter(int32_t offset, int32_t length, BloomFilter& bloom_filter) const;
 
+    // Read and deserialize the ColumnIndex/OffsetIndex at [offset, offset + length), the parsed index is shared
+    // across queries through the meta cache if it is enabled.
+    template <typename T>
+    Status _read_page_index(int64_t offset, uint32_t length, T* index) const;
+
 protected:
     StatusOr<bool> _row_group_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                               CompoundNodeType pred_relation, const TypeDescriptor& col_type,
@@ -86,11 +86,17 @@ private:
     bool _cur_page_selected(size_t row_readed, const Filter* filter, size_t to_read) override;
 
     const FilterData* _convert_filter_row_to_value(const Filter* filter, size_t row_readed) override {
-        // if we need it, remember considering null value in ancestor
-        // and the cost convert filter of row to value for repeated column
+        // the levels of the rows are not decoded yet, the row filter is converted to the value filter
+        // in _read_values_on_levels.
+        _row_filter = filter;
+        _row_filter_start = row_readed;
         return nullptr;
     }
 
+    // Build the filter of the values on the last `num_levels` levels from the row filter, the values of the removed
+    // rows will be skipped by the decoder.
+    const FilterData* _build_value_filter(size_t num_levels, size_t num_values);
+
 private:
     const ParquetField* _field = nullptr;
 
@@ -100,6 +106,10 @@ private:
 
     NullInfos _null_infos;
 
+    const Filter* _row_filter = nullptr;
+    size_t _row_filter_start = 0;
+    Filter _value_filter;
+
     // default is false, but if there is page index, it's true.
     // so that we don't need check next page to know the last record in current page is finished.
     bool _page_change_on_record_boundry = false;
@@ -510,12 +520,37 @@ Status RepeatedStoredColumnReader::_read_values_on_levels(size_t num_values,
         dst->append_default(null_pos);
         return Status::OK();
     } else if (null_pos != 0) {
+        if (_row_filter != nullptr) {
+            filter = _build_value_filter(num_values, null_pos);
+        }
         return _reader->decode_values(null_pos, _null_infos, content_type, dst, filter);
     } else {
+        _row_filter = nullptr;
         return Status::OK();
     }
 }
 
+const FilterData* RepeatedStoredColumnReader::_build_value_filter(size_t num_levels, size_t num_values) {
+    const Filter& row_filter = *_row_filter;
+    _row_filter = nullptr;
+    const level_t* def_levels = _reader->def_level_decoder().get_forward_levels(num_levels);
+    const level_t* rep_levels = _reader->rep_level_decoder().get_forward_levels(num_levels);
+    const level_t ancestor_def_level = _field->level_info.immediate_repeated_ancestor_def_level;
+    _value_filter.resize(num_values);
+    // The first level is either the beginning of the row or the rest of the row started in the previous page,
+    // both belong to the row at `_row_filter_start`. The trailing incomplete row may be out of the filter, keep it.
+    size_t row = _row_filter_start;
+    size_t value_pos = 0;
+    for (size_t i = 0; i < num_levels; ++i) {
+        row += (i > 0) & (rep_levels[i] == 0);
+        if (def_levels[i] >= ancestor_def_level) {
+            _value_filter[value_pos++] = row < row_filter.size() ? row_filter[row] : 1;
+        }
+    }
+    DCHECK_EQ(num_values, value_pos);
+    return _value_filter.data();
+}
+
 void RepeatedStoredColumnReader::_collect_not_null_values(size_t num_levels, bool lazy_flag) {
     if (lazy_flag) {
         _not_null_to_skip += count_not_null(_reader->def_level_decoder().get_forward_levels(num_levels), num_levels,
@@ -23,7 +23,7 @@ namespace starrocks::parquet {
 enum ColumnContentType { VALUE, DICT_CODE };
 
 enum ColumnIOType { INVALID = 0, PAGE_INDEX = 1, PAGES = 2, BLOOM_FILTER = 4 };
-enum CacheType { META, PAGE };
+enum CacheType { META, PAGE, PAGE_INDEX };
 
 using ColumnIOTypeFlags = int32_t;
 
@@ -43,7 +43,7 @@ public:
                                           uint64_t file_size);
 
 private:
-    inline static const std::vector<std::string> cache_key_prefix{"ft", "pg"};
+    inline static const std::vector<std::string> cache_key_prefix{"ft", "pg", "pi"};
 };
 
 struct NullInfos {
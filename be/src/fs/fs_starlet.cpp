@@ -34,6 +34,8 @@
 #include "io/input_stream.h"
 #include "io/io_profiler.h"
 #include "io/output_stream.h"
+#include "io/scheduled_output_stream.h"
+#include "io/scheduled_seekable_input_stream.h"
 #include "io/seekable_input_stream.h"
 #include "io/throttled_output_stream.h"
 #include "io/throttled_seekable_input_stream.h"
@@ -320,6 +322,9 @@ public:
             istream = std::make_unique<io::ThrottledSeekableInputStream>(std::move(istream),
                                                                          config::experimental_lake_wait_per_get_ms);
         }
+        if (!is_cache_hit && config::io_scheduler_max_concurrency > 0) {
+            istream = std::make_unique<io::ScheduledSeekableInputStream>(std::move(istream));
+        }
         return RandomAccessFile::from(std::move(istream), info.path, is_cache_hit, opts.encryption_info);
     }
 
@@ -366,6 +371,9 @@ public:
         if (config::experimental_lake_wait_per_put_ms > 0) {
             os = std::make_unique<io::ThrottledOutputStream>(std::move(os), config::experimental_lake_wait_per_put_ms);
         }
+        if (config::io_scheduler_max_concurrency > 0) {
+            os = std::make_unique<io::ScheduledOutputStream>(std::move(os));
+        }
         return wrap_encrypted(std::make_unique<starrocks::OutputStreamAdapter>(std::move(os), path),
                               opts.encryption_info);
     }
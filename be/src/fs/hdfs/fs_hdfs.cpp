@@ -55,6 +55,10 @@ public:
             auto st = getOrCreateFS();
             SCOPED_RAW_TIMER(&_total_open_file_time_ns);
             if (!st.ok()) return st.status();
+            _file = HdfsFileHandleCache::instance()->take(_hdfs_client, _path, _buffer_size);
+            if (_file != nullptr) {
+                return _file;
+            }
             _file = hdfsOpenFile(st.value(), _path.c_str(), O_RDONLY, _buffer_size, 0, 0);
             if (_file == nullptr) {
                 if (errno == ENOENT) {
@@ -92,11 +96,16 @@ public:
         return Status::OK();
     }
 
-    int close() {
+    // |reuse| indicates the file is still good to read and can be cached for the following readers.
+    int close(bool reuse = false) {
         int r = 0;
         if (_file != nullptr) {
-            hdfsFS fs = getFS();
-            r = hdfsCloseFile(fs, _file);
+            if (reuse) {
+                HdfsFileHandleCache::instance()->put(_hdfs_client, _path, _buffer_size, _file);
+            } else {
+                hdfsFS fs = getFS();
+                r = hdfsCloseFile(fs, _file);
+            }
             _file = nullptr;
         }
         return r;
@@ -195,7 +204,7 @@ private:
 
 HdfsInputStream::~HdfsInputStream() {
     auto ret = call_hdfs_scan_function_in_pthread([this]() {
-        int r = _handle->close();
+        int r = _handle->close(/*reuse=*/true);
         if (r == -1) {
             auto error_msg = fmt::format("Fail to close file {}: {}", _handle->getPath(), get_hdfs_err_msg());
             LOG(WARNING) << error_msg;
@@ -584,6 +593,8 @@ StatusOr<std::unique_ptr<WritableFile>> HdfsFileSystem::new_writable_file(const
         auto msg = strings::Substitute("Unsupported open mode $0", opts.mode);
         return Status::NotSupported(msg);
     }
+    // a file being rewritten must not be read through the stale cached handles
+    HdfsFileHandleCache::instance()->invalidate(path);
 
     // `io.file.buffer.size` of https://apache.github.io/hadoop/hadoop-project-dist/hadoop-common/core-default.xml
     int hdfs_write_buffer_size = 0;
@@ -646,6 +657,8 @@ Status HdfsFileSystem::rename_file(const std::string& src, const std::string& ta
     RETURN_IF_ERROR(get_namenode_from_path(src, &namenode));
     std::shared_ptr<HdfsFsClient> hdfs_client;
     RETURN_IF_ERROR(HdfsFsCache::instance()->get_connection(namenode, hdfs_client, _options));
+    HdfsFileHandleCache::instance()->invalidate(src);
+    HdfsFileHandleCache::instance()->invalidate(target);
     int ret = hdfsRename(hdfs_client->hdfs_fs, src.data(), target.data());
     if (ret != 0) {
         return Status::InvalidArgument(fmt::format("rename file from {} to {} error", src, target));
@@ -14,12 +14,15 @@
 
 #include "fs/hdfs/hdfs_fs_cache.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 #include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "udf/java/java_udf.h"
 #include "util/hdfs_util.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -123,4 +126,95 @@ Status HdfsFsCache::get_connection(const std::string& namenode, std::shared_ptr<
     return Status::OK();
 }
 
+void HdfsFileHandleCache::close_entries(std::vector<Entry>* entries) {
+    for (auto& entry : *entries) {
+        if (hdfsCloseFile(entry.client->hdfs_fs, entry.file) == -1) {
+            LOG(WARNING) << "Fail to close cached hdfs file " << entry.path << ": " << get_hdfs_err_msg();
+        }
+    }
+    entries->clear();
+}
+
+void HdfsFileHandleCache::_erase(EntryIter entry_it, std::vector<Entry>* erased) {
+    auto range = _index.equal_range(entry_it->path);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entry_it) {
+            _index.erase(it);
+            break;
+        }
+    }
+    if (erased != nullptr) {
+        erased->emplace_back(std::move(*entry_it));
+    }
+    _lru.erase(entry_it);
+}
+
+hdfsFile HdfsFileHandleCache::take(const std::shared_ptr<HdfsFsClient>& client, const std::string& path,
+                                   int buffer_size) {
+    if (config::hdfs_client_file_handle_cache_ttl_sec <= 0) {
+        return nullptr;
+    }
+    const int64_t expire_ms = MonotonicMillis() - config::hdfs_client_file_handle_cache_ttl_sec * 1000L;
+    hdfsFile file = nullptr;
+    std::vector<Entry> expired;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        std::vector<EntryIter> candidates;
+        auto range = _index.equal_range(path);
+        for (auto it = range.first; it != range.second; ++it) {
+            candidates.push_back(it->second);
+        }
+        for (auto entry_it : candidates) {
+            if (entry_it->idle_since_ms < expire_ms) {
+                _erase(entry_it, &expired);
+            } else if (file == nullptr && entry_it->client == client && entry_it->buffer_size == buffer_size) {
+                file = entry_it->file;
+                _erase(entry_it, nullptr);
+            }
+        }
+    }
+    close_entries(&expired);
+    return file;
+}
+
+void HdfsFileHandleCache::put(const std::shared_ptr<HdfsFsClient>& client, const std::string& path, int buffer_size,
+                              hdfsFile file) {
+    std::vector<Entry> evicted;
+    if (config::hdfs_client_file_handle_cache_ttl_sec <= 0) {
+        evicted.emplace_back(Entry{client, path, buffer_size, file, 0});
+        close_entries(&evicted);
+        return;
+    }
+    hdfsFileClearReadStatistics(file);
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _lru.push_front(Entry{client, path, buffer_size, file, MonotonicMillis()});
+        _index.emplace(path, _lru.begin());
+        const size_t max_size = std::max(0, config::hdfs_client_max_cached_file_handles);
+        while (_lru.size() > max_size) {
+            _erase(std::prev(_lru.end()), &evicted);
+        }
+    }
+    close_entries(&evicted);
+}
+
+void HdfsFileHandleCache::invalidate(const std::string& path) {
+    std::vector<Entry> erased;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        auto range = _index.equal_range(path);
+        for (auto it = range.first; it != range.second; ++it) {
+            erased.emplace_back(std::move(*it->second));
+            _lru.erase(it->second);
+        }
+        _index.erase(range.first, range.second);
+    }
+    close_entries(&erased);
+}
+
+size_t HdfsFileHandleCache::size() {
+    std::lock_guard<std::mutex> l(_lock);
+    return _lru.size();
+}
+
 } // namespace starrocks
@@ -17,6 +17,7 @@
 #include <hdfs/hdfs.h>
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -65,4 +66,50 @@ private:
     const HdfsFsCache& operator=(const HdfsFsCache&) = delete;
 };
 
+// Cache for the idle HDFS read-only files. A file closed by a reader is kept open here for at most
+// `hdfs_client_file_handle_cache_ttl_sec`, and the next reader of the same path takes it instead of opening the file
+// from the NameNode again. Only the positional reads are issued on the cached files, so a file has no state to reset.
+class HdfsFileHandleCache {
+public:
+    ~HdfsFileHandleCache() = default;
+    static HdfsFileHandleCache* instance() {
+        static HdfsFileHandleCache s_instance;
+        return &s_instance;
+    }
+
+    // Returns nullptr if there is no idle file of |path| opened through |client| with |buffer_size|.
+    hdfsFile take(const std::shared_ptr<HdfsFsClient>& client, const std::string& path, int buffer_size);
+
+    // Takes the ownership of |file|, which is closed if the cache is disabled or full.
+    void put(const std::shared_ptr<HdfsFsClient>& client, const std::string& path, int buffer_size, hdfsFile file);
+
+    // Closes the idle files of |path|, called when |path| is rewritten or deleted.
+    void invalidate(const std::string& path);
+
+    size_t size();
+
+private:
+    struct Entry {
+        std::shared_ptr<HdfsFsClient> client;
+        std::string path;
+        int buffer_size;
+        hdfsFile file;
+        int64_t idle_since_ms;
+    };
+    using EntryIter = std::list<Entry>::iterator;
+
+    static void close_entries(std::vector<Entry>* entries);
+    // Requires |_lock| held.
+    void _erase(EntryIter entry_it, std::vector<Entry>* erased);
+
+    std::mutex _lock;
+    // the most recently put entry is at the front
+    std::list<Entry> _lru;
+    std::unordered_multimap<std::string, EntryIter> _index;
+
+    HdfsFileHandleCache() = default;
+    HdfsFileHandleCache(const HdfsFileHandleCache&) = delete;
+    const HdfsFileHandleCache& operator=(const HdfsFileHandleCache&) = delete;
+};
+
 } // namespace starrocks
@@ -50,6 +50,7 @@
 #include "http/http_request.h"
 #include "io/io_profiler.h"
 #include "util/bfd_parser.h"
+#include "util/debug/query_cpu_profiler.h"
 
 namespace starrocks {
 
@@ -153,6 +154,35 @@ void IOProfileAction::handle(HttpRequest* req) {
     HttpChannel::send_reply(req, ret);
 }
 
+void QueryCpuProfileAction::handle(HttpRequest* req) {
+    auto* profiler = QueryCpuProfiler::instance();
+    if (!profiler->started()) {
+        HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE,
+                                "query cpu profiler is not running, set enable_query_cpu_profiler to enable it");
+        return;
+    }
+
+    QueryCpuProfiler::Filter filter;
+    const std::string& hours_str = req->param("hours");
+    if (!hours_str.empty()) {
+        filter.hours = std::atoi(hours_str.c_str());
+    }
+    filter.query_id = req->param("query_id");
+    const std::string& workgroup_id_str = req->param("workgroup_id");
+    if (!workgroup_id_str.empty()) {
+        filter.workgroup_id = std::atoll(workgroup_id_str.c_str());
+    }
+
+    const std::string& format = req->param("format");
+    if (format.empty() || format == "folded") {
+        HttpChannel::send_reply(req, profiler->dump_folded(filter));
+    } else if (format == "pprof") {
+        HttpChannel::send_reply(req, profiler->dump_pprof(filter));
+    } else {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "unknown format: " + format);
+    }
+}
+
 void CmdlineAction::handle(HttpRequest* req) {
     FILE* fp = fopen("/proc/self/cmdline", "r");
     if (fp == nullptr) {
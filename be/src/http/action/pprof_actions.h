@@ -87,6 +87,19 @@ public:
     void handle(HttpRequest* req) override {}
 };
 
+// Export the samples of the always-on QueryCpuProfiler.
+//   hours: the last N hours, 1 by default
+//   query_id: only the samples of this query
+//   workgroup_id: only the samples of this workgroup
+//   format: `folded` (default) for flamegraph.pl, or `pprof`
+class QueryCpuProfileAction : public HttpHandler {
+public:
+    QueryCpuProfileAction() = default;
+    ~QueryCpuProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
 class CmdlineAction : public HttpHandler {
 public:
     CmdlineAction() = default;
@@ -207,6 +207,20 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
             }
             return Status::OK();
         });
+        _config_callback.emplace("segment_encode_thread_pool_num_max", [&]() -> Status {
+            if (_exec_env->segment_encode_thread_pool() != nullptr) {
+                return _exec_env->segment_encode_thread_pool()->update_max_threads(
+                        std::max(1, config::segment_encode_thread_pool_num_max));
+            }
+            return Status::OK();
+        });
+        _config_callback.emplace("parquet_writer_encode_thread_pool_num_max", [&]() -> Status {
+            if (_exec_env->parquet_encode_thread_pool() != nullptr) {
+                return _exec_env->parquet_encode_thread_pool()->update_max_threads(
+                        std::max(1, config::parquet_writer_encode_thread_pool_num_max));
+            }
+            return Status::OK();
+        });
         _config_callback.emplace("transaction_publish_version_worker_count", [&]() -> Status {
             Status st1 = ExecEnv::GetInstance()
                                  ->agent_server()
@@ -67,7 +67,8 @@ CacheInputStream::CacheInputStream(const std::shared_ptr<SharedBufferedInputStre
 
 CacheInputStream::~CacheInputStream() = default;
 
-Status CacheInputStream::_read_block_from_local(const int64_t offset, const int64_t size, char* out) {
+Status CacheInputStream::_read_block_from_local(const int64_t offset, const int64_t size, char* out,
+                                               bool try_peer_cache) {
     if (UNLIKELY(size == 0)) {
         return Status::OK();
     }
@@ -105,7 +106,7 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         }
     }
 
-    Status res = _read_from_cache(offset, size, block_offset, load_size, out);
+    Status res = _read_from_cache(offset, size, block_offset, load_size, out, try_peer_cache);
     if (res.ok() && sb) {
         // Duplicate the block ranges to avoid saving the same data both in cache and shared buffer.
         _deduplicate_shared_buffer(sb);
@@ -115,7 +116,7 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
 }
 
 Status CacheInputStream::_read_from_cache(const int64_t offset, const int64_t size, const int64_t block_offset,
-                                          const int64_t block_size, char* out) {
+                                          const int64_t block_size, char* out, bool try_peer_cache) {
     DCHECK(block_offset % _block_size == 0);
     DCHECK(block_size <= _block_size);
 
@@ -140,15 +141,15 @@ Status CacheInputStream::_read_from_cache(const int64_t offset, const int64_t si
         }
     }
 
-    bool try_peer_cache = false;
+    bool read_peer_cache = false;
     int64_t read_peer_cache_ns = 0;
     if (res.ok() || res.is_resource_busy()) {
         _already_populated_blocks.emplace(block_id);
-    } else if (res.is_not_found() && _can_try_peer_cache()) {
+    } else if (res.is_not_found() && try_peer_cache && _can_try_peer_cache()) {
         {
             SCOPED_RAW_TIMER(&read_peer_cache_ns);
             res = _read_peer_cache(block_offset, block_size, &block.buffer, &options);
-            try_peer_cache = true;
+            read_peer_cache = true;
         }
         read_size = block_size;
 
@@ -170,7 +171,7 @@ Status CacheInputStream::_read_from_cache(const int64_t offset, const int64_t si
             block.offset = block_offset;
             _block_map[block_id] = block;
         }
-        if (try_peer_cache) {
+        if (read_peer_cache) {
             _stats.read_peer_cache_bytes += read_size;
             _stats.read_peer_cache_count += 1;
             _stats.read_peer_cache_ns += read_peer_cache_ns;
@@ -188,7 +189,7 @@ Status CacheInputStream::_read_from_cache(const int64_t offset, const int64_t si
             }
         }
     } else if (res.is_resource_busy()) {
-        if (try_peer_cache) {
+        if (read_peer_cache) {
             _stats.skip_read_peer_cache_count += 1;
             _stats.skip_read_peer_cache_bytes += read_size;
         } else {
@@ -209,6 +210,55 @@ Status CacheInputStream::_read_peer_cache(off_t offset, size_t size, IOBuffer* i
     return _cache->read_buffer_from_remote_cache(_cache_key, offset, size, iobuf, options);
 }
 
+Status CacheInputStream::_read_blocks_from_peer(const int64_t offset, const int64_t size, char* out) {
+    const int64_t block_start_offset = offset / _block_size * _block_size;
+    const int64_t block_end_offset = std::min((offset + size - 1) / _block_size * _block_size + _block_size, _size);
+    const int64_t read_size = block_end_offset - block_start_offset;
+
+    IOBuffer buffer;
+    ReadCacheOptions options;
+    options.use_adaptor = _enable_cache_io_adaptor;
+    int64_t read_peer_cache_ns = 0;
+    Status res;
+    {
+        SCOPED_RAW_TIMER(&read_peer_cache_ns);
+        res = _read_peer_cache(block_start_offset, read_size, &buffer, &options);
+    }
+    if (res.ok() && buffer.size() != read_size) {
+        // The peer node may miss some of the blocks or not support reading multiple blocks in one request.
+        res = Status::NotFound("incomplete blocks from peer cache");
+    }
+    if (res.is_resource_busy()) {
+        _stats.skip_read_peer_cache_count += 1;
+        _stats.skip_read_peer_cache_bytes += read_size;
+    }
+    RETURN_IF_ERROR(res);
+
+    buffer.copy_to(out, size, offset - block_start_offset);
+    _stats.read_peer_cache_bytes += read_size;
+    _stats.read_peer_cache_count += 1;
+    _stats.read_peer_cache_ns += read_peer_cache_ns;
+    if (_enable_cache_io_adaptor) {
+        _cache->record_read_remote_cache(read_size, read_peer_cache_ns / 1000);
+    }
+
+    if (_enable_populate_cache) {
+        WriteCacheOptions write_options;
+        write_options.async = _enable_async_populate_mode;
+        write_options.evict_probability = _datacache_evict_probability;
+        write_options.priority = _priority;
+        write_options.ttl_seconds = _ttl_seconds;
+        write_options.frequency = _frequency;
+        write_options.allow_zero_copy = true;
+        for (int64_t block_offset = block_start_offset; block_offset < block_end_offset; block_offset += _block_size) {
+            IOBuffer block;
+            buffer.raw_buf().cutn(&block.raw_buf(), std::min(_block_size, block_end_offset - block_offset));
+            _write_cache(block_offset, block, &write_options);
+        }
+    }
+    return Status::OK();
+}
+
 Status CacheInputStream::_read_blocks_from_remote(const int64_t offset, const int64_t size, char* out) {
     const int64_t start_block_id = offset / _block_size;
     const int64_t end_block_id = (offset + size - 1) / _block_size;
@@ -216,15 +266,18 @@ Status CacheInputStream::_read_blocks_from_remote(const int64_t offset, const in
     // We will load range=[read_start_offset, read_end_offset) from remote
     const int64_t block_start_offset = start_block_id * _block_size;
     const int64_t block_end_offset = std::min(end_block_id * _block_size + _block_size, _size);
+    // The blocks read ahead are only populated to the cache, they are not copied to `out`.
+    const int64_t read_end_offset =
+            _enable_populate_cache ? _read_ahead_end_offset(block_start_offset, block_end_offset) : block_end_offset;
 
     // cursors for `out`
     int64_t out_offset_cursor = offset;
     int64_t out_remain_size = size;
     char* out_pointer_cursor = out;
 
-    for (int64_t read_offset_cursor = block_start_offset; read_offset_cursor < block_end_offset;) {
+    for (int64_t read_offset_cursor = block_start_offset; read_offset_cursor < read_end_offset;) {
         // Everytime read at most one buffer size
-        const int64_t read_size = std::min(_buffer_size, block_end_offset - read_offset_cursor);
+        const int64_t read_size = std::min(_buffer_size, read_end_offset - read_offset_cursor);
         char* src = nullptr;
 
         // check [read_offset_cursor, read_size) is already in SharedBuffer
@@ -342,12 +395,15 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
     const int64_t end_block_id = (end_offset - 1) / _block_size;
 
     std::vector<ReadFromRemoteIORange> need_read_from_remote{};
+    // The missing blocks of a multi-block read are fetched from the peer cache in batches after the merge, rather
+    // than one request per block.
+    const bool batch_read_peer_cache = end_block_id > start_block_id && _can_try_peer_cache();
 
     for (int64_t i = start_block_id; i <= end_block_id; i++) {
         size_t off = std::max(offset, i * _block_size);
         size_t end = std::min((i + 1) * _block_size, end_offset);
         size_t size = end - off;
-        Status st = _read_block_from_local(off, size, p);
+        Status st = _read_block_from_local(off, size, p, !batch_read_peer_cache);
         if (st.is_not_found() || st.is_resource_busy()) {
             // Not found block from local or disk is busy, we need to load it from remote
             need_read_from_remote.emplace_back(off, p, size);
@@ -396,6 +452,10 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
     for (const auto& io_range : merged_need_read_from_remote) {
         DCHECK(io_range.offset >= origin_offset);
         DCHECK(io_range.offset + io_range.size <= origin_offset + count);
+        if (batch_read_peer_cache &&
+            _read_blocks_from_peer(io_range.offset, io_range.size, io_range.write_pointer).ok()) {
+            continue;
+        }
         RETURN_IF_ERROR(_read_blocks_from_remote(io_range.offset, io_range.size, io_range.write_pointer));
     }
 
@@ -510,6 +570,28 @@ bool CacheInputStream::_can_ignore_populate_error(const Status& status) const {
     return false;
 }
 
+int64_t CacheInputStream::_read_ahead_end_offset(int64_t start_offset, int64_t end_offset) {
+    const int64_t max_blocks = config::datacache_read_ahead_max_blocks;
+    if (max_blocks <= 0) {
+        return end_offset;
+    }
+    // Double the read ahead blocks for every sequential miss, and reset it for a random one.
+    if (start_offset == _last_remote_end_offset) {
+        _read_ahead_blocks = std::min(std::max<int64_t>(1, _read_ahead_blocks * 2), max_blocks);
+    } else {
+        _read_ahead_blocks = 0;
+    }
+    int64_t read_end_offset = end_offset;
+    for (int64_t i = 0; i < _read_ahead_blocks && read_end_offset < _size; i++) {
+        if (_already_populated_blocks.contains(read_end_offset / _block_size)) {
+            break;
+        }
+        read_end_offset = std::min(read_end_offset + _block_size, _size);
+    }
+    _last_remote_end_offset = read_end_offset;
+    return read_end_offset;
+}
+
 int64_t CacheInputStream::_calculate_remote_latency_per_block(int64_t io_bytes, int64_t read_time_ns) {
     int64_t latency_us_per_block = read_time_ns / 1000;
     // We try to estimate the average latency for accessing one block.
@@ -103,11 +103,15 @@ protected:
     using SharedBufferPtr = SharedBufferedInputStream::SharedBufferPtr;
 
     // Read block from local, if not found, will return Status::NotFound();
-    virtual Status _read_block_from_local(const int64_t offset, const int64_t size, char* out);
+    // If `try_peer_cache` is false, the peer cache is not tried for the missing block.
+    virtual Status _read_block_from_local(const int64_t offset, const int64_t size, char* out,
+                                          bool try_peer_cache = true);
     // Read multiple blocks from remote
     virtual Status _read_blocks_from_remote(const int64_t offset, const int64_t size, char* out);
+    // Read multiple blocks from the peer cache in one request, and populate them to the local cache.
+    Status _read_blocks_from_peer(const int64_t offset, const int64_t size, char* out);
     Status _read_from_cache(const int64_t offset, const int64_t size, const int64_t block_offset,
-                            const int64_t block_size, char* out);
+                            const int64_t block_size, char* out, bool try_peer_cache);
     Status _read_peer_cache(off_t offset, size_t size, IOBuffer* iobuf, ReadCacheOptions* options);
     void _populate_to_cache(const char* src, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _write_cache(int64_t offset, const IOBuffer& iobuf, WriteCacheOptions* options);
@@ -142,6 +146,11 @@ protected:
 
 private:
     inline int64_t _calculate_remote_latency_per_block(int64_t io_bytes, int64_t read_time_ns);
+    // Extend the remote read of [start_offset, end_offset) with the following blocks if the misses are sequential.
+    int64_t _read_ahead_end_offset(int64_t start_offset, int64_t end_offset);
+
+    int64_t _last_remote_end_offset = -1;
+    int64_t _read_ahead_blocks = 0;
     // Record already populated blocks, avoid duplicate populate
     std::unordered_set<int64_t> _already_populated_blocks{};
 };
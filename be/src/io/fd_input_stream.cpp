@@ -14,6 +14,7 @@
 
 #include "io/fd_input_stream.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -106,5 +107,13 @@ Status FdInputStream::seek(int64_t offset) {
     return Status::OK();
 }
 
+void FdInputStream::prefetch(int64_t offset, size_t length) {
+    if (_is_closed || offset < 0 || length == 0) {
+        return;
+    }
+    // Only a hint, the failure is ignored.
+    (void)::posix_fadvise(_fd, offset, length, POSIX_FADV_WILLNEED);
+}
+
 #undef CHECK_IS_CLOSED
 } // namespace starrocks::io
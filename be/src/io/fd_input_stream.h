@@ -38,6 +38,9 @@ public:
 
     Status seek(int64_t offset) override;
 
+    // Issues a POSIX_FADV_WILLNEED advice, the kernel reads the range into the OS page cache asynchronously.
+    void prefetch(int64_t offset, size_t length) override;
+
     // closes the underlying file.
     //
     // Returns error if an error occurs during the process;
@@ -50,6 +50,11 @@ public:
     // If the InputStream implementation doesn't support statistics, a null pointer or
     // an empty statistics is returned.
     virtual StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() { return nullptr; }
+
+    // Hint that [offset, offset+length] of the underlying file will be read soon, so that the implementation
+    // may start to load it asynchronously. It must not block on the I/O.
+    // stream offset will not change
+    virtual void prefetch(int64_t offset, size_t length) {}
 };
 
 class InputStreamWrapper : public InputStream {
@@ -81,6 +86,8 @@ public:
         return _impl->get_numeric_statistics();
     }
 
+    void prefetch(int64_t offset, size_t length) override { _impl->prefetch(offset, length); }
+
 private:
     InputStream* _impl;
     Ownership _ownership;
@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_heatmap.h"
+
+#include <sched.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+IOHeatmap* IOHeatmap::instance() {
+    static IOHeatmap heatmap;
+    return &heatmap;
+}
+
+IOHeatmap::IOHeatmap() : _shards(std::make_unique<Shard[]>(kNumShards)) {}
+
+size_t IOHeatmap::KeyHash::operator()(const Key& key) const {
+    size_t hash = key.query_hi * 31 + key.query_lo;
+    hash = hash * 31 + key.tablet_id;
+    return hash * 31 + key.column_unique_id;
+}
+
+bool IOHeatmap::should_sample() {
+    if (!config::enable_io_heatmap) {
+        return false;
+    }
+    static thread_local uint32_t tls_num_reads = 0;
+    return ++tls_num_reads % std::max(config::io_heatmap_sample_rate, 1) == 0;
+}
+
+void IOHeatmap::record(const Key& key, int64_t bytes, int64_t latency_ns) {
+    int cpu = sched_getcpu();
+    Shard& shard = _shards[(cpu < 0 ? 0 : cpu) % kNumShards];
+    Slot& slot = shard.slots[shard.write_pos.fetch_add(1, std::memory_order_relaxed) % kShardRingSize];
+    int expected = EMPTY;
+    if (!slot.state.compare_exchange_strong(expected, WRITING, std::memory_order_acquire)) {
+        // The ring is full, the aggregation can not keep up.
+        _num_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    slot.key = key;
+    slot.bytes = bytes;
+    slot.latency_ns = latency_ns;
+    slot.sample_rate = std::max(config::io_heatmap_sample_rate, 1);
+    slot.state.store(READY, std::memory_order_release);
+}
+
+void IOHeatmap::aggregate() {
+    const int64_t now = UnixSeconds();
+
+    std::lock_guard<std::mutex> l(_mutex);
+    for (size_t i = 0; i < kNumShards; i++) {
+        for (Slot& slot : _shards[i].slots) {
+            if (slot.state.load(std::memory_order_acquire) != READY) {
+                continue;
+            }
+            auto it = _entries.find(slot.key);
+            if (it == _entries.end()) {
+                if (_entries.size() >= static_cast<size_t>(config::io_heatmap_max_entries)) {
+                    slot.state.store(EMPTY, std::memory_order_release);
+                    _num_dropped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                it = _entries.emplace(slot.key, Entry{.key = slot.key}).first;
+            }
+            Entry& entry = it->second;
+            entry.read_ops += slot.sample_rate;
+            entry.read_bytes += slot.bytes * slot.sample_rate;
+            entry.read_time_ns += slot.latency_ns * slot.sample_rate;
+            entry.last_read_time = now;
+            slot.state.store(EMPTY, std::memory_order_release);
+        }
+    }
+
+    const int64_t expire_time = now - config::io_heatmap_retention_seconds;
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (it->second.last_read_time < expire_time) {
+            it = _entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::vector<IOHeatmap::Entry> IOHeatmap::entries() {
+    aggregate();
+    std::vector<Entry> result;
+    std::lock_guard<std::mutex> l(_mutex);
+    result.reserve(_entries.size());
+    for (const auto& [key, entry] : _entries) {
+        result.emplace_back(entry);
+    }
+    return result;
+}
+
+void IOHeatmap::clear() {
+    aggregate();
+    std::lock_guard<std::mutex> l(_mutex);
+    _entries.clear();
+}
+
+} // namespace starrocks
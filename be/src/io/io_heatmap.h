@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace starrocks {
+
+// Sampled read accounting per (query, tablet, column), to find out which of them saturate the devices.
+//
+// `record()` is on the read path of the column pages. It only puts the sample into the ring of the current cpu,
+// without any lock, and drops it if the ring is full. `aggregate()`, called periodically by a daemon thread,
+// drains the rings into the entries, which are expired `retention_seconds` after their last read.
+class IOHeatmap {
+public:
+    struct Key {
+        int64_t query_hi = 0;
+        int64_t query_lo = 0;
+        int64_t tablet_id = 0;
+        int32_t column_unique_id = -1;
+
+        bool operator==(const Key& other) const {
+            return query_hi == other.query_hi && query_lo == other.query_lo && tablet_id == other.tablet_id &&
+                   column_unique_id == other.column_unique_id;
+        }
+    };
+
+    struct Entry {
+        Key key;
+        // Scaled up by the sample rate, so they estimate the totals.
+        int64_t read_ops = 0;
+        int64_t read_bytes = 0;
+        int64_t read_time_ns = 0;
+        int64_t last_read_time = 0;
+    };
+
+    static IOHeatmap* instance();
+
+    // Whether the current read should be sampled, one in `config::io_heatmap_sample_rate` reads of a thread is.
+    static bool should_sample();
+
+    void record(const Key& key, int64_t bytes, int64_t latency_ns);
+
+    void aggregate();
+
+    std::vector<Entry> entries();
+
+    void clear();
+
+    int64_t num_dropped_samples() const { return _num_dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kNumShards = 64;
+    static constexpr size_t kShardRingSize = 1024;
+
+    enum SlotState : int { EMPTY = 0, WRITING = 1, READY = 2 };
+
+    struct Slot {
+        std::atomic<int> state{EMPTY};
+        Key key;
+        int64_t bytes = 0;
+        int64_t latency_ns = 0;
+        int64_t sample_rate = 1;
+    };
+
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> write_pos{0};
+        Slot slots[kShardRingSize];
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    IOHeatmap();
+
+    std::unique_ptr<Shard[]> _shards;
+    std::atomic<int64_t> _num_dropped{0};
+
+    std::mutex _mutex;
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+};
+
+} // namespace starrocks
@@ -126,9 +126,11 @@ void IOProfiler::reset() {
 
 thread_local IOStatEntry* current_io_stat = nullptr;
 thread_local uint32_t current_io_tag = IOProfiler::TAG_NONE;
+thread_local uint64_t current_io_tablet_id = 0;
 
 void IOProfiler::set_context(uint32_t tag, uint64_t tablet_id) {
     set_tag(tag);
+    set_tablet_id(tablet_id);
     if (tablet_id == 0 || _context_io_mode == IOMode::IOMODE_NONE) {
         return;
     }
@@ -157,6 +159,9 @@ IOProfiler::IOStat IOProfiler::get_context_io() {
 void IOProfiler::set_context(IOStatEntry* entry) {
     uint32_t tag = entry == nullptr ? TAG::TAG_NONE : entry->get_tag();
     set_tag(tag);
+    if (entry != nullptr) {
+        set_tablet_id(entry->id & 0x0000FFFFFFFFFFFFUL);
+    }
     current_io_stat = entry;
 }
 
@@ -164,6 +169,18 @@ void IOProfiler::set_tag(uint32_t tag) {
     current_io_tag = tag;
 }
 
+uint32_t IOProfiler::get_tag() {
+    return current_io_tag;
+}
+
+uint64_t IOProfiler::get_tablet_id() {
+    return current_io_tablet_id;
+}
+
+void IOProfiler::set_tablet_id(uint64_t tablet_id) {
+    current_io_tablet_id = tablet_id;
+}
+
 void IOProfiler::clear_context() {
     current_io_stat = nullptr;
 }
@@ -69,6 +69,10 @@ public:
     static void set_context(uint32_t tag, uint64_t tablet_id);
     static void set_context(IOStatEntry* entry);
     static void set_tag(uint32_t tag);
+    static uint32_t get_tag();
+    // The tablet of the current context, it is kept even if the io profiler is not started.
+    static uint64_t get_tablet_id();
+    static void set_tablet_id(uint64_t tablet_id);
     static IOStatEntry* get_context();
     static IOStat get_context_io();
     static void clear_context();
@@ -84,20 +88,26 @@ public:
         Scope(const Scope&) = delete;
         Scope(Scope&& other) {
             _old = other._old;
+            _old_tablet_id = other._old_tablet_id;
             _tls_io_snapshot = other._tls_io_snapshot;
             other._old = nullptr;
         }
         Scope(uint32_t tag, uint64_t tablet_id) {
             _old = get_context();
+            _old_tablet_id = get_tablet_id();
             set_context(tag, tablet_id);
             take_tls_io_snapshot(&_tls_io_snapshot);
         }
         Scope(IOStatEntry* entry) {
             _old = get_context();
+            _old_tablet_id = get_tablet_id();
             set_context(entry);
             take_tls_io_snapshot(&_tls_io_snapshot);
         }
-        ~Scope() { set_context(_old); }
+        ~Scope() {
+            set_context(_old);
+            set_tablet_id(_old_tablet_id);
+        }
 
         IOStat current_scoped_tls_io() { return calculate_scoped_tls_io(_tls_io_snapshot); }
 
@@ -105,6 +115,7 @@ public:
 
     private:
         IOStatEntry* _old{nullptr};
+        uint64_t _old_tablet_id{0};
         // A snapshot of the thread local io stat when this scope is created
         IOStat _tls_io_snapshot;
     };
@@ -0,0 +1,171 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "io/io_scheduler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/io_profiler.h"
+#include "util/time.h"
+
+namespace starrocks::io {
+
+IOScheduler* IOScheduler::instance() {
+    static IOScheduler scheduler;
+    return &scheduler;
+}
+
+IOScheduler::IOClass IOScheduler::current_io_class() {
+    switch (IOProfiler::get_tag()) {
+    case IOProfiler::TAG_QUERY:
+    case IOProfiler::TAG_NONE:
+        return IO_CLASS_QUERY;
+    case IOProfiler::TAG_SPILL:
+        return IO_CLASS_SPILL;
+    case IOProfiler::TAG_LOAD:
+    case IOProfiler::TAG_PKINDEX:
+        return IO_CLASS_LOAD;
+    default:
+        return IO_CLASS_BACKGROUND;
+    }
+}
+
+const char* IOScheduler::io_class_to_string(IOClass io_class) {
+    switch (io_class) {
+    case IO_CLASS_QUERY:
+        return "QUERY";
+    case IO_CLASS_SPILL:
+        return "SPILL";
+    case IO_CLASS_LOAD:
+        return "LOAD";
+    case IO_CLASS_BACKGROUND:
+        return "BACKGROUND";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+static int32_t io_class_weight(IOScheduler::IOClass io_class) {
+    int32_t weight = 1;
+    switch (io_class) {
+    case IOScheduler::IO_CLASS_QUERY:
+        weight = config::io_scheduler_query_weight;
+        break;
+    case IOScheduler::IO_CLASS_SPILL:
+        weight = config::io_scheduler_spill_weight;
+        break;
+    case IOScheduler::IO_CLASS_LOAD:
+        weight = config::io_scheduler_load_weight;
+        break;
+    default:
+        weight = config::io_scheduler_background_weight;
+        break;
+    }
+    return std::max(1, weight);
+}
+
+bool IOScheduler::acquire(IOClass io_class) {
+    const int64_t max_concurrency = config::io_scheduler_max_concurrency;
+    if (max_concurrency <= 0) {
+        return false;
+    }
+    std::unique_lock l(_mutex);
+    auto& queue = _queues[io_class];
+    if (queue.empty()) {
+        // A class becoming busy again must not take the slots of the others for the time it was idle.
+        double min_virtual_time = std::numeric_limits<double>::max();
+        for (int i = 0; i < IO_CLASS_COUNT; i++) {
+            if (!_queues[i].empty()) {
+                min_virtual_time = std::min(min_virtual_time, _virtual_time[i]);
+            }
+        }
+        if (min_virtual_time != std::numeric_limits<double>::max()) {
+            _virtual_time[io_class] = std::max(_virtual_time[io_class], min_virtual_time);
+        }
+    }
+    bool all_empty = std::all_of(_queues.begin(), _queues.end(), [](const auto& q) { return q.empty(); });
+    if (all_empty && _num_running < max_concurrency) {
+        _num_running++;
+        _virtual_time[io_class] += 1.0 / io_class_weight(io_class);
+        return true;
+    }
+    Waiter waiter;
+    waiter.enqueue_time_ms = MonotonicMillis();
+    queue.push_back(&waiter);
+    _dispatch(max_concurrency);
+    waiter.cv.wait(l, [&] { return waiter.granted; });
+    return true;
+}
+
+void IOScheduler::release(IOClass io_class) {
+    std::lock_guard l(_mutex);
+    DCHECK_GT(_num_running, 0);
+    _num_running--;
+    _dispatch(config::io_scheduler_max_concurrency);
+}
+
+int IOScheduler::_pick_class(int64_t now_ms) const {
+    int picked = -1;
+    // The class whose head request has waited the longest beyond the deadline goes first.
+    int64_t oldest_enqueue_time = now_ms - config::io_scheduler_max_wait_ms;
+    for (int i = 0; i < IO_CLASS_COUNT; i++) {
+        if (!_queues[i].empty() && _queues[i].front()->enqueue_time_ms < oldest_enqueue_time) {
+            oldest_enqueue_time = _queues[i].front()->enqueue_time_ms;
+            picked = i;
+        }
+    }
+    if (picked >= 0) {
+        return picked;
+    }
+    for (int i = 0; i < IO_CLASS_COUNT; i++) {
+        if (!_queues[i].empty() && (picked < 0 || _virtual_time[i] < _virtual_time[picked])) {
+            picked = i;
+        }
+    }
+    return picked;
+}
+
+void IOScheduler::_dispatch(int64_t max_concurrency) {
+    // The waiters are all granted if the scheduler has been disabled since they were queued.
+    const int64_t limit = max_concurrency <= 0 ? std::numeric_limits<int64_t>::max() : max_concurrency;
+    const int64_t now_ms = MonotonicMillis();
+    while (_num_running < limit) {
+        int picked = _pick_class(now_ms);
+        if (picked < 0) {
+            break;
+        }
+        Waiter* waiter = _queues[picked].front();
+        _queues[picked].pop_front();
+        _num_running++;
+        _virtual_time[picked] += 1.0 / io_class_weight(static_cast<IOClass>(picked));
+        waiter->granted = true;
+        waiter->cv.notify_one();
+    }
+}
+
+int64_t IOScheduler::num_running() const {
+    std::lock_guard l(_mutex);
+    return _num_running;
+}
+
+int64_t IOScheduler::num_waiting(IOClass io_class) const {
+    std::lock_guard l(_mutex);
+    return _queues[io_class].size();
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace starrocks::io {
+
+// IOScheduler bounds the number of concurrent object storage requests and decides which request goes next when the
+// limit is reached. Requests are classified by the IOProfiler tag of the issuing thread, each class has its own FIFO
+// queue, and a free slot goes to the class with the least weighted dispatched count, unless the head request of some
+// class has waited longer than `io_scheduler_max_wait_ms`.
+class IOScheduler {
+public:
+    enum IOClass {
+        IO_CLASS_QUERY = 0,
+        IO_CLASS_SPILL,
+        IO_CLASS_LOAD,
+        IO_CLASS_BACKGROUND,
+
+        IO_CLASS_COUNT,
+    };
+
+    // A permit holds one slot of the scheduler until destroyed.
+    class Permit {
+    public:
+        Permit(IOScheduler* scheduler, IOClass io_class) : _scheduler(scheduler), _io_class(io_class) {
+            _acquired = _scheduler->acquire(_io_class);
+        }
+        ~Permit() {
+            if (_acquired) {
+                _scheduler->release(_io_class);
+            }
+        }
+
+        Permit(const Permit&) = delete;
+        void operator=(const Permit&) = delete;
+
+    private:
+        IOScheduler* _scheduler;
+        IOClass _io_class;
+        bool _acquired;
+    };
+
+    static IOScheduler* instance();
+
+    // The io class of the current thread, derived from its IOProfiler tag.
+    static IOClass current_io_class();
+
+    static const char* io_class_to_string(IOClass io_class);
+
+    IOScheduler() = default;
+
+    // Blocks until a slot is granted. Returns false if the scheduler is disabled and no slot is taken.
+    bool acquire(IOClass io_class);
+
+    void release(IOClass io_class);
+
+    int64_t num_running() const;
+    int64_t num_waiting(IOClass io_class) const;
+
+private:
+    struct Waiter {
+        int64_t enqueue_time_ms;
+        bool granted{false};
+        std::condition_variable cv;
+    };
+
+    // Grant the free slots to the waiters, requires |_mutex| held.
+    void _dispatch(int64_t max_concurrency);
+    int _pick_class(int64_t now_ms) const;
+
+    mutable std::mutex _mutex;
+    int64_t _num_running{0};
+    std::array<std::deque<Waiter*>, IO_CLASS_COUNT> _queues;
+    // The number of requests dispatched of each class, divided by the class weight to make the dispatch decision.
+    std::array<double, IO_CLASS_COUNT> _virtual_time{};
+};
+
+} // namespace starrocks::io
@@ -18,10 +18,17 @@
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include "common/config.h"
 #include "io/io_profiler.h"
 #include "io/s3_zero_copy_iostream.h"
+#include "util/raw_container.h"
 #include "util/stopwatch.hpp"
 
 #ifdef USE_STAROS
@@ -47,6 +54,11 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     MonotonicStopWatch watch;
     watch.start();
     count = std::min(count, _size - _offset);
+    if (!_prefetched_ranges.empty() && _read_prefetched(static_cast<char*>(out), _offset, count)) {
+        _offset += count;
+        IOProfiler::add_read(count, watch.elapsed_time());
+        return count;
+    }
 
     // prefetch case:
     // case1: pretech is disable: _read_ahead_size = -1     -> direct read from s3
@@ -57,28 +69,10 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     // case6: read start is lower than buffer start         -> load data from s3 to buffer, copy from buffer
     if (count > _read_ahead_size) {
         auto real_length = std::min<int64_t>(_offset + count, _size) - _offset;
-
-        // https://www.rfc-editor.org/rfc/rfc9110.html#name-range
-        auto range = fmt::format("bytes={}-{}", _offset, _offset + real_length - 1);
-        Aws::S3::Model::GetObjectRequest request;
-        request.SetBucket(_bucket);
-        request.SetKey(_object);
-        request.SetRange(std::move(range));
-        request.SetResponseStreamFactory([out, real_length]() {
-            return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, reinterpret_cast<char*>(out), real_length);
-        });
-
-        Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
-        if (outcome.IsSuccess()) {
-            if (UNLIKELY(outcome.GetResult().GetContentLength() != real_length)) {
-                return Status::InternalError("The response length is different from request length for io stream!");
-            }
-            _offset += real_length;
-            IOProfiler::add_read(count, watch.elapsed_time());
-            return real_length;
-        } else {
-            return make_error_status(outcome.GetError());
-        }
+        RETURN_IF_ERROR(_read_range_parallel(static_cast<char*>(out), _offset, real_length));
+        _offset += real_length;
+        IOProfiler::add_read(count, watch.elapsed_time());
+        return real_length;
     } else {
         int64_t remain_to_read_length = count;
         int64_t copy_length = 0;
@@ -124,6 +118,207 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     }
 }
 
+// unit: us
+static bvar::LatencyRecorder g_s3_read_latency("s3_input_stream", "read_range");
+static bvar::Adder<int64_t> g_s3_hedged_reads("s3_input_stream", "hedged_reads");
+static bvar::Adder<int64_t> g_s3_hedged_read_wins("s3_input_stream", "hedged_read_wins");
+
+// Like S3Client::GetObjectCallable, but the task owns the client, because the loser of a hedged read keeps running
+// after the stream, and maybe the last reference to its client, is gone.
+static Aws::S3::Model::GetObjectOutcomeCallable get_object_async(std::shared_ptr<Aws::S3::S3Client> client,
+                                                                 Aws::S3::Model::GetObjectRequest request) {
+    auto task = std::make_shared<std::packaged_task<Aws::S3::Model::GetObjectOutcome()>>(
+            [client = std::move(client), request = std::move(request)]() { return client->GetObject(request); });
+    auto future = task->get_future();
+    std::thread([task]() { (*task)(); }).detach();
+    return future;
+}
+
+Status S3InputStream::_read_range(char* out, int64_t offset, int64_t length) {
+    MonotonicStopWatch watch;
+    watch.start();
+    auto st = config::object_storage_hedged_read_percentile > 0 ? _read_range_hedged(out, offset, length)
+                                                                : _read_range_once(out, offset, length);
+    if (st.ok()) {
+        g_s3_read_latency << watch.elapsed_time() / 1000;
+    }
+    return st;
+}
+
+Status S3InputStream::_read_range_hedged(char* out, int64_t offset, int64_t length) {
+    // A request can not be cancelled once sent, so each request writes into a buffer owned by itself instead of the
+    // caller's buffer, which must not be written after returning.
+    auto send_request = [&](std::shared_ptr<std::string> buffer) {
+        Aws::S3::Model::GetObjectRequest request;
+        request.SetBucket(_bucket);
+        request.SetKey(_object);
+        request.SetRange(fmt::format("bytes={}-{}", offset, offset + length - 1));
+        request.SetResponseStreamFactory([buffer = std::move(buffer), length]() {
+            return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), length);
+        });
+        return get_object_async(_s3client, std::move(request));
+    };
+    auto take_outcome = [&](Aws::S3::Model::GetObjectOutcome outcome, const std::string& buffer) -> Status {
+        if (!outcome.IsSuccess()) {
+            return make_error_status(outcome.GetError());
+        }
+        if (UNLIKELY(outcome.GetResult().GetContentLength() != length)) {
+            return Status::InternalError("The response length is different from request length for io stream!");
+        }
+        memcpy(out, buffer.data(), length);
+        return Status::OK();
+    };
+
+    auto primary_buffer = std::make_shared<std::string>();
+    raw::stl_string_resize_uninitialized(primary_buffer.get(), length);
+    auto primary = send_request(primary_buffer);
+    double ratio = std::min(config::object_storage_hedged_read_percentile, 99) / 100.0;
+    int64_t delay_us = std::max<int64_t>(config::object_storage_hedged_read_min_delay_ms * 1000,
+                                         g_s3_read_latency.latency_percentile(ratio));
+    if (primary.wait_for(std::chrono::microseconds(delay_us)) == std::future_status::ready) {
+        return take_outcome(primary.get(), *primary_buffer);
+    }
+
+    g_s3_hedged_reads << 1;
+    auto hedged_buffer = std::make_shared<std::string>();
+    raw::stl_string_resize_uninitialized(hedged_buffer.get(), length);
+    auto hedged = send_request(hedged_buffer);
+    while (true) {
+        if (primary.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready) {
+            auto st = take_outcome(primary.get(), *primary_buffer);
+            // fall back to the hedged request if the primary one failed
+            return st.ok() ? st : take_outcome(hedged.get(), *hedged_buffer);
+        }
+        if (hedged.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            auto st = take_outcome(hedged.get(), *hedged_buffer);
+            if (st.ok()) {
+                g_s3_hedged_read_wins << 1;
+                return st;
+            }
+            return take_outcome(primary.get(), *primary_buffer);
+        }
+    }
+}
+
+Status S3InputStream::_read_range_once(char* out, int64_t offset, int64_t length) {
+    // https://www.rfc-editor.org/rfc/rfc9110.html#name-range
+    auto range = fmt::format("bytes={}-{}", offset, offset + length - 1);
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(_bucket);
+    request.SetKey(_object);
+    request.SetRange(std::move(range));
+    request.SetResponseStreamFactory(
+            [out, length]() { return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, out, length); });
+
+    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    if (!outcome.IsSuccess()) {
+        return make_error_status(outcome.GetError());
+    }
+    if (UNLIKELY(outcome.GetResult().GetContentLength() != length)) {
+        return Status::InternalError("The response length is different from request length for io stream!");
+    }
+    return Status::OK();
+}
+
+Status S3InputStream::_read_range_parallel(char* out, int64_t offset, int64_t length) {
+    int64_t part_size = config::object_storage_parallel_read_part_size;
+    if (part_size <= 0 || length < 2 * part_size) {
+        return _read_range(out, offset, length);
+    }
+    int64_t max_parts = std::max<int64_t>(1, config::object_storage_parallel_read_max_parts);
+    part_size = std::max(part_size, (length + max_parts - 1) / max_parts);
+    int64_t num_parts = (length + part_size - 1) / part_size;
+
+    // the parts except the first one are read by the executor of the s3 client, and the first one by this thread
+    std::vector<Aws::S3::Model::GetObjectOutcomeCallable> futures;
+    std::vector<int64_t> part_lengths;
+    futures.reserve(num_parts - 1);
+    part_lengths.reserve(num_parts - 1);
+    for (int64_t part_offset = part_size; part_offset < length; part_offset += part_size) {
+        int64_t part_length = std::min(part_size, length - part_offset);
+        char* part_out = out + part_offset;
+        Aws::S3::Model::GetObjectRequest request;
+        request.SetBucket(_bucket);
+        request.SetKey(_object);
+        request.SetRange(fmt::format("bytes={}-{}", offset + part_offset, offset + part_offset + part_length - 1));
+        request.SetResponseStreamFactory([part_out, part_length]() {
+            return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, part_out, part_length);
+        });
+        futures.emplace_back(_s3client->GetObjectCallable(request));
+        part_lengths.emplace_back(part_length);
+    }
+    auto st = _read_range(out, offset, part_size);
+    // wait for all the parts even if some of them failed, they write into the caller's buffer
+    for (size_t i = 0; i < futures.size(); i++) {
+        auto outcome = futures[i].get();
+        if (!st.ok()) {
+            continue;
+        }
+        if (!outcome.IsSuccess()) {
+            st = make_error_status(outcome.GetError());
+        } else if (UNLIKELY(outcome.GetResult().GetContentLength() != part_lengths[i])) {
+            st = Status::InternalError("The response length is different from request length for io stream!");
+        }
+    }
+    return st;
+}
+
+void S3InputStream::prefetch(int64_t offset, size_t length) {
+    // the ranges already passed by the reading are unlikely to be read again
+    std::erase_if(_prefetched_ranges, [this](const auto& range) { return range.offset + range.length <= _offset; });
+    const auto max_ranges = static_cast<size_t>(std::max(0, config::object_storage_max_prefetch_ranges));
+    if (length == 0 || _prefetched_ranges.size() >= max_ranges) {
+        return;
+    }
+    for (const auto& range : _prefetched_ranges) {
+        if (offset < range.offset + range.length && range.offset < offset + static_cast<int64_t>(length)) {
+            return;
+        }
+    }
+    auto buffer = std::make_shared<std::string>();
+    raw::stl_string_resize_uninitialized(buffer.get(), length);
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(_bucket);
+    request.SetKey(_object);
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + length - 1));
+    request.SetResponseStreamFactory([buffer, length]() {
+        return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), length);
+    });
+    // The task owns the client and the buffer, a stream destroyed before the prefetch finishes does not wait for it.
+    auto task = std::make_shared<std::packaged_task<Status()>>(
+            [client = _s3client, request = std::move(request), length, buffer]() -> Status {
+                auto outcome = client->GetObject(request);
+                if (!outcome.IsSuccess()) {
+                    return make_error_status(outcome.GetError());
+                }
+                if (UNLIKELY(outcome.GetResult().GetContentLength() != static_cast<int64_t>(length))) {
+                    return Status::InternalError("The response length is different from request length for io stream!");
+                }
+                return Status::OK();
+            });
+    _prefetched_ranges.push_back(
+            PrefetchedRange{offset, static_cast<int64_t>(length), std::move(buffer), task->get_future().share()});
+    std::thread([task]() { (*task)(); }).detach();
+}
+
+bool S3InputStream::_read_prefetched(char* out, int64_t offset, int64_t count) {
+    for (auto it = _prefetched_ranges.begin(); it != _prefetched_ranges.end(); ++it) {
+        if (offset < it->offset || offset + count > it->offset + it->length) {
+            continue;
+        }
+        bool ok = it->status.get().ok();
+        if (ok) {
+            memcpy(out, it->buffer->data() + (offset - it->offset), count);
+        }
+        // the range is dropped once the read reaches its end, or it failed and the read falls back to a direct read
+        if (!ok || offset + count == it->offset + it->length) {
+            _prefetched_ranges.erase(it);
+        }
+        return ok;
+    }
+    return false;
+}
+
 Status S3InputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
@@ -156,6 +351,15 @@ void S3InputStream::set_size(int64_t value) {
 StatusOr<std::string> S3InputStream::read_all() {
     MonotonicStopWatch watch;
     watch.start();
+    if (_size > 0 && config::object_storage_parallel_read_part_size > 0 &&
+        _size >= 2 * config::object_storage_parallel_read_part_size) {
+        // the size is known, so the object can be read by concurrent ranged GETs
+        std::string result;
+        raw::stl_string_resize_uninitialized(&result, _size);
+        RETURN_IF_ERROR(_read_range_parallel(result.data(), 0, _size));
+        IOProfiler::add_read(_size, watch.elapsed_time());
+        return result;
+    }
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "io/seekable_input_stream.h"
 
@@ -58,10 +60,30 @@ public:
 
     StatusOr<std::string> read_all() override;
 
+    // Reads the range asynchronously, and the later reads inside the range take the data from it.
+    void prefetch(int64_t offset, size_t length) override;
+
     // only for UT
     int64_t get_read_ahead_size() const { return _read_ahead_size; }
 
 private:
+    // Read the range [offset, offset + length) of the object into `out`.
+    Status _read_range(char* out, int64_t offset, int64_t length);
+    Status _read_range_once(char* out, int64_t offset, int64_t length);
+    // Like `_read_range_once`, but hedge the request with a duplicate one if it is slower than the recent reads.
+    Status _read_range_hedged(char* out, int64_t offset, int64_t length);
+    // Like `_read_range`, but split the range into concurrent ranged GETs if it is large enough.
+    Status _read_range_parallel(char* out, int64_t offset, int64_t length);
+    // Copies [offset, offset + count) into `out` if it is inside a prefetched range, returns false otherwise.
+    bool _read_prefetched(char* out, int64_t offset, int64_t count);
+
+    struct PrefetchedRange {
+        int64_t offset;
+        int64_t length;
+        std::shared_ptr<std::string> buffer;
+        std::shared_future<Status> status;
+    };
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
@@ -72,6 +94,7 @@ private:
     int64_t _buffer_start_offset{-1};
     int64_t _buffer_data_length{-1};
     std::unique_ptr<uint8_t[]> _read_buffer;
+    std::vector<PrefetchedRange> _prefetched_ranges;
 };
 
 } // namespace starrocks::io
@@ -21,6 +21,10 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <thread>
+
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/io_profiler.h"
 #include "io/s3_zero_copy_iostream.h"
@@ -88,10 +92,12 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_all_parts());
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     IOProfiler::add_sync(watch.elapsed_time());
     _client = nullptr;
+    _free_buffers.clear();
     return Status::OK();
 }
 
@@ -131,20 +137,60 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
+    // Backpressure: the writer blocks until the oldest part finishes if too many parts are uploading.
+    const size_t max_inflight_parts = std::max(1, config::experimental_s3_max_inflight_upload_parts);
+    while (_pending_parts.size() >= max_inflight_parts) {
+        RETURN_IF_ERROR(wait_oldest_part());
+    }
+
+    auto buffer = std::make_shared<Aws::String>();
+    buffer->swap(_buffer);
+    if (!_free_buffers.empty()) {
+        _buffer.swap(_free_buffers.back());
+        _free_buffers.pop_back();
+    }
+    const int part_number = static_cast<int>(_etags.size() + 1);
+    _etags.emplace_back();
+
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(part_number);
     req.SetUploadId(_upload_id);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, _buffer.data(), _buffer.size()));
-    auto outcome = _client->UploadPart(req);
-    if (outcome.IsSuccess()) {
-        _etags.push_back(outcome.GetResult().GetETag());
-        return Status::OK();
+    req.SetContentLength(static_cast<int64_t>(buffer->size()));
+    req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), buffer->size()));
+    // The task owns the client and the buffer, so a stream destroyed before the upload finishes is still safe.
+    auto task = std::make_shared<std::packaged_task<Aws::S3::Model::UploadPartOutcome()>>(
+            [client = _client, req = std::move(req), buffer]() { return client->UploadPart(req); });
+    _pending_parts.push_back(PendingPart{part_number, std::move(buffer), task->get_future()});
+    std::thread([task]() { (*task)(); }).detach();
+    return Status::OK();
+}
+
+Status S3OutputStream::wait_oldest_part() {
+    DCHECK(!_pending_parts.empty());
+    PendingPart part = std::move(_pending_parts.front());
+    _pending_parts.pop_front();
+    auto outcome = part.outcome.get();
+    if (!outcome.IsSuccess()) {
+        return Status::IOError(
+                fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+    }
+    _etags[part.part_number - 1] = outcome.GetResult().GetETag();
+    part.buffer->clear();
+    _free_buffers.emplace_back(std::move(*part.buffer));
+    return Status::OK();
+}
+
+Status S3OutputStream::wait_all_parts() {
+    Status st;
+    while (!_pending_parts.empty()) {
+        auto wait_st = wait_oldest_part();
+        if (st.ok() && !wait_st.ok()) {
+            st = std::move(wait_st);
+        }
     }
-    return Status::IOError(
-            fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+    return st;
 }
 
 Status S3OutputStream::complete_multipart_upload() {
@@ -16,6 +16,9 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <deque>
+#include <future>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
@@ -50,10 +53,19 @@ public:
     Status close() override;
 
 private:
+    // A part whose upload has been sent but not waited yet, the buffer must be kept until the upload finishes.
+    struct PendingPart {
+        int part_number;
+        std::shared_ptr<Aws::String> buffer;
+        std::future<Aws::S3::Model::UploadPartOutcome> outcome;
+    };
+
     Status create_multipart_upload();
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    Status wait_oldest_part();
+    Status wait_all_parts();
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
@@ -63,6 +75,9 @@ private:
     Aws::String _buffer;
     Aws::String _upload_id;
     std::vector<Aws::String> _etags;
+    std::deque<PendingPart> _pending_parts;
+    // Buffers of the finished parts, reused by the following parts to avoid reallocating large buffers.
+    std::vector<Aws::String> _free_buffers;
 };
 
 } // namespace starrocks::io
@@ -0,0 +1,41 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "io/io_scheduler.h"
+#include "io/output_stream.h"
+
+namespace starrocks::io {
+
+// Every write waits for a slot of the IOScheduler, classified by the IOProfiler tag of the writing thread.
+class ScheduledOutputStream : public OutputStreamWrapper {
+public:
+    explicit ScheduledOutputStream(std::unique_ptr<OutputStream> stream) : OutputStreamWrapper(std::move(stream)) {}
+
+    ~ScheduledOutputStream() override = default;
+
+    Status write(const void* data, int64_t size) override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return OutputStreamWrapper::write(data, size);
+    }
+
+    Status close() override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return OutputStreamWrapper::close();
+    }
+};
+
+} // namespace starrocks::io
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "io/io_scheduler.h"
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+// Every read waits for a slot of the IOScheduler, classified by the IOProfiler tag of the reading thread.
+class ScheduledSeekableInputStream : public SeekableInputStreamWrapper {
+public:
+    explicit ScheduledSeekableInputStream(std::unique_ptr<SeekableInputStream> stream)
+            : SeekableInputStreamWrapper(std::move(stream)) {}
+
+    ~ScheduledSeekableInputStream() override = default;
+
+    StatusOr<int64_t> read(void* data, int64_t count) override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return SeekableInputStreamWrapper::read(data, count);
+    }
+
+    Status read_fully(void* data, int64_t count) override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return SeekableInputStreamWrapper::read_fully(data, count);
+    }
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return SeekableInputStreamWrapper::read_at(offset, out, count);
+    }
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        IOScheduler::Permit permit(IOScheduler::instance(), IOScheduler::current_io_class());
+        return SeekableInputStreamWrapper::read_at_fully(offset, out, count);
+    }
+};
+
+} // namespace starrocks::io
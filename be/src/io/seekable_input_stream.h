@@ -145,6 +145,8 @@ public:
 
     Status touch_cache(int64_t offset, size_t length) override { return _impl->touch_cache(offset, length); }
 
+    void prefetch(int64_t offset, size_t length) override { _impl->prefetch(offset, length); }
+
 private:
     SeekableInputStream* _impl;
     Ownership _ownership;
@@ -16,10 +16,13 @@
 
 #include <gutil/strings/substitute.h>
 
+#include <algorithm>
+
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks::io {
 
@@ -38,6 +41,46 @@ void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t
     }
 }
 
+SharedBufferedInputStream::CoalesceModel* SharedBufferedInputStream::CoalesceModel::get(int storage_type,
+                                                                                       bool cache_hit) {
+    static constexpr int kMaxStorageTypes = 16;
+    static CoalesceModel models[kMaxStorageTypes][2];
+    DCHECK(storage_type >= 0 && storage_type < kMaxStorageTypes);
+    return &models[storage_type % kMaxStorageTypes][cache_hit ? 1 : 0];
+}
+
+void SharedBufferedInputStream::CoalesceModel::update(int64_t bytes, int64_t latency_ns) {
+    const double x = bytes;
+    const double y = latency_ns;
+    std::lock_guard l(_mutex);
+    // a plain average until the first samples are collected, so that the initial zeros do not bias the fit
+    const double w = _samples < kMinSamples ? 1.0 / (_samples + 1) : kDecay;
+    _x += w * (x - _x);
+    _y += w * (y - _y);
+    _xx += w * (x * x - _xx);
+    _xy += w * (x * y - _xy);
+    _samples++;
+}
+
+int64_t SharedBufferedInputStream::CoalesceModel::max_dist_size(int64_t default_dist, int64_t max_buffer_size) const {
+    std::lock_guard l(_mutex);
+    if (_samples < kMinSamples) {
+        return default_dist;
+    }
+    const double var = _xx - _x * _x;
+    // the read sizes are too close to tell the per request cost from the bandwidth
+    if (var <= _x * _x * 0.01) {
+        return default_dist;
+    }
+    const double ns_per_byte = (_xy - _x * _y) / var;
+    const double ns_per_request = _y - ns_per_byte * _x;
+    if (ns_per_byte <= 0 || ns_per_request <= 0) {
+        return default_dist;
+    }
+    const double dist = ns_per_request / ns_per_byte;
+    return static_cast<int64_t>(std::clamp<double>(dist, kMinDistSize, std::max(kMinDistSize, max_buffer_size)));
+}
+
 std::string SharedBufferedInputStream::SharedBuffer::debug_string() const {
     return strings::Substitute(
             "SharedBuffer raw_offset=$0, raw_size=$1, offset=$2, size=$3, ref_count=$4, buffer_capacity=$5", raw_offset,
@@ -187,6 +230,9 @@ Status SharedBufferedInputStream::_set_io_ranges_active_and_lazy_columns(const s
 }
 
 Status SharedBufferedInputStream::set_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column) {
+    if (_model != nullptr) {
+        _options.max_dist_size = _model->max_dist_size(_options.max_dist_size, _options.max_buffer_size);
+    }
     if (coalesce_lazy_column || !config::io_coalesce_adaptive_lazy_active) {
         return _set_io_ranges_all_columns(ranges);
     } else {
@@ -226,12 +272,32 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
+        // issue the prefetches before blocking on this read, so that they are in flight meanwhile
+        _prefetch_buffers_after(sb);
+        MonotonicStopWatch watch;
+        watch.start();
         RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        if (_model != nullptr) {
+            _model->update(sb.size, watch.elapsed_time());
+        }
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+void SharedBufferedInputStream::_prefetch_buffers_after(const SharedBuffer& sb) {
+    int n = config::io_coalesce_prefetch_buffers;
+    for (auto it = _map.upper_bound(sb.raw_offset + sb.raw_size); it != _map.end() && n > 0; ++it, --n) {
+        SharedBuffer& next = *it->second;
+        // the large buffers are not coalesced ranges and are read with concurrent requests of their own
+        if (next.prefetched || next.buffer.capacity() != 0 || next.size > _options.max_buffer_size) {
+            continue;
+        }
+        next.prefetched = true;
+        _stream->prefetch(next.offset, next.size);
+    }
+}
+
 void SharedBufferedInputStream::release() {
     _map.clear();
 }
@@ -247,7 +313,12 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        MonotonicStopWatch watch;
+        watch.start();
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        if (_model != nullptr) {
+            _model->update(count, watch.elapsed_time());
+        }
         return Status::OK();
     }
     const uint8_t* buffer = nullptr;
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
@@ -47,10 +48,37 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // whether the underlying stream has been asked to prefetch this buffer
+        bool prefetched = false;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
+    // Learns the fixed cost per request and the bandwidth of a kind of storage by fitting `latency = a + b * bytes`
+    // over the recent reads, and derives the coalescing distance from them: reading through a gap of `a / b` bytes
+    // costs the same as issuing another request.
+    class CoalesceModel {
+    public:
+        // |storage_type| is the FileSystem::Type of the underlying file.
+        static CoalesceModel* get(int storage_type, bool cache_hit);
+
+        void update(int64_t bytes, int64_t latency_ns);
+        // Returns |default_dist| until enough reads have been observed.
+        int64_t max_dist_size(int64_t default_dist, int64_t max_buffer_size) const;
+
+    private:
+        static constexpr double kDecay = 0.02;
+        static constexpr int64_t kMinSamples = 32;
+        static constexpr int64_t kMinDistSize = 4 * 1024;
+
+        mutable std::mutex _mutex;
+        int64_t _samples = 0;
+        // exponentially weighted moving averages of x, y, x*x and x*y, where x is bytes and y is latency
+        double _x = 0;
+        double _y = 0;
+        double _xx = 0;
+        double _xy = 0;
+    };
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
     ~SharedBufferedInputStream() override = default;
@@ -81,6 +109,8 @@ public:
     void release_to_offset(int64_t offset);
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
+    // The coalescing distance is taken from |model| in set_io_ranges, and the reads feed the |model|.
+    void set_coalesce_model(CoalesceModel* model) { _model = model; }
     void set_align_size(int64_t size) { _align_size = size; }
 
     int64_t shared_io_count() const { return _shared_io_count; }
@@ -101,6 +131,7 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    void _prefetch_buffers_after(const SharedBuffer& sb);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
@@ -109,6 +140,7 @@ private:
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
+    CoalesceModel* _model = nullptr;
     int64_t _offset = 0;
     int64_t _file_size = 0;
     int64_t _shared_io_count = 0;
@@ -233,6 +233,9 @@ public:
         _fragment_instance_id = fragment_instance_id;
     }
     const starrocks::TUniqueId& fragment_instance_id() { return _fragment_instance_id; }
+    // The id of the resource group the thread is working for, -1 if none.
+    void set_workgroup_id(int64_t workgroup_id) { _workgroup_id = workgroup_id; }
+    int64_t workgroup_id() const { return _workgroup_id; }
     void set_pipeline_driver_id(int32_t driver_id) { _driver_id = driver_id; }
     int32_t get_driver_id() const { return _driver_id; }
 
@@ -347,6 +350,7 @@ private:
     TUniqueId _fragment_instance_id;
     std::string _custom_coredump_msg{};
     int32_t _driver_id = 0;
+    int64_t _workgroup_id = -1;
     bool _check = true;
     bool _reserve_mod = false;
 };
@@ -447,10 +451,11 @@ private:
     CurrentThread::current().set_query_id(query_id);              \
     CurrentThread::current().set_fragment_instance_id(fragment_instance_id);
 
-#define RESET_TRACE_INFO()                              \
-    CurrentThread::current().set_pipeline_driver_id(0); \
-    CurrentThread::current().set_query_id({});          \
-    CurrentThread::current().set_fragment_instance_id({});
+#define RESET_TRACE_INFO()                                 \
+    CurrentThread::current().set_pipeline_driver_id(0);    \
+    CurrentThread::current().set_query_id({});             \
+    CurrentThread::current().set_fragment_instance_id({}); \
+    CurrentThread::current().set_workgroup_id(-1);
 
 #define SCOPED_SET_TRACE_INFO(driver_id, query_id, fragment_instance_id) \
     SET_TRACE_INFO(driver_id, query_id, fragment_instance_id)            \
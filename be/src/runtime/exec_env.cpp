@@ -412,6 +412,38 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("segment_encode") // thread pool for encoding the columns of a segment
+                            .set_min_threads(0)
+                            .set_max_threads(std::max(1, config::segment_encode_thread_pool_num_max))
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_segment_encode_thread_pool));
+
+    RETURN_IF_ERROR(ThreadPoolBuilder("parquet_encode") // thread pool for encoding the columns of a parquet row group
+                            .set_min_threads(0)
+                            .set_max_threads(std::max(1, config::parquet_writer_encode_thread_pool_num_max))
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_parquet_encode_thread_pool));
+
+    if (config::lake_metadata_prefetch_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("lake_meta_prefetch") // thread pool for prefetching lake tablet metadata
+                                .set_min_threads(0)
+                                .set_max_threads(config::lake_metadata_prefetch_thread_num)
+                                .set_max_queue_size(100000)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&_lake_metadata_prefetch_pool));
+    }
+
+    if (config::lake_pk_publish_preload_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("lake_pk_preload") // thread pool for preloading the pk of txn logs to publish
+                                .set_min_threads(0)
+                                .set_max_threads(config::lake_pk_publish_preload_thread_num)
+                                .set_max_queue_size(100000)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&_lake_pk_preload_pool));
+    }
+
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
         _max_executor_threads = config::pipeline_exec_thread_pool_thread_num;
@@ -711,6 +743,22 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_segment_encode_thread_pool) {
+        _segment_encode_thread_pool->shutdown();
+    }
+
+    if (_parquet_encode_thread_pool) {
+        _parquet_encode_thread_pool->shutdown();
+    }
+
+    if (_lake_metadata_prefetch_pool) {
+        _lake_metadata_prefetch_pool->shutdown();
+    }
+
+    if (_lake_pk_preload_pool) {
+        _lake_pk_preload_pool->shutdown();
+    }
+
     if (_diagnose_daemon) {
         _diagnose_daemon->stop();
     }
@@ -776,6 +824,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_put_combined_txn_log_thread_pool);
     SAFE_DELETE(_diagnose_daemon);
     _dictionary_cache_pool.reset();
+    _segment_encode_thread_pool.reset();
+    _parquet_encode_thread_pool.reset();
+    _lake_metadata_prefetch_pool.reset();
+    _lake_pk_preload_pool.reset();
     _automatic_partition_pool.reset();
     _put_aggregate_metadata_thread_pool.reset();
     _metrics = nullptr;
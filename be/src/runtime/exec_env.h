@@ -293,6 +293,10 @@ public:
     PriorityThreadPool* datacache_rpc_pool() { return _datacache_rpc_pool; }
     ThreadPool* load_rpc_pool() { return _load_rpc_pool.get(); }
     ThreadPool* dictionary_cache_pool() { return _dictionary_cache_pool.get(); }
+    ThreadPool* segment_encode_thread_pool() { return _segment_encode_thread_pool.get(); }
+    ThreadPool* parquet_encode_thread_pool() { return _parquet_encode_thread_pool.get(); }
+    ThreadPool* lake_metadata_prefetch_pool() { return _lake_metadata_prefetch_pool.get(); }
+    ThreadPool* lake_pk_preload_pool() { return _lake_pk_preload_pool.get(); }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     BaseLoadPathMgr* load_path_mgr() { return _load_path_mgr; }
     BfdParser* bfd_parser() const { return _bfd_parser; }
@@ -383,6 +387,10 @@ private:
     PriorityThreadPool* _datacache_rpc_pool = nullptr;
     std::unique_ptr<ThreadPool> _load_rpc_pool;
     std::unique_ptr<ThreadPool> _dictionary_cache_pool;
+    std::unique_ptr<ThreadPool> _segment_encode_thread_pool;
+    std::unique_ptr<ThreadPool> _parquet_encode_thread_pool;
+    std::unique_ptr<ThreadPool> _lake_metadata_prefetch_pool;
+    std::unique_ptr<ThreadPool> _lake_pk_preload_pool;
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::QueryContextManager* _query_context_mgr = nullptr;
     std::unique_ptr<workgroup::WorkGroupManager> _workgroup_manager;
@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -405,6 +406,7 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
     // which prevents triggering a flush,
     // we need to proactively perform a flush when memory resources are insufficient.
     _flush_stale_memtables();
+    _flush_largest_memtables();
 
     if (close_channel) {
         // persist txn.
@@ -538,6 +540,55 @@ void LocalTabletsChannel::_flush_stale_memtables() {
     }
 }
 
+void LocalTabletsChannel::_flush_largest_memtables() {
+    if (config::load_memtable_arbitration_target_ratio <= 0) {
+        return;
+    }
+    MemTracker* tracker = nullptr;
+    if (_mem_tracker->limit_exceeded_by_ratio(70)) {
+        tracker = _mem_tracker;
+    } else if (_mem_tracker->parent() != nullptr && _mem_tracker->parent()->limit_exceeded_by_ratio(70)) {
+        tracker = _mem_tracker->parent();
+    } else {
+        return;
+    }
+    std::vector<std::pair<int64_t, AsyncDeltaWriter*>> candidates;
+    int64_t active_bytes = 0;
+    for (auto& [tablet_id, writer] : _delta_writers) {
+        int64_t size = writer->write_buffer_size();
+        if (size > 0) {
+            candidates.emplace_back(size, writer.get());
+            active_bytes += size;
+        }
+    }
+    const int64_t consumption = tracker->consumption();
+    const int64_t excess = consumption - tracker->limit() * config::load_memtable_arbitration_target_ratio / 100;
+    if (excess <= 0 || active_bytes <= 0 || consumption <= 0) {
+        return;
+    }
+    // The share of this channel of the memory to free, the memory of the flushing memtables is included in the
+    // consumption and will be freed soon.
+    const auto bytes_to_free = static_cast<int64_t>(static_cast<double>(excess) * active_bytes / consumption);
+
+    // The larger the memtable, the larger the segment it is flushed to.
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    int64_t flush_bytes = 0;
+    int64_t flush_writers = 0;
+    for (auto& [size, writer] : candidates) {
+        if (flush_bytes >= bytes_to_free) {
+            break;
+        }
+        writer->flush();
+        flush_bytes += size;
+        ++flush_writers;
+    }
+    VLOG(1) << "Flush largest memtables txn_id: " << _txn_id << " flush_bytes: " << flush_bytes
+            << " flush_writers: " << flush_writers << " active_bytes: " << active_bytes
+            << " active_writers: " << candidates.size() << " mem_usage: " << consumption
+            << " mem_limit: " << tracker->limit();
+}
+
 void LocalTabletsChannel::_abort_replica_tablets(
         const PTabletWriterAddChunkRequest& request, const std::string& abort_reason,
         const std::unordered_map<int64_t, std::vector<int64_t>>& node_id_to_abort_tablets) {
@@ -188,6 +188,8 @@ private:
                                 const std::unordered_map<int64_t, std::vector<int64_t>>& node_id_to_abort_tablets);
 
     void _flush_stale_memtables();
+    // Flush the largest memtables when the memory usage is high, see load_memtable_arbitration_target_ratio.
+    void _flush_largest_memtables();
 
     void _update_peer_replica_profile(DeltaWriter* writer, RuntimeProfile* profile);
     void _update_primary_replica_profile(DeltaWriter* writer, RuntimeProfile* profile);
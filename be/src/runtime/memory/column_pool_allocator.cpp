@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_pool_allocator.h"
+
+#include "util/bit_util.h"
+
+namespace starrocks {
+
+void* ColumnPoolAllocator::alloc(size_t size) {
+    if (size > (1ULL << (kMinSizeClass - 1)) && size <= (1ULL << kMaxSizeClass)) {
+        auto& free_list = _free_lists[BitUtil::Log2Ceiling64(size) - kMinSizeClass];
+        if (!free_list.empty()) {
+            auto [ptr, usable_size] = free_list.back();
+            free_list.pop_back();
+            _pooled_bytes -= usable_size;
+            return ptr;
+        }
+    }
+    return ::malloc(size);
+}
+
+void ColumnPoolAllocator::free(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    size_t usable_size = malloc_usable_size(ptr);
+    if (usable_size >= (1ULL << kMinSizeClass) && usable_size < (1ULL << (kMaxSizeClass + 1)) &&
+        _pooled_bytes + usable_size <= _max_pooled_bytes) {
+        _free_lists[BitUtil::Log2Floor64(usable_size) - kMinSizeClass].emplace_back(ptr, usable_size);
+        _pooled_bytes += usable_size;
+        return;
+    }
+    ::free(ptr);
+}
+
+void ColumnPoolAllocator::release() {
+    for (auto& free_list : _free_lists) {
+        for (auto& [ptr, _] : free_list) {
+            ::free(ptr);
+        }
+        free_list.clear();
+        free_list.shrink_to_fit();
+    }
+    _pooled_bytes = 0;
+}
+
+} // namespace starrocks
@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "runtime/memory/mem_hook_allocator.h"
+
+namespace starrocks {
+
+// ColumnPoolAllocator keeps the freed column buffers of middle sizes, grouped by power-of-two size classes,
+// and hands them out again for the following allocations, so that the buffers of the chunks that flow through
+// a pipeline driver are reused instead of going back to malloc and the mem hook for every chunk.
+// It is not thread-safe, each pipeline driver owns one and installs it as `tls_column_allocator` during
+// `process`. The buffers handed out are plain malloc memory, so they can be freed by any other allocator.
+class ColumnPoolAllocator final : public AllocatorFactory<Allocator, ColumnPoolAllocator> {
+public:
+    explicit ColumnPoolAllocator(size_t max_pooled_bytes) : _max_pooled_bytes(max_pooled_bytes) {}
+    ~ColumnPoolAllocator() override { release(); }
+
+    ColumnPoolAllocator(const ColumnPoolAllocator&) = delete;
+    ColumnPoolAllocator& operator=(const ColumnPoolAllocator&) = delete;
+
+    void* alloc(size_t size) override;
+
+    void free(void* ptr) override;
+
+    void* realloc(void* ptr, size_t size) override { return ::realloc(ptr, size); }
+
+    void* calloc(size_t n, size_t size) override { return ::calloc(n, size); }
+
+    void cfree(void* ptr) override { ::free(ptr); }
+
+    void* memalign(size_t align, size_t size) override { return ::memalign(align, size); }
+
+    void* aligned_alloc(size_t align, size_t size) override { return ::aligned_alloc(align, size); }
+
+    void* valloc(size_t size) override { return ::valloc(size); }
+
+    void* pvalloc(size_t size) override { return ::pvalloc(size); }
+
+    int posix_memalign(void** ptr, size_t align, size_t size) override { return ::posix_memalign(ptr, align, size); }
+
+    // free all the pooled buffers
+    void release();
+
+    size_t pooled_bytes() const { return _pooled_bytes; }
+
+private:
+    // small buffers are cheap enough in the thread cache of malloc, and huge buffers are rare
+    static constexpr int kMinSizeClass = 12; // 4KB
+    static constexpr int kMaxSizeClass = 22; // 4MB
+
+    // a buffer in the free list of class `c` can hold at least 2^c bytes
+    std::array<std::vector<std::pair<void*, size_t>>, kMaxSizeClass - kMinSizeClass + 1> _free_lists;
+    const size_t _max_pooled_bytes;
+    size_t _pooled_bytes = 0;
+};
+
+} // namespace starrocks
@@ -0,0 +1,51 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+static constexpr uintptr_t kHugePageSize = 2 * 1024 * 1024;
+
+// Advise the kernel to back the 2MB aligned part of [ptr, ptr + size) with transparent huge pages.
+// It only takes effect before the pages are touched, and is a no-op if THP is disabled.
+inline void madvise_huge_pages(void* ptr, size_t size) {
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(kHugePageSize - 1);
+    if (begin < end) {
+        // Only a hint, the failure is ignored.
+        (void)::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+}
+
+// Resize a large buffer that is accessed randomly, such as the buckets of a hash table.
+// If `madvise_huge_pages` is enabled, the buffer is reserved and advised before it is filled,
+// so its pages are faulted in as huge pages and the TLB misses of the random accesses are reduced.
+template <class T, class Alloc>
+void resize_random_access_buffer(std::vector<T, Alloc>* buffer, size_t size, const T& value) {
+    if (config::madvise_huge_pages && size * sizeof(T) >= kHugePageSize && buffer->capacity() < size) {
+        buffer->reserve(size);
+        madvise_huge_pages(buffer->data(), buffer->capacity() * sizeof(T));
+    }
+    buffer->resize(size, value);
+}
+
+} // namespace starrocks
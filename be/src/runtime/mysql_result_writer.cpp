@@ -40,11 +40,13 @@
 #include "column/const_column.h"
 #include "common/statusor.h"
 #include "exprs/expr.h"
+#include "gutil/strings/fastmem.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/buffer_control_result_writer.h"
 #include "runtime/current_thread.h"
 #include "types/logical_type.h"
 #include "util/mysql_row_buffer.h"
+#include "util/raw_container.h"
 
 namespace starrocks {
 
@@ -108,39 +110,13 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
     auto& result_rows = result->result_batch.rows;
     result_rows.resize(num_rows);
 
-    Columns result_columns;
     // Step 1: compute expr
-    int num_columns = _output_expr_ctxs.size();
-    result_columns.reserve(num_columns);
-
-    for (int i = 0; i < num_columns; ++i) {
-        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
-        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
-                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
-                         : column;
-        result_columns.emplace_back(std::move(column));
-    }
+    ASSIGN_OR_RETURN(Columns result_columns, _evaluate_result_columns(chunk));
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format
     {
-        _row_buffer->reserve(128);
         SCOPED_TIMER(_convert_tuple_timer);
-        for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            }
-            // TODO: codegen here
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
-                }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
-            }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
-        }
+        _convert_rows(result_columns, num_rows, &result_rows);
     }
     return result;
 }
@@ -150,62 +126,33 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     int num_rows = chunk->num_rows();
     std::vector<TFetchDataResultPtr> results;
 
-    Columns result_columns;
     // Step 1: compute expr
-    int num_columns = _output_expr_ctxs.size();
-    result_columns.reserve(num_columns);
-
-    for (int i = 0; i < num_columns; ++i) {
-        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
-        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
-                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
-                         : column;
-        result_columns.emplace_back(std::move(column));
-    }
+    ASSIGN_OR_RETURN(Columns result_columns, _evaluate_result_columns(chunk));
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format, and split the rows into batches of at most _max_row_buffer_size
     {
         TRY_CATCH_ALLOC_SCOPE_START()
-        _row_buffer->reserve(128);
-        size_t current_bytes = 0;
-        int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
-        auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        std::vector<std::string> rows(num_rows);
+        _convert_rows(result_columns, num_rows, &rows);
 
+        size_t current_bytes = 0;
+        auto result = std::make_unique<TFetchDataResult>();
+        auto* result_rows = &result->result_batch.rows;
+        result_rows->reserve(num_rows);
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            }
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
-                }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
-            }
-            size_t len = _row_buffer->length();
-
-            if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+            size_t len = rows[i].size();
+            if (UNLIKELY(current_bytes + len >= _max_row_buffer_size && !result_rows->empty())) {
                 results.emplace_back(std::move(result));
-
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
-
+                result_rows = &result->result_batch.rows;
+                result_rows->reserve(num_rows - i);
                 current_bytes = 0;
-                current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
-
+            result_rows->emplace_back(std::move(rows[i]));
             current_bytes += len;
-            current_rows += 1;
         }
-        if (current_rows > 0) {
-            result_rows.resize(current_rows);
+        if (!result_rows->empty()) {
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
@@ -213,4 +160,75 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     return results;
 }
 
+StatusOr<Columns> MysqlResultWriter::_evaluate_result_columns(Chunk* chunk) {
+    int num_columns = _output_expr_ctxs.size();
+    Columns result_columns;
+    result_columns.reserve(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
+        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
+                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
+                         : column;
+        result_columns.emplace_back(std::move(column));
+    }
+    return result_columns;
+}
+
+void MysqlResultWriter::_convert_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows) {
+    if (!_is_binary_format) {
+        _convert_text_rows(columns, num_rows, rows);
+        return;
+    }
+
+    // The binary protocol leads every row with the null bitmap of its cells, so it is converted row by row.
+    const size_t num_columns = columns.size();
+    _row_buffer->reserve(128);
+    for (size_t i = 0; i < num_rows; ++i) {
+        DCHECK_EQ(0, _row_buffer->length());
+        _row_buffer->start_binary_row(num_columns);
+        for (const auto& column : columns) {
+            if (!column->is_nullable()) {
+                _row_buffer->update_field_pos();
+            }
+            column->put_mysql_row_buffer(_row_buffer, i, true);
+        }
+        size_t len = _row_buffer->length();
+        _row_buffer->move_content(&(*rows)[i]);
+        _row_buffer->reserve(len * 1.1);
+    }
+}
+
+void MysqlResultWriter::_convert_text_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows) {
+    const size_t num_columns = columns.size();
+    _column_buffers.resize(num_columns);
+    _cell_ends.resize(num_columns * num_rows);
+    for (size_t col = 0; col < num_columns; ++col) {
+        MysqlRowBuffer& buffer = _column_buffers[col];
+        buffer.reset();
+        size_t* cell_ends = _cell_ends.data() + col * num_rows;
+        for (size_t i = 0; i < num_rows; ++i) {
+            columns[col]->put_mysql_row_buffer(&buffer, i);
+            cell_ends[i] = buffer.data().size();
+        }
+    }
+
+    for (size_t i = 0; i < num_rows; ++i) {
+        size_t row_size = 0;
+        for (size_t col = 0; col < num_columns; ++col) {
+            const size_t* cell_ends = _cell_ends.data() + col * num_rows;
+            row_size += cell_ends[i] - (i == 0 ? 0 : cell_ends[i - 1]);
+        }
+        std::string& row = (*rows)[i];
+        raw::stl_string_resize_uninitialized(&row, row_size);
+        char* dst = row.data();
+        for (size_t col = 0; col < num_columns; ++col) {
+            const size_t* cell_ends = _cell_ends.data() + col * num_rows;
+            const size_t cell_begin = i == 0 ? 0 : cell_ends[i - 1];
+            const size_t cell_size = cell_ends[i] - cell_begin;
+            strings::memcpy_inlined(dst, _column_buffers[col].data().data() + cell_begin, cell_size);
+            dst += cell_size;
+        }
+    }
+}
+
 } // namespace starrocks
@@ -62,10 +62,23 @@ private:
     // this function is only used in non-pipeline engine
     StatusOr<TFetchDataResultPtr> _process_chunk(Chunk* chunk);
 
+    StatusOr<Columns> _evaluate_result_columns(Chunk* chunk);
+
+    // Convert the first `num_rows` rows of `columns` to mysql rows into `rows`.
+    void _convert_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows);
+
+    // The text protocol is converted column by column, each column into a buffer of its own, and then every row is
+    // assembled from its cells with the exact size.
+    void _convert_text_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows);
+
     const std::vector<ExprContext*>& _output_expr_ctxs;
     MysqlRowBuffer* _row_buffer;
     bool _is_binary_format;
 
+    // The buffers of the columns for the text protocol and the end of each cell in them, reused across chunks.
+    std::vector<MysqlRowBuffer> _column_buffers;
+    std::vector<size_t> _cell_ends;
+
     const size_t _max_row_buffer_size = 1024 * 1024 * 1024;
 };
 
@@ -200,8 +200,9 @@ void RuntimeFilterPort::publish_runtime_filters(const std::list<RuntimeFilterBui
         size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(state, filter,
                                                                            reinterpret_cast<uint8_t*>(rf_data->data()));
         rf_data->resize(actual_size);
+        RuntimeFilterHelper::compress_serialized_runtime_filter(rf_data);
 
-        auto passthrough_delivery = actual_size <= config::deliver_broadcast_rf_passthrough_bytes_limit;
+        auto passthrough_delivery = rf_data->size() <= config::deliver_broadcast_rf_passthrough_bytes_limit;
         if (directly_send_broadcast_grf) {
             auto sender_id =
                     std::min_element(rf_desc->broadcast_grf_senders().begin(), rf_desc->broadcast_grf_senders().end(),
@@ -606,6 +607,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf_version, out,
                                                                        reinterpret_cast<uint8_t*>(send_data->data()));
     send_data->resize(actual_size);
+    RuntimeFilterHelper::compress_serialized_runtime_filter(send_data);
     int timeout_ms = config::send_rpc_runtime_filter_timeout_ms;
     if (_query_options.__isset.runtime_filter_send_timeout_ms) {
         timeout_ms = _query_options.runtime_filter_send_timeout_ms;
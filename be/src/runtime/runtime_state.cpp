@@ -429,7 +429,7 @@ DictOptimizeParser* RuntimeState::mutable_dict_optimize_parser() {
 }
 
 Status RuntimeState::init_query_global_dict(const GlobalDictLists& global_dict_list) {
-    RETURN_IF_ERROR(_build_global_dict(global_dict_list, &_query_global_dicts, nullptr));
+    RETURN_IF_ERROR(_build_global_dict(global_dict_list, &_query_global_dicts, &_query_dict_versions));
     _dict_optimize_parser.set_mutable_dict_maps(this, &_query_global_dicts);
     return Status::OK();
 }
@@ -473,6 +473,9 @@ public:
     DictOptimizeParser* mutable_dict_optimize_parser();
 
     const phmap::flat_hash_map<uint32_t, int64_t>& load_dict_versions() { return _load_dict_versions; }
+    // the versions of the query global dicts, fragments holding the same version of a dict could exchange the codes
+    // of the column instead of the decoded strings
+    const phmap::flat_hash_map<uint32_t, int64_t>& query_dict_versions() const { return _query_dict_versions; }
 
     using GlobalDictLists = std::vector<TGlobalDict>;
     Status init_query_global_dict(const GlobalDictLists& global_dict_list);
@@ -688,6 +691,7 @@ private:
     GlobalDictMaps _query_global_dicts;
     GlobalDictMaps _load_global_dicts;
     phmap::flat_hash_map<uint32_t, int64_t> _load_dict_versions;
+    phmap::flat_hash_map<uint32_t, int64_t> _query_dict_versions;
     DictOptimizeParser _dict_optimize_parser;
 
     pipeline::QueryContext* _query_ctx = nullptr;
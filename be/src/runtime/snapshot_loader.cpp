@@ -51,6 +51,7 @@
 #include "runtime/broker_mgr.h"
 #include "runtime/exec_env.h"
 #include "storage/index/index_descriptor.h"
+#include "storage/index/inverted/builtin/builtin_plugin.h"
 #include "storage/index/inverted/clucene/clucene_plugin.h"
 #include "storage/snapshot_manager.h"
 #include "storage/storage_engine.h"
@@ -1010,7 +1011,7 @@ Status SnapshotLoader::_replace_tablet_id(const std::string& file_name, int64_t
                _end_with(file_name, ".vi")) {
         *new_file_name = file_name;
         return Status::OK();
-    } else if (CLucenePlugin::is_index_files(file_name)) {
+    } else if (CLucenePlugin::is_index_files(file_name) || BuiltinInvertedPlugin::is_index_files(file_name)) {
         *new_file_name = file_name;
         return Status::OK();
     } else {
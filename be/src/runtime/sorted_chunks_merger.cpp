@@ -14,6 +14,8 @@
 
 #include "runtime/sorted_chunks_merger.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "exec/sort_exec_exprs.h"
 #include "exec/sorting/sorting.h"
@@ -22,6 +24,42 @@
 
 namespace starrocks {
 
+void CursorLoserTree::init(std::vector<ChunkCursor*> cursors) {
+    _cursors = std::move(cursors);
+    _num_valid_cursors = _cursors.size();
+    const uint32_t k = _cursors.size();
+    _tree.assign(std::max(k, 1U), 0);
+    if (k <= 1) {
+        return;
+    }
+    // play the matches from bottom to top, winners[i] is the winner of node i
+    std::vector<uint32_t> winners(k);
+    for (uint32_t node = k - 1; node >= 1; --node) {
+        uint32_t left = 2 * node < k ? winners[2 * node] : 2 * node - k;
+        uint32_t right = 2 * node + 1 < k ? winners[2 * node + 1] : 2 * node + 1 - k;
+        if (_less(right, left)) {
+            std::swap(left, right);
+        }
+        winners[node] = left;
+        _tree[node] = right;
+    }
+    _tree[0] = winners[1];
+}
+
+void CursorLoserTree::adjust_top() {
+    uint32_t winner = _tree[0];
+    if (!_cursors[winner]->is_valid()) {
+        --_num_valid_cursors;
+    }
+    const uint32_t k = _cursors.size();
+    for (uint32_t node = (winner + k) / 2; node >= 1; node /= 2) {
+        if (_less(_tree[node], winner)) {
+            std::swap(_tree[node], winner);
+        }
+    }
+    _tree[0] = winner;
+}
+
 SortedChunksMerger::SortedChunksMerger(RuntimeState* state, bool is_pipeline)
         : _state(state), _is_pipeline(is_pipeline) {}
 
@@ -37,7 +75,8 @@ Status SortedChunksMerger::init(const ChunkSuppliers& chunk_suppliers, const Chu
         _single_has_supplier = chunk_has_suppliers[0];
     } else {
         _cursors.reserve(chunk_suppliers.size());
-        _min_heap.reserve(chunk_suppliers.size());
+        std::vector<ChunkCursor*> valid_cursors;
+        valid_cursors.reserve(chunk_suppliers.size());
         for (int i = 0; i < chunk_suppliers.size(); ++i) {
             _cursors.emplace_back(std::make_unique<ChunkCursor>(chunk_suppliers[i], chunk_probe_suppliers[i],
                                                                 chunk_has_suppliers[i], sort_exprs, is_asc,
@@ -45,10 +84,10 @@ Status SortedChunksMerger::init(const ChunkSuppliers& chunk_suppliers, const Chu
             ChunkCursor* cursor = _cursors.rbegin()->get();
             cursor->next();
             if (cursor->is_valid()) {
-                _min_heap.push_back(cursor);
+                valid_cursors.push_back(cursor);
             }
         }
-        std::make_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        _loser_tree.init(std::move(valid_cursors));
     }
     return Status::OK();
 }
@@ -77,48 +116,49 @@ bool SortedChunksMerger::is_data_ready() {
     if (_cursors.size() == 1) {
         return _cursors[0]->chunk_has_supplier();
     } else {
-        if (!_after_min_heap) {
+        if (!_after_loser_tree) {
             for (auto& cursor : _cursors) {
                 if (!cursor->chunk_has_supplier()) {
                     return false;
                 }
             }
-            init_for_min_heap();
+            init_for_loser_tree();
             return true;
         } else {
             // if wait for data, we should probe next row;
-            // else because we have move to next row, so just test min_heap.
+            // else because we have move to next row, so just test loser tree.
             if (_wait_for_data) {
                 return _cursor->has_next() || _cursor->chunk_has_supplier();
             } else {
-                // when _wait_for_data is false, min heap is ready to produce output.
-                // case 1: min heap is empty, EOS has arrived.
-                // case 2: min heap is not emtpy, each cursor in min heap must satisfy one of properties following:
+                // when _wait_for_data is false, loser tree is ready to produce output.
+                // case 1: loser tree is empty, EOS has arrived.
+                // case 2: loser tree is not emtpy, each cursor in loser tree must satisfy one of properties following:
                 //     property 1: the current chunk is the cursor is not exhausted, or
                 //     property 2: the SenderQueue of the cursor has chunks ready for processing, or
                 //     property 3: the SenderQueue of the cursor has received the EOS.
                 //
-                // so in conclusion, in such situations, min_heap is always ready.
+                // so in conclusion, in such situations, loser tree is always ready.
                 return true;
             }
         }
     }
 }
 
-void SortedChunksMerger::init_for_min_heap() {
+void SortedChunksMerger::init_for_loser_tree() {
     if (_cursors.size() > 1) {
-        _min_heap.reserve(_cursors.size());
+        std::vector<ChunkCursor*> valid_cursors;
+        valid_cursors.reserve(_cursors.size());
         for (auto& cursor_ptr : _cursors) {
             ChunkCursor* cursor = cursor_ptr.get();
             cursor->next_chunk_for_pipeline();
             cursor->next_for_pipeline();
             if (cursor->is_valid()) {
-                _min_heap.push_back(cursor);
+                valid_cursors.push_back(cursor);
             }
         }
-        std::make_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        _loser_tree.init(std::move(valid_cursors));
     }
-    _after_min_heap = true;
+    _after_loser_tree = true;
 }
 
 void SortedChunksMerger::set_profile(RuntimeProfile* profile) {
@@ -129,7 +169,7 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
     ScopedTimer<MonotonicStopWatch> timer(_total_timer);
 
     DCHECK(chunk != nullptr);
-    if (_min_heap.empty() && !_single_supplier) {
+    if (_loser_tree.empty() && !_single_supplier) {
         *eos = true;
         *chunk = nullptr;
         return Status::OK();
@@ -146,7 +186,7 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
 
     // multiple sources
     *eos = false;
-    ChunkCursor* cursor = _min_heap[0];
+    ChunkCursor* cursor = _loser_tree.top();
     *chunk = cursor->clone_empty_chunk(_state->chunk_size());
 
     ChunkPtr current_chunk = cursor->get_current_chunk();
@@ -155,16 +195,11 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
     selective_values.push_back(cursor->get_current_position_in_chunk());
     size_t row_number = 1;
 
-    std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
     cursor->next();
-    if (cursor->is_valid()) {
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    } else {
-        _min_heap.pop_back();
-    }
+    _loser_tree.adjust_top();
 
-    while (row_number < _state->chunk_size() && !_min_heap.empty()) {
-        cursor = _min_heap[0];
+    while (row_number < _state->chunk_size() && !_loser_tree.empty()) {
+        cursor = _loser_tree.top();
         const auto& ptr = cursor->get_current_chunk();
         if (current_chunk == ptr) {
             selective_values.push_back(cursor->get_current_position_in_chunk());
@@ -175,13 +210,8 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
             selective_values.push_back(cursor->get_current_position_in_chunk());
         }
 
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
         cursor->next();
-        if (cursor->is_valid()) {
-            std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-        } else {
-            _min_heap.pop_back();
-        }
+        _loser_tree.adjust_top();
 
         ++row_number;
     }
@@ -197,7 +227,7 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
 
     DCHECK(chunk != nullptr);
     *chunk = std::make_shared<Chunk>();
-    if (_min_heap.empty() && !_single_probe_supplier) {
+    if (_loser_tree.empty() && !_single_probe_supplier) {
         *eos = true;
         return Status::OK();
     }
@@ -228,16 +258,16 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
         // move to next row
         if (_wait_for_data) {
             _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
+            move_cursor_and_adjust_loser_tree(eos);
+            if (_row_number >= _state->chunk_size() || _loser_tree.empty()) {
                 collect_merged_chunks(chunk);
                 break;
             }
         }
 
         // STEP 0:
-        // Guarantee: min_heap is keep min heap property, and it isn't empty.
-        _cursor = _min_heap[0];
+        // Guarantee: loser tree isn't empty.
+        _cursor = _loser_tree.top();
         if (!_row_number) {
             _result_chunk = _cursor->clone_empty_chunk(_state->chunk_size());
             _current_chunk = _cursor->get_current_chunk();
@@ -259,8 +289,7 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
         }
 
         ++_row_number;
-        // we move min-element in the heap and then probe next row in cursor.
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        // the min-element is kept on the top of loser tree until the cursor moves to next row.
         _wait_for_data = true;
 
         // probe next row.
@@ -271,8 +300,8 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
             // STEP 1:
             // move to next row
             _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
+            move_cursor_and_adjust_loser_tree(eos);
+            if (_row_number >= _state->chunk_size() || _loser_tree.empty()) {
                 collect_merged_chunks(chunk);
                 break;
             }
@@ -282,16 +311,13 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
     return Status::OK();
 }
 
-void SortedChunksMerger::move_cursor_and_adjust_min_heap(std::atomic<bool>* eos) {
+void SortedChunksMerger::move_cursor_and_adjust_loser_tree(std::atomic<bool>* eos) {
     // It has next row, so we move cursor.
     _cursor->next_for_pipeline();
-    if (_cursor->is_valid()) {
-        // we should adjust min_heap to keep min heap property.
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    } else {
-        // just remove one source.
-        _min_heap.pop_back();
-        *eos = _min_heap.empty();
+    // replay the matches of the cursor, and it's removed if it's exhausted.
+    _loser_tree.adjust_top();
+    if (_loser_tree.empty()) {
+        *eos = true;
     }
 }
 void SortedChunksMerger::collect_merged_chunks(ChunkPtr* chunk) {
@@ -26,6 +26,35 @@ namespace starrocks {
 
 class SortExecExprs;
 
+// Tournament tree of losers over the sorted cursors. Replaying the matches of the top cursor after it moves takes
+// log(k) comparisons, while a binary heap takes about 2*log(k) for the pop and push.
+class CursorLoserTree {
+public:
+    // All the cursors must be valid.
+    void init(std::vector<ChunkCursor*> cursors);
+
+    bool empty() const { return _num_valid_cursors == 0; }
+    ChunkCursor* top() const { return _cursors[_tree[0]]; }
+
+    // Called after the top cursor is moved to the next row, the cursor is removed once it's exhausted.
+    void adjust_top();
+
+private:
+    // An exhausted cursor is greater than any valid cursor.
+    bool _less(uint32_t a, uint32_t b) const {
+        if (!_cursors[a]->is_valid()) {
+            return false;
+        }
+        return !_cursors[b]->is_valid() || *_cursors[a] < *_cursors[b];
+    }
+
+    std::vector<ChunkCursor*> _cursors;
+    // _tree[0] is the index of the top cursor, and _tree[i] is the loser of internal node i, whose children are
+    // node 2i and 2i+1, and cursor j is the leaf node k+j.
+    std::vector<uint32_t> _tree;
+    size_t _num_valid_cursors = 0;
+};
+
 // Merge a group of sorted Chunks to one Chunk in order.
 class SortedChunksMerger {
 public:
@@ -46,14 +75,9 @@ public:
     Status get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bool>* eos, bool* should_exit);
 
 private:
-    struct CursorCmpGreater {
-        // if a is greater than b.
-        inline bool operator()(const ChunkCursor* a, const ChunkCursor* b) { return b->operator<(*a); }
-    };
-
-    void init_for_min_heap();
+    void init_for_loser_tree();
     void collect_merged_chunks(ChunkPtr* chunk);
-    void move_cursor_and_adjust_min_heap(std::atomic<bool>* eos);
+    void move_cursor_and_adjust_loser_tree(std::atomic<bool>* eos);
 
     RuntimeState* _state;
     bool _is_pipeline;
@@ -63,17 +87,16 @@ private:
     ChunkHasSupplier _single_has_supplier;
 
     std::vector<std::unique_ptr<ChunkCursor>> _cursors;
-    CursorCmpGreater _cursor_cmp_greater;
-    std::vector<ChunkCursor*> _min_heap;
+    CursorLoserTree _loser_tree;
 
     RuntimeProfile::Counter* _total_timer = nullptr;
 
     // for multiple suppliers.
-    bool _after_min_heap = false;
+    bool _after_loser_tree = false;
 
     /* this is for pipeline.
      * _row_number: is initial 0, and record the number of rows between calls, after return datas, set _row_number back to 0.
-     * _cursor: will record top element of min_heap.
+     * _cursor: will record top element of loser tree.
      * _current_chunk: record currently used chunk.
      * _result_chunk: copy rows from every _current_chunk. 
      * _selective_values: used to record index in _current_chunk.
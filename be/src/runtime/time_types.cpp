@@ -18,6 +18,7 @@
 
 #include "gutil/strings/substitute.h"
 #include "util/raw_container.h"
+#include "util/string_parser.hpp"
 
 namespace starrocks {
 
@@ -303,19 +304,40 @@ bool date::from_string(const char* date_str, size_t len, int* year, int* month,
     return true;
 }
 
+// The separator bytes of "%Y-%m-" and "%H:%i:%s" in the 8 chars loaded by StringParser::load_8_chars.
+static constexpr uint64_t DATE_SEPARATOR_MASK = 0xFF0000FF00000000ULL;
+static constexpr uint64_t TIME_SEPARATOR_MASK = 0x0000FF0000FF0000ULL;
+
+// Validate and convert the 8 chars in a 64-bit register, the chars at the separator bytes are not checked and the
+// others must be digits. Byte k of `pairs` holds the 2-digit number of the k-th and (k+1)-th char.
+static inline bool parse_8_chars_to_pairs(const char* ptr, uint64_t separator_mask, uint64_t* pairs) {
+    uint64_t chunk = StringParser::load_8_chars(ptr);
+    chunk = (chunk & ~separator_mask) | (0x3030303030303030ULL & separator_mask);
+    if (!StringParser::is_8_digits(chunk)) {
+        return false;
+    }
+    chunk -= 0x3030303030303030ULL;
+    *pairs = chunk * 10 + (chunk >> 8);
+    return true;
+}
+
+static inline int pair_at(uint64_t pairs, int k) {
+    return static_cast<int>((pairs >> (k * 8)) & 0xFF);
+}
+
 // Get date base on format "%Y-%m-%d", where '-' means any char.
-// compare every char.
+// The first 8 chars are checked at once.
 // Note that this method does not check whether the parsed year, month, and day are in valid range.
 bool date::from_string_to_date_internal(const char* ptr, int* pyear, int* pmonth, int* pday) {
-    const bool is_valid = isdigit(ptr[0]) && isdigit(ptr[1]) && isdigit(ptr[2]) && isdigit(ptr[3]) &&
-                          !isdigit(ptr[4]) && isdigit(ptr[5]) && isdigit(ptr[6]) && !isdigit(ptr[7]) &&
-                          isdigit(ptr[8]) && isdigit(ptr[9]);
+    uint64_t pairs;
+    const bool is_valid = parse_8_chars_to_pairs(ptr, DATE_SEPARATOR_MASK, &pairs) && !isdigit(ptr[4]) &&
+                          !isdigit(ptr[7]) && isdigit(ptr[8]) && isdigit(ptr[9]);
     if (!is_valid) {
         return false;
     }
 
-    const int year = ptr[0] * 1000 + ptr[1] * 100 + ptr[2] * 10 + ptr[3] - static_cast<int>('0') * 1111;
-    const int month = ptr[5] * 10 + ptr[6] - static_cast<int>('0') * 11;
+    const int year = pair_at(pairs, 0) * 100 + pair_at(pairs, 2);
+    const int month = pair_at(pairs, 5);
     const int day = ptr[8] * 10 + ptr[9] - static_cast<int>('0') * 11;
 
     *pyear = year;
@@ -385,37 +407,19 @@ bool date::is_standard_datetime_format(const char* ptr, int length, const char**
 // else return false;
 bool date::from_string_to_datetime_internal(const char* ptr_date, const char* ptr_time, int* year, int* month, int* day,
                                             int* hour, int* minute, int* second, int* microsecond) {
-    uint8_t year1;
-    uint8_t year2;
-    uint8_t year3;
-    uint8_t year4;
-    uint8_t month1;
-    uint8_t month2;
-    uint8_t day1;
-    uint8_t day2;
-
-    uint8_t hour1;
-    uint8_t hour2;
-    uint8_t minute1;
-    uint8_t minute2;
-    uint8_t second1;
-    uint8_t second2;
-    if (char_to_digit(ptr_date, 0, &year1) || char_to_digit(ptr_date, 1, &year2) ||
-        char_to_digit(ptr_date, 2, &year3) || char_to_digit(ptr_date, 3, &year4) || isdigit(ptr_date[4]) ||
-        char_to_digit(ptr_date, 5, &month1) || char_to_digit(ptr_date, 6, &month2) || isdigit(ptr_date[7]) ||
-        char_to_digit(ptr_date, 8, &day1) || char_to_digit(ptr_date, 9, &day2) || char_to_digit(ptr_time, 0, &hour1) ||
-        char_to_digit(ptr_time, 1, &hour2) || isdigit(ptr_time[2]) || char_to_digit(ptr_time, 3, &minute1) ||
-        char_to_digit(ptr_time, 4, &minute2) || isdigit(ptr_time[5]) || char_to_digit(ptr_time, 6, &second1) ||
-        char_to_digit(ptr_time, 7, &second2)) {
+    if (!from_string_to_date_internal(ptr_date, year, month, day)) {
+        return false;
+    }
+    // the time part "%H:%i:%s" is exactly 8 chars
+    uint64_t pairs;
+    if (!parse_8_chars_to_pairs(ptr_time, TIME_SEPARATOR_MASK, &pairs) || isdigit(ptr_time[2]) ||
+        isdigit(ptr_time[5])) {
         return false;
     }
 
-    *year = year1 * 1000 + year2 * 100 + year3 * 10 + year4;
-    *month = month1 * 10 + month2;
-    *day = day1 * 10 + day2;
-    *hour = hour1 * 10 + hour2;
-    *minute = minute1 * 10 + minute2;
-    *second = second1 * 10 + second2;
+    *hour = pair_at(pairs, 0);
+    *minute = pair_at(pairs, 3);
+    *second = pair_at(pairs, 6);
     *microsecond = 0;
     if (*month > 12 || (*day > DAYS_IN_MONTH[is_leap(*year)][*month]) || *hour > 23 || *minute > 59 || *second > 59) {
         return false;
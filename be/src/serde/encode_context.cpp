@@ -14,6 +14,8 @@
 
 #include "serde/encode_context.h"
 
+#include <algorithm>
+
 #include "gen_cpp/data.pb.h" // ChunkPB
 
 namespace starrocks::serde {
@@ -28,6 +30,18 @@ EncodeContext::EncodeContext(const int col_num, const int encode_level) : _sessi
     if (_session_encode_level & 1 && (_session_encode_level >> 1)) {
         _enable_adjust = true;
     }
+
+    _candidate_encode_levels.emplace_back(_session_encode_level);
+    for (int encode_flag : {ENCODE_STRING, ENCODE_INTEGER}) {
+        const uint32_t level = _session_encode_level & ~encode_flag;
+        if ((enable_encode_integer(level) || enable_encode_string(level)) &&
+            std::find(_candidate_encode_levels.begin(), _candidate_encode_levels.end(), level) ==
+                    _candidate_encode_levels.end()) {
+            _candidate_encode_levels.emplace_back(level);
+        }
+    }
+    _candidate_encode_levels.emplace_back(0);
+    _column_candidate_index.resize(col_num, 0);
 }
 
 void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte) {
@@ -41,13 +55,13 @@ void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode
     }
 }
 
-// if encode ratio < EncodeRatioLimit, encode it, otherwise not.
+// if encode ratio < EncodeRatioLimit, keep the encode level, otherwise try the next candidate.
 void EncodeContext::_adjust(const int col_id) {
     auto old_level = _column_encode_level[col_id];
-    if (_encoded_bytes[col_id] < _raw_bytes[col_id] * EncodeRatioLimit) {
-        _column_encode_level[col_id] = _session_encode_level;
-    } else {
-        _column_encode_level[col_id] = 0;
+    auto& candidate_index = _column_candidate_index[col_id];
+    if (_encoded_bytes[col_id] >= _raw_bytes[col_id] * EncodeRatioLimit &&
+        candidate_index + 1 < _candidate_encode_levels.size()) {
+        _column_encode_level[col_id] = _candidate_encode_levels[++candidate_index];
     }
     if (old_level != _column_encode_level[col_id] || _session_encode_level < -1) {
         VLOG_ROW << "column " << col_id << " encode_level changed from " << old_level << " to "
@@ -30,9 +30,10 @@ namespace starrocks::serde {
 constexpr double EncodeRatioLimit = 0.9;
 constexpr uint32_t EncodeSamplingNum = 5;
 
-// EncodeContext adaptively adjusts encode_level according to the compression ratio. In detail,
+// EncodeContext adaptively adjusts encode_level of each column according to the compression ratio. In detail,
 // for every _frequency chunks, if the compression ratio for the first EncodeSamplingNum chunks is less than
-// EncodeRatioLimit, then encode the rest chunks, otherwise not.
+// EncodeRatioLimit, then encode the rest chunks with the same level. Otherwise the column tries the next candidate
+// level, which drops the string or the integer encoding, and at last encodes nothing.
 
 class EncodeContext {
 public:
@@ -65,7 +66,7 @@ private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
 
-    // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
+    // if encode ratio < EncodeRatioLimit, keep the encode level, otherwise try the next candidate.
     void _adjust(const int col_id);
     const int _session_encode_level;
     uint64_t _times = 0;
@@ -73,5 +74,8 @@ private:
     bool _enable_adjust = false;
     std::vector<uint64_t> _raw_bytes, _encoded_bytes;
     std::vector<uint32_t> _column_encode_level;
+    // encode levels from encoding the most to encoding nothing
+    std::vector<uint32_t> _candidate_encode_levels;
+    std::vector<size_t> _column_candidate_index;
 };
 } // namespace starrocks::serde
\ No newline at end of file
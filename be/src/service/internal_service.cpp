@@ -38,8 +38,10 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 
 #include "agent/agent_server.h"
@@ -84,6 +86,7 @@
 #include "util/arrow/row_batch.h"
 #include "util/failpoint/fail_point.h"
 #include "util/hash_util.hpp"
+#include "util/priority_thread_pool.hpp"
 #include "util/stopwatch.hpp"
 #include "util/thrift_util.h"
 #include "util/time.h"
@@ -95,6 +98,33 @@ namespace starrocks {
 using PromiseStatus = std::promise<Status>;
 using PromiseStatusSharedPtr = std::shared_ptr<PromiseStatus>;
 
+// The number of transmit_chunk tasks queued in the query rpc pool of each query.
+class TransmitChunkQueue {
+public:
+    static TransmitChunkQueue* instance() {
+        static TransmitChunkQueue s_instance;
+        return &s_instance;
+    }
+
+    // Returns the priority of the newly queued task.
+    int enqueue(int64_t query_key) {
+        std::lock_guard l(_mutex);
+        return -(_queued[query_key]++);
+    }
+
+    void dequeue(int64_t query_key) {
+        std::lock_guard l(_mutex);
+        auto it = _queued.find(query_key);
+        if (it != _queued.end() && --it->second <= 0) {
+            _queued.erase(it);
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<int64_t, int> _queued;
+};
+
 template <typename T>
 PInternalServiceImplBase<T>::PInternalServiceImplBase(ExecEnv* exec_env) : _exec_env(exec_env) {}
 
@@ -117,8 +147,25 @@ template <typename T>
 void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController* cntl_base,
                                                  const PTransmitChunkParams* request, PTransmitChunkResult* response,
                                                  google::protobuf::Closure* done) {
-    auto task = [=]() { this->_transmit_chunk(cntl_base, request, response, done); };
-    if (!_exec_env->query_rpc_pool()->try_offer(std::move(task))) {
+    if (!config::internal_service_fair_transmit_chunk) {
+        auto task = [=]() { this->_transmit_chunk(cntl_base, request, response, done); };
+        if (!_exec_env->query_rpc_pool()->try_offer(std::move(task))) {
+            ClosureGuard closure_guard(done);
+            Status::ServiceUnavailable("submit transmit_chunk task failed").to_protobuf(response->mutable_status());
+        }
+        return;
+    }
+    // the fragment instances of a query share the high bits of the query id
+    const int64_t query_key = request->finst_id().hi();
+    auto* queue = TransmitChunkQueue::instance();
+    PriorityThreadPool::Task task;
+    task.priority = queue->enqueue(query_key);
+    task.work_function = [=]() {
+        queue->dequeue(query_key);
+        this->_transmit_chunk(cntl_base, request, response, done);
+    };
+    if (!_exec_env->query_rpc_pool()->try_offer(task)) {
+        queue->dequeue(query_key);
         ClosureGuard closure_guard(done);
         Status::ServiceUnavailable("submit transmit_chunk task failed").to_protobuf(response->mutable_status());
     }
@@ -645,7 +692,16 @@ void PInternalServiceImplBase<T>::_fetch_datacache(google::protobuf::RpcControll
     } else {
         ReadCacheOptions options;
         IOBuffer buf;
-        st = block_cache->read(request->cache_key(), request->offset(), request->size(), &buf, &options);
+        // A request may cover multiple continuous blocks, which are read block by block.
+        const int64_t block_size = block_cache->block_size();
+        const int64_t end_offset = request->offset() + request->size();
+        for (int64_t offset = request->offset(); st.ok() && offset < end_offset;) {
+            const int64_t size = std::min(end_offset - offset, block_size - offset % block_size);
+            IOBuffer block_buf;
+            st = block_cache->read(request->cache_key(), offset, size, &block_buf, &options);
+            buf.append(block_buf);
+            offset += size;
+        }
         if (st.ok()) {
             cntl->response_attachment().swap(buf.raw_buf());
         }
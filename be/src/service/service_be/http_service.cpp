@@ -182,6 +182,10 @@ Status HttpServiceBE::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "/pprof/symbol", symbol_action);
     _http_handlers.emplace_back(symbol_action);
 
+    auto* query_cpu_profile_action = new QueryCpuProfileAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_cpu_profile", query_cpu_profile_action);
+    _http_handlers.emplace_back(query_cpu_profile_action);
+
     auto* ioprofile_action = new IOProfileAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/ioprofile", ioprofile_action);
     _http_handlers.emplace_back(ioprofile_action);
@@ -18,6 +18,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/runtime_filter.h"
 #include "gutil/casts.h"
 #include "roaring/roaring.hh"
@@ -37,23 +38,22 @@ class ColumnInPredicate final : public ColumnPredicate {
 
 public:
     ColumnInPredicate(const TypeInfoPtr& type_info, ColumnId id, ItemSet values)
-            : ColumnPredicate(type_info, id), _values(std::move(values)) {}
+            : ColumnPredicate(type_info, id), _values(std::move(values)) {
+        _init_bitset();
+    }
 
     ~ColumnInPredicate() override = default;
 
     template <typename Op>
     inline void t_evaluate(const Column* column, uint8_t* sel, uint16_t from, uint16_t to) const {
-        auto* v = reinterpret_cast<const ValueType*>(column->raw_data());
-        if (!column->has_null()) {
-            for (size_t i = from; i < to; i++) {
-                sel[i] = Op::apply(sel[i], (uint8_t)(_values.contains(v[i])));
-            }
-        } else {
-            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
-            for (size_t i = from; i < to; i++) {
-                sel[i] = Op::apply(sel[i], (uint8_t)(!null_data[i] && _values.contains(v[i])));
+        if constexpr (can_use_bitset) {
+            if (_bitset != nullptr) {
+                _t_evaluate<Op>(column, sel, from, to,
+                                [&](const ValueType& v) { return _bitset->template contains<true>(v, true); });
+                return;
             }
         }
+        _t_evaluate<Op>(column, sel, from, to, [&](const ValueType& v) { return _values.contains(v); });
     }
 
     Status evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
@@ -72,25 +72,14 @@ public:
     }
 
     StatusOr<uint16_t> evaluate_branchless(const Column* column, uint16_t* sel, uint16_t sel_size) const override {
-        auto* v = reinterpret_cast<const ValueType*>(column->raw_data());
-
-        uint16_t new_size = 0;
-        if (!column->has_null()) {
-            for (uint16_t i = 0; i < sel_size; ++i) {
-                uint16_t data_idx = sel[i];
-                sel[new_size] = data_idx;
-                new_size += _values.contains(v[data_idx]);
-            }
-        } else {
-            /* must use uint8_t* to make vectorized effect */
-            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
-            for (uint16_t i = 0; i < sel_size; ++i) {
-                uint16_t data_idx = sel[i];
-                sel[new_size] = data_idx;
-                new_size += !null_data[data_idx] && _values.contains(v[data_idx]);
+        if constexpr (can_use_bitset) {
+            if (_bitset != nullptr) {
+                return _evaluate_branchless(column, sel, sel_size, [&](const ValueType& v) {
+                    return _bitset->template contains<true>(v, true);
+                });
             }
         }
-        return new_size;
+        return _evaluate_branchless(column, sel, sel_size, [&](const ValueType& v) { return _values.contains(v); });
     }
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override {
@@ -192,7 +181,65 @@ public:
     }
 
 private:
+    // the storage types of boolean and date are different from their runtime types
+    static constexpr bool can_use_bitset =
+            (lt_is_integer<field_type> || lt_is_decimal<field_type>) && sizeof(ValueType) <= sizeof(int64_t);
+
+    template <typename Op, typename Contains>
+    inline void _t_evaluate(const Column* column, uint8_t* sel, uint16_t from, uint16_t to,
+                            const Contains& contains) const {
+        auto* v = reinterpret_cast<const ValueType*>(column->raw_data());
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                sel[i] = Op::apply(sel[i], (uint8_t)(contains(v[i])));
+            }
+        } else {
+            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                sel[i] = Op::apply(sel[i], (uint8_t)(!null_data[i] && contains(v[i])));
+            }
+        }
+    }
+
+    template <typename Contains>
+    uint16_t _evaluate_branchless(const Column* column, uint16_t* sel, uint16_t sel_size,
+                                  const Contains& contains) const {
+        auto* v = reinterpret_cast<const ValueType*>(column->raw_data());
+
+        uint16_t new_size = 0;
+        if (!column->has_null()) {
+            for (uint16_t i = 0; i < sel_size; ++i) {
+                uint16_t data_idx = sel[i];
+                sel[new_size] = data_idx;
+                new_size += contains(v[data_idx]);
+            }
+        } else {
+            /* must use uint8_t* to make vectorized effect */
+            const uint8_t* null_data = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (uint16_t i = 0; i < sel_size; ++i) {
+                uint16_t data_idx = sel[i];
+                sel[new_size] = data_idx;
+                new_size += !null_data[data_idx] && contains(v[data_idx]);
+            }
+        }
+        return new_size;
+    }
+
+    // The same as VectorizedInConstPredicate, a long IN list of dense values is tested with a bitset.
+    void _init_bitset() {
+        if constexpr (can_use_bitset) {
+            if (_values.size() < config::in_predicate_bitset_min_values) {
+                return;
+            }
+            auto bitset = std::make_unique<Bitset<field_type>>();
+            if (bitset->init_for_in_list(_values)) {
+                _bitset = std::move(bitset);
+            }
+        }
+    }
+
     ItemSet _values;
+    std::unique_ptr<MaybeBitset<field_type>> _bitset;
 };
 
 // Template specialization for binary column
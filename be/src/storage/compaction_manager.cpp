@@ -252,6 +252,11 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
 
     int64_t last_failure_ts = 0;
     DataDir* data_dir = tablet->data_dir();
+    // when the disks are busy, e.g. with the queries at peak hours, hold off base compactions and stop the
+    // cumulative compactions from overrunning their per disk limit, they catch up when the disks are idle again
+    const bool io_busy = config::compaction_throttle_disk_io_util_percent > 0 &&
+                         StarRocksMetrics::instance()->max_disk_io_util_percent.value() >=
+                                 config::compaction_throttle_disk_io_util_percent;
     if (candidate.type == CUMULATIVE_COMPACTION) {
         std::shared_lock lk(tablet->get_cumulative_lock(), std::try_to_lock);
         if (!lk.owns_lock()) {
@@ -262,7 +267,7 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
         // allow overruns up to twice the configured limit
         uint16_t num = running_cumulative_tasks_num_for_dir(data_dir);
         if (config::cumulative_compaction_num_threads_per_disk > 0 &&
-            num >= config::cumulative_compaction_num_threads_per_disk * 2) {
+            num >= config::cumulative_compaction_num_threads_per_disk * (io_busy ? 1 : 2)) {
             VLOG(2) << "skip tablet:" << tablet->tablet_id()
                     << " for limit of cumulative compaction task per disk. disk path:" << data_dir->path()
                     << ", running num:" << num;
@@ -275,6 +280,11 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
             VLOG(2) << "skip tablet:" << tablet->tablet_id() << " for base lock";
             return false;
         }
+        if (io_busy) {
+            VLOG(2) << "skip tablet:" << tablet->tablet_id() << " for base compaction because disk io util "
+                    << StarRocksMetrics::instance()->max_disk_io_util_percent.value() << "% is too high";
+            return false;
+        }
         uint16_t num = running_base_tasks_num_for_dir(data_dir);
         if (config::base_compaction_num_threads_per_disk > 0 && num >= config::base_compaction_num_threads_per_disk) {
             VLOG(2) << "skip tablet:" << tablet->tablet_id()
@@ -35,6 +35,7 @@
 #include "storage/data_dir.h"
 
 #include <filesystem>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <utility>
@@ -58,6 +59,7 @@
 #include "util/defer_op.h"
 #include "util/errno.h"
 #include "util/monotime.h"
+#include "util/threadpool.h"
 #include "util/string_util.h"
 
 using strings::Substitute;
@@ -277,10 +279,12 @@ void DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_mutex;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mutex](int64_t tablet_id, int32_t schema_hash,
+                                                                                  std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_mutex);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -294,10 +298,59 @@ void DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // Deserializing the metas and initializing the tablets cost much more than scanning rocksdb, so the scanned metas
+    // are handed to a pool in batches. Tablets of different shards are loaded concurrently by TabletManager.
+    std::unique_ptr<ThreadPool> load_pool;
+    if (config::load_tablet_threads_per_data_dir > 1) {
+        auto st = ThreadPoolBuilder("load_tablet")
+                          .set_min_threads(1)
+                          .set_max_threads(config::load_tablet_threads_per_data_dir)
+                          .build(&load_pool);
+        LOG_IF(WARNING, !st.ok()) << "failed to create load tablet pool, load tablets serially: " << st;
+    }
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    constexpr size_t kLoadBatchSize = 64;
+    auto batch = std::make_shared<std::vector<TabletMetaEntry>>();
+    auto flush_batch = [&]() {
+        if (batch->empty()) {
+            return;
+        }
+        auto task = [batch, &load_tablet]() {
+            for (const auto& entry : *batch) {
+                load_tablet(entry.tablet_id, entry.schema_hash, entry.value);
+            }
+        };
+        if (!load_pool->submit_func(task).ok()) {
+            task();
+        }
+        batch = std::make_shared<std::vector<TabletMetaEntry>>();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        if (load_pool == nullptr) {
+            load_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        batch->push_back(TabletMetaEntry{tablet_id, schema_hash, std::string(value)});
+        if (batch->size() >= kLoadBatchSize) {
+            flush_batch();
+        }
         return true;
     };
+    auto wait_loading = [&]() {
+        if (load_pool != nullptr) {
+            flush_batch();
+            load_pool->wait();
+        }
+    };
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    wait_loading();
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -317,6 +370,10 @@ void DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        wait_loading();
+    }
+    if (load_pool != nullptr) {
+        load_pool->shutdown();
     }
 
     if (failed_tablet_ids.size() != 0) {
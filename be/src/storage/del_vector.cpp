@@ -39,6 +39,7 @@ void DelVector::_add_dels(const std::vector<uint32_t>& dels) {
     } else {
         _roaring->addMany(dels.size(), dels.data());
     }
+    _optimize();
     _update_stats();
 }
 
@@ -68,6 +69,7 @@ Status DelVector::load(int64_t version, const char* data, size_t length) {
     _version = version;
     if (length > 0) {
         _roaring = std::make_unique<Roaring>(Roaring::readSafe(data, length));
+        _optimize();
     }
     _update_stats();
     return Status::OK();
@@ -78,6 +80,7 @@ void DelVector::init(int64_t version, const uint32_t* data, size_t length) {
     _version = version;
     if (length > 0) {
         _roaring = std::make_unique<Roaring>(length, data);
+        _optimize();
     }
     _update_stats();
 }
@@ -106,6 +109,14 @@ string DelVector::to_string() const {
     return strings::Substitute("version:$0 $1", _version, _roaring ? _roaring->toString() : string("null"));
 }
 
+void DelVector::_optimize() {
+    // The deletes of upserts and compactions are mostly runs of row ids, which a run container keeps in a few bytes
+    // instead of an array or a bitset, both in memory and in the serialized bitmap.
+    if (_roaring->runOptimize()) {
+        _roaring->shrinkToFit();
+    }
+}
+
 void DelVector::_update_stats() {
     // TODO(cbl): optimization
     if (_roaring) {
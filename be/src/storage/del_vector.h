@@ -66,6 +66,9 @@ public:
 private:
     void _add_dels(const std::vector<uint32_t>& dels);
 
+    // convert the containers of runs to run containers
+    void _optimize();
+
     void _update_stats();
 
     bool _loaded = false;
@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/flat_json_access_stats.h"
+
+#include <algorithm>
+
+#include "column/column_access_path.h"
+#include "common/config.h"
+
+namespace starrocks {
+
+FlatJsonAccessStats* FlatJsonAccessStats::instance() {
+    static FlatJsonAccessStats s_instance;
+    return &s_instance;
+}
+
+void FlatJsonAccessStats::record(int64_t tablet_id, ColumnAccessPath* path) {
+    if (path->children().empty()) {
+        // access the whole json
+        return;
+    }
+    std::vector<ColumnAccessPath*> leafs;
+    path->get_all_leafs(&leafs);
+
+    const auto& column = path->absolute_path();
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _tablets.find(tablet_id);
+    if (iter == _tablets.end()) {
+        if (_tablets.size() >= kMaxTablets) {
+            return;
+        }
+        iter = _tablets.emplace(tablet_id, TabletStats()).first;
+    }
+    auto& paths = iter->second[column];
+    for (const auto* leaf : leafs) {
+        // use absolute path and remove the column name, same as the json column reader
+        if (leaf->absolute_path().size() <= column.size() + 1) {
+            continue;
+        }
+        auto sub_path = leaf->absolute_path().substr(column.size() + 1);
+        auto stat_iter = paths.find(sub_path);
+        if (stat_iter == paths.end()) {
+            if (paths.size() >= kMaxPathsPerColumn) {
+                continue;
+            }
+            stat_iter = paths.emplace(std::move(sub_path), PathStat()).first;
+        }
+        stat_iter->second.type = leaf->value_type().type;
+        stat_iter->second.hits++;
+    }
+}
+
+std::vector<std::pair<std::string, LogicalType>> FlatJsonAccessStats::hot_paths(int64_t tablet_id,
+                                                                                const std::string& column) const {
+    std::vector<std::pair<std::string, PathStat>> hot;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto iter = _tablets.find(tablet_id);
+        if (iter == _tablets.end()) {
+            return {};
+        }
+        auto column_iter = iter->second.find(column);
+        if (column_iter == iter->second.end()) {
+            return {};
+        }
+        for (const auto& [path, stat] : column_iter->second) {
+            if (stat.hits >= config::json_flat_hot_path_min_access) {
+                hot.emplace_back(path, stat);
+            }
+        }
+    }
+    std::sort(hot.begin(), hot.end(), [](const auto& a, const auto& b) {
+        return a.second.hits != b.second.hits ? a.second.hits > b.second.hits : a.first < b.first;
+    });
+
+    std::vector<std::pair<std::string, LogicalType>> result;
+    result.reserve(hot.size());
+    for (auto& [path, stat] : hot) {
+        result.emplace_back(std::move(path), stat.type);
+    }
+    return result;
+}
+
+void FlatJsonAccessStats::erase(int64_t tablet_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _tablets.erase(tablet_id);
+}
+
+void FlatJsonAccessStats::clear() {
+    std::lock_guard<std::mutex> l(_mutex);
+    _tablets.clear();
+}
+
+} // namespace starrocks
@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types/logical_type.h"
+
+namespace starrocks {
+
+class ColumnAccessPath;
+
+// Records the json sub paths accessed by queries on each tablet. The compaction flattens the hot paths into
+// typed sub columns even if they are sparse in the data, so that the queries on them skip parsing the remain json.
+// The stats are in memory only, they are rebuilt by the queries after restart.
+class FlatJsonAccessStats {
+public:
+    // the max number of recorded tablets and paths of a json column, the new ones are ignored when reached
+    static constexpr size_t kMaxTablets = 65536;
+    static constexpr size_t kMaxPathsPerColumn = 256;
+
+    static FlatJsonAccessStats* instance();
+
+    // record the json leaf paths in `path`, whose root is a json column of the tablet
+    void record(int64_t tablet_id, ColumnAccessPath* path);
+
+    // return the paths of the json column accessed at least config::json_flat_hot_path_min_access times,
+    // and the value types the queries read them as, sorted by the access count in descending order.
+    std::vector<std::pair<std::string, LogicalType>> hot_paths(int64_t tablet_id, const std::string& column) const;
+
+    void erase(int64_t tablet_id);
+
+    void clear();
+
+private:
+    struct PathStat {
+        LogicalType type = TYPE_JSON;
+        int64_t hits = 0;
+    };
+    // column name -> json path -> stat
+    using TabletStats = std::unordered_map<std::string, std::unordered_map<std::string, PathStat>>;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<int64_t, TabletStats> _tablets;
+};
+
+} // namespace starrocks
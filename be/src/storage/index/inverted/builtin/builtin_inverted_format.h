@@ -0,0 +1,43 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace starrocks {
+
+// The builtin inverted index keeps everything of a segment index in one file inside the ".ivt" directory:
+//
+//   posting lists | term blocks | block index | null bitmap | footer
+//
+// - posting lists: the portable serialized roaring bitmap of every term, in term order.
+// - term blocks:   every BUILTIN_INVERTED_BLOCK_TERMS sorted terms form a block, an entry is
+//                  varint32 shared prefix size | varint32 suffix size | suffix | varint32 posting size.
+//                  Postings are contiguous in term order, so the offset of a posting is the offset of the
+//                  previous one plus its size.
+// - block index:   per block, varint32 first term size | first term | varint64 block offset | varint32 block size |
+//                  varint64 offset of the first posting in the block.
+// - null bitmap:   the portable serialized roaring bitmap of the null rows.
+// - footer:        fixed64 block index offset | fixed32 block index size | fixed64 null bitmap offset |
+//                  fixed32 null bitmap size | fixed32 number of terms | fixed32 version | fixed32 magic.
+const std::string BUILTIN_INVERTED_INDEX_FILE_NAME = "builtin.inv";
+constexpr uint32_t BUILTIN_INVERTED_BLOCK_TERMS = 64;
+constexpr uint32_t BUILTIN_INVERTED_VERSION = 1;
+constexpr uint32_t BUILTIN_INVERTED_MAGIC = 0x56494253; // "SBIV"
+constexpr uint32_t BUILTIN_INVERTED_FOOTER_SIZE = 8 + 4 + 8 + 4 + 4 + 4 + 4;
+
+} // namespace starrocks
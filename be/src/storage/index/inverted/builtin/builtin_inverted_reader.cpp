@@ -0,0 +1,303 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/index/inverted/builtin/builtin_inverted_reader.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "storage/index/inverted/builtin/builtin_inverted_format.h"
+#include "storage/index/inverted/inverted_index_iterator.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/raw_container.h"
+#include "util/utf8.h"
+
+namespace starrocks {
+
+// Posting lists closer than this are read with one IO.
+static constexpr uint64_t kMaxPostingReadGap = 64 * 1024;
+
+Status BuiltinInvertedReader::create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                                     LogicalType field_type, std::unique_ptr<InvertedReader>* res) {
+    if (!is_string_type(field_type)) {
+        return Status::InvalidArgument(fmt::format("Not supported type {}", field_type));
+    }
+    *res = std::make_unique<BuiltinInvertedReader>(path, tablet_index->index_id());
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::new_iterator(const std::shared_ptr<TabletIndex> index_meta,
+                                           InvertedIndexIterator** iterator) {
+    *iterator = new InvertedIndexIterator(index_meta, this);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_load() {
+    std::string path = fmt::format("{}/{}", _index_path, BUILTIN_INVERTED_INDEX_FILE_NAME);
+    ASSIGN_OR_RETURN(_file, FileSystem::Default()->new_random_access_file(path));
+    ASSIGN_OR_RETURN(auto file_size, _file->get_size());
+    if (file_size < BUILTIN_INVERTED_FOOTER_SIZE) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: file size {}", path, file_size));
+    }
+
+    uint8_t footer[BUILTIN_INVERTED_FOOTER_SIZE];
+    RETURN_IF_ERROR(_file->read_at_fully(file_size - BUILTIN_INVERTED_FOOTER_SIZE, footer, sizeof(footer)));
+    const uint64_t block_index_offset = decode_fixed64_le(footer);
+    const uint32_t block_index_size = decode_fixed32_le(footer + 8);
+    const uint64_t null_bitmap_offset = decode_fixed64_le(footer + 12);
+    const uint32_t null_bitmap_size = decode_fixed32_le(footer + 20);
+    _num_terms = decode_fixed32_le(footer + 24);
+    const uint32_t version = decode_fixed32_le(footer + 28);
+    const uint32_t magic = decode_fixed32_le(footer + 32);
+    if (magic != BUILTIN_INVERTED_MAGIC || version != BUILTIN_INVERTED_VERSION ||
+        null_bitmap_offset + null_bitmap_size + BUILTIN_INVERTED_FOOTER_SIZE != file_size ||
+        block_index_offset + block_index_size != null_bitmap_offset) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: magic {} version {}", path, magic,
+                                              version));
+    }
+
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, std::max(block_index_size, null_bitmap_size));
+    RETURN_IF_ERROR(_file->read_at_fully(block_index_offset, buf.data(), block_index_size));
+    Slice input(buf.data(), block_index_size);
+    _blocks.clear();
+    while (!input.empty()) {
+        BlockMeta block;
+        Slice first_term;
+        if (!get_length_prefixed_slice(&input, &first_term) || !get_varint64(&input, &block.offset) ||
+            !get_varint32(&input, &block.size) || !get_varint64(&input, &block.posting_offset)) {
+            return Status::Corruption(fmt::format("Bad block index of builtin inverted index file {}", path));
+        }
+        block.first_term = first_term.to_string();
+        _blocks.emplace_back(std::move(block));
+    }
+
+    RETURN_IF_ERROR(_file->read_at_fully(null_bitmap_offset, buf.data(), null_bitmap_size));
+    _null_bitmap = roaring::Roaring::read(buf.data(), true);
+    return Status::OK();
+}
+
+size_t BuiltinInvertedReader::_seek_block(const Slice& term) const {
+    auto it = std::upper_bound(_blocks.begin(), _blocks.end(), term,
+                               [](const Slice& t, const BlockMeta& block) { return t.compare(block.first_term) < 0; });
+    return it == _blocks.begin() ? 0 : it - _blocks.begin() - 1;
+}
+
+template <class Visitor>
+Status BuiltinInvertedReader::_visit_terms(size_t block_idx, Visitor&& visitor) const {
+    std::string buf;
+    std::string term;
+    for (size_t b = block_idx; b < _blocks.size(); b++) {
+        const BlockMeta& block = _blocks[b];
+        raw::stl_string_resize_uninitialized(&buf, block.size);
+        RETURN_IF_ERROR(_file->read_at_fully(block.offset, buf.data(), block.size));
+        Slice input(buf);
+        uint64_t posting_offset = block.posting_offset;
+        while (!input.empty()) {
+            uint32_t shared = 0;
+            uint32_t suffix = 0;
+            uint32_t posting_size = 0;
+            if (!get_varint32(&input, &shared) || !get_varint32(&input, &suffix) || shared > term.size() ||
+                input.size < suffix) {
+                return Status::Corruption(fmt::format("Bad term block of builtin inverted index {}", _index_path));
+            }
+            term.resize(shared);
+            term.append(input.data, suffix);
+            input.remove_prefix(suffix);
+            if (!get_varint32(&input, &posting_size)) {
+                return Status::Corruption(fmt::format("Bad term block of builtin inverted index {}", _index_path));
+            }
+            if (!visitor(Slice(term), PostingLocation{posting_offset, posting_size})) {
+                return Status::OK();
+            }
+            posting_offset += posting_size;
+        }
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_read_postings(const std::vector<PostingLocation>& locations,
+                                             roaring::Roaring* result) const {
+    std::vector<roaring::Roaring> postings;
+    postings.reserve(locations.size());
+    std::string buf;
+    size_t begin = 0;
+    while (begin < locations.size()) {
+        size_t end = begin + 1;
+        uint64_t read_end = locations[begin].offset + locations[begin].size;
+        while (end < locations.size() && locations[end].offset <= read_end + kMaxPostingReadGap) {
+            read_end = locations[end].offset + locations[end].size;
+            end++;
+        }
+        const uint64_t read_offset = locations[begin].offset;
+        raw::stl_string_resize_uninitialized(&buf, read_end - read_offset);
+        RETURN_IF_ERROR(_file->read_at_fully(read_offset, buf.data(), buf.size()));
+        for (size_t i = begin; i < end; i++) {
+            postings.emplace_back(roaring::Roaring::read(buf.data() + (locations[i].offset - read_offset), true));
+        }
+        begin = end;
+    }
+
+    if (postings.size() == 1) {
+        result->swap(postings[0]);
+    } else if (postings.size() > 1) {
+        std::vector<const roaring::Roaring*> inputs;
+        inputs.reserve(postings.size());
+        for (const auto& posting : postings) {
+            inputs.push_back(&posting);
+        }
+        *result = roaring::Roaring::fastunion(inputs.size(), inputs.data());
+    }
+    return Status::OK();
+}
+
+bool BuiltinInvertedReader::wildcard_match(const Slice& pattern, const Slice& value) {
+    auto char_size = [&](size_t pos) {
+        return std::min<size_t>(UTF8_BYTE_LENGTH_TABLE[static_cast<uint8_t>(value.data[pos])], value.size - pos);
+    };
+    size_t p = 0;
+    size_t v = 0;
+    size_t star_p = std::string::npos;
+    size_t star_v = 0;
+    while (v < value.size) {
+        if (p < pattern.size) {
+            char c = pattern.data[p];
+            if (c == '%' || c == '*') {
+                star_p = ++p;
+                star_v = v;
+                continue;
+            }
+            if (c == '_' || c == '?') {
+                p++;
+                v += char_size(v);
+                continue;
+            }
+            size_t literal_size = 1;
+            if (c == '\\' && p + 1 < pattern.size) {
+                c = pattern.data[p + 1];
+                literal_size = 2;
+            }
+            if (c == value.data[v]) {
+                p += literal_size;
+                v++;
+                continue;
+            }
+        }
+        if (star_p == std::string::npos) {
+            return false;
+        }
+        // let the last '%' take one more character and retry
+        star_v += char_size(star_v);
+        p = star_p;
+        v = star_v;
+    }
+    while (p < pattern.size && (pattern.data[p] == '%' || pattern.data[p] == '*')) {
+        p++;
+    }
+    return p == pattern.size;
+}
+
+Status BuiltinInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
+                                    const void* query_value, InvertedIndexQueryType query_type,
+                                    roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(success_once(_load_once, [this]() { return _load(); }).status());
+    const auto* search_query = reinterpret_cast<const Slice*>(query_value);
+    const Slice value(search_query->data, strnlen(search_query->data, search_query->size));
+
+    std::vector<PostingLocation> locations;
+    switch (query_type) {
+    case InvertedIndexQueryType::MATCH_ALL_QUERY:
+    case InvertedIndexQueryType::EQUAL_QUERY:
+        RETURN_IF_ERROR(_visit_terms(_seek_block(value), [&](const Slice& term, const PostingLocation& location) {
+            int cmp = term.compare(value);
+            if (cmp == 0) {
+                locations.push_back(location);
+            }
+            return cmp < 0;
+        }));
+        break;
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY: {
+        const bool inclusive = query_type == InvertedIndexQueryType::LESS_EQUAL_QUERY;
+        RETURN_IF_ERROR(_visit_terms(0, [&](const Slice& term, const PostingLocation& location) {
+            int cmp = term.compare(value);
+            if (cmp < 0 || (inclusive && cmp == 0)) {
+                locations.push_back(location);
+                return true;
+            }
+            return false;
+        }));
+        break;
+    }
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY: {
+        const bool inclusive = query_type == InvertedIndexQueryType::GREATER_EQUAL_QUERY;
+        RETURN_IF_ERROR(_visit_terms(_seek_block(value), [&](const Slice& term, const PostingLocation& location) {
+            int cmp = term.compare(value);
+            if (cmp > 0 || (inclusive && cmp == 0)) {
+                locations.push_back(location);
+            }
+            return true;
+        }));
+        break;
+    }
+    case InvertedIndexQueryType::MATCH_WILDCARD_QUERY: {
+        // only the terms starting with the literal prefix of the pattern can match
+        std::string prefix;
+        for (size_t i = 0; i < value.size; i++) {
+            char c = value.data[i];
+            if (c == '%' || c == '*' || c == '_' || c == '?') {
+                break;
+            }
+            if (c == '\\') {
+                if (++i == value.size) {
+                    break;
+                }
+                c = value.data[i];
+            }
+            prefix.push_back(c);
+        }
+        RETURN_IF_ERROR(_visit_terms(_seek_block(prefix), [&](const Slice& term, const PostingLocation& location) {
+            if (!term.starts_with(prefix)) {
+                return term.compare(prefix) < 0;
+            }
+            if (wildcard_match(value, term)) {
+                locations.push_back(location);
+            }
+            return true;
+        }));
+        break;
+    }
+    default:
+        return Status::InvalidArgument("Unknown query type");
+    }
+
+    roaring::Roaring result;
+    RETURN_IF_ERROR(_read_postings(locations, &result));
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::query_null(OlapReaderStatistics* stats, const std::string& column_name,
+                                         roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(success_once(_load_once, [this]() { return _load(); }).status());
+    *bit_map = _null_bitmap;
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <roaring/roaring.hh>
+#include <string>
+#include <vector>
+
+#include "fs/fs.h"
+#include "storage/index/inverted/inverted_reader.h"
+#include "util/once.h"
+
+namespace starrocks {
+
+// Reads the builtin inverted index written by BuiltinInvertedWriter. The block index and the null bitmap are
+// loaded on the first query and kept in memory, a query reads the term blocks it needs and the posting lists of
+// the matched terms. Posting lists of adjacent matched terms are read with one IO.
+//
+// The query value is matched against the terms as is, MATCH_WILDCARD_QUERY treats '%' and '*' as any sequence
+// and '_' and '?' as any single character, '\' escapes the next character.
+class BuiltinInvertedReader : public InvertedReader {
+public:
+    BuiltinInvertedReader(std::string path, uint32_t index_id) : InvertedReader(std::move(path), index_id) {}
+
+    static Status create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                         LogicalType field_type, std::unique_ptr<InvertedReader>* res);
+
+    Status new_iterator(const std::shared_ptr<TabletIndex> index_meta, InvertedIndexIterator** iterator) override;
+
+    Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
+                 InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
+
+    Status query_null(OlapReaderStatistics* stats, const std::string& column_name, roaring::Roaring* bit_map) override;
+
+    InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::TEXT; }
+
+    static bool wildcard_match(const Slice& pattern, const Slice& value);
+
+private:
+    struct BlockMeta {
+        std::string first_term;
+        uint64_t offset;
+        uint32_t size;
+        uint64_t posting_offset;
+    };
+
+    struct PostingLocation {
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    Status _load();
+
+    // Index of the last block whose first term is not greater than |term|, 0 if there is no such block.
+    size_t _seek_block(const Slice& term) const;
+
+    // Visit the terms in order from the block |block_idx|, until all terms are visited or |visitor| returns false.
+    // |visitor| is called with the term and the location of its posting list.
+    template <class Visitor>
+    Status _visit_terms(size_t block_idx, Visitor&& visitor) const;
+
+    Status _read_postings(const std::vector<PostingLocation>& locations, roaring::Roaring* result) const;
+
+    OnceFlag _load_once;
+    std::unique_ptr<RandomAccessFile> _file;
+    std::vector<BlockMeta> _blocks;
+    roaring::Roaring _null_bitmap;
+    uint32_t _num_terms = 0;
+};
+
+} // namespace starrocks
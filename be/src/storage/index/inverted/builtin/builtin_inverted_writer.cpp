@@ -0,0 +1,200 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/index/inverted/builtin/builtin_inverted_writer.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gutil/strings/substitute.h"
+#include "storage/index/inverted/builtin/builtin_inverted_format.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// Flush the serialized posting lists into the file once they exceed this size.
+static constexpr size_t kPostingFlushBytes = 1024 * 1024;
+
+Status BuiltinInvertedWriter::create(const TypeInfoPtr& typeinfo, const std::string& field_name,
+                                     const std::string& directory, TabletIndex* tablet_index,
+                                     std::unique_ptr<InvertedWriter>* res) {
+    LogicalType type = typeinfo->type();
+    if (type != LogicalType::TYPE_CHAR && type != LogicalType::TYPE_VARCHAR) {
+        return Status::NotSupported(
+                strings::Substitute("Unsupported type for builtin inverted index: $0", type_to_string_v2(type)));
+    }
+    InvertedIndexParserType parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type == InvertedIndexParserType::PARSER_CHINESE) {
+        return Status::NotSupported("Chinese parser is not supported by builtin inverted index");
+    }
+    *res = std::make_unique<BuiltinInvertedWriter>(directory, parser_type);
+    return Status::OK();
+}
+
+Status BuiltinInvertedWriter::init() {
+    return Status::OK();
+}
+
+void BuiltinInvertedWriter::tokenize(const Slice& value, InvertedIndexParserType parser_type,
+                                     std::vector<std::string>* terms) {
+    if (parser_type == InvertedIndexParserType::PARSER_NONE) {
+        terms->emplace_back(value.data, value.size);
+        return;
+    }
+    std::string term;
+    for (size_t i = 0; i < value.size; i++) {
+        auto c = static_cast<unsigned char>(value.data[i]);
+        if (c >= 0x80 || isalnum(c)) {
+            term.push_back(static_cast<char>(c < 0x80 ? tolower(c) : c));
+        } else if (!term.empty()) {
+            terms->emplace_back(std::move(term));
+            term.clear();
+        }
+    }
+    if (!term.empty()) {
+        terms->emplace_back(std::move(term));
+    }
+}
+
+void BuiltinInvertedWriter::add_values(const void* values, size_t count) {
+    const auto* slices = reinterpret_cast<const Slice*>(values);
+    for (size_t i = 0; i < count; i++) {
+        _terms.clear();
+        tokenize(slices[i], _parser_type, &_terms);
+        for (auto& term : _terms) {
+            auto [it, inserted] = _postings.try_emplace(std::move(term));
+            if (inserted) {
+                _mem_usage += it->first.size() + sizeof(std::string) + sizeof(roaring::Roaring);
+            }
+            it->second.add(_rid);
+            // a row usually takes two bytes in the array container of a roaring bitmap
+            _mem_usage += sizeof(uint16_t);
+        }
+        _rid++;
+    }
+}
+
+void BuiltinInvertedWriter::add_nulls(uint32_t count) {
+    _null_bitmap.addRange(_rid, _rid + count);
+    _rid += count;
+}
+
+Status BuiltinInvertedWriter::finish() {
+    std::vector<std::pair<const std::string*, roaring::Roaring*>> postings;
+    postings.reserve(_postings.size());
+    for (auto& [term, posting] : _postings) {
+        postings.emplace_back(&term, &posting);
+    }
+    std::sort(postings.begin(), postings.end(), [](const auto& a, const auto& b) { return *a.first < *b.first; });
+
+    // The posting lists go first, their total size is needed to locate the term blocks.
+    std::vector<uint32_t> posting_sizes(postings.size());
+    uint64_t postings_size = 0;
+    for (size_t i = 0; i < postings.size(); i++) {
+        postings[i].second->runOptimize();
+        posting_sizes[i] = postings[i].second->getSizeInBytes(true);
+        postings_size += posting_sizes[i];
+    }
+
+    // Every BUILTIN_INVERTED_BLOCK_TERMS terms form a block, the terms in a block share prefixes with the previous
+    // term, and the block index records the first term of every block.
+    faststring blocks;
+    faststring block_index;
+    size_t block_start = 0;
+    std::string block_first_term;
+    uint64_t block_posting_offset = 0;
+    auto finish_block = [&]() {
+        put_varint32(&block_index, block_first_term.size());
+        block_index.append(block_first_term);
+        put_varint64(&block_index, postings_size + block_start);
+        put_varint32(&block_index, blocks.size() - block_start);
+        put_varint64(&block_index, block_posting_offset);
+    };
+    uint64_t posting_offset = 0;
+    for (size_t i = 0; i < postings.size(); i++) {
+        const std::string& term = *postings[i].first;
+        size_t shared = 0;
+        if (i % BUILTIN_INVERTED_BLOCK_TERMS == 0) {
+            if (i > 0) {
+                finish_block();
+            }
+            block_start = blocks.size();
+            block_first_term = term;
+            block_posting_offset = posting_offset;
+        } else {
+            const std::string& prev = *postings[i - 1].first;
+            size_t limit = std::min(prev.size(), term.size());
+            while (shared < limit && prev[shared] == term[shared]) {
+                shared++;
+            }
+        }
+        put_varint32(&blocks, shared);
+        put_varint32(&blocks, term.size() - shared);
+        blocks.append(term.data() + shared, term.size() - shared);
+        put_varint32(&blocks, posting_sizes[i]);
+        posting_offset += posting_sizes[i];
+    }
+    if (!postings.empty()) {
+        finish_block();
+    }
+
+    RETURN_IF_ERROR(fs::create_directories(_directory));
+    std::string path = fmt::format("{}/{}", _directory, BUILTIN_INVERTED_INDEX_FILE_NAME);
+    ASSIGN_OR_RETURN(auto wfile, FileSystem::Default()->new_writable_file(path));
+
+    faststring buf;
+    for (size_t i = 0; i < postings.size(); i++) {
+        size_t old_size = buf.size();
+        buf.resize(old_size + posting_sizes[i]);
+        postings[i].second->write(reinterpret_cast<char*>(buf.data() + old_size), true);
+        if (buf.size() >= kPostingFlushBytes) {
+            RETURN_IF_ERROR(wfile->append(Slice(buf.data(), buf.size())));
+            buf.clear();
+        }
+    }
+    RETURN_IF_ERROR(wfile->append(Slice(buf.data(), buf.size())));
+    _postings.clear();
+
+    _null_bitmap.runOptimize();
+    buf.resize(_null_bitmap.getSizeInBytes(true));
+    _null_bitmap.write(reinterpret_cast<char*>(buf.data()), true);
+
+    const uint64_t block_index_offset = postings_size + blocks.size();
+    const uint64_t null_bitmap_offset = block_index_offset + block_index.size();
+    faststring footer;
+    put_fixed64_le(&footer, block_index_offset);
+    put_fixed32_le(&footer, block_index.size());
+    put_fixed64_le(&footer, null_bitmap_offset);
+    put_fixed32_le(&footer, buf.size());
+    put_fixed32_le(&footer, postings.size());
+    put_fixed32_le(&footer, BUILTIN_INVERTED_VERSION);
+    put_fixed32_le(&footer, BUILTIN_INVERTED_MAGIC);
+    DCHECK_EQ(BUILTIN_INVERTED_FOOTER_SIZE, footer.size());
+
+    Slice slices[] = {Slice(blocks.data(), blocks.size()), Slice(block_index.data(), block_index.size()),
+                      Slice(buf.data(), buf.size()), Slice(footer.data(), footer.size())};
+    RETURN_IF_ERROR(wfile->appendv(slices, std::size(slices)));
+    return wfile->close();
+}
+
+} // namespace starrocks
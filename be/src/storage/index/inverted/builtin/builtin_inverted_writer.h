@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <roaring/roaring.hh>
+#include <string>
+#include <vector>
+
+#include "storage/index/inverted/inverted_index_option.h"
+#include "storage/index/inverted/inverted_writer.h"
+#include "storage/olap_common.h"
+#include "storage/tablet_schema.h"
+#include "util/phmap/phmap.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// Builds the builtin inverted index of a segment column, see builtin_inverted_format.h for the file layout.
+// The terms and their posting lists are kept in memory and written out sorted in finish().
+class BuiltinInvertedWriter : public InvertedWriter {
+public:
+    BuiltinInvertedWriter(std::string directory, InvertedIndexParserType parser_type)
+            : _directory(std::move(directory)), _parser_type(parser_type) {}
+
+    ~BuiltinInvertedWriter() override = default;
+
+    static Status create(const TypeInfoPtr& typeinfo, const std::string& field_name, const std::string& directory,
+                         TabletIndex* tablet_index, std::unique_ptr<InvertedWriter>* res);
+
+    Status init() override;
+
+    void add_values(const void* values, size_t count) override;
+
+    void add_nulls(uint32_t count) override;
+
+    Status finish() override;
+
+    uint64_t size() const override { return _rid; }
+
+    uint64_t estimate_buffer_size() const override { return _mem_usage; }
+
+    uint64_t total_mem_footprint() const override { return _mem_usage; }
+
+    // Split |value| into terms by |parser_type| and append them into |terms|.
+    // PARSER_NONE keeps the whole value as one term, the other parsers split the value at the ASCII characters
+    // which are neither letters nor digits and lower case the ASCII letters. Bytes of multi-byte UTF-8 characters
+    // are always part of a term.
+    static void tokenize(const Slice& value, InvertedIndexParserType parser_type, std::vector<std::string>* terms);
+
+private:
+    std::string _directory;
+    InvertedIndexParserType _parser_type;
+    rowid_t _rid = 0;
+    roaring::Roaring _null_bitmap;
+    phmap::flat_hash_map<std::string, roaring::Roaring> _postings;
+    std::vector<std::string> _terms;
+    uint64_t _mem_usage = 0;
+};
+
+} // namespace starrocks
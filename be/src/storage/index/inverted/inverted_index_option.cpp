@@ -22,8 +22,11 @@ StatusOr<InvertedImplementType> get_inverted_imp_type(const TabletIndex& tablet_
     auto inverted_imp_prop = tablet_index.common_properties().find(INVERTED_IMP_KEY);
     if (inverted_imp_prop != tablet_index.common_properties().end()) {
         const auto& imp_type = inverted_imp_prop->second;
-        if (boost::algorithm::to_lower_copy(imp_type) == TYPE_CLUCENE) {
+        auto lower_imp_type = boost::algorithm::to_lower_copy(imp_type);
+        if (lower_imp_type == TYPE_CLUCENE) {
             return InvertedImplementType::CLUCENE;
+        } else if (lower_imp_type == TYPE_BUILTIN) {
+            return InvertedImplementType::BUILTIN;
         } else {
             return Status::InvalidArgument("Do not support imp_type : " + imp_type);
         }
@@ -35,17 +35,29 @@
 #ifdef WITH_TENANN
 #include "storage/index/vector/tenann/del_id_filter.h"
 
+#include <algorithm>
+
 #include "storage/range.h"
-#include "storage/roaring2range.h"
 #include "tenann/common/type_traits.h"
 #include "tenann/searcher/id_filter.h"
 
 namespace starrocks {
 
-DelIdFilter::DelIdFilter(const SparseRange<>& scan_range) : _row_bitmap(range2roaring(scan_range)) {}
+DelIdFilter::DelIdFilter(const SparseRange<>& scan_range) {
+    rowid_t num_rows = 0;
+    for (size_t i = 0; i < scan_range.size(); i++) {
+        num_rows = std::max(num_rows, scan_range[i].end());
+    }
+    _bits.resize((num_rows + 63) / 64, 0);
+    for (size_t i = 0; i < scan_range.size(); i++) {
+        for (rowid_t id = scan_range[i].begin(); id < scan_range[i].end(); id++) {
+            _bits[id >> 6] |= 1ULL << (id & 63);
+        }
+    }
+}
 
 bool DelIdFilter::IsMember(tenann::idx_t id) const {
-    return _row_bitmap.contains(id);
+    return id >= 0 && static_cast<size_t>(id >> 6) < _bits.size() && ((_bits[id >> 6] >> (id & 63)) & 1);
 }
 
 } // namespace starrocks
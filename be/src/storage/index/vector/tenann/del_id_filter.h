@@ -35,6 +35,8 @@
 #pragma once
 
 #ifdef WITH_TENANN
+#include <vector>
+
 #include "storage/del_vector.h"
 #include "storage/range.h"
 #include "tenann/common/type_traits.h"
@@ -42,6 +44,8 @@
 
 namespace starrocks {
 
+// Allow-list of the rows left by the other indexes and the delete vector. It's probed for every candidate visited
+// by the ANN search, so the rows are kept in a dense bitset to make IsMember a single memory access.
 class DelIdFilter final : public tenann::IdFilter {
 public:
     explicit DelIdFilter(const SparseRange<>& scan_range);
@@ -50,7 +54,7 @@ public:
     bool IsMember(tenann::idx_t id) const override;
 
 private:
-    Roaring _row_bitmap;
+    std::vector<uint64_t> _bits;
 };
 
 } // namespace starrocks
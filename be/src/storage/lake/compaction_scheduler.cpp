@@ -24,6 +24,7 @@
 
 #include "agent/master_info.h"
 #include "common/status.h"
+#include "fs/bundle_file.h"
 #include "fs/fs.h"
 #include "fs/key_cache.h"
 #include "gen_cpp/FrontendService.h"
@@ -139,6 +140,11 @@ void CompactionTaskCallback::finish_task(std::unique_ptr<CompactionTaskContext>&
     //                     ^^^^^^^^^^^^^^^^^ Do NOT touch "context" since here, it has been `move`ed.
 
     if (_contexts.size() == _request->tablet_ids_size()) { // All tasks finished, send RPC response to FE
+        // The bundle data files must be complete before the txn logs referencing them are returned.
+        for (auto& [root_location, bundle_file_context] : _bundle_file_contexts) {
+            _status.update(bundle_file_context->decrease_active_writers());
+        }
+        _bundle_file_contexts.clear();
         _status.to_protobuf(_response->mutable_status());
         _response->set_success_compaction_input_file_size(_success_compaction_input_file_size);
         if (_done != nullptr) {
@@ -158,6 +164,20 @@ void CompactionTaskCallback::finish_task(std::unique_ptr<CompactionTaskContext>&
     }
 }
 
+BundleWritableFileContext* CompactionTaskCallback::bundle_file_context(const std::string& root_location) {
+    std::lock_guard l(_mtx);
+    if (_request == nullptr || _request->tablet_ids_size() <= 1) {
+        return nullptr;
+    }
+    auto& bundle_file_context = _bundle_file_contexts[root_location];
+    if (bundle_file_context == nullptr) {
+        bundle_file_context = std::make_unique<BundleWritableFileContext>();
+        // Held by the request rather than by each task, released when all the tasks have finished.
+        bundle_file_context->increase_active_writers();
+    }
+    return bundle_file_context.get();
+}
+
 Status CompactionTaskCallback::is_txn_still_valid() {
     RETURN_IF_ERROR(has_error());
     auto check_interval_seconds = 60L * config::lake_compaction_check_valid_interval_minutes;
@@ -18,6 +18,8 @@
 #include <butil/containers/linked_list.h>
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "common/status.h"
 #include "compaction_task_context.h"
@@ -31,6 +33,7 @@ class Closure;
 } // namespace google::protobuf
 
 namespace starrocks {
+class BundleWritableFileContext;
 class CompactRequest;
 class CompactResponse;
 class ThreadPool;
@@ -83,6 +86,10 @@ public:
     // check if txn in FE still valid while compaction task (specified by `context`) is running
     Status is_txn_still_valid();
 
+    // The bundle data file shared by the tablets of this request under `root_location`, created on first use and
+    // closed once all the tasks of the request have finished. nullptr if the request has a single tablet.
+    BundleWritableFileContext* bundle_file_context(const std::string& root_location);
+
 private:
     const static int64_t kDefaultTimeoutMs = 24L * 60 * 60 * 1000; // 1 day
 
@@ -100,6 +107,7 @@ private:
     mutable std::mutex _txn_valid_check_mutex;
     std::vector<std::unique_ptr<CompactionTaskContext>> _contexts;
     int64_t _success_compaction_input_file_size = 0;
+    std::unordered_map<std::string, std::unique_ptr<BundleWritableFileContext>> _bundle_file_contexts;
 };
 
 struct CompactionTaskInfo {
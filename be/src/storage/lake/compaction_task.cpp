@@ -14,11 +14,15 @@
 
 #include "storage/lake/compaction_task.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "runtime/exec_env.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_writer.h"
 #include "storage/lake/update_manager.h"
+#include "util/time.h"
 
 namespace starrocks::lake {
 
@@ -53,6 +57,19 @@ Status CompactionTask::execute_index_major_compaction(TxnLogPB* txn_log) {
     return Status::OK();
 }
 
+bool CompactionTask::should_fill_data_cache() const {
+    const int64_t max_idle_sec = config::lake_compaction_fill_data_cache_max_idle_sec;
+    if (max_idle_sec < 0) {
+        return true;
+    }
+    const auto& metadata = _tablet.metadata();
+    if (!metadata->has_commit_time() || metadata->commit_time() <= 0) {
+        // unknown recency, keep the default behavior
+        return true;
+    }
+    return UnixSeconds() - metadata->commit_time() < max_idle_sec;
+}
+
 Status CompactionTask::fill_compaction_segment_info(TxnLogPB_OpCompaction* op_compaction, TabletWriter* writer) {
     for (auto& rowset : _input_rowsets) {
         op_compaction->add_input_rowsets(rowset->id());
@@ -69,10 +86,17 @@ Status CompactionTask::fill_compaction_segment_info(TxnLogPB_OpCompaction* op_co
         op_compaction->mutable_output_rowset()->set_data_size(writer->data_size() + uncompacted_data_size);
         op_compaction->mutable_output_rowset()->set_overlapped(true);
     } else {
-        for (auto& file : writer->files()) {
+        const auto& files = writer->files();
+        const bool has_bundle_file = std::any_of(files.begin(), files.end(), [](const FileInfo& f) {
+            return f.bundle_file_offset.value_or(-1) >= 0;
+        });
+        for (auto& file : files) {
             op_compaction->mutable_output_rowset()->add_segments(file.path);
             op_compaction->mutable_output_rowset()->add_segment_size(file.size.value());
             op_compaction->mutable_output_rowset()->add_segment_encryption_metas(file.encryption_meta);
+            if (has_bundle_file) {
+                op_compaction->mutable_output_rowset()->add_bundle_file_offsets(file.bundle_file_offset.value_or(-1));
+            }
         }
         op_compaction->mutable_output_rowset()->set_num_rows(writer->num_rows());
         op_compaction->mutable_output_rowset()->set_data_size(writer->data_size());
@@ -54,6 +54,10 @@ public:
     Status fill_compaction_segment_info(TxnLogPB_OpCompaction* op_compaction, TabletWriter* writer);
 
 protected:
+    // Whether the output segments should be populated into the local datacache, see
+    // `config::lake_compaction_fill_data_cache_max_idle_sec`.
+    bool should_fill_data_cache() const;
+
     int64_t _txn_id;
     VersionedTablet _tablet;
     std::vector<std::shared_ptr<Rowset>> _input_rowsets;
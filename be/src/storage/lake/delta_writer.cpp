@@ -17,6 +17,7 @@
 #include <bthread/bthread.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -590,13 +591,18 @@ StatusOr<TxnLogPtr> DeltaWriterImpl::finish_with_txnlog(DeltaWriterFinishMode mo
     txn_log->set_partition_id(_partition_id);
     auto op_write = txn_log->mutable_op_write();
 
-    for (auto& f : _tablet_writer->files()) {
+    auto files = _tablet_writer->files();
+    const bool has_bundle_file = std::any_of(files.begin(), files.end(), [](const FileInfo& f) {
+        return f.bundle_file_offset.value_or(-1) >= 0;
+    });
+    for (auto& f : files) {
         if (is_segment(f.path)) {
             op_write->mutable_rowset()->add_segments(std::move(f.path));
             op_write->mutable_rowset()->add_segment_size(f.size.value());
             op_write->mutable_rowset()->add_segment_encryption_metas(f.encryption_meta);
-            if (f.bundle_file_offset.has_value() && f.bundle_file_offset.value() >= 0) {
-                op_write->mutable_rowset()->add_bundle_file_offsets(f.bundle_file_offset.value());
+            if (has_bundle_file) {
+                // Segments of large flushes are standalone files, -1 keeps the offsets aligned with the segments.
+                op_write->mutable_rowset()->add_bundle_file_offsets(f.bundle_file_offset.value_or(-1));
             }
         } else if (is_del(f.path)) {
             op_write->add_dels(std::move(f.path));
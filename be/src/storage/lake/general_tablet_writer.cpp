@@ -51,7 +51,7 @@ Status HorizontalGeneralTabletWriter::write(const starrocks::Chunk& data, Segmen
         (_auto_flush && (_seg_writer->estimate_segment_size() >= config::max_segment_file_size ||
                          _seg_writer->num_rows_written() + data.num_rows() >= INT32_MAX /*TODO: configurable*/))) {
         RETURN_IF_ERROR(flush_segment_writer(segment));
-        RETURN_IF_ERROR(reset_segment_writer(eos));
+        RETURN_IF_ERROR(reset_segment_writer(eos, data.bytes_usage()));
     }
     RETURN_IF_ERROR(_seg_writer->append_chunk(data));
     _num_rows += data.num_rows();
@@ -86,12 +86,13 @@ void HorizontalGeneralTabletWriter::close() {
     _files.clear();
 }
 
-Status HorizontalGeneralTabletWriter::reset_segment_writer(bool eos) {
+Status HorizontalGeneralTabletWriter::reset_segment_writer(bool eos, size_t flush_bytes) {
     DCHECK(_schema != nullptr);
     auto name = gen_segment_filename(_txn_id);
     SegmentWriterOptions opts;
     opts.is_compaction = _is_compaction;
     WritableFileOptions wopts;
+    wopts.skip_fill_local_cache = !_fill_data_cache;
     if (config::enable_transparent_data_encryption) {
         ASSIGN_OR_RETURN(auto pair, KeyCache::instance().create_encryption_meta_pair_using_current_kek());
         wopts.encryption_info = pair.info;
@@ -105,9 +106,12 @@ Status HorizontalGeneralTabletWriter::reset_segment_writer(bool eos) {
             return fs::new_writable_file(wopts, _tablet_mgr->segment_location(_tablet_id, name));
         }
     };
-    if (_bundle_file_context != nullptr && _files.empty() && eos) {
-        // If this is the first data file writer and it is the end of stream,
-        // then we will create a shared file for this segment writer.
+    // If this is the first data file writer and it is the end of stream, or the flushed chunk is small,
+    // then we will write this segment into the shared file. Every memtable flush writes one segment, so the
+    // buffered segment is bounded by the flushed chunk.
+    const int64_t max_flush_bytes = config::lake_bundle_data_file_max_flush_bytes;
+    const bool small_flush = max_flush_bytes > 0 && static_cast<int64_t>(flush_bytes) <= max_flush_bytes;
+    if (_bundle_file_context != nullptr && ((_files.empty() && eos) || small_flush)) {
         RETURN_IF_ERROR(_bundle_file_context->try_create_bundle_file(create_file_fn));
         of = std::make_unique<BundleWritableFile>(_bundle_file_context, wopts.encryption_info);
     } else {
@@ -306,6 +310,7 @@ StatusOr<std::shared_ptr<SegmentWriter>> VerticalGeneralTabletWriter::create_seg
     SegmentWriterOptions opts;
     opts.is_compaction = _is_compaction;
     WritableFileOptions wopts;
+    wopts.skip_fill_local_cache = !_fill_data_cache;
     if (config::enable_transparent_data_encryption) {
         ASSIGN_OR_RETURN(auto pair, KeyCache::instance().create_encryption_meta_pair_using_current_kek());
         wopts.encryption_info = pair.info;
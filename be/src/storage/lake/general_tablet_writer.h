@@ -76,7 +76,7 @@ public:
     RowsetTxnMetaPB* rowset_txn_meta() override { return nullptr; }
 
 protected:
-    Status reset_segment_writer(bool eos);
+    Status reset_segment_writer(bool eos, size_t flush_bytes);
     virtual Status flush_segment_writer(SegmentPB* segment = nullptr);
 
     std::unique_ptr<SegmentWriter> _seg_writer;
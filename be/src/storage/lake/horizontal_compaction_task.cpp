@@ -17,7 +17,9 @@
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
 #include "storage/compaction_utils.h"
+#include "storage/lake/compaction_scheduler.h"
 #include "storage/lake/rowset.h"
+#include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_reader.h"
 #include "storage/lake/tablet_writer.h"
 #include "storage/lake/txn_log.h"
@@ -30,6 +32,25 @@
 
 namespace starrocks::lake {
 
+BundleWritableFileContext* HorizontalCompactionTask::bundle_file_context() const {
+    const int64_t max_input_bytes = config::lake_compaction_bundle_max_input_bytes;
+    if (max_input_bytes <= 0 || _context->callback == nullptr ||
+        _tablet_schema->keys_type() == KeysType::PRIMARY_KEYS || _input_rowsets.empty() ||
+        _input_rowsets.back()->partial_segments_compaction()) {
+        return nullptr;
+    }
+    int64_t input_bytes = 0;
+    for (auto& rowset : _input_rowsets) {
+        input_bytes += rowset->data_size();
+    }
+    if (input_bytes > max_input_bytes) {
+        return nullptr;
+    }
+    // The output segment is buffered in memory until it is appended to the bundle file, which is only shared by
+    // the tablets of the same data directory, so that vacuum sees all of its references.
+    return _context->callback->bundle_file_context(_tablet.tablet_manager()->tablet_root_location(_tablet.id()));
+}
+
 Status HorizontalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush_pool) {
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker.get());
 
@@ -58,7 +79,9 @@ Status HorizontalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flu
 
     ASSIGN_OR_RETURN(auto writer,
                      _tablet.new_writer_with_schema(kHorizontal, _txn_id, 0, flush_pool, true /** compaction **/,
-                                                    _tablet_schema /** output rowset schema**/))
+                                                    _tablet_schema /** output rowset schema**/,
+                                                    bundle_file_context()))
+    writer->set_fill_data_cache(should_fill_data_cache());
     RETURN_IF_ERROR(writer->open());
     DeferOp defer([&]() { writer->close(); });
 
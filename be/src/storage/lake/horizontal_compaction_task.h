@@ -20,6 +20,7 @@
 #include "storage/lake/compaction_task.h"
 
 namespace starrocks {
+class BundleWritableFileContext;
 class Chunk;
 class ChunkIterator;
 } // namespace starrocks
@@ -40,6 +41,10 @@ public:
 
 private:
     StatusOr<int32_t> calculate_chunk_size();
+
+    // The bundle data file to write the output segment into, nullptr if the output is a standalone file, see
+    // `config::lake_compaction_bundle_max_input_bytes`.
+    BundleWritableFileContext* bundle_file_context() const;
 };
 
 } // namespace starrocks::lake
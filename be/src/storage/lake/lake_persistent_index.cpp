@@ -401,8 +401,9 @@ Status LakePersistentIndex::prepare_merging_iterator(
         return Status::OK();
     }
     for (const auto& sstable_pb : sstables_to_merge) {
-        // build sstable from meta, instead of reuse `_sstables`, to keep it thread safe
-        RandomAccessFileOptions opts;
+        // build sstable from meta, instead of reuse `_sstables`, to keep it thread safe.
+        // The input sstables are read through sequentially, read them with a large buffer to save the remote reads.
+        RandomAccessFileOptions opts{.buffer_size = config::lake_compaction_stream_buffer_size_bytes};
         if (!sstable_pb.encryption_meta().empty()) {
             ASSIGN_OR_RETURN(auto info, KeyCache::instance().unwrap_encryption_meta(sstable_pb.encryption_meta()));
             opts.encryption_info = std::move(info);
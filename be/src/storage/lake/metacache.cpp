@@ -246,6 +246,26 @@ void Metacache::_cache_segment_no_lock(std::string_view key, std::shared_ptr<Seg
     insert(key, value.release(), mem_cost);
 }
 
+void Metacache::update_segment_cache_size(std::string_view key, intptr_t segment_addr_hint) {
+    // the mutex serializes the updates, so that the last one charges the latest memory usage
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return;
+    }
+    DeferOp defer([this, handle]() { _cache->release(handle); });
+    auto value = static_cast<CacheValue*>(_cache->value(handle));
+    auto segment = std::get_if<std::shared_ptr<Segment>>(value);
+    if (segment == nullptr) {
+        return;
+    }
+    if (segment_addr_hint != 0 && segment_addr_hint != reinterpret_cast<intptr_t>(segment->get())) {
+        // the segment in cache is not the one as expected, skip the cache update
+        return;
+    }
+    _cache->update_charge(handle, (*segment)->mem_usage());
+}
+
 std::shared_ptr<Segment> Metacache::cache_segment_if_absent(std::string_view key, std::shared_ptr<Segment> segment) {
     std::lock_guard<std::mutex> lock(_mutex);
     auto seg = _lookup_segment_no_lock(key);
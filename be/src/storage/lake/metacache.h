@@ -73,6 +73,10 @@ public:
     // cache the segment if the given key not exists in the cache, returns the segment shared_ptr stored in the cache.
     std::shared_ptr<Segment> cache_segment_if_absent(std::string_view key, std::shared_ptr<Segment> segment);
 
+    // Update the charge of the cached segment to its current memory usage, the column indexes of a segment are
+    // loaded lazily after it is cached. Skip the update if the cached segment is not the one at `segment_addr_hint`.
+    void update_segment_cache_size(std::string_view key, intptr_t segment_addr_hint);
+
     void cache_delvec(std::string_view key, std::shared_ptr<const DelVector> delvec);
 
     void cache_aggregation_partition(std::string_view key, bool is_aggregation);
@@ -133,6 +133,10 @@ public:
 
     void set_auto_flush(bool auto_flush) { _auto_flush = auto_flush; }
 
+    // Whether to populate the local datacache with the written files, on by default so that the newly written
+    // data is served locally.
+    void set_fill_data_cache(bool fill_data_cache) { _fill_data_cache = fill_data_cache; }
+
     void set_fs(const std::shared_ptr<FileSystem> fs) { _fs = std::move(fs); }
     void set_location_provider(const std::shared_ptr<LocationProvider> location_provider) {
         _location_provider = std::move(location_provider);
@@ -152,6 +156,7 @@ protected:
     uint32_t _seg_id = 0;
     bool _finished = false;
     bool _auto_flush = true;
+    bool _fill_data_cache = true;
     std::shared_ptr<FileSystem> _fs;
     std::shared_ptr<LocationProvider> _location_provider;
     OlapWriterStatistics _stats;
@@ -247,9 +247,13 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
     // 5. txn4 will be published in later publish task, but we can't judge what's the latest_version in BE and we can not reapply txn_log if
     // txn logs have been deleted.
     int txn_offset = base_version - ori_base_version;
+    // the next txn log loaded in advance to preload its data
+    TxnLogPtr next_txn_log;
     for (size_t i = txn_offset, sz = txns.size(); i < sz; i++) {
         bool ignore_txn_log = false;
-        auto txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        auto txn_log_st = next_txn_log != nullptr ? StatusOr<TxnLogPtr>(std::move(next_txn_log))
+                                                  : load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        next_txn_log = nullptr;
 
         if (txn_log_st.status().is_not_found()) {
             if (i == 0) {
@@ -358,6 +362,15 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
             alter_version = txn_log->op_schema_change().alter_version();
         }
 
+        if (i + 1 < sz) {
+            // the preload of the next log overlaps the apply of the current one
+            auto next_txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i + 1]);
+            if (next_txn_log_st.ok()) {
+                next_txn_log = std::move(next_txn_log_st).value();
+                log_applier->preload(next_txn_log);
+            }
+        }
+
         auto st = log_applier->apply(*txn_log);
         if (!st.ok()) {
             LOG(WARNING) << "Fail to apply txn log : " << st << " tablet_id=" << tablet_id
@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include "gutil/strings/join.h"
+#include "runtime/exec_env.h"
 #include "storage/lake/lake_primary_index.h"
 #include "storage/lake/lake_primary_key_recover.h"
 #include "storage/lake/meta_file.h"
@@ -26,6 +27,7 @@
 #include "testutil/sync_point.h"
 #include "util/dynamic_cache.h"
 #include "util/phmap/phmap_fwd_decl.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace starrocks::lake {
@@ -107,7 +109,10 @@ public:
         _skip_write_tablet_metadata = skip_write_tablet_metadata;
     }
 
-    ~PrimaryKeyTxnLogApplier() override { handle_failure(); }
+    ~PrimaryKeyTxnLogApplier() override {
+        wait_preload();
+        handle_failure();
+    }
 
     Status init() override { return check_meta_version(); }
 
@@ -152,7 +157,31 @@ public:
         return Status::OK();
     }
 
+    void preload(std::shared_ptr<const TxnLogPB> log) override {
+        auto* pool = ExecEnv::GetInstance()->lake_pk_preload_pool();
+        if (pool == nullptr || !log->has_op_write()) {
+            return;
+        }
+        const auto& op_write = log->op_write();
+        // the partial update states are resolved against the primary index, which is being updated by the
+        // current log, so only the upserts of full row writes are preloaded
+        const auto& txn_meta = op_write.txn_meta();
+        if (op_write.rowset().segments_size() == 0 || txn_meta.partial_update_column_unique_ids_size() > 0 ||
+            txn_meta.has_auto_increment_partial_update_column_id() || is_column_mode_partial_update(op_write)) {
+            return;
+        }
+        if (_preload_token == nullptr) {
+            _preload_token = pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+        }
+        auto st = _preload_token->submit_func([tablet = _tablet, log = std::move(log)]() mutable {
+            tablet.update_mgr()->preload_update_state(*log, &tablet);
+        });
+        LOG_IF(WARNING, !st.ok()) << "Fail to submit pk preload task, tablet_id=" << _tablet.id() << ": " << st;
+    }
+
     Status apply(const TxnLogPB& log) override {
+        // the update state of a preloaded log must not be loaded concurrently
+        wait_preload();
         SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(true);
         SCOPED_THREAD_LOCAL_SINGLETON_CHECK_MEM_TRACKER_SETTER(
                 config::enable_pk_strict_memcheck ? _tablet.update_mgr()->mem_tracker() : nullptr);
@@ -207,6 +236,12 @@ public:
     }
 
 private:
+    void wait_preload() {
+        if (_preload_token != nullptr) {
+            _preload_token->wait();
+        }
+    }
+
     bool need_recover(const Status& st) { return _builder.recover_flag() != RecoverFlag::OK; }
     bool need_re_publish(const Status& st) { return _builder.recover_flag() == RecoverFlag::RECOVER_WITH_PUBLISH; }
     bool is_column_mode_partial_update(const TxnLogPB_OpWrite& op_write) const {
@@ -400,6 +435,8 @@ private:
     // True when finalize meta file success.
     bool _has_finalized = false;
     bool _rebuild_pindex = false;
+    // serializes the preload tasks of the logs applied by this applier
+    std::unique_ptr<ThreadPoolToken> _preload_token;
 };
 
 class NonPrimaryKeyTxnLogApplier : public TxnLogApplier {
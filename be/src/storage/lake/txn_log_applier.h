@@ -37,6 +37,11 @@ public:
 
     virtual Status apply(const TxnLogPB& tnx_log) = 0;
 
+    // Start loading the data that applying `tnx_log` needs in the background. When publishing a batch of txn logs,
+    // it's called with the next log before the current one is applied, so that the load of the next log overlaps
+    // the apply of the current one.
+    virtual void preload(std::shared_ptr<const TxnLogPB> tnx_log) {}
+
     virtual Status finish() = 0;
 
     void observe_empty_compaction() { _has_empty_compaction = true; }
@@ -17,6 +17,8 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <algorithm>
+#include <atomic>
 #include <set>
 #include <string_view>
 #include <unordered_map>
@@ -121,10 +123,53 @@ int64_t calculate_retry_delay(int64_t attempted_retries) {
     return min_delay * (1 << attempted_retries);
 }
 
+// Adapts the pace of the deletions of all the vacuum tasks to the throttling of the object storage. While the
+// deletions succeed, the batches grow and the delay between them shrinks, and the other way round once a deletion
+// is throttled, so that the concurrent tasks back off together instead of each retrying at full speed.
+class DeleteRateController {
+public:
+    static DeleteRateController* instance() {
+        static DeleteRateController s_instance;
+        return &s_instance;
+    }
+
+    int64_t batch_size() const {
+        int64_t min_size = std::max<int64_t>(1, config::lake_vacuum_min_batch_delete_size);
+        int64_t max_size = std::max<int64_t>(min_size, config::lake_vacuum_max_batch_delete_size);
+        return std::clamp(_batch_size.load(std::memory_order_relaxed), min_size, max_size);
+    }
+
+    int64_t delay_ms() const { return _delay_ms.load(std::memory_order_relaxed); }
+
+    void on_success() {
+        int64_t delay = _delay_ms.load(std::memory_order_relaxed);
+        _delay_ms.store(delay / 2 < config::lake_vacuum_retry_min_delay_ms ? 0 : delay / 2, std::memory_order_relaxed);
+        _batch_size.store(std::min<int64_t>(batch_size() * 2, config::lake_vacuum_max_batch_delete_size),
+                          std::memory_order_relaxed);
+    }
+
+    void on_throttled() {
+        int64_t delay = _delay_ms.load(std::memory_order_relaxed);
+        delay = std::clamp<int64_t>(delay * 2, config::lake_vacuum_retry_min_delay_ms, kMaxDelayMs);
+        _delay_ms.store(delay, std::memory_order_relaxed);
+        _batch_size.store(batch_size() / 2, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t kMaxDelayMs = 10000;
+
+    std::atomic<int64_t> _batch_size{0};
+    std::atomic<int64_t> _delay_ms{0};
+};
+
 Status delete_files_with_retry(FileSystem* fs, std::span<const std::string> paths) {
     for (int64_t attempted_retries = 0; /**/; attempted_retries++) {
         auto st = fs->delete_files(paths);
-        if (!st.ok() && should_retry(st, attempted_retries)) {
+        if (st.ok()) {
+            DeleteRateController::instance()->on_success();
+            return st;
+        } else if (should_retry(st, attempted_retries)) {
+            DeleteRateController::instance()->on_throttled();
             int64_t delay = calculate_retry_delay(attempted_retries);
             LOG(WARNING) << "Fail to delete: " << st << " will retry after " << delay << "ms";
             std::this_thread::sleep_for(std::chrono::milliseconds(delay));
@@ -141,7 +186,8 @@ Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
     }
 
     auto delete_single_batch = [fs](std::span<const std::string> batch) -> Status {
-        auto wait_duration = config::experimental_lake_wait_per_delete_ms;
+        auto wait_duration = std::max<int64_t>(config::experimental_lake_wait_per_delete_ms,
+                                               DeleteRateController::instance()->delay_ms());
         if (wait_duration > 0) {
             std::this_thread::sleep_for(std::chrono::milliseconds(wait_duration));
         }
@@ -166,12 +212,11 @@ Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
         return st;
     };
 
-    auto batch_size = int64_t{config::lake_vacuum_min_batch_delete_size};
-    auto batch_count = static_cast<int64_t>((paths.size() + batch_size - 1) / batch_size);
-    for (auto i = int64_t{0}; i < batch_count; i++) {
-        auto begin = paths.begin() + (i * batch_size);
-        auto end = std::min(begin + batch_size, paths.end());
+    for (auto begin = paths.begin(); begin != paths.end(); /**/) {
+        auto batch_size = DeleteRateController::instance()->batch_size();
+        auto end = begin + std::min<int64_t>(batch_size, paths.end() - begin);
         RETURN_IF_ERROR(delete_single_batch(std::span<const std::string>(begin, end)));
+        begin = end;
     }
     return Status::OK();
 }
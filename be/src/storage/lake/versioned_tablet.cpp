@@ -43,7 +43,7 @@ StatusOr<std::unique_ptr<TabletWriter>> VersionedTablet::new_writer(WriterType t
 
 StatusOr<std::unique_ptr<TabletWriter>> VersionedTablet::new_writer_with_schema(
         WriterType type, int64_t txn_id, uint32_t max_rows_per_segment, ThreadPool* flush_pool, bool is_compaction,
-        const std::shared_ptr<const TabletSchema>& tablet_schema) {
+        const std::shared_ptr<const TabletSchema>& tablet_schema, BundleWritableFileContext* bundle_file_context) {
     if (tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
         if (type == kHorizontal) {
             return std::make_unique<HorizontalPkTabletWriter>(_tablet_mgr, id(), tablet_schema, txn_id, flush_pool,
@@ -56,7 +56,7 @@ StatusOr<std::unique_ptr<TabletWriter>> VersionedTablet::new_writer_with_schema(
     } else {
         if (type == kHorizontal) {
             return std::make_unique<HorizontalGeneralTabletWriter>(_tablet_mgr, id(), tablet_schema, txn_id,
-                                                                   is_compaction, flush_pool);
+                                                                   is_compaction, flush_pool, bundle_file_context);
         } else {
             DCHECK(type == kVertical);
             return std::make_unique<VerticalGeneralTabletWriter>(_tablet_mgr, id(), tablet_schema, txn_id,
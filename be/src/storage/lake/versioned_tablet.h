@@ -21,6 +21,7 @@
 #include "storage/rowset/base_rowset.h"
 
 namespace starrocks {
+class BundleWritableFileContext;
 class TabletSchema;
 class TabletMetadataPB;
 class Schema;
@@ -69,9 +70,11 @@ public:
 
     // `segment_max_rows` is used in vertical writer
     // create a tablet writer with given `tablet_schema`
+    // `bundle_file_context` is only used by the horizontal writer of non primary key tablets
     StatusOr<std::unique_ptr<TabletWriter>> new_writer_with_schema(
             WriterType type, int64_t txn_id, uint32_t max_rows_per_segment, ThreadPool* flush_pool, bool is_compaction,
-            const std::shared_ptr<const TabletSchema>& tablet_schema);
+            const std::shared_ptr<const TabletSchema>& tablet_schema,
+            BundleWritableFileContext* bundle_file_context = nullptr);
 
     StatusOr<std::unique_ptr<TabletWriter>> new_writer(WriterType type, int64_t txn_id,
                                                        uint32_t max_rows_per_segment = 0,
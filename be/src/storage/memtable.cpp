@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -196,6 +197,16 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
     }
 
     size_t cur_row_count = _chunk->num_rows();
+    const bool append_by_runs = _split_into_runs(indexes, from, size);
+    auto append_rows = [&](ColumnPtr& dest, const ColumnPtr& src) {
+        if (append_by_runs) {
+            for (const auto& [first, count] : _insert_runs) {
+                dest->append(*src, first, count);
+            }
+        } else {
+            dest->append_selective(*src, indexes, from, size);
+        }
+    };
     if (_slot_descs != nullptr) {
         // For schema change, FE will construct a shadow column.
         // The shadow column is not exist in _vectorized_schema
@@ -204,7 +215,7 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         for (int i = 0; i < _slot_descs->size(); ++i) {
             const ColumnPtr& src = chunk.get_column_by_slot_id((*_slot_descs)[i]->id());
             ColumnPtr& dest = _chunk->get_column_by_index(i);
-            dest->append_selective(*src, indexes, from, size);
+            append_rows(dest, src);
         }
         if (is_column_with_row) {
             ColumnPtr& dest = _chunk->get_column_by_name(Schema::FULL_ROW_COLUMN);
@@ -214,7 +225,7 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         for (int i = 0; i < _vectorized_schema->num_fields(); i++) {
             const ColumnPtr& src = chunk.get_column_by_index(i);
             ColumnPtr& dest = _chunk->get_column_by_index(i);
-            dest->append_selective(*src, indexes, from, size);
+            append_rows(dest, src);
             if (is_column_with_row && i == _vectorized_schema->num_fields() - 1) {
                 dest->append(*full_row_col.get());
             }
@@ -227,6 +238,12 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         _total_rows += chunk.num_rows();
     }
 
+    // sort the rows of a duplicate keys table as they arrive, so that the flush only needs to merge the runs
+    if (_keys_type == KeysType::DUP_KEYS && config::memtable_sorted_run_rows > 0 &&
+        _chunk->num_rows() >= config::memtable_sorted_run_rows) {
+        RETURN_IF_ERROR(_sort_run());
+    }
+
     // if memtable is full, push it to the flush executor,
     // and create a new memtable for incoming data
     bool suggest_flush = false;
@@ -249,6 +266,32 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
     return suggest_flush;
 }
 
+// The senders group the rows of a request by tablet, so the rows of a tablet are usually a few runs of consecutive
+// rows. Appending a run is a memcpy for the fixed length columns, rather than a gather of every row.
+bool MemTable::_split_into_runs(const uint32_t* indexes, uint32_t from, uint32_t size) {
+    static constexpr uint32_t kMinAvgRunRows = 16;
+    _insert_runs.clear();
+    if (size < kMinAvgRunRows) {
+        return false;
+    }
+    uint32_t first = indexes[from];
+    uint32_t count = 1;
+    for (uint32_t i = from + 1; i < from + size; i++) {
+        if (indexes[i] == first + count) {
+            count++;
+            continue;
+        }
+        _insert_runs.emplace_back(first, count);
+        if (_insert_runs.size() * kMinAvgRunRows > size) {
+            return false;
+        }
+        first = indexes[i];
+        count = 1;
+    }
+    _insert_runs.emplace_back(first, count);
+    return _insert_runs.size() * kMinAvgRunRows <= size;
+}
+
 Status MemTable::finalize() {
     if (_chunk == nullptr) {
         return Status::OK();
@@ -317,6 +360,8 @@ Status MemTable::finalize() {
             _aggregator.reset();
             _aggregator_memory_usage = 0;
             _aggregator_bytes_usage = 0;
+        } else if (!_sorted_runs.empty()) {
+            RETURN_IF_ERROR(_merge_sorted_runs());
         } else {
             RETURN_IF_ERROR(_sort(true));
         }
@@ -443,6 +488,61 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     return Status::OK();
 }
 
+Status MemTable::_sort_run() {
+    auto start_time = MonotonicNanos();
+    DeferOp defer([&]() { ADD_COUNTER_RELAXED(_stats.sort_time_ns, MonotonicNanos() - start_time); });
+    ADD_COUNTER_RELAXED(_stats.sort_count, 1);
+    SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
+    std::swap(perm, _permutations);
+    RETURN_IF_ERROR(_sort_column_inc(true));
+    ChunkPtr run = _chunk->clone_empty_with_schema(0);
+    _append_to_sorted_chunk(_chunk.get(), run.get(), true);
+    _sorted_runs.emplace_back(std::move(run));
+    // the memory usage of the runs is still accounted in _chunk_memory_usage and _chunk_bytes_usage
+    _chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
+    return Status::OK();
+}
+
+Status MemTable::_merge_sorted_runs() {
+    if (_chunk->num_rows() > 0) {
+        RETURN_IF_ERROR(_sort_run());
+    }
+    _chunk.reset();
+
+    auto start_time = MonotonicNanos();
+    DeferOp defer([&]() { ADD_COUNTER_RELAXED(_stats.sort_time_ns, MonotonicNanos() - start_time); });
+    // cascade two-way merge, every level halves the number of runs
+    Permutation perm;
+    while (_sorted_runs.size() > 1) {
+        std::vector<ChunkPtr> merged_runs;
+        for (size_t i = 0; i + 1 < _sorted_runs.size(); i += 2) {
+            ChunkPtr& left = _sorted_runs[i];
+            ChunkPtr& right = _sorted_runs[i + 1];
+            Columns left_columns;
+            Columns right_columns;
+            SortDescs sort_descs;
+            RETURN_IF_ERROR(_sort_columns(*left, true, &left_columns, &sort_descs));
+            RETURN_IF_ERROR(_sort_columns(*right, true, &right_columns, &sort_descs));
+            RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, SortedRun(left, left_columns),
+                                                        SortedRun(right, right_columns), &perm));
+            ChunkPtr merged = left->clone_empty_with_schema(0);
+            materialize_by_permutation(merged.get(), {left, right}, perm);
+            left.reset();
+            right.reset();
+            merged_runs.emplace_back(std::move(merged));
+        }
+        if (_sorted_runs.size() % 2 == 1) {
+            merged_runs.emplace_back(std::move(_sorted_runs.back()));
+        }
+        _sorted_runs.swap(merged_runs);
+    }
+    _result_chunk = std::move(_sorted_runs[0]);
+    _sorted_runs.clear();
+    _chunk_memory_usage = 0;
+    _chunk_bytes_usage = 0;
+    return Status::OK();
+}
+
 void MemTable::_append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final) {
     DCHECK_EQ(src->num_rows(), _permutations.size());
     permutate_to_selective(_permutations, &_selective_values);
@@ -503,6 +603,13 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, Mutabl
 
 Status MemTable::_sort_column_inc(bool by_sort_key) {
     Columns columns;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_sort_columns(*_chunk, by_sort_key, &columns, &sort_descs));
+    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
+    return st;
+}
+
+Status MemTable::_sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns, SortDescs* sort_descs) const {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -532,22 +639,20 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
     }
 
     for (auto sort_key_idx : sort_key_idxes) {
-        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+        columns->push_back(chunk.get_column_by_index(sort_key_idx));
     }
 
-    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    *sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
     if (!_merge_condition.empty()) {
         for (int i = 0; i < _vectorized_schema->num_fields(); ++i) {
             if (_vectorized_schema->field(i)->name() == _merge_condition) {
-                columns.push_back(_chunk->get_column_by_index(i));
-                sort_descs.descs.emplace_back(1, -1);
+                columns->push_back(chunk.get_column_by_index(i));
+                sort_descs->descs.emplace_back(1, -1);
                 break;
             }
         }
     }
-
-    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
-    return st;
+    return Status::OK();
 }
 
 } // namespace starrocks
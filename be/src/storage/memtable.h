@@ -30,6 +30,7 @@ class SlotDescriptor;
 class TabletSchema;
 
 class MemTableSink;
+struct SortDescs;
 
 struct MemtableStats {
     // The number of insert operation
@@ -119,8 +120,17 @@ private:
 
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    Status _sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns, SortDescs* sort_descs) const;
+    // sort the buffered rows of a DUP_KEYS memtable into a sorted run
+    Status _sort_run();
+    // merge all the sorted runs into `_result_chunk`
+    Status _merge_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
+    // split `indexes[from, from + size)` into ascending runs of consecutive rows, return whether they are long
+    // enough to append the rows range by range
+    bool _split_into_runs(const uint32_t* indexes, uint32_t from, uint32_t size);
+
     void _init_aggregator_if_needed();
     void _aggregate(bool is_final);
 
@@ -128,6 +138,11 @@ private:
 
     ChunkPtr _chunk;
     ChunkPtr _result_chunk;
+    // the sorted runs of a DUP_KEYS memtable, see `config::memtable_sorted_run_rows`
+    std::vector<ChunkPtr> _sorted_runs;
+
+    // the runs of the rows of an insert, (first row, number of rows)
+    std::vector<std::pair<uint32_t, uint32_t>> _insert_runs;
 
     // for sort by columns
     SmallPermutation _permutations;
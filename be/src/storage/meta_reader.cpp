@@ -23,6 +23,7 @@
 #include "column/column_helper.h"
 #include "column/datum.h"
 #include "column/datum_convert.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/global_dict/config.h"
 #include "storage/olap_common.h"
@@ -35,7 +36,7 @@
 namespace starrocks {
 
 std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {
-        META_FLAT_JSON_META, META_DICT_MERGE, META_MAX, META_MIN, META_COUNT_ROWS, META_COUNT_COL};
+        META_FLAT_JSON_META, META_DICT_MERGE, META_MAX, META_MIN, META_COUNT_ROWS, META_COUNT_COL, META_NDV};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -236,6 +237,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, Col
         return _collect_flat_json(cid, column);
     } else if (name == META_COUNT_COL) {
         return _collect_count(cid, column, type);
+    } else if (name == META_NDV) {
+        return _collect_ndv(cid, column, type);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -409,4 +412,59 @@ Status SegmentMetaCollecter::_collect_count(ColumnId cid, Column* column, Logica
     return Status::OK();
 }
 
+// The number of distinct non-null values of the column in this segment, derived only from what the
+// segment already persists, without reading any data page:
+// - the dictionary size of the bitmap index,
+// - the dictionary size of the column when all its pages are dict encoded,
+// - 0 or 1 when the segment zone map shows no non-null value or min == max.
+// NULL is returned when none of them applies.
+Status SegmentMetaCollecter::_collect_ndv(ColumnId cid, Column* column, LogicalType type) {
+    if (cid >= _segment->num_columns()) {
+        return Status::NotFound("");
+    }
+    const ColumnReader* col_reader = _segment->column(cid);
+    if (col_reader == nullptr) {
+        return Status::NotFound("");
+    }
+
+    if (col_reader->has_bitmap_index()) {
+        IndexReadOptions opts;
+        opts.use_page_cache = !config::disable_storage_page_cache && config::enable_bitmap_index_memory_page_cache;
+        opts.read_file = _read_file.get();
+        opts.stats = &_stats;
+        BitmapIndexIterator* bitmap_iter = nullptr;
+        RETURN_IF_ERROR(_segment->new_bitmap_index_iterator(_params->tablet_schema->column(cid).unique_id(), opts,
+                                                            &bitmap_iter));
+        if (bitmap_iter != nullptr) {
+            std::unique_ptr<BitmapIndexIterator> guard(bitmap_iter);
+            int64_t ndv = bitmap_iter->bitmap_nums() - (bitmap_iter->has_null_bitmap() ? 1 : 0);
+            column->append_datum(ndv);
+            return Status::OK();
+        }
+    }
+
+    if (_column_iterators.size() > cid && _column_iterators[cid] != nullptr &&
+        _column_iterators[cid]->all_page_dict_encoded()) {
+        std::vector<Slice> words;
+        RETURN_IF_ERROR(_column_iterators[cid]->fetch_all_dict_words(&words));
+        column->append_datum(int64_t(words.size()));
+        return Status::OK();
+    }
+
+    const ZoneMapPB* segment_zone_map_pb = col_reader->segment_zone_map();
+    if (segment_zone_map_pb != nullptr) {
+        if (!segment_zone_map_pb->has_not_null()) {
+            column->append_datum(int64_t(0));
+            return Status::OK();
+        }
+        if (segment_zone_map_pb->min() == segment_zone_map_pb->max()) {
+            column->append_datum(int64_t(1));
+            return Status::OK();
+        }
+    }
+
+    column->append_nulls(1);
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -105,6 +105,7 @@ static const std::string META_MAX = "max";
 static const std::string META_DICT_MERGE = "dict_merge";
 static const std::string META_FLAT_JSON_META = "flat_json_meta";
 static const std::string META_COUNT_COL = "count";
+static const std::string META_NDV = "ndv";
 
 class SegmentMetaCollecter {
 public:
@@ -130,6 +131,7 @@ private:
     Status _collect_count(ColumnId cid, Column* column, LogicalType type);
     Status _collect_rows(Column* column, LogicalType type);
     Status _collect_flat_json(ColumnId cid, Column* column);
+    Status _collect_ndv(ColumnId cid, Column* column, LogicalType type);
     template <bool is_max>
     Status __collect_max_or_min(ColumnId cid, Column* column, LogicalType type);
     SegmentSharedPtr _segment;
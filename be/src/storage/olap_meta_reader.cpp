@@ -87,7 +87,7 @@ Status OlapMetaReader::_build_collect_context(const OlapMetaReaderParams& read_p
 
         // only collect the field of dict need read data page
         // others just depend on footer
-        if (collect_field == META_DICT_MERGE || collect_field == META_COUNT_COL) {
+        if (collect_field == META_DICT_MERGE || collect_field == META_COUNT_COL || collect_field == META_NDV) {
             _collect_context.seg_collecter_params.read_page.emplace_back(true);
         } else {
             _collect_context.seg_collecter_params.read_page.emplace_back(false);
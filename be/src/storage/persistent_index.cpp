@@ -2420,6 +2420,24 @@ size_t get_matched_tag_idxes(const uint8_t* tags, size_t ntag, uint8_t tag, uint
 
 #endif
 
+// Probing a bucket of a large shard is dominated by the cache misses of the bucket info in the page header
+// and of the bucket's tags, so they are prefetched some keys ahead: the bucket info at 2 * distance, and the
+// tags at distance, whose bucket info is already in cache by then.
+static constexpr size_t kProbePrefetchDistance = 8;
+
+static inline void prefetch_bucket(ImmutableIndexShard* shard, uint32_t npage, uint32_t nbucket,
+                                   const std::vector<KeyInfo>& keys_info, size_t i) {
+    if (i + 2 * kProbePrefetchDistance < keys_info.size()) {
+        IndexHash h(keys_info[i + 2 * kProbePrefetchDistance].second);
+        __builtin_prefetch(&shard->bucket(h.page() % npage, h.bucket() % nbucket));
+    }
+    if (i + kProbePrefetchDistance < keys_info.size()) {
+        IndexHash h(keys_info[i + kProbePrefetchDistance].second);
+        const auto& bucket_info = shard->bucket(h.page() % npage, h.bucket() % nbucket);
+        __builtin_prefetch(shard->pack_in_page(bucket_info.pageid, bucket_info.packid));
+    }
+}
+
 Status ImmutableIndex::_get_fixlen_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_by_shard, size_t shard_idx,
                                                  uint32_t shard_bits,
                                                  std::unique_ptr<ImmutableIndexShard>* shard) const {
@@ -2488,7 +2506,9 @@ Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Sl
                                             std::unique_ptr<ImmutableIndexShard>* shard) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        prefetch_bucket(shard->get(), shard_info.npage, shard_info.nbucket, keys_info, i);
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2520,7 +2540,9 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
 
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        prefetch_bucket(shard->get(), shard_info.npage, shard_info.nbucket, keys_info, i);
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2748,6 +2770,31 @@ Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const S
                                              std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
+    if (config::enable_pindex_page_prefetch && keys_info_by_page.size() > 1) {
+        // Hint the OS to read all the pages of this batch ahead, so the following synchronous reads of
+        // the pages are mostly served by the page cache. Adjacent pages are merged into one range.
+        int64_t range_start = -1;
+        int64_t range_end = -1;
+        for (const auto& [pageid, keys_info] : keys_info_by_page) {
+            int64_t start = shard_info.offset;
+            int64_t end = shard_info.offset;
+            if (_compression_type == CompressionTypePB::NO_COMPRESSION) {
+                start += shard_info.page_size * pageid;
+                end = start + shard_info.page_size;
+            } else {
+                start += shard_info.page_off[pageid];
+                end += shard_info.page_off[pageid + 1];
+            }
+            if (start != range_end) {
+                if (range_start >= 0) {
+                    _file->prefetch(range_start, range_end - range_start);
+                }
+                range_start = start;
+            }
+            range_end = end;
+        }
+        _file->prefetch(range_start, range_end - range_start);
+    }
     std::map<size_t, LargeIndexPage> pages;
     for (auto [pageid, keys_info] : keys_info_by_page) {
         LargeIndexPage page(shard_info.page_size / kPageSize);
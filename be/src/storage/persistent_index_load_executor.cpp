@@ -76,13 +76,14 @@ Status PersistentIndexLoadExecutor::refresh_max_thread_num() {
     }
 }
 
-Status PersistentIndexLoadExecutor::submit_task_and_wait_for(const TabletSharedPtr& tablet, int32_t wait_seconds) {
+Status PersistentIndexLoadExecutor::submit_task_and_wait_for(const TabletSharedPtr& tablet, int32_t wait_seconds,
+                                                             ThreadPool::Priority pri) {
     auto tablet_id = tablet->tablet_id();
     if (tablet->updates() == nullptr) {
         return Status::InvalidArgument(fmt::format("Tablet {} is not primary key", tablet_id));
     }
 
-    auto latch_or = submit_task(tablet);
+    auto latch_or = submit_task(tablet, pri);
     if (latch_or.ok()) {
         auto finished = latch_or.value()->wait_for(std::chrono::seconds(wait_seconds));
         if (!finished) {
@@ -101,7 +102,8 @@ Status PersistentIndexLoadExecutor::submit_task_and_wait_for(const TabletSharedP
     return Status::OK();
 }
 
-StatusOr<std::shared_ptr<CountDownLatch>> PersistentIndexLoadExecutor::submit_task(const TabletSharedPtr& tablet) {
+StatusOr<std::shared_ptr<CountDownLatch>> PersistentIndexLoadExecutor::submit_task(const TabletSharedPtr& tablet,
+                                                                                  ThreadPool::Priority pri) {
     if (_load_pool == nullptr) {
         return Status::Uninitialized("Persistent index load executor is not initialized");
     }
@@ -120,7 +122,7 @@ StatusOr<std::shared_ptr<CountDownLatch>> PersistentIndexLoadExecutor::submit_ta
         std::lock_guard<std::mutex> lock(_lock);
         _running_tablets.erase(tablet->tablet_id());
     });
-    RETURN_IF_ERROR(_load_pool->submit(std::move(task)));
+    RETURN_IF_ERROR(_load_pool->submit(std::move(task), pri));
     _running_tablets.emplace(tablet_id, latch);
     return std::move(latch);
 }
@@ -43,13 +43,16 @@ public:
 
     Status refresh_max_thread_num();
 
-    Status submit_task_and_wait_for(const TabletSharedPtr& tablet, int32_t wait_seconds);
+    // Loads of the primary index that a write is waiting on should use HIGH_PRIORITY, so they are not queued
+    // behind the background rebuilds, e.g. the ones after clone.
+    Status submit_task_and_wait_for(const TabletSharedPtr& tablet, int32_t wait_seconds,
+                                    ThreadPool::Priority pri = ThreadPool::LOW_PRIORITY);
 
     ThreadPool* TEST_get_load_pool() { return _load_pool.get(); }
     void TEST_reset_load_pool() { _load_pool.reset(); }
 
 private:
-    StatusOr<std::shared_ptr<CountDownLatch>> submit_task(const TabletSharedPtr& tablet);
+    StatusOr<std::shared_ptr<CountDownLatch>> submit_task(const TabletSharedPtr& tablet, ThreadPool::Priority pri);
 
     std::unique_ptr<ThreadPool> _load_pool;
     std::mutex _lock;
@@ -14,8 +14,13 @@
 
 #include "storage/predicate_tree/predicate_tree.hpp"
 
+#include <limits>
+#include <numeric>
+
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "simd/simd.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -126,6 +131,41 @@ template <>
 Status PredicateCompoundNode<CompoundNodeType::OR>::evaluate_or(CompoundNodeContexts& contexts, const Chunk* chunk,
                                                                 uint8_t* selection, uint16_t from, uint16_t to) const;
 
+// ------------------------------------------------------------------------------------
+// CompoundNodeContext
+// ------------------------------------------------------------------------------------
+
+void CompoundNodeContext::CompoundAndContext::reorder_vec_children() {
+    // A child with the per-row cost c and the observed selectivity s filters (1 - s) rows per unit of cost,
+    // evaluating the children in the ascending order of c / (1 - s) minimizes the expected total cost.
+    // The children which are never evaluated during sampling keep their original relative positions at the end.
+    const size_t num_children = vec_children.size();
+    std::vector<double> ranks(num_children);
+    for (size_t i = 0; i < num_children; i++) {
+        const auto& stats = vec_children_stats[i];
+        if (stats.input_rows == 0) {
+            ranks[i] = std::numeric_limits<double>::max();
+            continue;
+        }
+        const double cost = static_cast<double>(stats.cost_ns) / stats.input_rows;
+        const double filtered = 1.0 - static_cast<double>(stats.output_rows) / stats.input_rows;
+        ranks[i] = filtered > 0 ? cost / filtered : std::numeric_limits<double>::max();
+    }
+
+    std::vector<size_t> order(num_children);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return ranks[lhs] < ranks[rhs]; });
+
+    std::vector<ConstPredicateNodePtr> new_children;
+    new_children.reserve(num_children);
+    for (const auto idx : order) {
+        new_children.emplace_back(vec_children[idx]);
+    }
+    vec_children = std::move(new_children);
+    vec_children_stats.clear();
+    vec_children_stats.resize(num_children);
+}
+
 // ------------------------------------------------------------------------------------
 // PredicateAndNode
 // ------------------------------------------------------------------------------------
@@ -159,13 +199,20 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
         for (const auto& child : _compound_children) {
             ctx.vec_children.emplace_back(&child);
         }
+        ctx.vec_children_stats.resize(ctx.vec_children.size());
     }
     auto& ctx = node_ctx.and_context.value();
 
+    const bool sampling = ctx.vec_children.size() > 1 && config::enable_predicate_adaptive_reorder &&
+                          ctx.num_sampled_chunks < config::predicate_reorder_sample_chunks;
+
     // Evaluate vectorized predicates first.
     bool first = true;
     bool contains_true = true;
-    for (const auto& child : ctx.vec_children) {
+    size_t hit_count = num_rows;
+    for (size_t i = 0; i < ctx.vec_children.size(); i++) {
+        const auto& child = ctx.vec_children[i];
+        const int64_t start_ns = sampling ? MonotonicNanos() : 0;
         if (first) {
             first = false;
             RETURN_IF_ERROR(
@@ -175,11 +222,23 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
                     [&](const auto& pred) { return pred.evaluate_and(contexts, chunk, selection, from, to); }));
         }
 
-        contains_true = SIMD::count_nonzero(selection + from, num_rows);
+        const size_t input_rows = hit_count;
+        hit_count = SIMD::count_nonzero(selection + from, num_rows);
+        if (sampling) {
+            auto& stats = ctx.vec_children_stats[i];
+            stats.cost_ns += MonotonicNanos() - start_ns;
+            stats.input_rows += input_rows;
+            stats.output_rows += hit_count;
+        }
+
+        contains_true = hit_count > 0;
         if (!contains_true) {
             break;
         }
     }
+    if (sampling && ++ctx.num_sampled_chunks == config::predicate_reorder_sample_chunks) {
+        ctx.reorder_vec_children();
+    }
 
     // Evaluate non-vectorized predicates using evaluate_branchless.
     if (contains_true && !ctx.non_vec_children.empty()) {
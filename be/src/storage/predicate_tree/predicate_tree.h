@@ -289,6 +289,18 @@ struct CompoundNodeContext {
     struct CompoundAndContext {
         std::vector<const PredicateColumnNode*> non_vec_children;
         std::vector<ConstPredicateNodePtr> vec_children;
+
+        // The observed input rows, output rows and cost of each child in `vec_children`, collected over the first
+        // `predicate_reorder_sample_chunks` chunks, and used to evaluate the cheap and selective children first.
+        struct ChildStats {
+            int64_t input_rows = 0;
+            int64_t output_rows = 0;
+            int64_t cost_ns = 0;
+        };
+        std::vector<ChildStats> vec_children_stats;
+        int64_t num_sampled_chunks = 0;
+
+        void reorder_vec_children();
     };
     std::optional<CompoundAndContext> and_context;
 
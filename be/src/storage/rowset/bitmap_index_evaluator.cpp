@@ -14,6 +14,8 @@
 
 #include "storage/rowset/bitmap_index_evaluator.h"
 
+#include <algorithm>
+
 #include "storage/chunk_helper.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/roaring2range.h"
@@ -332,7 +334,21 @@ struct BitmapIndexRetriver {
         }
         const auto& node_ctx = it->second;
 
+        // For AND, read the column which selects the fewest dictionary entries first,
+        // so that the intersection can stop reading bitmaps as soon as it becomes empty.
+        std::vector<std::pair<size_t, ColumnId>> ordered_cids;
+        ordered_cids.reserve(node_ctx.col_contexts.size());
         for (const auto& [cid, col_ctx] : node_ctx.col_contexts) {
+            ordered_cids.emplace_back(col_ctx.bitmap_ranges.span_size(), cid);
+        }
+        if constexpr (Type == CompoundNodeType::AND) {
+            std::sort(ordered_cids.begin(), ordered_cids.end());
+        }
+
+        // For OR, the bitmaps of all the children are collected and unioned at once.
+        std::vector<Roaring> roarings;
+        for (const auto& [_, cid] : ordered_cids) {
+            const auto& col_ctx = node_ctx.col_contexts.at(cid);
             auto* bitmap_iter = parent->_bitmap_index_iterators[cid];
 
             Roaring roaring;
@@ -343,7 +359,9 @@ struct BitmapIndexRetriver {
                 roaring -= null_bitmap;
             }
 
-            _merge_roaring<Type>(result_roaring, roaring);
+            if (_merge_roaring<Type>(result_roaring, roarings, roaring)) {
+                return result_roaring;
+            }
         }
 
         for (const auto& child : node.compound_children()) {
@@ -351,22 +369,41 @@ struct BitmapIndexRetriver {
             if (!roaring.has_value()) {
                 continue;
             }
-            _merge_roaring<Type>(result_roaring, roaring.value());
+            if (_merge_roaring<Type>(result_roaring, roarings, roaring.value())) {
+                return result_roaring;
+            }
+        }
+
+        if constexpr (Type == CompoundNodeType::OR) {
+            if (roarings.size() == 1) {
+                result_roaring = std::move(roarings[0]);
+            } else if (!roarings.empty()) {
+                std::vector<const Roaring*> inputs;
+                inputs.reserve(roarings.size());
+                for (const auto& roaring : roarings) {
+                    inputs.emplace_back(&roaring);
+                }
+                result_roaring = Roaring::fastunion(inputs.size(), inputs.data());
+            }
         }
 
         return result_roaring;
     }
 
+    // Return true if the result of the compound node is already determined to be empty.
     template <CompoundNodeType Type>
-    void _merge_roaring(std::optional<Roaring>& result_roaring, Roaring& roaring) const {
-        if (!result_roaring.has_value()) {
-            result_roaring = std::move(roaring);
-        } else {
-            if constexpr (Type == CompoundNodeType::AND) {
-                result_roaring.value() &= roaring;
+    bool _merge_roaring(std::optional<Roaring>& result_roaring, std::vector<Roaring>& roarings,
+                        Roaring& roaring) const {
+        if constexpr (Type == CompoundNodeType::AND) {
+            if (!result_roaring.has_value()) {
+                result_roaring = std::move(roaring);
             } else {
-                result_roaring.value() |= roaring;
+                result_roaring.value() &= roaring;
             }
+            return result_roaring.value().isEmpty();
+        } else {
+            roarings.emplace_back(std::move(roaring));
+            return false;
         }
     }
 
@@ -36,7 +36,9 @@
 
 #include <bthread/sys_futex.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
@@ -120,22 +122,44 @@ Status BitmapIndexIterator::read_bitmap(rowid_t ordinal, Roaring* result) {
     return Status::OK();
 }
 
+// Union `bitmaps` into `result` with one lazy or, which only repairs the container cardinalities once at the end
+// instead of after every single or.
+static void fast_union_bitmaps(std::vector<Roaring>& bitmaps, Roaring* result) {
+    if (bitmaps.empty()) {
+        return;
+    }
+    std::vector<const Roaring*> inputs;
+    inputs.reserve(bitmaps.size() + 1);
+    inputs.emplace_back(result);
+    for (const auto& bitmap : bitmaps) {
+        inputs.emplace_back(&bitmap);
+    }
+    *result = Roaring::fastunion(inputs.size(), inputs.data());
+    bitmaps.clear();
+}
+
 Status BitmapIndexIterator::read_union_bitmap(rowid_t from, rowid_t to, Roaring* result) {
     DCHECK(0 <= from && from <= to && to <= _reader->bitmap_nums());
-
-    for (rowid_t pos = from; pos < to; pos++) {
-        Roaring bitmap;
-        RETURN_IF_ERROR(read_bitmap(pos, &bitmap));
-        *result |= bitmap;
-    }
-    return Status::OK();
+    return read_union_bitmap(SparseRange<>(from, to), result);
 }
 
 Status BitmapIndexIterator::read_union_bitmap(const SparseRange<>& range, Roaring* result) {
+    // Bound the number of bitmaps held in memory at the same time.
+    static constexpr size_t kUnionBatchSize = 64;
+
+    std::vector<Roaring> bitmaps;
+    bitmaps.reserve(std::min<size_t>(range.span_size(), kUnionBatchSize));
     for (size_t i = 0; i < range.size(); i++) { // NOLINT
         const Range<>& r = range[i];
-        RETURN_IF_ERROR(read_union_bitmap(r.begin(), r.end(), result));
+        DCHECK(r.end() <= _reader->bitmap_nums());
+        for (rowid_t pos = r.begin(); pos < r.end(); pos++) {
+            RETURN_IF_ERROR(read_bitmap(pos, &bitmaps.emplace_back()));
+            if (bitmaps.size() >= kUnionBatchSize) {
+                fast_union_bitmaps(bitmaps, result);
+            }
+        }
     }
+    fast_union_bitmaps(bitmaps, result);
     return Status::OK();
 }
 
@@ -50,6 +50,9 @@
 #include "common/status.h"
 #include "common/statusor.h"
 #include "gen_cpp/segment.pb.h"
+#include "io/io_heatmap.h"
+#include "io/io_profiler.h"
+#include "runtime/current_thread.h"
 #include "runtime/types.h"
 #include "storage/column_predicate.h"
 #include "storage/index/index_descriptor.h"
@@ -354,7 +357,21 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.use_page_cache = iter_opts.use_page_cache;
     opts.encoding_type = _encoding_info->encoding();
 
-    return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
+    if (!IOHeatmap::should_sample()) {
+        return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
+    }
+    // The page cache hits do not count, only the bytes read from the file.
+    const int64_t old_bytes = opts.stats->compressed_bytes_read_request;
+    const int64_t old_io_ns = opts.stats->io_ns;
+    RETURN_IF_ERROR(PageIO::read_and_decompress_page(opts, handle, page_body, footer));
+    const int64_t bytes = opts.stats->compressed_bytes_read_request - old_bytes;
+    if (bytes > 0) {
+        const TUniqueId& query_id = CurrentThread::current().query_id();
+        IOHeatmap::Key key{query_id.hi, query_id.lo, static_cast<int64_t>(IOProfiler::get_tablet_id()),
+                           static_cast<int32_t>(_column_unique_id)};
+        IOHeatmap::instance()->record(key, bytes, opts.stats->io_ns - old_io_ns);
+    }
+    return Status::OK();
 }
 
 Status ColumnReader::_calculate_row_ranges(const std::vector<uint32_t>& page_indexes, SparseRange<>* row_ranges) {
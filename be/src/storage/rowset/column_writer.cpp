@@ -34,6 +34,7 @@
 
 #include "storage/rowset/column_writer.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -279,6 +280,10 @@ public:
     template <LogicalType Type>
     inline EncodingTypePB speculate_encoding(const Column& column);
 
+    // Whether the distinct values of the sample column are few enough for dictionary encoding
+    template <LogicalType Type>
+    inline bool is_low_cardinality(const RunTimeColumnType<Type>& column);
+
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
     uint64_t estimate_buffer_size() override { return _scalar_column_writer->estimate_buffer_size(); };
@@ -314,7 +319,8 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
         str_opts.field_name = column->name();
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, type_info, wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(type_info), std::move(column_writer));
-    } else if (enable_non_string_column_dict_encoding() &&
+    } else if ((enable_non_string_column_dict_encoding() ||
+                (config::enable_for_encoding_speculation && opts.meta->encoding() == DEFAULT_ENCODING)) &&
                numeric_types_support_dict_encoding(delegate_type(column->type()))) {
         DCHECK(column->type() != TYPE_VARCHAR);
         DCHECK(column->type() != TYPE_CHAR);
@@ -519,6 +525,42 @@ Status ScalarColumnWriter::write_data() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_tune_compression(const std::vector<Slice>& body) {
+    const size_t uncompressed_size = Slice::compute_total_size(body);
+    if (uncompressed_size == 0) {
+        return Status::OK();
+    }
+    auto compressed_size = [&](CompressionTypePB type, int level) -> StatusOr<size_t> {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(type, &codec, level));
+        faststring compressed_body;
+        // min_space_saving of 0 keeps the compressed body unless it is larger than the input
+        RETURN_IF_ERROR(PageIO::compress_page_body(codec, 0, body, &compressed_body));
+        return compressed_body.size() == 0 ? uncompressed_size : compressed_body.size();
+    };
+    const int zstd_level =
+            _opts.meta->compression() == CompressionTypePB::ZSTD ? _opts.meta->compression_level() : -1;
+    ASSIGN_OR_RETURN(size_t lz4_size, compressed_size(CompressionTypePB::LZ4_FRAME, -1));
+    ASSIGN_OR_RETURN(size_t zstd_size, compressed_size(CompressionTypePB::ZSTD, zstd_level));
+
+    CompressionTypePB type = CompressionTypePB::LZ4_FRAME;
+    int level = -1;
+    const double max_saving = 1.0 - static_cast<double>(std::min(lz4_size, zstd_size)) / uncompressed_size;
+    if (max_saving < _opts.compression_min_space_saving) {
+        // incompressible, e.g. random floats, skip the codec on both the write and the read
+        type = CompressionTypePB::NO_COMPRESSION;
+    } else if (zstd_size <= lz4_size * (1 - config::compaction_compression_tuning_min_gain)) {
+        type = CompressionTypePB::ZSTD;
+        level = zstd_level;
+    }
+    VLOG(2) << "Tune compression of column " << _opts.meta->unique_id() << ": uncompressed=" << uncompressed_size
+            << ", lz4_frame=" << lz4_size << ", zstd=" << zstd_size << ", chosen=" << CompressionTypePB_Name(type);
+    RETURN_IF_ERROR(get_block_compression_codec(type, &_compress_codec, level));
+    _opts.meta->set_compression(type);
+    _opts.meta->set_compression_level(level);
+    return Status::OK();
+}
+
 // This method should be called when _page_builder is empty
 inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     if (_encoding_info != nullptr && _encoding_info->encoding() == encoding) {
@@ -634,6 +676,10 @@ Status ScalarColumnWriter::finish_current_page() {
         // for page format v2 or above, use the encoding type of config::null_encoding
         data_page_footer->set_null_encoding(_null_map_builder_v2->null_encoding());
     }
+    if (_opts.need_tune_compression && !_compression_tuned) {
+        RETURN_IF_ERROR(_tune_compression(body));
+        _compression_tuned = true;
+    }
     // trying to compress page body
     faststring compressed_body;
     RETURN_IF_ERROR(
@@ -1011,9 +1057,10 @@ inline Status DictColumnWriter::speculate_column_and_set_encoding(const Column&
     return st;
 }
 
-// The detection logic here uses a set to record the distinct values of a sample column. When the number
-// of distinct values exceeds row_count * ratio, dictionary encoding is no longer used.
-// Here, row_count is the number of elements in the sample column, and ratio is set by the user.
+// Dictionary encoding is used if the values of the sample column are of low cardinality. Otherwise the integer and
+// date columns whose sample is in ascending order, e.g. auto increment ids or event times, use FOR_ENCODING, which
+// stores the deltas of the ascending frames bit packed, if enable_for_encoding_speculation is on. The others use
+// BIT_SHUFFLE.
 template <LogicalType Type>
 inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column) {
     using ColumnType = typename RunTimeTypeTraits<Type>::ColumnType;
@@ -1025,7 +1072,27 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
         numerical_col = &down_cast<const ColumnType&>(column);
     }
 
-    auto row_count = numerical_col->size();
+    if (enable_non_string_column_dict_encoding() && is_low_cardinality<Type>(*numerical_col)) {
+        return DICT_ENCODING;
+    }
+    if constexpr (Type == TYPE_SMALLINT || Type == TYPE_INT || Type == TYPE_BIGINT || Type == TYPE_LARGEINT ||
+                  Type == TYPE_DATE || Type == TYPE_DATETIME) {
+        // The values of the null rows are encoded as well, so they are checked too
+        const auto& data = numerical_col->get_data();
+        if (config::enable_for_encoding_speculation && data.size() > dictionary_min_rowcount &&
+            std::is_sorted(data.begin(), data.end())) {
+            return FOR_ENCODING;
+        }
+    }
+    return BIT_SHUFFLE;
+}
+
+// The detection logic here uses a set to record the distinct values of a sample column. When the number
+// of distinct values exceeds row_count * ratio, dictionary encoding is no longer used.
+// Here, row_count is the number of elements in the sample column, and ratio is set by the user.
+template <LogicalType Type>
+inline bool DictColumnWriter::is_low_cardinality(const RunTimeColumnType<Type>& column) {
+    auto row_count = column.size();
     auto ratio = config::dictionary_encoding_ratio_for_non_string_column;
     auto max_card = static_cast<size_t>(static_cast<double>(row_count) * ratio);
 
@@ -1033,15 +1100,15 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
         using CppType = typename RunTimeTypeTraits<Type>::CppType;
         phmap::flat_hash_set<CppType> hash_set;
         for (size_t i = 0; i < row_count; i++) {
-            CppType value = numerical_col->get_data()[i];
+            CppType value = column.get_data()[i];
             hash_set.insert(value);
             if (hash_set.size() > max_card) {
-                return BIT_SHUFFLE;
+                return false;
             }
         }
     }
 
-    return DICT_ENCODING;
+    return true;
 }
 
 Status DictColumnWriter::finish() {
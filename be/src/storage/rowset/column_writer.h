@@ -89,10 +89,14 @@ struct ColumnWriterOptions {
     GlobalDictMap* global_dict = nullptr;
 
     bool is_compaction = false;
+    // choose the compression of the column from its first data page, see `enable_compaction_compression_tuning`
+    bool need_tune_compression = false;
     bool need_flat = false;
 
     std::string field_name;
     const FlatJsonConfig* flat_json_config = nullptr;
+    // json paths accessed frequently by queries, compaction flattens them first
+    std::vector<std::string> flat_json_hot_paths;
 };
 
 class BitmapIndexWriter;
@@ -239,6 +243,9 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // Replace the compression of the column by the one fitting `body` best, before any page is compressed.
+    Status _tune_compression(const std::vector<Slice>& body);
+
     ColumnWriterOptions _opts;
     WritableFile* _wfile;
     uint32_t _curr_page_format;
@@ -275,6 +282,7 @@ private:
     int64_t _previous_ordinal = 0;
 
     bool _is_global_dict_valid = true;
+    bool _compression_tuned = false;
 
     uint64_t _total_mem_footprint = 0;
 };
@@ -49,6 +49,7 @@ Status FlatJsonColumnCompactor::_compact_columns(Columns& json_datas) {
     }
     deriver.set_generate_filter(true);
     deriver.init_flat_json_config(_flat_json_config);
+    deriver.set_hot_paths(std::move(_hot_paths));
 
     deriver.derived(vc);
 
@@ -22,7 +22,8 @@ class FlatJsonColumnCompactor final : public FlatJsonColumnWriter {
 public:
     FlatJsonColumnCompactor(const ColumnWriterOptions& opts, TypeInfoPtr type_info, WritableFile* wfile,
                             std::unique_ptr<ScalarColumnWriter> json_writer)
-            : FlatJsonColumnWriter(opts, std::move(type_info), wfile, std::move(json_writer)) {}
+            : FlatJsonColumnWriter(opts, std::move(type_info), wfile, std::move(json_writer)),
+              _hot_paths(opts.flat_json_hot_paths) {}
 
     Status append(const Column& column) override;
 
@@ -34,6 +35,9 @@ private:
     Status _merge_columns(Columns& json_datas);
 
     Status _flatten_columns(Columns& json_datas);
+
+private:
+    std::vector<std::string> _hot_paths;
 };
 
 class JsonColumnCompactor final : public ColumnWriter {
@@ -40,6 +40,7 @@
 
 #include "cache/object_cache/page_cache.h"
 #include "column/column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
@@ -143,6 +144,36 @@ std::string encode_cache_key(const std::string& fname, int64_t offset) {
     return str;
 }
 
+// The suffix of the cache key of a page cached in its compressed form.
+static constexpr char kCompressedPageCacheKeySuffix = 'c';
+
+Status PageIO::_read_page_from_file(const PageReadOptions& opts, Slice* page_slice) {
+    {
+        SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        // todo override is_cache_hit
+        RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice->data, page_slice->size));
+        if (opts.read_file->is_cache_hit()) {
+            ++opts.stats->pages_from_local_disk;
+        }
+        opts.stats->compressed_bytes_read_request += page_slice->size;
+        ++opts.stats->io_count_request;
+    }
+
+    if (opts.verify_checksum) {
+        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice->data + page_slice->size - 4);
+        uint32_t actual = crc32c::Value(page_slice->data, page_slice->size - 4);
+        if (expect != actual) {
+            return Status::Corruption(
+                    strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2 encrypted=$3",
+                                        actual, expect, opts.read_file->filename(), opts.read_file->is_encrypted()));
+        }
+    }
+
+    // remove checksum suffix
+    page_slice->size -= 4;
+    return Status::OK();
+}
+
 Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                         PageFooterPB* footer) {
     // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
@@ -175,6 +206,19 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         return Status::OK();
     }
 
+    // The compressed pages whose compression ratio is high are cached in their compressed form at first, under
+    // another key, and are promoted to the decompressed form when they are read again.
+    const bool use_compressed_cache = opts.use_page_cache && page_cache_available &&
+                                      config::storage_page_cache_compressed_ratio_threshold > 0;
+    std::string compressed_cache_key;
+    PageCacheHandle compressed_cache_handle;
+    bool hit_compressed_cache = false;
+    if (use_compressed_cache) {
+        compressed_cache_key = cache_key;
+        compressed_cache_key.push_back(kCompressedPageCacheKeySuffix);
+        hit_compressed_cache = cache->lookup(compressed_cache_key, &compressed_cache_handle);
+    }
+
     // every page contains 4 bytes footer length and 4 bytes checksum
     const uint32_t page_size = opts.page_pointer.size;
     if (page_size < 8) {
@@ -184,32 +228,20 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     // hold compressed page at first, reset to decompressed page later
     // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-    std::unique_ptr<std::vector<uint8_t>> page(new std::vector<uint8_t>());
-    raw::stl_vector_resize_uninitialized(page.get(), page_size + Column::APPEND_OVERFLOW_MAX_SIZE, page_size - 4);
-    Slice page_slice(page->data(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        // todo override is_cache_hit
-        RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
-        if (opts.read_file->is_cache_hit()) {
-            ++opts.stats->pages_from_local_disk;
-        }
-        opts.stats->compressed_bytes_read_request += page_size;
-        ++opts.stats->io_count_request;
-    }
-
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        if (expect != actual) {
-            return Status::Corruption(
-                    strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2 encrypted=$3",
-                                        actual, expect, opts.read_file->filename(), opts.read_file->is_encrypted()));
-        }
+    std::unique_ptr<std::vector<uint8_t>> page;
+    Slice page_slice;
+    if (hit_compressed_cache) {
+        // the cached compressed page has no checksum suffix
+        const auto* cached_page = reinterpret_cast<const std::vector<uint8_t>*>(compressed_cache_handle.data());
+        page_slice = Slice(cached_page->data(), cached_page->size());
+        opts.stats->cached_compressed_pages_num++;
+    } else {
+        page.reset(new std::vector<uint8_t>());
+        raw::stl_vector_resize_uninitialized(page.get(), page_size + Column::APPEND_OVERFLOW_MAX_SIZE, page_size - 4);
+        page_slice = Slice(page->data(), page_size);
+        RETURN_IF_ERROR(_read_page_from_file(opts, &page_slice));
     }
 
-    // remove checksum suffix
-    page_slice.size -= 4;
     // parse and set footer
     uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
     if (!footer->ParseFromArray(page_slice.data + page_slice.size - 4 - footer_size, footer_size)) {
@@ -219,11 +251,27 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     }
 
     uint32_t body_size = page_slice.size - 4 - footer_size;
+    if (hit_compressed_cache && body_size == footer->uncompressed_size()) {
+        return Status::Corruption(strings::Substitute("Bad page: uncompressed page in compressed page cache, file=$0",
+                                                      opts.read_file->filename()));
+    }
+    bool insert_decompressed_page = true;
     if (body_size != footer->uncompressed_size()) { // need decompress body
         if (opts.codec == nullptr) {
             return Status::Corruption(strings::Substitute(
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
         }
+        if (use_compressed_cache && !hit_compressed_cache &&
+            footer->uncompressed_size() >= config::storage_page_cache_compressed_ratio_threshold * body_size) {
+            auto compressed_page = std::make_unique<std::vector<uint8_t>>(page_slice.data,
+                                                                          page_slice.data + page_slice.size);
+            ObjectCacheWriteOptions write_opts;
+            PageCacheHandle handle;
+            if (cache->insert(compressed_cache_key, compressed_page.get(), write_opts, &handle).ok()) {
+                compressed_page.release();
+                insert_decompressed_page = false;
+            }
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
         std::unique_ptr<std::vector<uint8_t>> decompressed_page(new std::vector<uint8_t>());
@@ -254,7 +302,7 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache && page_cache_available) {
+    if (opts.use_page_cache && page_cache_available && insert_decompressed_page) {
         // insert this page into cache and return the cache handle
         ObjectCacheWriteOptions opts;
         Status st = cache->insert(cache_key, page.get(), opts, &cache_handle);
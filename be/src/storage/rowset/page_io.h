@@ -115,6 +115,10 @@ public:
     //     `footer' stores the page footer.
     static Status read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                            PageFooterPB* footer);
+
+private:
+    // Read the page into `page_slice', verify and remove its checksum suffix.
+    static Status _read_page_from_file(const PageReadOptions& opts, Slice* page_slice);
 };
 
 } // namespace starrocks
@@ -344,12 +344,39 @@ Status ScalarColumnIterator::_load_next_page(bool* eos) {
         return Status::OK();
     }
 
+    _prefetch_data_pages();
     RETURN_IF_ERROR(_read_data_page(_page_iter));
     RETURN_IF_ERROR(_seek_to_pos_in_page(_page.get(), 0));
     *eos = false;
     return Status::OK();
 }
 
+// When the scan reads the pages one by one, advise the file to read the following pages in one batch once the
+// current page reaches the end of the last batch. The data pages of a column are stored contiguously.
+// The remote storage is skipped, it is read ahead by SharedBufferedInputStream when io coalesce is enabled.
+void ScalarColumnIterator::_prefetch_data_pages() {
+    const int32_t prefetch_num = config::column_data_page_prefetch_num;
+    const uint32_t page_index = _page_iter.page_index();
+    if (prefetch_num <= 0 || _opts.is_io_coalesce || page_index < _prefetch_end_page_index) {
+        return;
+    }
+    const uint32_t num_pages = _reader->num_data_pages();
+    const uint32_t end_page_index = std::min<uint32_t>(num_pages, page_index + 1 + prefetch_num);
+    if (page_index + 1 >= end_page_index) {
+        return;
+    }
+    OrdinalPageIndexIterator iter_start;
+    OrdinalPageIndexIterator iter_end;
+    if (!_reader->seek_by_page_index(page_index + 1, &iter_start).ok() ||
+        !_reader->seek_by_page_index(end_page_index - 1, &iter_end).ok()) {
+        return;
+    }
+    const auto offset = iter_start.page().offset;
+    const auto size = iter_end.page().offset + iter_end.page().size - offset;
+    _opts.read_file->prefetch(offset, size);
+    _prefetch_end_page_index = end_page_index;
+}
+
 template <LogicalType Type>
 Status ScalarColumnIterator::_load_dict_page() {
     DCHECK(_dict_decoder == nullptr);
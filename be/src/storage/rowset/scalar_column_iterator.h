@@ -113,6 +113,7 @@ private:
     static Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page);
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    void _prefetch_data_pages();
 
     template <LogicalType Type>
     int _do_dict_lookup(const Slice& word);
@@ -161,6 +162,9 @@ private:
     // current value ordinal
     ordinal_t _current_ordinal = 0;
 
+    // the data pages before this index have been advised to be read ahead
+    uint32_t _prefetch_end_page_index = 0;
+
     // page indexes those are DEL_PARTIAL_SATISFIED
     std::optional<std::unordered_set<uint32_t>> _delete_partial_satisfied_pages;
 
@@ -606,23 +606,33 @@ Status SegmentIterator::_get_row_ranges_by_vector_index() {
 
     SCOPED_RAW_TIMER(&_opts.stats->get_row_ranges_by_vector_index_timer);
 
+    // IVFPQ distances are computed again by the refine stage, so when no more than k rows pass the other filters
+    // they are exactly the top k and the search can be skipped.
+    if (_use_ivfpq && _vector_range < 0 && _scan_range.span_size() <= static_cast<size_t>(_k)) {
+        return Status::OK();
+    }
+
     Status st;
     std::map<rowid_t, float> id2distance_map;
     std::vector<int64_t> result_ids;
     std::vector<float> result_distances;
     std::vector<int64_t> filtered_result_ids;
-    DelIdFilter del_id_filter(_scan_range);
+    // The rows left by the other filters are pushed down as an allow-list, unless every row of the segment is left.
+    std::unique_ptr<DelIdFilter> del_id_filter;
+    if (_scan_range.span_size() < _segment->num_rows()) {
+        del_id_filter = std::make_unique<DelIdFilter>(_scan_range);
+    }
 
     {
         SCOPED_RAW_TIMER(&_opts.stats->vector_search_timer);
         if (_vector_range >= 0) {
-            st = _ann_reader->range_search(_query_view, _k, &result_ids, &result_distances, &del_id_filter,
+            st = _ann_reader->range_search(_query_view, _k, &result_ids, &result_distances, del_id_filter.get(),
                                            static_cast<float>(_vector_range), _result_order);
         } else {
             result_ids.resize(_k);
             result_distances.resize(_k);
             st = _ann_reader->search(_query_view, _k, (result_ids.data()),
-                                     reinterpret_cast<uint8_t*>(result_distances.data()), &del_id_filter);
+                                     reinterpret_cast<uint8_t*>(result_distances.data()), del_id_filter.get());
         }
     }
 
@@ -705,6 +715,13 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
 
                 RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r,
                                                                                    CompoundNodeType::AND));
+                // The IN and EQ predicates built from the runtime in-filter can also prune the pages by the bloom
+                // filter index, the min/max predicates don't support bloom filter and are ignored by it.
+                if (config::enable_index_bloom_filter && !r.empty() &&
+                    _column_iterators[cid]->has_original_bloom_filter_index()) {
+                    SCOPED_RAW_TIMER(&_opts.stats->bf_filter_ns);
+                    RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_bloom_filter(predicates, &r));
+                }
                 size_t prev_size = _range_iter.remaining_rows();
                 SparseRange<> res;
                 res.set_sorted(_scan_range.is_sorted());
@@ -814,6 +831,10 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
                     .max_dist_size = config::io_coalesce_read_max_distance_size,
                     .max_buffer_size = config::io_coalesce_read_max_buffer_size};
             shared_buffered_input_stream->set_coalesce_options(options);
+            if (config::io_coalesce_adaptive_distance_enable) {
+                shared_buffered_input_stream->set_coalesce_model(io::SharedBufferedInputStream::CoalesceModel::get(
+                        _opts.fs->type(), rfile->is_cache_hit()));
+            }
             iter_opts.read_file = shared_buffered_input_stream.get();
             iter_opts.is_io_coalesce = true;
             _column_files[cid] = std::move(shared_buffered_input_stream);
@@ -45,6 +45,9 @@
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "storage/flat_json_access_stats.h"
 #include "storage/index/index_descriptor.h"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
@@ -52,6 +55,7 @@
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
 #include "types/logical_type.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
@@ -209,11 +213,19 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
 
         opts.need_flat = config::enable_json_flat;
         opts.is_compaction = _opts.is_compaction;
+        opts.need_tune_compression = _opts.is_compaction && config::enable_compaction_compression_tuning;
 
         if (column.type() == LogicalType::TYPE_JSON && _opts.flat_json_config != nullptr) {
             opts.need_flat = _opts.flat_json_config->is_flat_json_enabled();
             opts.flat_json_config = _opts.flat_json_config.get();
         }
+        if (column.type() == LogicalType::TYPE_JSON && opts.need_flat && _opts.is_compaction &&
+            config::enable_json_flat_access_stats) {
+            auto hot_paths = FlatJsonAccessStats::instance()->hot_paths(_opts.tablet_id, std::string(column.name()));
+            for (auto& [path, type] : hot_paths) {
+                opts.flat_json_hot_paths.emplace_back(std::move(path));
+            }
+        }
 
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
@@ -292,6 +304,10 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
     }
     _num_rows_written = 0;
 
+    // finish the writers first, which encodes and compresses the last pages of the columns and can run in parallel,
+    // the data and indexes are then written to the file in column order
+    RETURN_IF_ERROR(_for_each_column(_column_writers.size(), [&](size_t i) { return _column_writers[i]->finish(); }));
+
     size_t num_columns = _tablet_schema->num_columns();
     for (size_t i = 0; i < _column_indexes.size(); ++i) {
         uint32_t column_index = _column_indexes[i];
@@ -301,7 +317,6 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         }
 
         auto& column_writer = _column_writers[i];
-        RETURN_IF_ERROR(column_writer->finish());
         // write data
         RETURN_IF_ERROR(column_writer->write_data());
         // write index
@@ -389,13 +404,57 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
     return Status::OK();
 }
 
+Status SegmentWriter::_for_each_column(size_t num_columns, const std::function<Status(size_t)>& func) {
+    ThreadPool* pool = ExecEnv::GetInstance()->segment_encode_thread_pool();
+    if (pool == nullptr || config::segment_encode_thread_pool_num_max <= 0 ||
+        num_columns < config::segment_encode_parallel_min_columns) {
+        for (size_t i = 0; i < num_columns; ++i) {
+            RETURN_IF_ERROR(func(i));
+        }
+        return Status::OK();
+    }
+
+    // the calling thread takes the group 0, the columns are interleaved between the groups so that the
+    // columns of the same type, which are often adjacent, are spread over the threads
+    const size_t num_groups = std::min<size_t>(num_columns, pool->max_threads() + 1);
+    std::vector<Status> statuses(num_groups);
+    auto run_group = [&](size_t group) {
+        for (size_t i = group; i < num_columns; i += num_groups) {
+            statuses[group] = func(i);
+            if (!statuses[group].ok()) {
+                return;
+            }
+        }
+    };
+    CountDownLatch latch(num_groups - 1);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t group = 1; group < num_groups; ++group) {
+        auto st = pool->submit_func([&, group]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            run_group(group);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            // the pool is shut down or its queue is full, run the group in this thread instead
+            run_group(group);
+            latch.count_down();
+        }
+    }
+    run_group(0);
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status SegmentWriter::append_chunk(const Chunk& chunk) {
     size_t chunk_num_rows = chunk.num_rows();
     size_t chunk_num_columns = chunk.num_columns();
-    for (size_t i = 0; i < chunk_num_columns; ++i) {
+    RETURN_IF_ERROR(_for_each_column(chunk_num_columns, [&](size_t i) {
         const Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
-    }
+        return _column_writers[i]->append(*col);
+    }));
 
     // TODO(cbl): put the fill full row column logic here is a bit hacky, this segment writer is used in many other
     //            situations(compaction etc.), so better to put it into somewhere early in the write pipeline
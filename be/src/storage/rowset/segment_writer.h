@@ -37,6 +37,7 @@
 #include <storage/flat_json_config.h>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -81,6 +82,7 @@ struct SegmentWriterOptions {
     std::string encryption_meta;
     bool is_compaction = false;
     std::shared_ptr<FlatJsonConfig> flat_json_config = nullptr;
+    int64_t tablet_id = 0;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -158,6 +160,9 @@ private:
     Status _write_raw_data(const std::vector<Slice>& slices);
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
     void _verify_footer();
+    // Run `func` on the first `num_columns` column writers. The columns are split into groups and encoded in
+    // the segment encode thread pool when the segment is wide enough, otherwise they run in the calling thread.
+    Status _for_each_column(size_t num_columns, const std::function<Status(size_t)>& func);
 
     uint32_t _segment_id;
     TabletSchemaCSPtr _tablet_schema;
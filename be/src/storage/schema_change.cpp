@@ -58,6 +58,7 @@
 #include "storage/tablet_meta_manager.h"
 #include "storage/tablet_updates.h"
 #include "util/failpoint/fail_point.h"
+#include "util/threadpool.h"
 #include "util/unaligned_access.h"
 
 namespace starrocks {
@@ -988,6 +989,69 @@ Status SchemaChangeHandler::_get_versions_to_be_changed(const TabletSharedPtr& b
     return Status::OK();
 }
 
+Status SchemaChangeHandler::_convert_rowset(SchemaChangeParams& sc_params, SchemaChange* sc_procedure, size_t idx,
+                                            StatusOr<RowsetSharedPtr>* new_rowset) {
+    VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[idx]->version();
+
+    const TabletSharedPtr& new_tablet = sc_params.new_tablet;
+    RowsetWriterContext writer_context;
+    writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
+    writer_context.tablet_uid = new_tablet->tablet_uid();
+    writer_context.tablet_id = new_tablet->tablet_id();
+    writer_context.partition_id = new_tablet->partition_id();
+    writer_context.tablet_schema_hash = new_tablet->schema_hash();
+    writer_context.rowset_path_prefix = new_tablet->schema_hash_path();
+    writer_context.tablet_schema = new_tablet->tablet_schema();
+    writer_context.rowset_state = VISIBLE;
+    writer_context.version = sc_params.rowsets_to_change[idx]->version();
+    writer_context.segments_overlap = sc_params.rowsets_to_change[idx]->rowset_meta()->segments_overlap();
+
+    if (sc_params.sc_sorting) {
+        writer_context.schema_change_sorting = true;
+    }
+
+    std::unique_ptr<RowsetWriter> rowset_writer;
+    if (auto st = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer); !st.ok()) {
+        return Status::InternalError(fmt::format("bulid rowset writer failed: {}", st.to_string()));
+    }
+
+    RETURN_IF_ERROR(sc_procedure->process(sc_params.rowset_readers[idx].get(), rowset_writer.get(), new_tablet,
+                                          sc_params.base_tablet, sc_params.rowsets_to_change[idx],
+                                          sc_params.base_tablet_schema));
+    sc_params.rowset_readers[idx]->close();
+    *new_rowset = rowset_writer->build();
+    if (new_rowset->ok() && config::enable_rowset_verify) {
+        RETURN_IF_ERROR((**new_rowset)->verify());
+    }
+    return Status::OK();
+}
+
+Status SchemaChangeHandler::_convert_rowsets_in_parallel(SchemaChangeParams& sc_params, SchemaChange* sc_procedure,
+                                                         size_t parallelism,
+                                                         std::vector<StatusOr<RowsetSharedPtr>>* new_rowsets) {
+    const size_t num_rowsets = sc_params.rowset_readers.size();
+    new_rowsets->assign(num_rowsets, Status::InternalError("rowset not converted"));
+    std::vector<Status> statuses(num_rowsets);
+
+    std::unique_ptr<ThreadPool> pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("schema_change").set_min_threads(0).set_max_threads(parallelism).build(&pool));
+    // the memory of all the rowsets is accounted to the tracker of the task
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    Status submit_st;
+    for (size_t i = 0; i < num_rowsets && submit_st.ok(); i++) {
+        submit_st = pool->submit_func([&, i]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            statuses[i] = _convert_rowset(sc_params, sc_procedure, i, &(*new_rowsets)[i]);
+        });
+    }
+    pool->wait();
+    RETURN_IF_ERROR(submit_st);
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_params) {
     VLOG(2) << _alter_msg_header << "begin to convert historical rowsets for new_tablet from base_tablet."
             << " base_tablet=" << sc_params.base_tablet->full_name()
@@ -1000,12 +1064,20 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     });
     std::unique_ptr<SchemaChange> sc_procedure;
     auto chunk_changer = sc_params.chunk_changer.get();
+    const size_t num_rowsets = sc_params.rowset_readers.size();
+    size_t parallelism = 1;
+    if ((sc_params.sc_sorting || sc_params.sc_directly) && !chunk_changer->has_exprs()) {
+        parallelism = std::min<size_t>(num_rowsets, std::max(config::schema_change_max_parallel_rowsets, 1));
+        parallelism = std::max<size_t>(parallelism, 1);
+    }
     if (sc_params.sc_sorting) {
         VLOG(2) << _alter_msg_header << "doing schema change with sorting for base_tablet "
                 << sc_params.base_tablet->full_name();
         _task_detail_msg += fmt::format("[tablet: {} doing sorting schema change]", sc_params.base_tablet->full_name());
+        // the rowsets converted at the same time share the memory limitation
         size_t memory_limitation =
-                static_cast<size_t>(config::memory_limitation_per_thread_for_schema_change) * 1024 * 1024 * 1024;
+                static_cast<size_t>(config::memory_limitation_per_thread_for_schema_change) * 1024 * 1024 * 1024 /
+                parallelism;
         sc_procedure = std::make_unique<SchemaChangeWithSorting>(chunk_changer, memory_limitation);
     } else if (sc_params.sc_directly) {
         VLOG(2) << _alter_msg_header << "doing directly schema change for base_tablet "
@@ -1030,49 +1102,28 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     std::vector<std::vector<DeltaColumnGroupList>> all_historical_dcgs;
     std::vector<RowsetId> new_rowset_ids;
 
-    for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
-        VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
+    std::vector<StatusOr<RowsetSharedPtr>> converted_rowsets;
+    if (parallelism > 1) {
+        _task_detail_msg += fmt::format("[convert {} rowsets in {} threads]", num_rowsets, parallelism);
+        RETURN_IF_ERROR(
+                _convert_rowsets_in_parallel(sc_params, sc_procedure.get(), parallelism, &converted_rowsets));
+    }
 
+    for (int i = 0; i < num_rowsets; ++i) {
         TabletSharedPtr new_tablet = sc_params.new_tablet;
         TabletSharedPtr base_tablet = sc_params.base_tablet;
-        RowsetWriterContext writer_context;
-        writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
-        writer_context.tablet_uid = new_tablet->tablet_uid();
-        writer_context.tablet_id = new_tablet->tablet_id();
-        writer_context.partition_id = new_tablet->partition_id();
-        writer_context.tablet_schema_hash = new_tablet->schema_hash();
-        writer_context.rowset_path_prefix = new_tablet->schema_hash_path();
-        writer_context.tablet_schema = new_tablet->tablet_schema();
-        writer_context.rowset_state = VISIBLE;
-        writer_context.version = sc_params.rowsets_to_change[i]->version();
-        writer_context.segments_overlap = sc_params.rowsets_to_change[i]->rowset_meta()->segments_overlap();
-
-        if (sc_params.sc_sorting) {
-            writer_context.schema_change_sorting = true;
-        }
-
-        std::unique_ptr<RowsetWriter> rowset_writer;
-        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
-        if (!status.ok()) {
-            return Status::InternalError(fmt::format("bulid rowset writer failed: {}", status.to_string()));
-        }
-
-        auto st = sc_procedure->process(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
-                                        sc_params.rowsets_to_change[i], sc_params.base_tablet_schema);
-        if (!st.ok()) {
-            return st;
+        StatusOr<RowsetSharedPtr> new_rowset = Status::InternalError("rowset not converted");
+        if (parallelism > 1) {
+            new_rowset = std::move(converted_rowsets[i]);
+        } else {
+            RETURN_IF_ERROR(_convert_rowset(sc_params, sc_procedure.get(), i, &new_rowset));
         }
-        sc_params.rowset_readers[i]->close();
-        auto new_rowset = rowset_writer->build();
         if (!new_rowset.ok()) {
             VLOG(2) << _alter_msg_header << "failed to build rowset: " << new_rowset.status() << ". exit alter process";
             _task_detail_msg +=
                     fmt::format("[fail to build rowset: {}. exit alter process]", new_rowset.status().to_string());
             break;
         }
-        if (config::enable_rowset_verify) {
-            RETURN_IF_ERROR((*new_rowset)->verify());
-        }
         status = sc_params.new_tablet->add_rowset(*new_rowset, false);
         FAIL_POINT_TRIGGER_EXECUTE(add_rowset_already_exist,
                                    { status = Status::AlreadyExist("rowset already exist"); });
@@ -156,6 +156,15 @@ private:
 
     Status _convert_historical_rowsets(SchemaChangeParams& sc_params);
 
+    // Convert the rowset `idx` of `sc_params`. The returned status is of the conversion, `new_rowset` is of building
+    // the converted rowset.
+    Status _convert_rowset(SchemaChangeParams& sc_params, SchemaChange* sc_procedure, size_t idx,
+                           StatusOr<RowsetSharedPtr>* new_rowset);
+
+    // Convert all the rowsets of `sc_params` in `parallelism` threads, only for the conversions without expressions.
+    Status _convert_rowsets_in_parallel(SchemaChangeParams& sc_params, SchemaChange* sc_procedure, size_t parallelism,
+                                        std::vector<StatusOr<RowsetSharedPtr>>* new_rowsets);
+
     DISALLOW_COPY(SchemaChangeHandler);
     std::string _alter_msg_header;
     std::string _task_detail_msg = "";
@@ -235,6 +235,11 @@ StatusOr<Buffer<uint8_t>> ChunkChanger::_execute_where_expr(ChunkPtr& chunk) {
     return filter;
 }
 
+bool ChunkChanger::has_exprs() const {
+    // the mv expressions are only evaluated by the rollups
+    return _alter_job_type == TAlterJobType::ROLLUP || _where_expr != nullptr || !_gc_exprs.empty();
+}
+
 bool ChunkChanger::change_chunk_v2(ChunkPtr& base_chunk, ChunkPtr& new_chunk, const Schema& base_schema,
                                    const Schema& new_schema, MemPool* mem_pool) {
     if (new_chunk->num_columns() != _schema_mapping.size()) {
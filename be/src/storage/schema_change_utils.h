@@ -82,6 +82,10 @@ public:
 
     std::unordered_map<int, ExprContext*>* get_gc_exprs() { return &_gc_exprs; }
 
+    // Whether converting a chunk may evaluate a where, generated column or mv expression, whose contexts can not
+    // be shared by threads.
+    bool has_exprs() const;
+
     bool change_chunk_v2(ChunkPtr& base_chunk, ChunkPtr& new_chunk, const Schema& base_schema, const Schema& new_schema,
                          MemPool* mem_pool);
 
@@ -34,8 +34,13 @@
 
 #include "storage/short_key_index.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
 
+#include "common/config.h"
+#include "gutil/endian.h"
 #include "gutil/strings/substitute.h"
 #include "util/coding.h"
 
@@ -97,8 +102,57 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const ShortKeyFooterPB& fo
     if (offset_slice.size != 0) {
         return Status::Corruption("Still has data after parse all key offset");
     }
+
+    _prefixes.resize(_footer.num_items());
+    for (uint32_t i = 0; i < _footer.num_items(); ++i) {
+        _prefixes[i] = key_prefix(Slice(_key_data.data + _offsets[i], _offsets[i + 1] - _offsets[i]));
+    }
     _parsed = true;
     return Status::OK();
 }
 
+uint64_t ShortKeyIndexDecoder::key_prefix(const Slice& key) {
+    uint8_t buf[sizeof(uint64_t)] = {0};
+    memcpy(buf, key.data, std::min(key.size, sizeof(uint64_t)));
+    return BigEndian::Load64(buf);
+}
+
+std::pair<uint32_t, uint32_t> ShortKeyIndexDecoder::_prefix_range(const Slice& key) const {
+    if (!config::enable_short_key_interpolation_search) {
+        return {0, num_items()};
+    }
+    uint64_t prefix = key_prefix(key);
+    uint32_t first = _prefix_lower_bound(prefix);
+    uint32_t last = prefix == std::numeric_limits<uint64_t>::max() ? num_items() : _prefix_lower_bound(prefix + 1);
+    return {first, last};
+}
+
+uint32_t ShortKeyIndexDecoder::_prefix_lower_bound(uint64_t prefix) const {
+    // the items before lo are less than prefix, the items from hi are not less than prefix
+    size_t lo = 0;
+    size_t hi = _prefixes.size();
+    // the keys may be skewed, fall back to binary search if the interpolation doesn't converge quickly
+    constexpr int kMaxProbes = 8;
+    constexpr size_t kMinInterpolationSize = 16;
+    for (int probe = 0; probe < kMaxProbes && hi - lo > kMinInterpolationSize; ++probe) {
+        uint64_t lo_value = _prefixes[lo];
+        uint64_t hi_value = _prefixes[hi - 1];
+        if (prefix <= lo_value) {
+            return lo;
+        }
+        if (prefix > hi_value) {
+            return hi;
+        }
+        // lo_value < prefix <= hi_value
+        auto ratio = static_cast<long double>(prefix - lo_value) / static_cast<long double>(hi_value - lo_value);
+        size_t pos = lo + std::min(static_cast<size_t>(ratio * (hi - 1 - lo)), hi - 1 - lo);
+        if (_prefixes[pos] < prefix) {
+            lo = pos + 1;
+        } else {
+            hi = pos;
+        }
+    }
+    return std::lower_bound(_prefixes.begin() + lo, _prefixes.begin() + hi, prefix) - _prefixes.begin();
+}
+
 } // namespace starrocks
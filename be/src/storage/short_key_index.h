@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <iterator>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
@@ -216,26 +217,42 @@ public:
     }
 
     int64_t mem_usage() const {
-        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() + _key_data.size +
-               _footer.ByteSizeLong() - sizeof(_footer);
+        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() + sizeof(uint64_t) * _prefixes.size() +
+               _key_data.size + _footer.ByteSizeLong() - sizeof(_footer);
     }
 
+    // The first 8 bytes of the key as a big endian integer, padded with zero. The prefixes keep the order of
+    // the keys, i.e. prefix(a) < prefix(b) means a < b.
+    static uint64_t key_prefix(const Slice& key);
+
 private:
     template <bool lower_bound>
     ShortKeyIndexIterator seek(const Slice& key) const {
         auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
+        // only the items with the same prefix need to compare the whole key
+        auto [first, last] = _prefix_range(key);
         if (lower_bound) {
-            return std::lower_bound(begin(), end(), key, comparator);
+            return std::lower_bound(ShortKeyIndexIterator(this, first), ShortKeyIndexIterator(this, last), key,
+                                    comparator);
         } else {
-            return std::upper_bound(begin(), end(), key, comparator);
+            return std::upper_bound(ShortKeyIndexIterator(this, first), ShortKeyIndexIterator(this, last), key,
+                                    comparator);
         }
     }
 
+    // Return the range of the items whose prefix is equal to the prefix of key. The items before the range are
+    // less than key and the items after the range are greater than key.
+    std::pair<uint32_t, uint32_t> _prefix_range(const Slice& key) const;
+
+    // Return the first item whose prefix is not less than `prefix`, by interpolation search.
+    uint32_t _prefix_lower_bound(uint64_t prefix) const;
+
     bool _parsed{false};
 
     // All following fields are only valid after parse has been executed successfully
     ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
+    std::vector<uint64_t> _prefixes;
     Slice _key_data;
 };
 
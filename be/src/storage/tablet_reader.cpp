@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "storage/conjunctive_predicates.h"
 #include "storage/delete_predicates.h"
 #include "storage/empty_iterator.h"
+#include "storage/flat_json_access_stats.h"
 #include "storage/merge_iterator.h"
 #include "storage/olap_common.h"
 #include "storage/predicate_parser.h"
@@ -140,6 +142,33 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
     return st;
 }
 
+static bool is_conflict_json_path(const std::string& a, const std::string& b) {
+    if (a.size() == b.size()) {
+        return a == b;
+    }
+    const auto& shorter = a.size() < b.size() ? a : b;
+    const auto& longer = a.size() < b.size() ? b : a;
+    return longer.compare(0, shorter.size(), shorter) == 0 && longer[shorter.size()] == '.';
+}
+
+// The hot query paths which are not flat in any input are still in the remain json, append them to the
+// compaction paths so that they are extracted from the remain as the types the queries read them.
+static void append_hot_json_paths(const std::vector<std::pair<std::string, LogicalType>>& hot_paths,
+                                  size_t max_column, std::vector<std::string>* paths,
+                                  std::vector<LogicalType>* types) {
+    for (const auto& [hot_path, hot_type] : hot_paths) {
+        if (paths->size() >= max_column) {
+            break;
+        }
+        bool conflict = std::any_of(paths->begin(), paths->end(),
+                                    [&](const std::string& path) { return is_conflict_json_path(path, hot_path); });
+        if (!conflict) {
+            paths->emplace_back(hot_path);
+            types->emplace_back(hot_type);
+        }
+    }
+}
+
 Status TabletReader::_init_compaction_column_paths(const TabletReaderParams& read_params) {
     if (!config::enable_compaction_flat_json || !is_compaction(read_params.reader_type) ||
         read_params.column_access_paths == nullptr) {
@@ -185,9 +214,24 @@ Status TabletReader::_init_compaction_column_paths(const TabletReaderParams& rea
             JsonPathDeriver deriver;
             auto flat_json_config = _tablet->flat_json_config();
             deriver.init_flat_json_config(flat_json_config.get());
+            std::vector<std::pair<std::string, LogicalType>> hot_paths;
+            if (config::enable_json_flat_access_stats) {
+                hot_paths = FlatJsonAccessStats::instance()->hot_paths(_tablet->tablet_id(), col_name);
+                std::vector<std::string> hot_names;
+                for (const auto& hot : hot_paths) {
+                    hot_names.emplace_back(hot.first);
+                }
+                deriver.set_hot_paths(std::move(hot_names));
+            }
             deriver.derived(readers);
             auto paths = deriver.flat_paths();
             auto types = deriver.flat_types();
+            if (!hot_paths.empty() && deriver.has_remain_json()) {
+                int max_column = flat_json_config != nullptr ? flat_json_config->get_flat_json_max_column_max()
+                                                             : config::json_flat_column_max;
+                size_t limit = max_column > 0 ? max_column : std::numeric_limits<size_t>::max();
+                append_hot_json_paths(hot_paths, limit, &paths, &types);
+            }
 
             VLOG(3) << "Compaction flat json column: " << JsonFlatPath::debug_flat_json(paths, types, true);
             ASSIGN_OR_RETURN(auto res, ColumnAccessPath::create(TAccessPathType::ROOT, col_name, i));
@@ -1215,6 +1215,21 @@ Status TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo&
                 return apply_st;
             }
         }
+        {
+            // the delta column files are the read amplification of their rowsets
+            std::lock_guard lg(_rowset_stats_lock);
+            for (const auto& [rssid, dcg] : state.delta_column_groups()) {
+                auto iter = _rowset_stats.upper_bound(rssid);
+                if (iter == _rowset_stats.begin()) {
+                    continue;
+                }
+                iter--;
+                if (rssid < iter->first + iter->second->num_segments) {
+                    iter->second->num_dcg_files += dcg->relative_column_files().size();
+                    _calc_compaction_score(iter->second.get());
+                }
+            }
+        }
         size_t num_dels = 0;
         // put delvec in cache
         TabletSegmentId tsid;
@@ -3547,6 +3562,13 @@ void TabletUpdates::_calc_compaction_score(RowsetStats* stats) {
     stats->compaction_score =
             config::update_compaction_size_threshold * (stats->num_segments > 1 ? stats->num_segments - 1 : 1) +
             (cost_record_read + cost_record_write) * delete_bytes - cost_record_write * stats->byte_size;
+    if (config::update_compaction_max_dcg_files_per_segment > 0) {
+        auto max_dcg_files = stats->num_segments * config::update_compaction_max_dcg_files_per_segment;
+        if (stats->num_dcg_files > max_dcg_files) {
+            stats->compaction_score +=
+                    config::update_compaction_size_threshold * (int64_t)(stats->num_dcg_files - max_dcg_files);
+        }
+    }
 }
 
 size_t TabletUpdates::_get_rowset_num_deletes(uint32_t rowsetid) {
@@ -3702,9 +3724,9 @@ int64_t TabletUpdates::get_average_row_size() {
 std::string TabletUpdates::RowsetStats::to_string() const {
     return strings::Substitute(
             "[seg:$0 row:$1 del:$2 bytes:$3 row_size:$4 compaction_score:$5 compaction_level:$6 "
-            "partial_update_by_column:$7]",
+            "partial_update_by_column:$7 dcg_files:$8]",
             num_segments, num_rows, num_dels, byte_size, row_size, compaction_score, compaction_level,
-            partial_update_by_column);
+            partial_update_by_column, num_dcg_files);
 }
 
 std::string TabletUpdates::debug_string() const {
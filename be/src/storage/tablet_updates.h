@@ -411,6 +411,8 @@ private:
         int64_t compaction_score = 0;
         int32_t compaction_level = -1;
         bool partial_update_by_column = false;
+        // the delta column files added by the column mode partial updates since the tablet is loaded
+        size_t num_dcg_files = 0;
         std::string to_string() const;
     };
 
@@ -1161,18 +1161,120 @@ int64_t BitmapValue::bitmap_subset_in_range_internal(const int64_t& range_start,
     }
 }
 
+void BitmapValue::_to_bitmap() {
+    switch (_type) {
+    case EMPTY:
+        _bitmap = std::make_shared<detail::Roaring64Map>();
+        break;
+    case SINGLE:
+        _bitmap = std::make_shared<detail::Roaring64Map>();
+        _bitmap->add(_sv);
+        break;
+    case SET:
+        _from_set_to_bitmap();
+        break;
+    case BITMAP:
+        return;
+    }
+    _type = BITMAP;
+}
+
 void BitmapValue::add_many(size_t n_args, const uint32_t* vals) {
     _mem_usage = 0;
-    if (_type != BITMAP) {
+    if (_type != BITMAP && n_args < 32) {
+        for (size_t i = 0; i < n_args; i++) {
+            add(vals[i]);
+        }
+    } else {
+        // materialize the bitmap once instead of growing the set value by value
+        _to_bitmap();
+        _copy_on_write();
+        _bitmap->addMany(n_args, vals);
+    }
+}
+
+void BitmapValue::add_many(size_t n_args, const uint64_t* vals) {
+    _mem_usage = 0;
+    if (_type != BITMAP && n_args < 32) {
         for (size_t i = 0; i < n_args; i++) {
             add(vals[i]);
         }
     } else {
+        _to_bitmap();
         _copy_on_write();
         _bitmap->addMany(n_args, vals);
     }
 }
 
+void BitmapValue::union_many(size_t n, const BitmapValue* const* values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    std::vector<uint64_t> small_values;
+    const BitmapValue* bitmap_value = nullptr;
+    for (size_t i = 0; i < n; i++) {
+        const BitmapValue* value = values[i];
+        switch (value->_type) {
+        case EMPTY:
+            break;
+        case SINGLE:
+            small_values.push_back(value->_sv);
+            break;
+        case SET:
+            small_values.insert(small_values.end(), value->_set->begin(), value->_set->end());
+            break;
+        case BITMAP:
+            bitmaps.push_back(value->_bitmap.get());
+            bitmap_value = value;
+            break;
+        }
+    }
+    if (bitmaps.empty()) {
+        add_many(small_values.size(), small_values.data());
+        return;
+    }
+
+    _mem_usage = 0;
+    switch (_type) {
+    case EMPTY:
+        break;
+    case SINGLE:
+        small_values.push_back(_sv);
+        break;
+    case SET:
+        small_values.insert(small_values.end(), _set->begin(), _set->end());
+        _set.reset();
+        break;
+    case BITMAP:
+        bitmaps.push_back(_bitmap.get());
+        break;
+    }
+
+    if (bitmaps.size() == 1) {
+        // share the only input bitmap like operator|= does, it's copied before the first write
+        _bitmap = bitmap_value->_bitmap;
+    } else {
+        _bitmap = std::make_shared<detail::Roaring64Map>(
+                detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    }
+    _type = BITMAP;
+    if (!small_values.empty()) {
+        _copy_on_write();
+        _bitmap->addMany(small_values.size(), small_values.data());
+    }
+}
+
+void BitmapValue::intersect_many(size_t n, const BitmapValue* const* values) {
+    std::vector<const BitmapValue*> sorted(values, values + n);
+    std::sort(sorted.begin(), sorted.end(), [](const BitmapValue* lhs, const BitmapValue* rhs) {
+        return lhs->cardinality() < rhs->cardinality();
+    });
+    for (const BitmapValue* value : sorted) {
+        if (_type == EMPTY) {
+            break;
+        }
+        *this &= *value;
+    }
+}
+
 uint64_t BitmapValueIter::next_batch(uint64_t* values, uint64_t count) {
     uint64_t remain_rows = _remain_rows();
     uint64_t read_count = std::min(count, remain_rows);
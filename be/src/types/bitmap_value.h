@@ -126,6 +126,7 @@ public:
     }
 
     void add_many(size_t n_args, const uint32_t* vals);
+    void add_many(size_t n_args, const uint64_t* vals);
 
     // Note: rhs BitmapValue is only readable after this method
     // Compute the union between the current bitmap and the provided bitmap.
@@ -148,6 +149,15 @@ public:
     BitmapValue& operator-=(const BitmapValue& rhs);
     BitmapValue& operator^=(const BitmapValue& rhs);
 
+    // Compute the union between the current bitmap and all the n provided bitmaps at once.
+    // The roaring bitmaps are merged by a single fastunion and the small values are added in batch,
+    // so the current bitmap is materialized at most once instead of once per input.
+    void union_many(size_t n, const BitmapValue* const* values);
+
+    // Compute the intersection between the current bitmap and all the n provided bitmaps.
+    // The inputs are intersected from the smallest cardinality and it stops as soon as the result is empty.
+    void intersect_many(size_t n, const BitmapValue* const* values);
+
     // check if value x is present
     bool contains(uint64_t x) const;
 
@@ -211,6 +221,8 @@ public:
 private:
     void _from_bitmap_to_smaller_type();
     void _from_set_to_bitmap();
+    // Convert the current value of any type to the BITMAP type.
+    void _to_bitmap();
 
     // The implementation of this function needs to place .h,
     // otherwise it cannot be inlined and affects the performance of BitmapValue::add.
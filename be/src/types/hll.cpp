@@ -525,6 +525,23 @@ static float harmomic_tables[65] = {
         5.421010862427522e-20f,
 };
 
+// Count the registers of each value. Neighbouring registers go to different sub histograms, so that the increments
+// of equal values, which are the most of them, do not wait for each other.
+static void build_register_histogram(const uint8_t* registers, uint32_t* histogram) {
+    constexpr int kNumSubHistograms = 4;
+    static_assert(HLL_REGISTERS_COUNT % kNumSubHistograms == 0);
+    uint32_t sub_histograms[kNumSubHistograms][256] = {};
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i += kNumSubHistograms) {
+        sub_histograms[0][registers[i]]++;
+        sub_histograms[1][registers[i + 1]]++;
+        sub_histograms[2][registers[i + 2]]++;
+        sub_histograms[3][registers[i + 3]]++;
+    }
+    for (int v = 0; v < 256; v++) {
+        histogram[v] = sub_histograms[0][v] + sub_histograms[1][v] + sub_histograms[2][v] + sub_histograms[3][v];
+    }
+}
+
 int64_t HyperLogLog::estimate_cardinality() const {
     if (_type == HLL_DATA_EMPTY) {
         return 0;
@@ -547,18 +564,17 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213f / (1 + 1.079f / num_streams);
     }
 
-    float harmonic_mean = 0;
-    int num_zero_registers = 0;
-
-    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += harmomic_tables[_registers.data[i]];
-
-        if (_registers.data[i] == 0) {
-            ++num_zero_registers;
-        }
+    // The harmonic sum over the histogram of the registers instead of a serial float sum over all of them, which is
+    // a chain of dependent additions.
+    uint32_t histogram[256];
+    build_register_histogram(_registers.data, histogram);
+    double harmonic_sum = 0;
+    for (int v = 0; v < 65; ++v) {
+        harmonic_sum += histogram[v] * static_cast<double>(harmomic_tables[v]);
     }
+    int num_zero_registers = histogram[0];
 
-    harmonic_mean = 1.0f / harmonic_mean;
+    float harmonic_mean = 1.0f / static_cast<float>(harmonic_sum);
     double estimate = alpha * num_streams * num_streams * harmonic_mean;
     // according to HerperLogLog current correction, if E is cardinal
     // E =< num_streams * 2.5 , LC has higher accuracy.
@@ -97,13 +97,17 @@ struct ColumnToArrowConverter<LT, AT, is_nullable, ConvFloatAndIntegerGuard<LT,
         if constexpr (is_nullable) {
             const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
             const auto* data_column = down_cast<const StarRocksColumnType*>(nullable_column->data_column().get());
-            const auto& data = data_column->get_data();
-            for (auto i = start_idx; i < end_idx; ++i) {
-                if (nullable_column->is_null(i)) {
-                    ARROW_RETURN_NOT_OK(builder->AppendNull());
-                } else {
-                    ARROW_RETURN_NOT_OK(builder->Append(data[i]));
+            const auto* values = data_column->get_data().data() + start_idx;
+            if (!nullable_column->has_null()) {
+                ARROW_RETURN_NOT_OK(builder->AppendValues(values, end_idx - start_idx));
+            } else {
+                // Append the values in batch with the validity, which is the negation of the null column
+                const auto* nulls = nullable_column->immutable_null_column_data().data() + start_idx;
+                std::vector<uint8_t> valid_bytes(end_idx - start_idx);
+                for (size_t i = 0; i < valid_bytes.size(); ++i) {
+                    valid_bytes[i] = !nulls[i];
                 }
+                ARROW_RETURN_NOT_OK(builder->AppendValues(values, end_idx - start_idx, valid_bytes.data()));
             }
         } else {
             const auto* data_column = down_cast<const StarRocksColumnType*>(column.get());
@@ -205,6 +209,15 @@ struct ColumnToArrowConverter<LT, AT, is_nullable, ConvBinaryGuard<LT, AT>> {
         }
     }
 
+    // Reserve the offsets and the bytes of the strings in [start_idx, end_idx), so they are appended without
+    // growing the buffers or going through std::string.
+    static inline arrow::Status reserve_binary(const StarRocksColumnType& data_column, int start_idx, int end_idx,
+                                               ArrowBuilderType* builder) {
+        const auto& offsets = data_column.get_offset();
+        ARROW_RETURN_NOT_OK(builder->Reserve(end_idx - start_idx));
+        return builder->ReserveData(offsets[end_idx] - offsets[start_idx]);
+    }
+
     static inline arrow::Status convert(const ColumnPtr& column, int start_idx, int end_idx,
                                         [[maybe_unused]] ColumnContext* column_context,
                                         arrow::ArrayBuilder* array_builder) {
@@ -214,12 +227,13 @@ struct ColumnToArrowConverter<LT, AT, is_nullable, ConvBinaryGuard<LT, AT>> {
             const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
             const auto* data_column = down_cast<const StarRocksColumnType*>(nullable_column->data_column().get());
             if constexpr (lt_is_string<LT>) {
-                const auto& data = data_column->get_proxy_data();
+                ARROW_RETURN_NOT_OK(reserve_binary(*data_column, start_idx, end_idx, builder));
                 for (auto i = start_idx; i < end_idx; ++i) {
                     if (nullable_column->is_null(i)) {
-                        ARROW_RETURN_NOT_OK(builder->AppendNull());
+                        builder->UnsafeAppendNull();
                     } else {
-                        ARROW_RETURN_NOT_OK(builder->Append(convert_datum(data[i], -1, -1)));
+                        Slice slice = data_column->get_slice(i);
+                        builder->UnsafeAppend(reinterpret_cast<const uint8_t*>(slice.data), slice.size);
                     }
                 }
             } else {
@@ -241,9 +255,10 @@ struct ColumnToArrowConverter<LT, AT, is_nullable, ConvBinaryGuard<LT, AT>> {
         } else {
             const auto* data_column = down_cast<const StarRocksColumnType*>(column.get());
             if constexpr (lt_is_string<LT>) {
-                const auto& data = data_column->get_proxy_data();
+                ARROW_RETURN_NOT_OK(reserve_binary(*data_column, start_idx, end_idx, builder));
                 for (auto i = start_idx; i < end_idx; ++i) {
-                    ARROW_RETURN_NOT_OK(builder->Append(convert_datum(data[i], -1, -1)));
+                    Slice slice = data_column->get_slice(i);
+                    builder->UnsafeAppend(reinterpret_cast<const uint8_t*>(slice.data), slice.size);
                 }
             } else {
                 const auto& data = data_column->get_data();
@@ -16,7 +16,11 @@
 
 #include <fmt/format.h>
 
+#include <mutex>
+
 #include "common/config.h"
+#include "jemalloc/jemalloc.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 
 namespace starrocks {
@@ -50,6 +54,71 @@ void CpuUtil::bind_cpus(Thread* thread, const std::vector<size_t>& cpuids) {
     thread->set_first_bound_cpuid(cpuids[0]);
 }
 
+std::vector<CpuUtil::CpuIds> CpuUtil::split_by_numa_node(const CpuIds& cpuids) {
+    std::vector<CpuIds> node_cpuids(CpuInfo::get_max_num_numa_nodes());
+    for (const auto cpu_id : cpuids) {
+        if (cpu_id >= CpuInfo::get_max_num_cores()) {
+            continue;
+        }
+        node_cpuids[CpuInfo::get_numa_node_for_core(cpu_id)].emplace_back(cpu_id);
+    }
+    return node_cpuids;
+}
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+// Create the arena of the NUMA node lazily, and return the arena index.
+// Return -1 if failed to create the arena.
+static int get_or_create_numa_arena(int numa_node) {
+    static std::mutex mutex;
+    static std::vector<int> node_arenas;
+
+    std::lock_guard<std::mutex> l(mutex);
+    if (node_arenas.empty()) {
+        node_arenas.resize(CpuInfo::get_max_num_numa_nodes(), -1);
+    }
+    if (numa_node < 0 || numa_node >= node_arenas.size()) {
+        return -1;
+    }
+    if (node_arenas[numa_node] < 0) {
+        unsigned arena_idx = 0;
+        size_t sz = sizeof(arena_idx);
+        if (je_mallctl("arenas.create", &arena_idx, &sz, nullptr, 0) != 0) {
+            return -1;
+        }
+        node_arenas[numa_node] = arena_idx;
+    }
+    return node_arenas[numa_node];
+}
+#endif
+
+void CpuUtil::bind_current_thread_to_numa_node(int numa_node, const CpuIds& cpuids) {
+    if (!cpuids.empty()) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (const auto cpu_id : cpuids) {
+            CPU_SET(cpu_id, &cpuset);
+        }
+        if (const int res = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset); res != 0) {
+            LOG(WARNING) << fmt::format("failed to bind numa node [tid={}] [node={}] [cpuids={}] [error={}]",
+                                        pthread_self(), numa_node, to_string(cpuids), std::strerror(res));
+            return;
+        }
+        if (auto* thread = Thread::current_thread(); thread != nullptr) {
+            thread->set_num_bound_cpu_cores(cpuids.size());
+            thread->set_first_bound_cpuid(cpuids[0]);
+        }
+    }
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    if (int arena_idx = get_or_create_numa_arena(numa_node); arena_idx >= 0) {
+        unsigned idx = arena_idx;
+        if (je_mallctl("thread.arena", nullptr, nullptr, &idx, sizeof(idx)) != 0) {
+            LOG(WARNING) << "failed to bind jemalloc arena [node=" << numa_node << "] [arena=" << arena_idx << "]";
+        }
+    }
+#endif
+}
+
 std::string CpuUtil::to_string(const CpuIds& cpuids) {
     std::string result = "(";
     for (size_t i = 0; i < cpuids.size(); i++) {
@@ -29,6 +29,16 @@ public:
 
     static void bind_cpus(Thread* thread, const std::vector<size_t>& cpuids);
 
+    // Group the cpuids by NUMA node. The i-th element contains the cpuids belonging to the i-th NUMA node,
+    // and may be empty.
+    static std::vector<CpuIds> split_by_numa_node(const CpuIds& cpuids);
+
+    // Bind the current thread to the cpuids and to a jemalloc arena dedicated to the NUMA node,
+    // so that the memory allocated by this thread is backed by the pages faulted in on the local node
+    // and is only reused by the threads of the same node.
+    // It is independent of `enable_resource_group_bind_cpus`.
+    static void bind_current_thread_to_numa_node(int numa_node, const CpuIds& cpuids);
+
     static std::string to_string(const CpuIds& cpuids);
 };
 
@@ -0,0 +1,286 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/debug/query_cpu_profiler.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "common/logging.h"
+#include "gen_cpp/Types_types.h"
+#include "runtime/current_thread.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace google::glog_internal_namespace_ {
+enum class SymbolizeOptions { kNone = 0, kNoLineNumbers = 1 };
+int GetStackTrace(void** result, int max_depth, int skip_count);
+bool Symbolize(void* pc, char* out, unsigned long out_size, SymbolizeOptions options = SymbolizeOptions::kNone);
+} // namespace google::glog_internal_namespace_
+
+namespace starrocks {
+
+// SIGRTMIN is used by get_stack_trace_for_thread().
+static int profiler_signal() {
+    return SIGRTMIN + 1;
+}
+
+static void query_cpu_profiler_sighandler(int signum, siginfo_t* siginfo, void* ucontext) {
+    int saved_errno = errno;
+    QueryCpuProfiler::instance()->record_sample();
+    errno = saved_errno;
+}
+
+QueryCpuProfiler* QueryCpuProfiler::instance() {
+    static QueryCpuProfiler profiler;
+    return &profiler;
+}
+
+size_t QueryCpuProfiler::StackKeyHash::operator()(const StackKey& key) const {
+    size_t hash = key.query_hi * 31 + key.query_lo;
+    hash = hash * 31 + key.workgroup_id;
+    for (void* pc : key.pcs) {
+        hash = hash * 31 + reinterpret_cast<size_t>(pc);
+    }
+    return hash;
+}
+
+Status QueryCpuProfiler::start(const Options& options) {
+    if (started()) {
+        return Status::OK();
+    }
+    if (options.frequency <= 0 || options.frequency > 1000) {
+        return Status::InvalidArgument(fmt::format("invalid query cpu profiler frequency: {}", options.frequency));
+    }
+    _options = options;
+    if (_ring == nullptr) {
+        _ring = std::make_unique<Slot[]>(kRingSize);
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = query_cpu_profiler_sighandler;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(profiler_signal(), &action, &_old_action) != 0) {
+        return Status::InternalError(
+                fmt::format("install query cpu profiler signal handler failed: {}", strerror(errno)));
+    }
+
+    struct sigevent sev;
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo = profiler_signal();
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &sev, &_timer) != 0) {
+        auto msg = fmt::format("create query cpu profiler timer failed: {}", strerror(errno));
+        sigaction(profiler_signal(), &_old_action, nullptr);
+        return Status::InternalError(msg);
+    }
+
+    // The timer runs on the process cpu clock, so a thread which keeps a cpu busy is sampled `frequency` times
+    // per second, and an idle thread is not sampled.
+    struct itimerspec its;
+    const int64_t interval_ns = 1000000000L / _options.frequency;
+    its.it_interval.tv_sec = interval_ns / 1000000000L;
+    its.it_interval.tv_nsec = interval_ns % 1000000000L;
+    its.it_value = its.it_interval;
+    if (timer_settime(_timer, 0, &its, nullptr) != 0) {
+        auto msg = fmt::format("arm query cpu profiler timer failed: {}", strerror(errno));
+        timer_delete(_timer);
+        sigaction(profiler_signal(), &_old_action, nullptr);
+        return Status::InternalError(msg);
+    }
+
+    _started.store(true, std::memory_order_release);
+    LOG(INFO) << "query cpu profiler started, frequency: " << _options.frequency
+              << ", retention hours: " << _options.retention_hours;
+    return Status::OK();
+}
+
+void QueryCpuProfiler::stop() {
+    if (!started()) {
+        return;
+    }
+    timer_delete(_timer);
+    // Ignore the signals which are still pending rather than restoring the default action which would terminate
+    // the process. The ring is never released, so a late signal handler is still safe.
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_IGN;
+    sigaction(profiler_signal(), &action, nullptr);
+    _started.store(false, std::memory_order_release);
+    aggregate();
+}
+
+void QueryCpuProfiler::record_sample() {
+    if (_ring == nullptr) {
+        return;
+    }
+    Slot& slot = _ring[_write_pos.fetch_add(1, std::memory_order_relaxed) % kRingSize];
+    int expected = EMPTY;
+    if (!slot.state.compare_exchange_strong(expected, WRITING, std::memory_order_acquire)) {
+        // The ring is full, the aggregation can not keep up.
+        _num_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Do not touch tls_thread_status before it is constructed, its lazy construction is not async-signal-safe.
+    if (tls_is_thread_status_init) {
+        const TUniqueId& query_id = tls_thread_status.query_id();
+        slot.query_hi = query_id.hi;
+        slot.query_lo = query_id.lo;
+        slot.workgroup_id = tls_thread_status.workgroup_id();
+    } else {
+        slot.query_hi = 0;
+        slot.query_lo = 0;
+        slot.workgroup_id = -1;
+    }
+    // Skip record_sample() and the signal handler.
+    slot.depth = google::glog_internal_namespace_::GetStackTrace(slot.pcs, kMaxStackDepth, 2);
+    slot.state.store(READY, std::memory_order_release);
+    _num_samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueryCpuProfiler::aggregate() {
+    if (_ring == nullptr) {
+        return;
+    }
+    const int64_t hour = UnixSeconds() / 3600;
+
+    std::lock_guard<std::mutex> l(_mutex);
+    auto& stacks = _hours[hour];
+    for (size_t i = 0; i < kRingSize; i++) {
+        Slot& slot = _ring[i];
+        if (slot.state.load(std::memory_order_acquire) != READY) {
+            continue;
+        }
+        StackKey key{slot.query_hi, slot.query_lo, slot.workgroup_id,
+                     std::vector<void*>(slot.pcs, slot.pcs + std::max(slot.depth, 0))};
+        slot.state.store(EMPTY, std::memory_order_release);
+
+        auto it = stacks.find(key);
+        if (it != stacks.end()) {
+            it->second++;
+        } else if (stacks.size() < _options.max_stacks_per_hour) {
+            stacks.emplace(std::move(key), 1);
+        } else {
+            _num_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    while (!_hours.empty() && _hours.begin()->first <= hour - _options.retention_hours) {
+        _hours.erase(_hours.begin());
+    }
+}
+
+QueryCpuProfiler::HourlyStacks QueryCpuProfiler::_collect(const Filter& filter) {
+    TUniqueId query_id;
+    if (!filter.query_id.empty()) {
+        if (!parse_id(filter.query_id, &query_id)) {
+            return {};
+        }
+    }
+    const int64_t since_hour = UnixSeconds() / 3600 - std::max(filter.hours, 1) + 1;
+
+    HourlyStacks result;
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto it = _hours.lower_bound(since_hour); it != _hours.end(); ++it) {
+        for (const auto& [key, count] : it->second) {
+            if (!filter.query_id.empty() && (key.query_hi != query_id.hi || key.query_lo != query_id.lo)) {
+                continue;
+            }
+            if (filter.workgroup_id >= 0 && key.workgroup_id != filter.workgroup_id) {
+                continue;
+            }
+            result[key] += count;
+        }
+    }
+    return result;
+}
+
+std::string QueryCpuProfiler::dump_folded(const Filter& filter) {
+    HourlyStacks stacks = _collect(filter);
+
+    std::unordered_map<void*, std::string> symbols;
+    auto symbolize = [&](void* pc) -> const std::string& {
+        auto it = symbols.find(pc);
+        if (it != symbols.end()) {
+            return it->second;
+        }
+        char buf[1024];
+        std::string symbol;
+        if (google::glog_internal_namespace_::Symbolize(pc, buf, sizeof(buf))) {
+            symbol = buf;
+            // ';' separates the frames in the folded format.
+            std::replace(symbol.begin(), symbol.end(), ';', ':');
+        } else {
+            symbol = fmt::format("{}", pc);
+        }
+        return symbols.emplace(pc, std::move(symbol)).first->second;
+    };
+
+    std::stringstream ss;
+    for (const auto& [key, count] : stacks) {
+        ss << "workgroup_" << key.workgroup_id;
+        if (key.query_hi != 0 || key.query_lo != 0) {
+            TUniqueId query_id;
+            query_id.hi = key.query_hi;
+            query_id.lo = key.query_lo;
+            ss << ";query_" << print_id(query_id);
+        } else {
+            ss << ";no_query";
+        }
+        // The pcs are from the leaf to the root.
+        for (auto it = key.pcs.rbegin(); it != key.pcs.rend(); ++it) {
+            ss << ';' << symbolize(*it);
+        }
+        ss << ' ' << count << '\n';
+    }
+    return ss.str();
+}
+
+std::string QueryCpuProfiler::dump_pprof(const Filter& filter) {
+    HourlyStacks stacks = _collect(filter);
+
+    // Merge the stacks of different queries and workgroups, pprof does not know them.
+    HourlyStacks by_pcs;
+    for (const auto& [key, count] : stacks) {
+        by_pcs[StackKey{0, 0, -1, key.pcs}] += count;
+    }
+
+    std::vector<uintptr_t> words;
+    // header: header count, header words, version, sampling period in microseconds, padding
+    words.insert(words.end(), {0, 3, 0, static_cast<uintptr_t>(1000000 / std::max(_options.frequency, 1)), 0});
+    for (const auto& [key, count] : by_pcs) {
+        words.emplace_back(count);
+        words.emplace_back(key.pcs.size());
+        for (void* pc : key.pcs) {
+            words.emplace_back(reinterpret_cast<uintptr_t>(pc));
+        }
+    }
+    // trailer
+    words.insert(words.end(), {0, 1, 0});
+
+    std::string result(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uintptr_t));
+    std::ifstream maps("/proc/self/maps");
+    result.append(std::string(std::istreambuf_iterator<char>(maps), std::istreambuf_iterator<char>()));
+    return result;
+}
+
+} // namespace starrocks
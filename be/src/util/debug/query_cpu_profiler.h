@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <signal.h>
+#include <time.h>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// A low overhead sampling cpu profiler which is meant to be always on.
+//
+// A timer on the process cpu clock fires `frequency` times per cpu second, so every busy thread is sampled about
+// `frequency` times per second. The signal handler captures the stack of the interrupted thread together with
+// the query id and the workgroup id set in its CurrentThread, and puts them into a lock-free ring.
+// `aggregate()`, called periodically by a daemon thread, moves the ring into hourly aggregates which are kept for
+// `retention_hours`, so the cpu usage of a query or a workgroup can be looked at after the fact.
+class QueryCpuProfiler {
+public:
+    struct Options {
+        int frequency = 19;
+        int retention_hours = 24;
+        // The max number of distinct (query, workgroup, stack) per hour, the samples beyond it are dropped.
+        size_t max_stacks_per_hour = 100000;
+    };
+
+    struct Filter {
+        // Only the samples of the last `hours` hours, including the current one.
+        int hours = 1;
+        // Only the samples of this query if it is not empty, in the format of print_id().
+        std::string query_id;
+        // Only the samples of this workgroup if it is not negative.
+        int64_t workgroup_id = -1;
+    };
+
+    static QueryCpuProfiler* instance();
+
+    Status start(const Options& options);
+    void stop();
+    bool started() const { return _started.load(std::memory_order_acquire); }
+
+    void aggregate();
+
+    // Folded stacks in the input format of flamegraph.pl, one `frame;...;frame count` per line from the root to
+    // the leaf. The first two frames are the workgroup and the query of the samples.
+    std::string dump_folded(const Filter& filter);
+
+    // The legacy binary cpu profile format of gperftools, which can be read by pprof.
+    std::string dump_pprof(const Filter& filter);
+
+    int64_t num_samples() const { return _num_samples.load(std::memory_order_relaxed); }
+    int64_t num_dropped_samples() const { return _num_dropped.load(std::memory_order_relaxed); }
+
+    // Called by the signal handler, must be async-signal-safe.
+    void record_sample();
+
+private:
+    static constexpr int kMaxStackDepth = 48;
+    static constexpr size_t kRingSize = 8192;
+
+    enum SlotState : int { EMPTY = 0, WRITING = 1, READY = 2 };
+
+    struct Slot {
+        std::atomic<int> state{EMPTY};
+        int64_t query_hi = 0;
+        int64_t query_lo = 0;
+        int64_t workgroup_id = -1;
+        int depth = 0;
+        void* pcs[kMaxStackDepth];
+    };
+
+    struct StackKey {
+        int64_t query_hi;
+        int64_t query_lo;
+        int64_t workgroup_id;
+        std::vector<void*> pcs;
+
+        bool operator==(const StackKey& other) const {
+            return query_hi == other.query_hi && query_lo == other.query_lo && workgroup_id == other.workgroup_id &&
+                   pcs == other.pcs;
+        }
+    };
+
+    struct StackKeyHash {
+        size_t operator()(const StackKey& key) const;
+    };
+
+    using HourlyStacks = std::unordered_map<StackKey, int64_t, StackKeyHash>;
+
+    QueryCpuProfiler() = default;
+
+    // Merge the stacks of the hours selected by `filter`.
+    HourlyStacks _collect(const Filter& filter);
+
+    Options _options;
+    std::atomic<bool> _started{false};
+    timer_t _timer;
+    struct sigaction _old_action;
+
+    std::unique_ptr<Slot[]> _ring;
+    std::atomic<uint64_t> _write_pos{0};
+    std::atomic<int64_t> _num_samples{0};
+    std::atomic<int64_t> _num_dropped{0};
+
+    std::mutex _mutex;
+    // hour since epoch -> stacks
+    std::map<int64_t, HourlyStacks> _hours;
+};
+
+} // namespace starrocks
@@ -31,13 +31,15 @@ namespace starrocks {
 // FixedSizeHashMap
 // Key: KeyType integer type eg: uint8 uint16
 // value shouldn't be nullptr
+// TableSize: the keys are in [0, TableSize), all the values of KeyType by default. A smaller one is for the keys of
+// a known small range, e.g. the codes of a global dictionary.
 
-template <typename KeyType, typename ValueType, PhmapSeed seed>
+template <typename KeyType, typename ValueType, PhmapSeed seed, int TableSize = 1 << sizeof(KeyType) * 8>
 class SmallFixedSizeHashMap {
 public:
     static_assert(std::is_integral_v<KeyType>);
     static_assert(std::is_pointer_v<ValueType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = TableSize;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -84,6 +86,7 @@ public:
     template <class F>
     iterator lazy_emplace(KeyType key, F&& f) {
         auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(static_cast<size_t>(search_key), static_cast<size_t>(hash_table_size));
         if (_hash_table[search_key] == nullptr) {
             _size++;
             f([&](KeyType key, ValueType value) {
@@ -138,11 +141,11 @@ private:
     ValueType _hash_table[hash_table_size + 1];
 };
 
-template <typename KeyType, PhmapSeed seed>
+template <typename KeyType, PhmapSeed seed, int TableSize = 1 << sizeof(KeyType) * 8>
 class SmallFixedSizeHashSet {
 public:
     static_assert(std::is_integral_v<KeyType>);
-    static constexpr int hash_table_size = 1 << sizeof(KeyType) * 8;
+    static constexpr int hash_table_size = TableSize;
 
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
@@ -187,6 +190,7 @@ public:
     iterator end() { return iterator(_hash_table, hash_table_size); }
 
     void emplace(KeyType key) {
+        DCHECK_LT(static_cast<size_t>(static_cast<search_key_type>(key)), static_cast<size_t>(hash_table_size));
         _size += _hash_table[static_cast<search_key_type>(key)] == 0;
         _hash_table[static_cast<search_key_type>(key)] = 1;
     }
@@ -53,15 +53,70 @@
 #include "util/cpu_info.h"
 #include "util/int96.h"
 #include "util/murmur_hash3.h"
+#include "util/unaligned_access.h"
 
 namespace starrocks {
 
+// Slicing-by-8 tables of the zlib crc32 polynomial, used to compute the crc of small fixed length values inline.
+struct ZlibCrc32Tables {
+    uint32_t t[8][256];
+
+    constexpr ZlibCrc32Tables() : t() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int k = 0; k < 8; k++) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+            }
+            t[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++) {
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
+inline constexpr ZlibCrc32Tables kZlibCrc32Tables{};
+
 // Utility class to compute hash values.
 class HashUtil {
 public:
     static uint32_t zlib_crc_hash(const void* data, int32_t bytes, uint32_t hash) {
         return crc32(hash, (const unsigned char*)data, bytes);
     }
+
+    // Same result as zlib_crc_hash, but inlined for the values of 1/2/4/8/16 bytes, which saves the call into zlib
+    // for each row when hashing a fixed length column.
+    template <size_t bytes>
+    ALWAYS_INLINE static uint32_t zlib_crc_hash_fixed(const void* data, uint32_t hash) {
+        if constexpr (bytes == 16) {
+            uint32_t seed = zlib_crc_hash_fixed<8>(data, hash);
+            return zlib_crc_hash_fixed<8>(reinterpret_cast<const uint8_t*>(data) + 8, seed);
+        } else if constexpr (bytes == 8 || bytes == 4) {
+            const auto& t = kZlibCrc32Tables.t;
+            uint32_t crc = ~hash;
+            if constexpr (bytes == 8) {
+                uint64_t v = unaligned_load<uint64_t>(data) ^ crc;
+                crc = t[7][v & 0xff] ^ t[6][(v >> 8) & 0xff] ^ t[5][(v >> 16) & 0xff] ^ t[4][(v >> 24) & 0xff] ^
+                      t[3][(v >> 32) & 0xff] ^ t[2][(v >> 40) & 0xff] ^ t[1][(v >> 48) & 0xff] ^ t[0][v >> 56];
+            } else {
+                uint32_t v = unaligned_load<uint32_t>(data) ^ crc;
+                crc = t[3][v & 0xff] ^ t[2][(v >> 8) & 0xff] ^ t[1][(v >> 16) & 0xff] ^ t[0][v >> 24];
+            }
+            return ~crc;
+        } else if constexpr (bytes == 2 || bytes == 1) {
+            const auto& t = kZlibCrc32Tables.t;
+            const auto* s = reinterpret_cast<const uint8_t*>(data);
+            uint32_t crc = ~hash;
+            for (size_t i = 0; i < bytes; i++) {
+                crc = (crc >> 8) ^ t[0][(crc ^ s[i]) & 0xff];
+            }
+            return ~crc;
+        } else {
+            return zlib_crc_hash(data, bytes, hash);
+        }
+    }
 #ifdef __SSE4_2__
     // Compute the Crc32 hash for data using SSE4 instructions.  The input hash parameter is
     // the current hash/seed value.
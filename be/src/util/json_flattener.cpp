@@ -378,6 +378,27 @@ void JsonPathDeriver::init_flat_json_config(const FlatJsonConfig* flat_json_conf
     }
 }
 
+void JsonPathDeriver::set_hot_paths(std::vector<std::string> hot_paths) {
+    DCHECK(_path_root == nullptr);
+    _hot_paths = std::move(hot_paths);
+    _hot_root.reset();
+    if (_hot_paths.empty()) {
+        return;
+    }
+    _hot_root = std::make_shared<JsonFlatPath>();
+    for (const auto& path : _hot_paths) {
+        JsonFlatPath::normalize_from_path(path, _hot_root.get());
+    }
+}
+
+static const JsonFlatPath* find_hot_child(const JsonFlatPath* hot, const std::string_view& key) {
+    if (hot == nullptr) {
+        return nullptr;
+    }
+    auto iter = hot->children.find(key);
+    return iter == hot->children.end() ? nullptr : iter->second.get();
+}
+
 void JsonPathDeriver::derived(const std::vector<const Column*>& json_datas) {
     DCHECK(_paths.empty());
     DCHECK(_types.empty());
@@ -542,19 +563,21 @@ void JsonPathDeriver::_derived(const Column* col, size_t mark_row) {
         // if the number of missed rows exceeds (1 - _min_json_sparsity_factor) * total_rows, then the path must not be extracted.
         if (((mark_row + i) % check_batch) == 0) {
             size_t hits_min = mark_row + i > ignore_max ? mark_row + i - ignore_max : 0;
-            _clean_sparsity_path("", _path_root.get(), hits_min);
+            _clean_sparsity_path("", _path_root.get(), _hot_root.get(), hits_min);
         }
     }
 }
 
-void JsonPathDeriver::_clean_sparsity_path(const std::string_view& name, JsonFlatPath* node, size_t check_hits_min) {
+void JsonPathDeriver::_clean_sparsity_path(const std::string_view& name, JsonFlatPath* node, const JsonFlatPath* hot,
+                                           size_t check_hits_min) {
     for (auto& [key, child] : node->children) {
-        _clean_sparsity_path(key, child.get(), check_hits_min);
+        _clean_sparsity_path(key, child.get(), find_hot_child(hot, key), check_hits_min);
     }
     auto iter = node->children.begin();
     while (iter != node->children.end()) {
         auto desc = _derived_maps[iter->second.get()];
-        if (desc.hits < check_hits_min) {
+        // the hot paths are kept even if they are sparse
+        if (desc.hits < check_hits_min && find_hot_child(hot, iter->first) == nullptr) {
             if (_generate_filter) {
                 _remain_keys.insert(iter->first);
             }
@@ -609,7 +632,7 @@ void JsonPathDeriver::_visit_json_paths(const vpack::Slice& value, JsonFlatPath*
 }
 
 // why dfs? because need compute parent isn't extract base on bottom-up, stack is not suitable
-uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const std::string& absolute_path,
+uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const JsonFlatPath* hot, const std::string& absolute_path,
                                         std::vector<std::pair<JsonFlatPath*, std::string>>* hit_leaf) {
     uint32_t flat_count = 0;
     for (auto& [key, child] : node->children) {
@@ -621,7 +644,7 @@ uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const std::string& a
             // input string `a\"b` -> in binary `a\\\"b` -> vpack json binary `a\"b`
             // it's take us can't identify `"` and `\` corrently
             std::string abs_path = fmt::format("{}.{}", absolute_path, key);
-            flat_count += _dfs_finalize(child.get(), abs_path, hit_leaf);
+            flat_count += _dfs_finalize(child.get(), find_hot_child(hot, key), abs_path, hit_leaf);
         } else {
             child->remain = true;
         }
@@ -633,7 +656,13 @@ uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const std::string& a
 
         bool is_base_type = desc.base_type_count >= desc.hits - (desc.hits * config::json_flat_complex_type_factor);
         bool type_check = config::enable_json_flat_complex_type || is_base_type;
-        if (type_check && desc.multi_times <= 0 && desc.hits >= _total_rows * _min_json_sparsity_factory) {
+        // a hot path is queried exactly on this leaf, flatten it as long as it exists
+        bool is_hot = hot != nullptr && hot->children.empty();
+        bool sparsity_check = is_hot ? desc.hits > 0 : desc.hits >= _total_rows * _min_json_sparsity_factory;
+        if (type_check && desc.multi_times <= 0 && sparsity_check) {
+            if (is_hot) {
+                _hot_leafs.insert(node);
+            }
             hit_leaf->emplace_back(node, absolute_path);
             node->type = flat_json::JSON_BITS_TO_LOGICAL_TYPE.at(desc.type);
             node->remain = false;
@@ -670,10 +699,15 @@ void JsonPathDeriver::_finalize() {
     }
 
     std::vector<std::pair<JsonFlatPath*, std::string>> hit_leaf;
-    _dfs_finalize(_path_root.get(), "", &hit_leaf);
+    _dfs_finalize(_path_root.get(), _hot_root.get(), "", &hit_leaf);
 
-    // sort by name, just for stable order
+    // sort by hot and hits, the hot paths are kept first within the limit
     std::sort(hit_leaf.begin(), hit_leaf.end(), [&](const auto& a, const auto& b) {
+        bool hot_a = _hot_leafs.contains(a.first);
+        bool hot_b = _hot_leafs.contains(b.first);
+        if (hot_a != hot_b) {
+            return hot_a;
+        }
         auto desc_a = _derived_maps[a.first];
         auto desc_b = _derived_maps[b.first];
         return desc_a.hits > desc_b.hits;
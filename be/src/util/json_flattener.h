@@ -124,6 +124,10 @@ public:
 
     void set_generate_filter(bool generate_filter) { _generate_filter = generate_filter; }
 
+    // the paths accessed frequently by queries, they are flattened as long as they are leaves in the data,
+    // regardless of the sparsity, and they take precedence over the other paths within the max column count.
+    void set_hot_paths(std::vector<std::string> hot_paths);
+
     std::shared_ptr<BloomFilter>& remain_fitler() { return _remain_filter; }
 
     std::shared_ptr<JsonFlatPath>& flat_path_root() { return _path_root; }
@@ -138,7 +142,7 @@ private:
     JsonFlatPath* _normalize_exists_path(const std::string_view& path, JsonFlatPath* root, uint64_t hits);
 
     void _finalize();
-    uint32_t _dfs_finalize(JsonFlatPath* node, const std::string& absolute_path,
+    uint32_t _dfs_finalize(JsonFlatPath* node, const JsonFlatPath* hot, const std::string& absolute_path,
                            std::vector<std::pair<JsonFlatPath*, std::string>>* hit_leaf);
 
     void _derived_on_flat_json(const std::vector<const Column*>& json_datas);
@@ -146,7 +150,8 @@ private:
     void _visit_json_paths(const vpack::Slice& value, JsonFlatPath* root, size_t mark_row);
 
     // clean sparsity path, to save memory
-    void _clean_sparsity_path(const std::string_view& name, JsonFlatPath* root, size_t check_hits_min);
+    void _clean_sparsity_path(const std::string_view& name, JsonFlatPath* root, const JsonFlatPath* hot,
+                              size_t check_hits_min);
 
 private:
     struct JsonFlatDesc {
@@ -180,6 +185,11 @@ private:
     bool _generate_filter = false;
     std::shared_ptr<BloomFilter> _remain_filter = nullptr;
     std::unordered_set<std::string_view> _remain_keys;
+
+    // the tree of the hot paths, its keys point to _hot_paths
+    std::vector<std::string> _hot_paths;
+    std::shared_ptr<JsonFlatPath> _hot_root = nullptr;
+    std::unordered_set<JsonFlatPath*> _hot_leafs;
 };
 
 // flattern JsonColumn to flat json A,B,C
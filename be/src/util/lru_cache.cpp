@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -150,6 +151,53 @@ bool HandleTable::_resize() {
     return true;
 }
 
+void FrequencySketch::init(size_t width) {
+    _width = 1;
+    while (_width < width) {
+        _width <<= 1;
+    }
+    _table.assign(kDepth * _width, 0);
+    _num_increments = 0;
+    _sample_size = 10 * _width;
+}
+
+size_t FrequencySketch::_index(uint32_t hash, int row) const {
+    static constexpr uint64_t kSeeds[kDepth] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                                0xcbf29ce484222325ULL};
+    uint64_t h = (hash + kSeeds[row]) * kSeeds[row];
+    h ^= h >> 32;
+    return row * _width + (h & (_width - 1));
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    bool added = false;
+    for (int row = 0; row < kDepth; row++) {
+        auto& counter = _table[_index(hash, row)];
+        if (counter < kMaxCount) {
+            counter++;
+            added = true;
+        }
+    }
+    if (added && ++_num_increments >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    uint32_t freq = kMaxCount;
+    for (int row = 0; row < kDepth; row++) {
+        freq = std::min<uint32_t>(freq, _table[_index(hash, row)]);
+    }
+    return freq;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& counter : _table) {
+        counter >>= 1;
+    }
+    _num_increments /= 2;
+}
+
 LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
@@ -193,6 +241,16 @@ void LRUCache::set_capacity(size_t capacity) {
     }
 }
 
+void LRUCache::enable_admission_filter(size_t sketch_width) {
+    std::lock_guard l(_mutex);
+    _sketch.init(sketch_width);
+}
+
+uint64_t LRUCache::get_rejected_count() const {
+    std::lock_guard l(_mutex);
+    return _rejected_count;
+}
+
 uint64_t LRUCache::get_lookup_count() const {
     std::lock_guard l(_mutex);
     return _lookup_count;
@@ -216,6 +274,9 @@ size_t LRUCache::get_capacity() const {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_sketch.initialized()) {
+        _sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -284,6 +345,24 @@ void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted)
     }
 }
 
+bool LRUCache::_admit(const LRUHandle* e) {
+    if (!_sketch.initialized() || e->priority == CachePriority::DURABLE || _usage + e->charge <= _capacity) {
+        return true;
+    }
+    // the entry which replaces an old one doesn't evict others
+    if (_table.lookup(e->key(), e->hash) != nullptr) {
+        return true;
+    }
+    const LRUHandle* victim = _lru.next;
+    while (victim != &_lru && victim->priority == CachePriority::DURABLE) {
+        victim = victim->next;
+    }
+    if (victim == &_lru) {
+        return true;
+    }
+    return _sketch.frequency(e->hash) > _sketch.frequency(victim->hash);
+}
+
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
     DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
@@ -314,6 +393,15 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     {
         std::lock_guard l(_mutex);
 
+        if (!_admit(e)) {
+            // the rejected entry is only referenced by the returned handle, and is freed when it is released
+            e->in_cache = false;
+            e->refs = 1;
+            _usage += kv_mem_size;
+            ++_rejected_count;
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
         _evict_from_lru(kv_mem_size, &last_ref_list);
@@ -368,6 +456,25 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     }
 }
 
+void LRUCache::update_charge(Cache::Handle* handle, size_t value_size) {
+    auto* e = reinterpret_cast<LRUHandle*>(handle);
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        size_t charge = sizeof(LRUHandle) - 1 + e->key_length + value_size;
+        _usage = _usage - e->charge + charge;
+        e->charge = charge;
+        // the entry is referenced by the handle, so it is not in the lru list and can not be evicted itself
+        if (e->in_cache) {
+            _evict_from_lru(0, &last_ref_list);
+        }
+    }
+
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
+
 int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
@@ -429,6 +536,15 @@ bool ShardedLRUCache::adjust_capacity(int64_t delta, size_t min_capacity) {
     return true;
 }
 
+void ShardedLRUCache::enable_admission_filter(size_t expected_entry_size) {
+    const size_t per_shard = (get_capacity() + (kNumShards - 1)) / kNumShards;
+    const size_t sketch_width =
+            std::clamp<size_t>(per_shard / std::max<size_t>(expected_entry_size, 1), kMinSketchWidth, kMaxSketchWidth);
+    for (auto& shard : _shards) {
+        shard.enable_admission_filter(sketch_width);
+    }
+}
+
 Cache::Handle* ShardedLRUCache::insert(const CacheKey& key, void* value, size_t value_size,
                                        void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
     const uint32_t hash = _hash_slice(key);
@@ -450,6 +566,11 @@ void ShardedLRUCache::erase(const CacheKey& key) {
     _shards[_shard(hash)].erase(key, hash);
 }
 
+void ShardedLRUCache::update_charge(Handle* handle, size_t value_size) {
+    auto* h = reinterpret_cast<LRUHandle*>(handle);
+    _shards[_shard(h->hash)].update_charge(handle, value_size);
+}
+
 void* ShardedLRUCache::value(Handle* handle) {
     return reinterpret_cast<LRUHandle*>(handle)->value;
 }
@@ -496,6 +617,10 @@ size_t ShardedLRUCache::get_hit_count() const {
     return _get_stat(&LRUCache::get_hit_count);
 }
 
+size_t ShardedLRUCache::get_rejected_count() const {
+    return _get_stat(&LRUCache::get_rejected_count);
+}
+
 void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     size_t shard_count = sizeof(_shards) / sizeof(LRUCache);
 
@@ -526,6 +651,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
         }
 
         shard_info.AddMember("hit_ratio", hit_ratio, document->GetAllocator());
+        shard_info.AddMember("rejected_count", static_cast<double>(_shards[i].get_rejected_count()),
+                             document->GetAllocator());
         document->PushBack(shard_info, document->GetAllocator());
     }
 }
@@ -163,6 +163,11 @@ public:
     // to it have been released.
     virtual void erase(const CacheKey& key) = 0;
 
+    // Update the charge of the entry of the given handle against the cache capacity, to follow the memory usage
+    // of a value which grows after being inserted. It evicts other entries if the cache becomes full.
+    // REQUIRES: handle must not have been released yet.
+    virtual void update_charge(Handle* handle, size_t value_size) = 0;
+
     // Return a new numeric id.  May be used by multiple clients who are
     // sharing the same cache to partition the key space.  Typically the
     // client will allocate a new id at startup and prepend the id to
@@ -258,6 +263,31 @@ private:
     bool _resize();
 };
 
+// A count-min sketch of the access frequency of the keys, the counters saturate at 15 and are halved after every
+// 10 * width increments, so that the sketch follows the recent workload.
+class FrequencySketch {
+public:
+    // `width` is rounded up to the power of 2.
+    void init(size_t width);
+    bool initialized() const { return !_table.empty(); }
+
+    void increment(uint32_t hash);
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    size_t _index(uint32_t hash, int row) const;
+    void _reset();
+
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    // kDepth rows of counters
+    std::vector<uint8_t> _table;
+    size_t _width = 0;
+    size_t _num_increments = 0;
+    size_t _sample_size = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -267,6 +297,11 @@ public:
     // Separate from constructor so caller can easily make an array of LRUCache
     void set_capacity(size_t capacity);
 
+    // Admit a new entry which makes the cache full only when its key is accessed more frequently than the entry
+    // it would evict firstly (TinyLFU), so that a large scan doesn't flush the frequently accessed entries.
+    // A rejected entry is still returned, but it is freed once it is released.
+    void enable_admission_filter(size_t sketch_width);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t value_size,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -274,10 +309,12 @@ public:
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
+    void update_charge(Cache::Handle* handle, size_t value_size);
     int prune();
 
     uint64_t get_lookup_count() const;
     uint64_t get_hit_count() const;
+    uint64_t get_rejected_count() const;
     size_t get_usage() const;
     size_t get_capacity() const;
     static size_t key_handle_size(const CacheKey& key) { return sizeof(LRUHandle) - 1 + key.size(); }
@@ -288,6 +325,7 @@ private:
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    bool _admit(const LRUHandle* e);
 
     // Initialized before use.
     size_t _capacity{0};
@@ -305,6 +343,10 @@ private:
 
     uint64_t _lookup_count{0};
     uint64_t _hit_count{0};
+
+    // only initialized when the admission filter is enabled
+    FrequencySketch _sketch;
+    uint64_t _rejected_count{0};
 };
 
 static const int kNumShardBits = 5;
@@ -320,6 +362,7 @@ public:
     Handle* lookup(const CacheKey& key) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
+    void update_charge(Handle* handle, size_t value_size) override;
     void* value(Handle* handle) override;
     Slice value_slice(Handle* handle) override;
     uint64_t new_id() override;
@@ -332,7 +375,16 @@ public:
     uint64_t get_hit_count() const override;
     bool adjust_capacity(int64_t delta, size_t min_capacity = 0) override;
 
+    // Enable the admission filter of all the shards, the frequency sketch of each shard is sized by the number of
+    // the entries of `expected_entry_size` bytes it can hold.
+    void enable_admission_filter(size_t expected_entry_size);
+    // The number of the entries rejected by the admission filter.
+    size_t get_rejected_count() const;
+
 private:
+    static constexpr size_t kMinSketchWidth = 1024;
+    static constexpr size_t kMaxSketchWidth = 1 << 20;
+
     static uint32_t _hash_slice(const CacheKey& s);
     static uint32_t _shard(uint32_t hash);
     void _set_capacity(size_t capacity);
@@ -40,6 +40,19 @@ public:
 
     void merge(const PercentileValue* other) { _tdigest.merge(&other->_tdigest); }
 
+    // Merge the values in one pass, which is much cheaper than merging them one by one, because the centroids are
+    // only compressed when a batch of kHighWater centroids is collected.
+    void merge(const std::vector<const PercentileValue*>& others) {
+        std::vector<const TDigest*> digests;
+        digests.reserve(others.size());
+        for (const auto* other : others) {
+            digests.push_back(&other->_tdigest);
+        }
+        _tdigest.add(digests);
+    }
+
+    size_t total_size() const { return _tdigest.totalSize(); }
+
     uint64_t serialize_size() const {
         //_type 1 bytes
         return 1 + _tdigest.serialize_size();
@@ -0,0 +1,142 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+const char* PerfEventCounters::event_name(Event event) {
+    switch (event) {
+    case CYCLES:
+        return "HwCycles";
+    case INSTRUCTIONS:
+        return "HwInstructions";
+    case LLC_MISSES:
+        return "HwLLCMisses";
+    case DTLB_MISSES:
+        return "HwDTLBMisses";
+    case BRANCH_MISSES:
+        return "HwBranchMisses";
+    default:
+        return "Unknown";
+    }
+}
+
+PerfEventCounters* PerfEventCounters::thread_local_instance() {
+    static thread_local PerfEventCounters counters;
+    return &counters;
+}
+
+#ifdef __linux__
+
+static int open_event(uint32_t type, uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // pid = 0 and cpu = -1: the calling thread on any cpu.
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+PerfEventCounters::PerfEventCounters() {
+    _fds.fill(-1);
+    _indexes.fill(-1);
+
+    static constexpr uint64_t kDTLBReadMiss = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    const std::array<std::pair<uint32_t, uint64_t>, NUM_EVENTS> events = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HW_CACHE, kDTLBReadMiss},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+
+    // The cycles counter leads the group, the group is useless without it.
+    _fds[CYCLES] = open_event(events[CYCLES].first, events[CYCLES].second, -1);
+    if (_fds[CYCLES] < 0) {
+        VLOG(1) << "perf_event_open is not available: " << strerror(errno);
+        return;
+    }
+    _group_fd = _fds[CYCLES];
+    _indexes[CYCLES] = _num_opened++;
+    for (int i = CYCLES + 1; i < NUM_EVENTS; i++) {
+        _fds[i] = open_event(events[i].first, events[i].second, _group_fd);
+        if (_fds[i] >= 0) {
+            _indexes[i] = _num_opened++;
+        }
+    }
+
+    ioctl(_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfEventCounters::~PerfEventCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool PerfEventCounters::read(Values* values) const {
+    if (_group_fd < 0) {
+        return false;
+    }
+    // PERF_FORMAT_GROUP: the number of events, followed by the value of each event in opening order.
+    uint64_t buf[NUM_EVENTS + 1];
+    const ssize_t size = sizeof(uint64_t) * (_num_opened + 1);
+    if (::read(_group_fd, buf, size) != size) {
+        return false;
+    }
+    for (int i = 0; i < NUM_EVENTS; i++) {
+        (*values)[i] = _indexes[i] >= 0 ? buf[_indexes[i] + 1] : 0;
+    }
+    return true;
+}
+
+#else
+
+PerfEventCounters::PerfEventCounters() {
+    _fds.fill(-1);
+    _indexes.fill(-1);
+}
+
+PerfEventCounters::~PerfEventCounters() = default;
+
+bool PerfEventCounters::read(Values* values) const {
+    return false;
+}
+
+#endif
+
+} // namespace starrocks
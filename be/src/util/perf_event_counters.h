@@ -0,0 +1,61 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace starrocks {
+
+// A group of hardware performance counters of the calling thread, read through perf_event_open(2).
+//
+// The group is opened lazily once per thread and counts only in user space, so it works with the default
+// perf_event_paranoid setting. If the kernel or the sandbox does not allow it, `available()` returns false
+// and every read returns false.
+class PerfEventCounters {
+public:
+    enum Event {
+        CYCLES = 0,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        DTLB_MISSES,
+        BRANCH_MISSES,
+        NUM_EVENTS,
+    };
+    using Values = std::array<uint64_t, NUM_EVENTS>;
+
+    static const char* event_name(Event event);
+
+    // The counters of the calling thread.
+    static PerfEventCounters* thread_local_instance();
+
+    ~PerfEventCounters();
+
+    bool available() const { return _group_fd >= 0; }
+
+    // Read the current value of all the events. An event not supported by the cpu reads as 0.
+    bool read(Values* values) const;
+
+private:
+    PerfEventCounters();
+
+    int _group_fd = -1;
+    std::array<int, NUM_EVENTS> _fds;
+    // The position of each event in the group read, -1 if it is not opened.
+    std::array<int, NUM_EVENTS> _indexes;
+    int _num_opened = 0;
+};
+
+} // namespace starrocks
@@ -68,6 +68,18 @@ public:
     // If there are no elements in all the containers, the behavior is undefined.
     void pop_front();
 
+    // Returns the priority of the element returned by front().
+    //
+    // Calling front_priority on an empty container is undefined
+    [[nodiscard]] int front_priority() const;
+
+    // Removes all the elements satisfying |pred|, returns the number of removed elements.
+    template <class Pred>
+    size_type remove_if(Pred pred);
+
+    // Removes all the elements.
+    void clear() noexcept;
+
 private:
     std::array<Container, NUM_PRIORITY> _queues;
 };
@@ -95,4 +95,40 @@ PriorityQueue<NUM_PRIORITY, T, Container>::front() const {
     return _queues[0].front();
 }
 
+template <int NUM_PRIORITY, class T, class Container>
+inline int PriorityQueue<NUM_PRIORITY, T, Container>::front_priority() const {
+    for (int i = 0; i < NUM_PRIORITY; i++) {
+        if (!_queues[i].empty()) {
+            return NUM_PRIORITY - i - 1;
+        }
+    }
+    // undefined behavior
+    return 0;
+}
+
+template <int NUM_PRIORITY, class T, class Container>
+template <class Pred>
+inline typename PriorityQueue<NUM_PRIORITY, T, Container>::size_type
+PriorityQueue<NUM_PRIORITY, T, Container>::remove_if(Pred pred) {
+    size_type removed = 0;
+    for (auto& q : _queues) {
+        for (auto it = q.begin(); it != q.end();) {
+            if (pred(*it)) {
+                it = q.erase(it);
+                removed++;
+            } else {
+                ++it;
+            }
+        }
+    }
+    return removed;
+}
+
+template <int NUM_PRIORITY, class T, class Container>
+inline void PriorityQueue<NUM_PRIORITY, T, Container>::clear() noexcept {
+    for (auto& q : _queues) {
+        q.clear();
+    }
+}
+
 } // namespace starrocks
@@ -67,7 +67,7 @@ namespace starrocks {
 //  - lookup table for converting character to digit
 // Improvements (TODO):
 //  - Validate input using _sidd_compare_ranges
-//  - Since we know the length, we can parallelize this: i.e. result = 100*s[0] + 10*s[1] + s[2]
+// Digits are validated and converted 8 at a time in a 64-bit register (SWAR), see is_8_digits and parse_8_digits.
 class StringParser {
 public:
     enum ParseResult { PARSE_SUCCESS = 0, PARSE_FAILURE, PARSE_OVERFLOW, PARSE_UNDERFLOW };
@@ -143,6 +143,30 @@ public:
     template <typename T = __int128>
     static inline T string_to_decimal(const char* s, int len, int type_precision, int type_scale, ParseResult* result);
 
+    // Load 8 chars into a 64-bit integer, the first char takes the lowest byte on little endian platforms.
+    static inline uint64_t load_8_chars(const char* s) {
+        uint64_t chunk;
+        memcpy(&chunk, s, sizeof(chunk));
+        return chunk;
+    }
+
+    // Return true if all the 8 chars loaded by load_8_chars are ascii digits.
+    static inline bool is_8_digits(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    // Convert the 8 digits loaded by load_8_chars to its value with 3 multiplications.
+    static inline uint32_t parse_8_digits(uint64_t chunk) {
+        const uint64_t mask = 0x000000FF000000FFULL;
+        const uint64_t mul1 = 100 + (1000000ULL << 32);
+        const uint64_t mul2 = 1 + (10000ULL << 32);
+        chunk -= 0x3030303030303030ULL;
+        // every byte holds the 2-digit number of itself and its next byte
+        chunk = (chunk * 10) + (chunk >> 8);
+        return static_cast<uint32_t>((((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32);
+    }
+
     template <typename T>
     static Status split_string_to_map(const std::string& base, const T element_separator, const T key_value_separator,
                                       std::map<std::string, std::string>* result) {
@@ -259,6 +283,18 @@ inline T StringParser::string_to_int_internal(const char* s, int len, ParseResul
     const T max_mod_10 = max_val % 10;
 
     int first = i;
+    if constexpr (sizeof(T) >= sizeof(int64_t) && sizeof(T) <= sizeof(__int128)) {
+        // the leading digits which can never overflow are converted 8 at a time
+        const int max_safe_len = StringParseTraits<T>::max_ascii_len() - 3;
+        while (i + 8 <= len && i - first + 8 <= max_safe_len) {
+            uint64_t chunk = load_8_chars(s + i);
+            if (!is_8_digits(chunk)) {
+                break;
+            }
+            val = val * 100000000 + parse_8_digits(chunk);
+            i += 8;
+        }
+    }
     for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
@@ -400,14 +436,27 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_FAILURE;
         return val;
     }
-    // Factor out the first char for error handling speeds up the loop.
-    if (LIKELY(s[0] >= '0' && s[0] <= '9')) {
-        val = s[0] - '0';
-    } else {
-        *result = PARSE_FAILURE;
-        return 0;
+    int i = 0;
+    if constexpr (sizeof(T) >= sizeof(int32_t) && sizeof(T) <= sizeof(__int128)) {
+        for (; i + 8 <= len; i += 8) {
+            uint64_t chunk = load_8_chars(s + i);
+            if (!is_8_digits(chunk)) {
+                break;
+            }
+            val = val * 100000000 + parse_8_digits(chunk);
+        }
+    }
+    if (i == 0) {
+        // Factor out the first char for error handling speeds up the loop.
+        if (LIKELY(s[0] >= '0' && s[0] <= '9')) {
+            val = s[0] - '0';
+        } else {
+            *result = PARSE_FAILURE;
+            return 0;
+        }
+        i = 1;
     }
-    for (int i = 1; i < len; ++i) {
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -108,8 +108,8 @@ Status ThreadPoolBuilder::build(std::unique_ptr<ThreadPool>* pool) const {
     return Status::OK();
 }
 
-ThreadPoolToken::ThreadPoolToken(ThreadPool* pool, ThreadPool::ExecutionMode mode)
-        : _mode(mode), _pool(pool), _state(State::IDLE), _active_threads(0) {}
+ThreadPoolToken::ThreadPoolToken(ThreadPool* pool, ThreadPool::ExecutionMode mode, ThreadPool::Priority pri)
+        : _mode(mode), _priority(pri), _pool(pool), _state(State::IDLE), _active_threads(0) {}
 
 ThreadPoolToken::~ThreadPoolToken() {
     shutdown();
@@ -150,13 +150,7 @@ void ThreadPoolToken::shutdown() {
         // Plus doing it this way (rather than switching to QUIESCING and waiting
         // for a worker thread to process the queue entry) helps retain state
         // transition symmetry with ThreadPool::shutdown.
-        for (auto it = _pool->_queue.begin(); it != _pool->_queue.end();) {
-            if (*it == this) {
-                it = _pool->_queue.erase(it);
-            } else {
-                it++;
-            }
-        }
+        _pool->_queue.remove_if([this](ThreadPoolToken* t) { return t == this; });
 
         if (_active_threads == 0) {
             transition(State::QUIESCED);
@@ -343,9 +337,9 @@ void ThreadPool::shutdown() {
     }
 }
 
-std::unique_ptr<ThreadPoolToken> ThreadPool::new_token(ExecutionMode mode) {
+std::unique_ptr<ThreadPoolToken> ThreadPool::new_token(ExecutionMode mode, Priority pri) {
     std::lock_guard unique_lock(_lock);
-    std::unique_ptr<ThreadPoolToken> t(new ThreadPoolToken(this, mode));
+    std::unique_ptr<ThreadPoolToken> t(new ThreadPoolToken(this, mode, pri));
     InsertOrDie(&_tokens, t.get());
     return t;
 }
@@ -431,7 +425,7 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
     DCHECK(state == ThreadPoolToken::State::IDLE || state == ThreadPoolToken::State::RUNNING);
     token->_entries.emplace_back(pri, std::move(task));
     if (state == ThreadPoolToken::State::IDLE || token->mode() == ExecutionMode::CONCURRENT) {
-        _queue.emplace_back(token);
+        _queue.emplace_back(token->queue_priority(), token);
         if (state == ThreadPoolToken::State::IDLE) {
             token->transition(ThreadPoolToken::State::RUNNING);
         }
@@ -661,7 +655,7 @@ void ThreadPool::dispatch_thread() {
             } else if (token->_entries.empty()) {
                 token->transition(ThreadPoolToken::State::IDLE);
             } else if (token->mode() == ExecutionMode::SERIAL) {
-                _queue.emplace_back(token);
+                _queue.emplace_back(token->queue_priority(), token);
             }
         }
         if (--_active_threads == 0) {
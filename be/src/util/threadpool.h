@@ -36,6 +36,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <atomic>
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
@@ -257,7 +258,10 @@ public:
         CONCURRENT,
     };
 
-    std::unique_ptr<ThreadPoolToken> new_token(ExecutionMode mode);
+    // The ready tokens are dispatched in the order of their priorities, which is the higher one of |pri| and the
+    // priority of the next task of the token. So the tasks of a HIGH_PRIORITY token are not delayed by the queued
+    // LOW_PRIORITY tokens, while the tasks of the same token still keep the execution mode.
+    std::unique_ptr<ThreadPoolToken> new_token(ExecutionMode mode, Priority pri = LOW_PRIORITY);
 
     // Return the number of threads currently running (or in the process of starting up)
     // for this thread pool.
@@ -381,11 +385,11 @@ private:
     // Protected by _lock.
     std::unordered_set<ThreadPoolToken*> _tokens;
 
-    // FIFO of tokens from which tasks should be executed. Does not own the
+    // FIFOs of tokens from which tasks should be executed, one per priority. Does not own the
     // tokens; they are owned by clients and are removed from the FIFO on shutdown.
     //
     // Protected by _lock.
-    std::deque<ThreadPoolToken*> _queue;
+    PriorityQueue<NUM_PRIORITY, ThreadPoolToken*> _queue;
 
     // Pointers to all running threads. Raw pointers are safe because a Thread
     // may only go out of scope after being removed from _threads.
@@ -502,7 +506,7 @@ private:
     // Constructs a new token.
     //
     // The token may not outlive its thread pool ('pool').
-    ThreadPoolToken(ThreadPool* pool, ThreadPool::ExecutionMode mode);
+    ThreadPoolToken(ThreadPool* pool, ThreadPool::ExecutionMode mode, ThreadPool::Priority pri);
 
     // Changes this token's state to 'new_state' taking actions as needed.
     void transition(State new_state);
@@ -517,9 +521,15 @@ private:
     State state() const { return _state; }
     ThreadPool::ExecutionMode mode() const { return _mode; }
 
+    // The priority to queue this token in the pool, requires a queued task.
+    int queue_priority() const { return std::max<int>(_priority, _entries.front_priority()); }
+
     // Token's configured execution mode.
     const ThreadPool::ExecutionMode _mode;
 
+    // Token's configured priority.
+    const ThreadPool::Priority _priority;
+
     // Pointer to the token's thread pool.
     ThreadPool* _pool;
 
@@ -208,6 +208,33 @@ bool TimezoneUtils::find_cctz_time_zone(const TimezoneHsScan& timezone_hsscan, s
     }
 }
 
+bool TimezoneOffsetCache::local_to_utc(int64_t local_seconds, int64_t* utc_seconds) {
+    int64_t utc = local_seconds - _offset;
+    if (!_far_from_transitions(utc)) {
+        _refresh(utc);
+        utc = local_seconds - _offset;
+        if (!_far_from_transitions(utc)) {
+            return false;
+        }
+    }
+    *utc_seconds = utc;
+    return true;
+}
+
+void TimezoneOffsetCache::_refresh(int64_t utc_seconds) {
+    static const cctz::time_point<cctz::sys_seconds> epoch =
+            std::chrono::time_point_cast<cctz::sys_seconds>(std::chrono::system_clock::from_time_t(0));
+    static const cctz::civil_second civil_epoch(1970, 1, 1, 0, 0, 0);
+    const cctz::time_point<cctz::sys_seconds> tp = epoch + cctz::seconds(utc_seconds);
+
+    _offset = _ctz.lookup(tp).offset;
+    // The civil times of a transition are `from` in the offset before it and `to` in the offset after it.
+    cctz::time_zone::civil_transition trans;
+    _begin = _ctz.prev_transition(tp + cctz::seconds(1), &trans) ? (trans.to - civil_epoch) - _offset
+                                                                  : -kNoTransition;
+    _end = _ctz.next_transition(tp, &trans) ? (trans.from - civil_epoch) - _offset : kNoTransition;
+}
+
 int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     cctz::time_zone utc = cctz::utc_time_zone();
     const std::chrono::time_point<std::chrono::system_clock> tp;
@@ -61,4 +61,41 @@ public:
 private:
     static bool _match_cctz_time_zone(std::string_view timezone, cctz::time_zone& ctz);
 };
+
+// The utc offset of a time zone between two of its transitions. The timestamps of a chunk seldom cross a
+// transition, so they are converted with integer arithmetic and only go to cctz when they leave the window.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    // The utc offset in seconds at the unix timestamp `utc_seconds`.
+    int64_t utc_offset(int64_t utc_seconds) {
+        if (utc_seconds < _begin || utc_seconds >= _end) {
+            _refresh(utc_seconds);
+        }
+        return _offset;
+    }
+
+    // Convert `local_seconds`, the seconds of a civil time of this time zone since 1970-01-01 00:00:00, to a unix
+    // timestamp. Return false when the civil time is close to a transition, where it may be skipped or repeated,
+    // and the caller has to convert it with cctz.
+    bool local_to_utc(int64_t local_seconds, int64_t* utc_seconds);
+
+private:
+    void _refresh(int64_t utc_seconds);
+
+    bool _far_from_transitions(int64_t utc_seconds) const {
+        return utc_seconds - _begin >= kTransitionMargin && _end - utc_seconds > kTransitionMargin;
+    }
+
+    // Larger than the difference of the utc offsets around any transition.
+    static constexpr int64_t kTransitionMargin = 2 * 24 * 3600;
+    static constexpr int64_t kNoTransition = int64_t(1) << 60;
+
+    cctz::time_zone _ctz;
+    int64_t _offset = 0;
+    // The unix timestamps in [_begin, _end) have the utc offset `_offset`, empty before the first lookup.
+    int64_t _begin = 0;
+    int64_t _end = 0;
+};
 } // namespace starrocks
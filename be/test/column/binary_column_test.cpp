@@ -669,4 +669,34 @@ PARALLEL_TEST(BinaryColumnTest, test_reference_memory_usage) {
     ASSERT_EQ(0, column->Column::reference_memory_usage());
 }
 
+PARALLEL_TEST(BinaryColumnTest, test_is_ascii) {
+    BinaryColumn::Ptr column = BinaryColumn::create();
+    ASSERT_TRUE(column->is_ascii());
+    column->append("abc");
+    column->append("def");
+    ASSERT_TRUE(column->is_ascii());
+
+    // only the appended bytes are checked
+    column->append("中文");
+    ASSERT_FALSE(column->is_ascii());
+
+    // removing the non-ASCII string
+    column->resize(2);
+    column->append("ghi");
+    ASSERT_TRUE(column->is_ascii());
+
+    // modifying the bytes in place
+    column->get_bytes()[0] = 0x80;
+    ASSERT_FALSE(column->is_ascii());
+    column->get_bytes()[0] = 'a';
+    ASSERT_TRUE(column->is_ascii());
+
+    Filter filter{1, 0, 1};
+    column->filter(filter);
+    ASSERT_TRUE(column->is_ascii());
+    column->reset_column();
+    column->append("中文");
+    ASSERT_FALSE(column->is_ascii());
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/chunk_extra_data.h"
 #include "column/column_helper.h"
+#include "column/const_column.h"
 #include "column/field.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
@@ -395,6 +396,25 @@ TEST_F(ChunkTest, test_filter_with_extra_data) {
     check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk_extra_data1->columns()[1].get()), {2, 4});
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_sparse_filter) {
+    Columns columns = make_columns(3, 100);
+    columns.emplace_back(ConstColumn::create(make_column(7, 1), 100));
+    auto chunk = std::make_unique<Chunk>(columns, make_schema(4));
+    Buffer<uint8_t> selection(100, 0);
+    selection[3] = 1;
+    selection[50] = 2;
+    selection[99] = 1;
+    ASSERT_EQ(3, chunk->filter(selection));
+    chunk->check_or_die();
+    for (size_t i = 0; i < 3; i++) {
+        check_column(down_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[i].get()),
+                     {static_cast<int32_t>(i + 3), static_cast<int32_t>(i + 50), static_cast<int32_t>(i + 99)});
+    }
+    ASSERT_TRUE(chunk->columns()[3]->is_constant());
+    ASSERT_EQ(3, chunk->columns()[3]->size());
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_clone_empty_with_extra_data) {
     auto extra_data1 = make_extra_data(2);
@@ -430,6 +450,25 @@ TEST_F(ChunkTest, test_clone_unique_with_extra_data) {
     ASSERT_EQ(copy_extra_data->columns()[0]->size(), expect_extra_data->columns()[0]->size());
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_clone_shared) {
+    auto chunk1 = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+    auto copy = chunk1->clone_shared();
+    ASSERT_EQ(copy->num_rows(), chunk1->num_rows());
+    ASSERT_EQ(copy->get_column_by_index(0).get(), chunk1->get_column_by_index(0).get());
+
+    // the shared columns are copied on write, the source chunk is kept unchanged
+    copy->set_num_rows(10);
+    ASSERT_EQ(10, copy->num_rows());
+    ASSERT_EQ(100, chunk1->num_rows());
+    ASSERT_NE(copy->get_column_by_index(0).get(), chunk1->get_column_by_index(0).get());
+    check_column(down_cast<const FixedLengthColumn<int32_t>*>(chunk1->get_column_by_index(1).get()), 1);
+    auto* column = down_cast<const FixedLengthColumn<int32_t>*>(copy->get_column_by_index(1).get());
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_EQ(column->get_data()[i], static_cast<int32_t>(i + 1));
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_reset_with_extra_data) {
     auto extra_data1 = make_extra_data(2);
@@ -21,6 +21,7 @@
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/sorting.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -645,4 +646,24 @@ TEST(FixedLengthColumnTest, test_fill_range) {
     ASSERT_EQ(0, p[4]);
 }
 
+// NOLINTNEXTLINE
+TEST(FixedLengthColumnTest, test_crc32_hash) {
+    auto check = [](auto column) {
+        for (int i = 0; i < 100; i++) {
+            column->append(i * 1000003);
+        }
+        std::vector<uint32_t> hashes(column->size(), 7);
+        column->crc32_hash(hashes.data(), 0, column->size());
+        for (size_t i = 0; i < column->size(); i++) {
+            auto value = column->get_data()[i];
+            ASSERT_EQ(HashUtil::zlib_crc_hash(&value, sizeof(value), 7), hashes[i]);
+        }
+    };
+    check(Int8Column::create());
+    check(Int16Column::create());
+    check(Int32Column::create());
+    check(Int64Column::create());
+    check(Int128Column::create());
+}
+
 } // namespace starrocks
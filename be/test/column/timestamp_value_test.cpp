@@ -122,4 +122,21 @@ TEST(TimestampValueTest, unixTime) {
     ASSERT_EQ(1078097430000, v.to_unixtime(cctz::utc_time_zone()));
 }
 
+TEST(TimestampValueTest, fromStandardFormatString) {
+    TimestampValue v;
+    std::string s = "2024-02-29 23:59:07";
+    ASSERT_TRUE(v.from_string(s.data(), s.size()));
+    ASSERT_EQ("2024-02-29 23:59:07", v.to_string());
+    s = "2024-02-29T01:02:03";
+    ASSERT_TRUE(v.from_string(s.data(), s.size()));
+    ASSERT_EQ("2024-02-29 01:02:03", v.to_string());
+    s = "  2024/02/29  ";
+    ASSERT_TRUE(v.from_string(s.data(), s.size()));
+    ASSERT_EQ("2024-02-29 00:00:00", v.to_string());
+
+    for (std::string invalid : {"2024-02-29 23:60:00", "2023-02-29 23:59:07"}) {
+        ASSERT_FALSE(v.from_string(invalid.data(), invalid.size())) << invalid;
+    }
+}
+
 } // namespace starrocks
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include "connector/deletion_vector/deletion_bitmap_cache.h"
 #include "util/base85.h"
 
 namespace starrocks {
@@ -66,4 +67,33 @@ TEST_F(DeletionVectorTest, absolutePathTest) {
     ASSERT_TRUE(absolute_path.ok());
     ASSERT_EQ("s3://mytable/deletion_vector_d2c639aa-8816-431a-aaf6-d3fe2512ff61.bin", absolute_path.value());
 }
+
+TEST_F(DeletionVectorTest, deletionBitmapCacheTest) {
+    DeletionBitmapCache cache(1024 * 1024);
+    const std::string key =
+            DeletionBitmapCache::make_key("s3://mytable/delete.parquet", 0, 100, "s3://mytable/a.parquet");
+    const std::string other_key =
+            DeletionBitmapCache::make_key("s3://mytable/delete.parquet", 0, 100, "s3://mytable/b.parquet");
+    ASSERT_EQ(nullptr, cache.lookup(key));
+
+    auto bitmap = std::make_shared<DeletionBitmap>(roaring64_bitmap_create());
+    bitmap->add_value(3);
+    bitmap->add_value(7);
+    cache.insert(key, bitmap);
+    ASSERT_EQ(nullptr, cache.lookup(other_key));
+    DeletionBitmapPtr cached = cache.lookup(key);
+    ASSERT_EQ(bitmap, cached);
+
+    auto merged = std::make_shared<DeletionBitmap>(roaring64_bitmap_create());
+    merged->add_value(1);
+    merged->add_bitmap(*cached);
+    ASSERT_EQ(3, merged->get_cardinality());
+    ASSERT_EQ(2, cached->get_cardinality());
+
+    // a disabled cache never keeps the bitmaps
+    DeletionBitmapCache disabled_cache(0);
+    disabled_cache.insert(key, bitmap);
+    ASSERT_EQ(nullptr, disabled_cache.lookup(key));
+}
+
 } // namespace starrocks
\ No newline at end of file
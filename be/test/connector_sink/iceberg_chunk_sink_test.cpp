@@ -137,6 +137,64 @@ TEST_F(IcebergChunkSinkTest, test_callback) {
     }
 }
 
+TEST_F(IcebergChunkSinkTest, test_buffer_partitions) {
+    auto max_open_writers = config::connector_sink_max_open_writers;
+    auto partition_buffer_bytes = config::connector_sink_partition_buffer_bytes;
+    DeferOp defer([&]() {
+        config::connector_sink_max_open_writers = max_open_writers;
+        config::connector_sink_partition_buffer_bytes = partition_buffer_bytes;
+    });
+    config::connector_sink_max_open_writers = 1;
+    config::connector_sink_partition_buffer_bytes = 1L << 30;
+
+    std::vector<std::string> partition_column_names = {"k1"};
+    std::vector<std::string> transform = {"identity"};
+    std::vector<std::unique_ptr<ColumnEvaluator>> partition_column_evaluators =
+            ColumnSlotIdEvaluator::from_types({TypeDescriptor::from_logical_type(TYPE_VARCHAR)});
+    auto mock_writer_factory = std::make_unique<MockFileWriterFactory>();
+    std::vector<std::string> paths;
+    EXPECT_CALL(*mock_writer_factory, create(::testing::_))
+            .Times(3)
+            .WillRepeatedly([&](const std::string& path) {
+                paths.emplace_back(path);
+                WriterAndStream ws;
+                ws.writer = std::make_unique<MockWriter>();
+                ws.stream =
+                        std::make_unique<io::AsyncFlushOutputStream>(std::make_unique<MockFile>(), nullptr, nullptr);
+                return StatusOr<WriterAndStream>(std::move(ws));
+            });
+    auto location_provider = std::make_unique<LocationProvider>("base_path", "ffffff", 0, 0, "parquet");
+    auto sink = std::make_unique<IcebergChunkSink>(partition_column_names, transform,
+                                                   std::move(partition_column_evaluators), std::move(location_provider),
+                                                   std::move(mock_writer_factory), 100, _runtime_state);
+    auto poller = MockPoller();
+    sink->set_io_poller(&poller);
+
+    auto add_chunk = [&](std::string value) {
+        Datum datum;
+        datum.set_slice(value);
+        auto column = ColumnHelper::create_column(TYPE_VARCHAR_DESC, true);
+        column->append_datum(datum);
+        Columns partition_key_columns{ConstColumn::create(std::move(column), 1)};
+        std::vector<ChunkExtraColumnsMeta> extra_metas{ChunkExtraColumnsMeta{TYPE_VARCHAR_DESC, true, true}};
+        ChunkPtr chunk = std::make_shared<Chunk>();
+        chunk->set_extra_data(std::make_shared<ChunkExtraColumnsData>(extra_metas, std::move(partition_key_columns)));
+        return sink->add(chunk.get());
+    };
+
+    // "b" gets the only open writer, then the sink buffers "a", "b" and "a" and writes them sorted by partition
+    EXPECT_OK(add_chunk("b"));
+    EXPECT_OK(add_chunk("a"));
+    EXPECT_OK(add_chunk("b"));
+    EXPECT_OK(add_chunk("a"));
+    ASSERT_EQ(paths.size(), 1);
+    EXPECT_OK(sink->finish());
+    ASSERT_EQ(paths.size(), 3);
+    EXPECT_EQ(paths[0].find("base_path/k1=b/"), 0);
+    EXPECT_EQ(paths[1].find("base_path/k1=a/"), 0);
+    EXPECT_EQ(paths[2].find("base_path/k1=b/"), 0);
+}
+
 TEST_F(IcebergChunkSinkTest, test_factory) {
     IcebergChunkSinkProvider provider;
 
@@ -24,6 +24,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/aggregate/agg_hash_set.h"
 #include "exec/aggregate/agg_hash_variant.h"
+#include "exec/aggregator.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
@@ -175,6 +176,81 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, TwoLevelSubMapNum) {
+    ASSERT_EQ(16, SliceAggTwoLevelHashMap<PhmapSeed1>::subcnt());
+    ASSERT_EQ(256, SliceAggTwoLevelHashMap<PhmapSeed2>::subcnt());
+    ASSERT_EQ(256, Int32AggTwoLevelHashMap<PhmapSeed2>::subcnt());
+    ASSERT_EQ(256, SliceAggTwoLevelHashSet<PhmapSeed2>::subcnt());
+
+    phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, PhmapSeed2>> map;
+    for (int32_t i = 0; i < 100000; i++) {
+        map.emplace(i, nullptr);
+    }
+    Int32AggTwoLevelHashMap<PhmapSeed2> two_level_map;
+    two_level_map.insert(map.begin(), map.end());
+    ASSERT_EQ(map.size(), two_level_map.size());
+    for (int32_t i = 0; i < 100000; i++) {
+        ASSERT_TRUE(two_level_map.contains(i));
+    }
+}
+
+TEST(HashMapTest, RepeatedKeys) {
+    const int chunk_size = 8;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    Int32AggHashMapWithOneNumberKey<PhmapSeed1> key(chunk_size, &statis);
+    MemPool pool;
+    Buffer<AggDataPtr> agg_states(chunk_size);
+
+    auto column = Int32Column::create();
+    for (int32_t v : {1, 1, 1, 2, 2, 1, 3, 3}) {
+        column->append(v);
+    }
+    Columns key_columns{column};
+    size_t num_allocated = 0;
+    auto allocate_func = [&](auto& key) {
+        num_allocated++;
+        return pool.allocate(16);
+    };
+    key.build_hash_map(chunk_size, key_columns, &pool, allocate_func, &agg_states);
+
+    ASSERT_EQ(3, num_allocated);
+    ASSERT_EQ(3, key.hash_map.size());
+    ASSERT_EQ(agg_states[0], agg_states[1]);
+    ASSERT_EQ(agg_states[0], agg_states[2]);
+    ASSERT_EQ(agg_states[0], agg_states[5]);
+    ASSERT_EQ(agg_states[3], agg_states[4]);
+    ASSERT_EQ(agg_states[6], agg_states[7]);
+    ASSERT_NE(agg_states[0], agg_states[3]);
+    ASSERT_NE(agg_states[3], agg_states[6]);
+}
+
+TEST(AggrAutoContextTest, SampleNdv) {
+    auto make_column = [](int32_t start, int32_t mod) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < 4096; i++) {
+            column->append(start + i % mod);
+        }
+        return column;
+    };
+
+    // nearly unique keys
+    AggrAutoContext unique_context;
+    for (int32_t i = 0; i < 4; i++) {
+        Columns columns{make_column(i * 4096, 4096)};
+        ASSERT_EQ(i == 3, unique_context.sample_ndv(columns, 4096, 4));
+    }
+    ASSERT_GE(unique_context.sampled_ndv_ratio(), AggrAutoContext::HighNdvRatio);
+
+    // highly duplicated keys
+    AggrAutoContext dup_context;
+    for (int32_t i = 0; i < 4; i++) {
+        Columns columns{make_column(0, 16)};
+        dup_context.sample_ndv(columns, 4096, 4);
+    }
+    ASSERT_LE(dup_context.sampled_ndv_ratio(), AggrAutoContext::LowNdvRatio);
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -746,6 +746,39 @@ TEST_F(ChunksSorterTest, topn_sort_with_limit) {
     }
 }
 
+// The sorters of the many small partitions of a partition topn sort whenever more rows than the limit are buffered.
+// NOLINTNEXTLINE
+TEST_F(ChunksSorterTest, topn_sort_with_limit_buffered_rows) {
+    std::vector<int32_t> expected{2, 4, 6, 12, 16, 24, 41, 49, 52, 54, 55, 56, 58, 69, 70, 71};
+    std::vector<bool> is_asc{true};
+    std::vector<bool> is_null_first{true};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    constexpr int kTotalRows = 16;
+    for (int limit = 1; limit < kTotalRows; limit++) {
+        ChunksSorterTopn sorter(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit,
+                                TTopNType::ROW_NUMBER, limit, ChunksSorterTopn::kDefaultMaxBufferBytes,
+                                ChunksSorterTopn::max_buffered_chunks(limit));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_3->clone_unique().release())));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_1->clone_unique().release())));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_2->clone_unique().release())));
+        ASSERT_OK(sorter.done(_runtime_state.get()));
+
+        ChunkPtr page = consume_page_from_sorter(sorter);
+        ASSERT_EQ(limit, page->num_rows());
+        std::vector<int32_t> result;
+        for (size_t i = 0; i < page->num_rows(); ++i) {
+            result.push_back(page->get(i).get(0).get_int32());
+        }
+        EXPECT_EQ(std::vector<int32_t>(expected.begin(), expected.begin() + limit), result);
+    }
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunksSorterTest, rank_topn) {
     std::vector<bool> is_asc{true};
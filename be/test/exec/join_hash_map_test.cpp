@@ -994,8 +994,10 @@ TEST_F(JoinHashMapTest, JoinKeyHash) {
         ASSERT_EQ(6, max_count);
     }
 
+    // the bucket of a string key comes from the hash of its runtime bloom filter
     auto v3 = JoinKeyHash<Slice>()(Slice{"abcd", 4}, num_buckets, log_num_buckets);
-    ASSERT_EQ(v3, 2777932099l % num_buckets);
+    ASSERT_EQ(v3, JoinKeyHash<Slice>::bucket(SliceHash()(Slice{"abcd", 4}), log_num_buckets));
+    ASSERT_LT(v3, num_buckets);
 }
 
 // NOLINTNEXTLINE
@@ -1207,6 +1209,59 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinBuildFuncKeepKeyHashes) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    std::vector<std::string> values;
+    for (int i = 0; i < 10; i++) {
+        values.emplace_back("key_" + std::to_string(i));
+    }
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR);
+    auto build_column = ColumnHelper::create_column(type, false);
+    auto probe_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    for (const auto& value : values) {
+        build_column->append_datum(Slice(value));
+        probe_column->append_datum(Slice(value));
+    }
+    table_items.first.resize(16, 0);
+    table_items.key_columns.emplace_back(std::move(build_column));
+    table_items.key_hashes = std::make_shared<Buffer<uint64_t>>();
+    table_items.bucket_size = 16;
+    table_items.row_count = 10;
+    table_items.next.resize(11);
+    probe_state.probe_row_count = 10;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+
+    JoinBuildFunc<TYPE_VARCHAR>::prepare(nullptr, &table_items);
+    JoinProbeFunc<TYPE_VARCHAR>::prepare(_runtime_state.get(), &probe_state);
+    JoinBuildFunc<TYPE_VARCHAR>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    JoinProbeFunc<TYPE_VARCHAR>::lookup_init(table_items, &probe_state);
+
+    ASSERT_EQ(table_items.key_hashes->size(), 11);
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_EQ((*table_items.key_hashes)[i + 1], SliceHash()(Slice(values[i])));
+    }
+
+    const auto* data_column = ColumnHelper::as_raw_column<BinaryColumn>(table_items.key_columns[0]);
+    for (size_t i = 0; i < 10; i++) {
+        size_t found_count = 0;
+        size_t probe_index = probe_state.next[i];
+        while (probe_index != 0) {
+            if (Slice(values[i]) == data_column->get_slice(probe_index)) {
+                found_count++;
+            }
+            probe_index = table_items.next[probe_index];
+        }
+        ASSERT_EQ(found_count, 1);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -2929,4 +2984,42 @@ TEST_F(JoinHashMapTest, TestLazyPredicateSlotsNormal) {
     check_lazy_build_output_slot_ids(*ht.table_items(), {4});
     check_not_output_slot_ids(*ht.table_items(), {0, 3});
 }
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, AppendSelectiveHashTable) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable src;
+    src.create(param);
+    auto build_chunk = create_int32_build_chunk(10, 0, false);
+    Columns build_keys_column{build_chunk->columns()[0]};
+    src.append_chunk(build_chunk, build_keys_column);
+
+    // row 0 of the build chunk is a placeholder, so row i holds value i - 1
+    std::vector<uint32_t> indexes{2, 4, 6, 8, 10};
+    JoinHashTable dst;
+    dst.create(param);
+    dst.append_selective_ht(src, indexes.data(), 1, 3);
+
+    ASSERT_EQ(dst.get_row_count(), 3);
+    const auto& dst_chunk = dst.get_build_chunk();
+    ASSERT_EQ(dst_chunk->num_rows(), 4);
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_EQ(dst_chunk->get_column_by_slot_id(3)->get(i + 1).get_int32(), 3 + 2 * i);
+        ASSERT_EQ(dst_chunk->get_column_by_slot_id(5)->get(i + 1).get_int32(), 23 + 2 * i);
+    }
+
+    src.close();
+    dst.close();
+}
 } // namespace starrocks
@@ -0,0 +1,135 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/datum.h"
+#include "runtime/descriptors.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class NLJoinRangeIndexTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        for (SlotId id : {kLoSlot, kHiSlot, kPayloadSlot}) {
+            _slots.emplace_back(std::make_unique<SlotDescriptor>(id, fmt::format("c{}", id), TypeDescriptor(TYPE_INT)));
+            _build_slots.emplace_back(_slots.back().get());
+        }
+        _spec.probe_slot = kProbeSlot;
+        _spec.lo_slot = kLoSlot;
+        _spec.hi_slot = kHiSlot;
+        _spec.type = TYPE_INT;
+    }
+
+protected:
+    static constexpr SlotId kProbeSlot = 0;
+    static constexpr SlotId kLoSlot = 1;
+    static constexpr SlotId kHiSlot = 2;
+    static constexpr SlotId kPayloadSlot = 3;
+
+    // rows of (lo, hi), a null bound is std::nullopt
+    ChunkPtr _build_chunk(const std::vector<std::pair<std::optional<int32_t>, std::optional<int32_t>>>& rows,
+                          int32_t payload_start) {
+        auto chunk = std::make_shared<Chunk>();
+        auto lo = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+        auto hi = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+        auto payload = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+        for (const auto& [l, h] : rows) {
+            lo->append_datum(l.has_value() ? Datum(*l) : Datum());
+            hi->append_datum(h.has_value() ? Datum(*h) : Datum());
+            payload->append_datum(Datum(payload_start++));
+        }
+        chunk->append_column(std::move(lo), kLoSlot);
+        chunk->append_column(std::move(hi), kHiSlot);
+        chunk->append_column(std::move(payload), kPayloadSlot);
+        return chunk;
+    }
+
+    std::vector<std::unique_ptr<SlotDescriptor>> _slots;
+    std::vector<SlotDescriptor*> _build_slots;
+    NLJoinRangeSpec _spec;
+};
+
+TEST_F(NLJoinRangeIndexTest, test_sort_and_drop_null_bounds) {
+    std::vector<ChunkPtr> build_chunks;
+    build_chunks.emplace_back(_build_chunk({{30, 39}, {std::nullopt, 5}, {10, 19}}, 0));
+    build_chunks.emplace_back(_build_chunk({{20, 29}, {0, std::nullopt}, {15, 12}, {0, 9}}, 3));
+
+    ChunkPtr sorted_chunk;
+    ASSIGN_OR_ABORT(auto index, NLJoinRangeIndex::build(_spec, _build_slots, build_chunks, &sorted_chunk));
+    // the null bounds and the empty range [15, 12] never match
+    ASSERT_EQ(4, sorted_chunk->num_rows());
+    std::vector<int32_t> expected_payloads{6, 2, 3, 0};
+    for (size_t i = 0; i < expected_payloads.size(); i++) {
+        EXPECT_EQ(expected_payloads[i], sorted_chunk->get_column_by_slot_id(kPayloadSlot)->get(i).get_int32());
+    }
+
+    auto [first, end] = index->candidates(-1);
+    EXPECT_EQ(0u, first);
+    EXPECT_EQ(0u, end);
+    std::tie(first, end) = index->candidates(25);
+    EXPECT_EQ(2u, first);
+    EXPECT_EQ(3u, end);
+    std::tie(first, end) = index->candidates(40);
+    EXPECT_EQ(first, end);
+
+    auto probe = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    probe->append_nulls(1);
+    std::tie(first, end) = index->candidates(*probe, 0);
+    EXPECT_EQ(first, end);
+}
+
+TEST_F(NLJoinRangeIndexTest, test_candidates_cover_all_matches) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> start_dist(0, 10000);
+    std::uniform_int_distribution<int32_t> length_dist(0, 100);
+    std::vector<std::pair<std::optional<int32_t>, std::optional<int32_t>>> rows;
+    std::vector<std::pair<int32_t, int32_t>> ranges;
+    for (int i = 0; i < 1000; i++) {
+        int32_t lo = start_dist(rng);
+        int32_t hi = lo + length_dist(rng);
+        rows.emplace_back(lo, hi);
+        ranges.emplace_back(lo, hi);
+    }
+    ChunkPtr sorted_chunk;
+    ASSIGN_OR_ABORT(auto index, NLJoinRangeIndex::build(_spec, _build_slots, {_build_chunk(rows, 0)}, &sorted_chunk));
+    ASSERT_EQ(rows.size(), sorted_chunk->num_rows());
+
+    const auto& payloads = sorted_chunk->get_column_by_slot_id(kPayloadSlot);
+    for (int32_t p = -10; p <= 10200; p += 7) {
+        auto [first, end] = index->candidates(p);
+        size_t num_matches = 0;
+        for (uint32_t i = first; i < end; i++) {
+            const auto& [lo, hi] = ranges[payloads->get(i).get_int32()];
+            num_matches += lo <= p && p <= hi;
+        }
+        size_t expected = std::count_if(ranges.begin(), ranges.end(),
+                                        [&](const auto& range) { return range.first <= p && p <= range.second; });
+        ASSERT_EQ(expected, num_matches) << "probe=" << p;
+        // the candidates are a small part of the build rows for the short ranges
+        ASSERT_LE(end - first, 200u) << "probe=" << p;
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
 #include <thread>
 
 #include "exec/pipeline/pipeline_fwd.h"
@@ -170,6 +171,125 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_basic) {
+    PipelineExecutorMetrics metrics;
+    // A single shard behaves the same as QuerySharedDriverQueue.
+    WorkStealingDriverQueue queue(metrics.get_driver_queue_metrics(), 1);
+
+    QueryContext query_context;
+    auto driver71 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver71.get(), 7);
+    driver71->driver_acct().update_last_time_spent(5'000'000L * 1);
+
+    auto driver61 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver61.get(), 6);
+    driver61->driver_acct().update_last_time_spent(30'000'000L * QuerySharedDriverQueue::ratio_of_adjacent_queue());
+
+    auto driver51 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver51.get(), 5);
+    driver51->driver_acct().update_last_time_spent(20'000'000L * QuerySharedDriverQueue::ratio_of_adjacent_queue() *
+                                                   QuerySharedDriverQueue::ratio_of_adjacent_queue());
+
+    std::vector<DriverRawPtr> in_drivers = {driver71.get(), driver61.get(), driver51.get()};
+    std::vector<DriverRawPtr> out_drivers = {driver71.get(), driver51.get(), driver61.get()};
+
+    for (auto* in_driver : in_drivers) {
+        queue.update_statistics(in_driver);
+        queue.put_back(in_driver);
+    }
+    ASSERT_EQ(3, queue.size());
+
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    PipelineExecutorMetrics metrics;
+    WorkStealingDriverQueue queue(metrics.get_driver_queue_metrics(), 4);
+
+    QueryContext query_context;
+    std::vector<DriverPtr> drivers;
+    for (int i = 0; i < 8; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1));
+        queue.put_back(drivers.back().get());
+    }
+    ASSERT_EQ(8, queue.size());
+
+    // All the drivers can be taken from a single thread, no matter which shard they are put into.
+    std::set<DriverRawPtr> taken;
+    for (int i = 0; i < 8; ++i) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_NE(nullptr, maybe_driver.value());
+        ASSERT_FALSE(maybe_driver.value()->is_in_ready());
+        taken.insert(maybe_driver.value());
+    }
+    ASSERT_EQ(8, taken.size());
+    ASSERT_TRUE(queue.empty());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(nullptr, maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_cancel) {
+    PipelineExecutorMetrics metrics;
+    WorkStealingDriverQueue queue(metrics.get_driver_queue_metrics(), 1);
+
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, nullptr, -1);
+    auto driver3 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, nullptr, -1);
+    queue.put_back(driver1.get());
+    queue.put_back(driver2.get());
+    queue.put_back(driver3.get());
+
+    queue.cancel(driver3.get());
+    std::vector<DriverRawPtr> out_drivers = {driver3.get(), driver1.get(), driver2.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_block) {
+    PipelineExecutorMetrics metrics;
+    WorkStealingDriverQueue queue(metrics.get_driver_queue_metrics(), 4);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.put_back(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    PipelineExecutorMetrics metrics;
+    WorkStealingDriverQueue queue(metrics.get_driver_queue_metrics(), 4);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -15,6 +15,7 @@
 #include <chrono>
 #include <random>
 
+#include "exec/join_hash_map.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/work_group.h"
 #include "gtest/gtest.h"
@@ -299,4 +300,22 @@ TEST(QueryContextManagerTest, testSetWorkgroup) {
     ASSERT_EQ(0, wg->num_running_queries());
 }
 
+TEST(QueryContextManagerTest, testBroadcastHashTable) {
+    auto query_ctx = std::make_shared<QueryContext>();
+    ASSERT_EQ(nullptr, query_ctx->get_broadcast_hash_table(1));
+
+    auto ht1 = std::make_shared<JoinHashTable>();
+    auto ht2 = std::make_shared<JoinHashTable>();
+    query_ctx->publish_broadcast_hash_table(1, ht1);
+    // the first published table is kept while it is alive.
+    query_ctx->publish_broadcast_hash_table(1, ht2);
+    ASSERT_EQ(ht1, query_ctx->get_broadcast_hash_table(1));
+    ASSERT_EQ(nullptr, query_ctx->get_broadcast_hash_table(2));
+
+    ht1.reset();
+    ASSERT_EQ(nullptr, query_ctx->get_broadcast_hash_table(1));
+    query_ctx->publish_broadcast_hash_table(1, ht2);
+    ASSERT_EQ(ht2, query_ctx->get_broadcast_hash_table(1));
+}
+
 } // namespace starrocks::pipeline
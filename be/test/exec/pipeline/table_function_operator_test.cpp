@@ -167,6 +167,58 @@ TEST_F(TableFunctionOperatorTest, check_mem_leak) {
     op.close(&_runtime_state);
 }
 
+TEST_F(TableFunctionOperatorTest, unnest_repeat_outer_columns) {
+    CounterPtr counter_ptr = std::make_shared<Counter>();
+    TestNormalOperatorFactory factory(1, 1, counter_ptr, &_tnode);
+    TableFunctionOperator op(&factory, 1, 1, 0, _tnode);
+    ASSERT_TRUE(op.prepare(&_runtime_state).ok());
+
+    // The arrays span several output chunks, and the outer rows of the empty arrays are skipped.
+    const std::vector<int> array_sizes{3000, 2000, 0, 1, 5000};
+    const std::vector<Datum> outer_values{Datum(10), Datum(), Datum(30), Datum(40), Datum(50)};
+    auto array_column = ColumnHelper::create_column(TYPE_INT_ARRAY_DESC, false);
+    auto outer_column = ColumnHelper::create_column(TYPE_INT_DESC, true);
+    for (size_t i = 0; i < array_sizes.size(); i++) {
+        DatumArray array;
+        for (int j = 0; j < array_sizes[i]; j++) {
+            array.emplace_back(j);
+        }
+        array_column->append_datum(Datum(array));
+        outer_column->append_datum(outer_values[i]);
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(std::move(array_column), 1);
+    chunk->append_column(std::move(outer_column), 2);
+    ASSERT_TRUE(op.push_chunk(&_runtime_state, chunk).ok());
+
+    size_t num_rows = 0;
+    size_t row_idx = 0;
+    int element = 0;
+    while (op.has_output()) {
+        auto res = op.pull_chunk(&_runtime_state);
+        ASSERT_TRUE(res.ok());
+        const auto& outer = res.value()->get_column_by_slot_id(2);
+        const auto& result = res.value()->get_column_by_slot_id(3);
+        ASSERT_EQ(outer->size(), result->size());
+        for (size_t i = 0; i < outer->size(); i++) {
+            while (element == array_sizes[row_idx]) {
+                row_idx++;
+                element = 0;
+            }
+            if (outer_values[row_idx].is_null()) {
+                ASSERT_TRUE(outer->is_null(i));
+            } else {
+                ASSERT_EQ(outer_values[row_idx].get_int32(), outer->get(i).get_int32());
+            }
+            ASSERT_EQ(element, result->get(i).get_int32());
+            element++;
+        }
+        num_rows += outer->size();
+    }
+    ASSERT_EQ(10001, num_rows);
+    op.close(&_runtime_state);
+}
+
 TEST_F(TableFunctionOperatorTest, key_partition_exchanger) {
     auto pseudo_plan_node_id = -200;
     auto mem_mgr = std::make_shared<ChunkBufferMemoryManager>(4096, 134217728);
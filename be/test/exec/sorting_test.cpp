@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <numeric>
 #include <random>
 #include <utility>
 
@@ -389,6 +390,132 @@ TEST(SortingTest, merge_sorted_stream) {
     }
 }
 
+TEST(SortingTest, radix_sort_columns) {
+    constexpr size_t num_rows = 4096;
+    std::mt19937 rng(0);
+    ColumnPtr col0 = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr col1 = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), false);
+    ColumnPtr col2 = ColumnHelper::create_column(TypeDescriptor(TYPE_DATE), true);
+    for (size_t i = 0; i < num_rows; i++) {
+        col0->append_datum(rng() % 8 == 0 ? Datum() : Datum(static_cast<int32_t>(rng() % 64) - 32));
+        col1->append_datum(Datum(static_cast<int64_t>(rng() % 16) - 8));
+        col2->append_datum(rng() % 8 == 0 ? Datum() : Datum(DateValue::create(2024, 1, 1 + rng() % 28)));
+    }
+    Columns columns{col0, col1, col2};
+    // col0 asc nulls first, col1 desc, col2 desc nulls last
+    SortDescs sort_desc(std::vector<bool>{true, false, false}, std::vector<bool>{true, false, false});
+
+    Permutation perm;
+    ASSIGN_OR_ABORT(bool sorted, radix_sort_columns(false, columns, sort_desc, &perm));
+    ASSERT_TRUE(sorted);
+    ASSERT_EQ(num_rows, perm.size());
+
+    // radix sort is stable, so it must produce the same order with std::stable_sort
+    std::vector<uint32_t> expected(num_rows);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](uint32_t lhs, uint32_t rhs) {
+        Datum l0 = col0->get(lhs), r0 = col0->get(rhs);
+        if (l0.is_null() != r0.is_null()) {
+            return l0.is_null();
+        }
+        if (!l0.is_null() && l0.get_int32() != r0.get_int32()) {
+            return l0.get_int32() < r0.get_int32();
+        }
+        Datum l1 = col1->get(lhs), r1 = col1->get(rhs);
+        if (l1.get_int64() != r1.get_int64()) {
+            return l1.get_int64() > r1.get_int64();
+        }
+        Datum l2 = col2->get(lhs), r2 = col2->get(rhs);
+        if (l2.is_null() != r2.is_null()) {
+            return r2.is_null();
+        }
+        return !l2.is_null() && l2.get_date() > r2.get_date();
+    });
+    std::vector<uint32_t> result;
+    permutate_to_selective(perm, &result);
+    ASSERT_EQ(expected, result);
+
+    // binary keys are not supported
+    ColumnPtr binary = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), false);
+    binary->append_datum(Datum(Slice("a")));
+    ASSIGN_OR_ABORT(sorted, radix_sort_columns(false, Columns{binary}, SortDescs::asc_null_first(1), &perm));
+    ASSERT_FALSE(sorted);
+}
+
+TEST(SortingTest, sort_key_prefix) {
+    constexpr size_t num_rows = 512;
+    std::mt19937 rng(0);
+    ColumnPtr col0 = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr col1 = ColumnHelper::create_column(TypeDescriptor(TYPE_SMALLINT), false);
+    ColumnPtr col2 = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), false);
+    std::vector<std::string> strings(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        col0->append_datum(rng() % 8 == 0 ? Datum() : Datum(static_cast<int32_t>(rng() % 8) - 4));
+        col1->append_datum(Datum(static_cast<int16_t>(rng() % 4)));
+        strings[i] = std::to_string(rng() % 16);
+        col2->append_datum(Datum(Slice(strings[i])));
+    }
+    Columns columns{col0, col1, col2};
+    // col0 desc nulls last, col1 asc, col2 asc
+    SortDescs sort_desc(std::vector<bool>{false, true, true}, std::vector<bool>{false, true, true});
+
+    size_t num_encoded_columns = 0;
+    ColumnPtr prefix = encode_sort_key_prefix(columns, sort_desc, &num_encoded_columns);
+    ASSERT_TRUE(prefix != nullptr);
+    ASSERT_EQ(2, num_encoded_columns);
+
+    auto less = [&](uint32_t lhs, uint32_t rhs) {
+        Datum l0 = col0->get(lhs), r0 = col0->get(rhs);
+        if (l0.is_null() != r0.is_null()) {
+            return r0.is_null();
+        }
+        if (!l0.is_null() && l0.get_int32() != r0.get_int32()) {
+            return l0.get_int32() > r0.get_int32();
+        }
+        return col1->get(lhs).get_int16() < col1->get(rhs).get_int16();
+    };
+    for (uint32_t i = 1; i < num_rows; i++) {
+        int cmp = prefix->compare_at(i - 1, i, *prefix, 1);
+        ASSERT_EQ(less(i - 1, i), cmp < 0);
+        ASSERT_EQ(less(i, i - 1), cmp > 0);
+    }
+
+    Permutation perm;
+    ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &perm));
+    ASSERT_EQ(num_rows, perm.size());
+    for (size_t i = 1; i < num_rows; i++) {
+        uint32_t lhs = perm[i - 1].index_in_chunk, rhs = perm[i].index_in_chunk;
+        ASSERT_FALSE(less(rhs, lhs));
+        if (!less(lhs, rhs)) {
+            ASSERT_LE(strings[lhs], strings[rhs]);
+        }
+    }
+}
+
+TEST(SortingTest, sort_binary_column_by_prefix) {
+    // the strings share long prefixes, contain zero bytes and differ in length around the inlined 8 bytes
+    std::vector<std::string> strings = {"", std::string("ab\0", 3), "ab", std::string("ab\0c", 4), "abcdefgh",
+                                        "abcdefg", "abcdefghi", "abcdefgh\xff", "\xff", "abcdefgha", "b", "abcdefgh"};
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), false);
+    for (const auto& str : strings) {
+        column->append_datum(Datum(Slice(str)));
+    }
+    for (bool asc : {true, false}) {
+        Permutation perm;
+        SortDescs sort_desc(std::vector<bool>{asc}, std::vector<bool>{true});
+        ASSERT_OK(sort_and_tie_columns(false, Columns{column}, sort_desc, &perm));
+        std::vector<std::string> expected = strings;
+        std::sort(expected.begin(), expected.end());
+        if (!asc) {
+            std::reverse(expected.begin(), expected.end());
+        }
+        ASSERT_EQ(strings.size(), perm.size());
+        for (size_t i = 0; i < perm.size(); i++) {
+            ASSERT_EQ(expected[i], strings[perm[i].index_in_chunk]);
+        }
+    }
+}
+
 static void test_merge_path(const size_t num_cols, const size_t left_start, const size_t left_num_rows,
                             const size_t right_start, const size_t right_num_rows, const size_t dest_num_rows,
                             const size_t processor_num, bool& success) {
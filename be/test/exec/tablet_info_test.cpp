@@ -36,6 +36,9 @@
 
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
 #include "runtime/descriptor_helper.h"
 
 namespace starrocks {
@@ -165,6 +168,78 @@ TEST_F(OlapTablePartitionParamTest, bad_index) {
     }
 }
 
+static TExprNode create_int_literal(int32_t value) {
+    TExprNode node;
+    node.node_type = TExprNodeType::INT_LITERAL;
+    node.type = TypeDescriptor(TYPE_INT).to_thrift();
+    node.__isset.int_literal = true;
+    node.int_literal.value = value;
+    return node;
+}
+
+TEST_F(OlapTablePartitionParamTest, find_tablets_with_range_partition) {
+    TDescriptorTable t_desc_tbl;
+    auto t_schema = get_schema(&t_desc_tbl);
+    std::shared_ptr<OlapTableSchemaParam> schema(new OlapTableSchemaParam());
+    ASSERT_TRUE(schema->init(t_schema).ok());
+
+    // (-oo, 10) | [10, 50) | [60, +oo)
+    TOlapTablePartitionParam t_partition_param;
+    t_partition_param.db_id = 1;
+    t_partition_param.table_id = 2;
+    t_partition_param.version = 0;
+    t_partition_param.__set_partition_columns({"c1"});
+    t_partition_param.__set_distributed_columns({"c2"});
+    t_partition_param.partitions.resize(3);
+    for (int i = 0; i < 3; i++) {
+        auto& t_part = t_partition_param.partitions[i];
+        t_part.id = 10 + i;
+        t_part.indexes.resize(2);
+        t_part.indexes[0].index_id = 4;
+        t_part.indexes[0].tablets = {20 + i * 2};
+        t_part.indexes[1].index_id = 5;
+        t_part.indexes[1].tablets = {21 + i * 2};
+    }
+    t_partition_param.partitions[0].__set_end_keys({create_int_literal(10)});
+    t_partition_param.partitions[1].__set_start_keys({create_int_literal(10)});
+    t_partition_param.partitions[1].__set_end_keys({create_int_literal(50)});
+    t_partition_param.partitions[2].__set_start_keys({create_int_literal(60)});
+
+    OlapTablePartitionParam part(schema, t_partition_param);
+    ASSERT_TRUE(part.init(nullptr).ok());
+
+    std::vector<int32_t> keys{5, 10, 49, 50, 55, 60, 1000, 10, -100};
+    std::vector<int64_t> expect_partitions{10, 11, 11, -1, -1, 12, 12, 11, 10};
+    auto c1 = Int32Column::create();
+    auto c2 = Int64Column::create();
+    auto c3 = BinaryColumn::create();
+    for (size_t i = 0; i < keys.size(); i++) {
+        c1->append(keys[i]);
+        c2->append(i);
+        c3->append(Slice("a"));
+    }
+    Chunk chunk(Columns{std::move(c1), std::move(c2), std::move(c3)}, Chunk::SlotHashMap{{0, 0}, {1, 1}, {2, 2}});
+
+    std::vector<OlapTablePartition*> partitions;
+    std::vector<uint32_t> hashes;
+    std::vector<uint8_t> selection(keys.size(), 1);
+    selection.back() = 0;
+    std::vector<int> invalid_row_indexs;
+    ASSERT_TRUE(part.find_tablets(&chunk, &partitions, &hashes, &selection, &invalid_row_indexs, 0, nullptr).ok());
+
+    // the last row is not selected
+    for (size_t i = 0; i + 1 < keys.size(); i++) {
+        if (expect_partitions[i] < 0) {
+            ASSERT_EQ(0, selection[i]) << i;
+        } else {
+            ASSERT_EQ(1, selection[i]) << i;
+            ASSERT_EQ(expect_partitions[i], partitions[i]->id) << i;
+        }
+    }
+    ASSERT_EQ(0, selection.back());
+    ASSERT_EQ((std::vector<int>{3, 4}), invalid_row_indexs);
+}
+
 TEST_F(OlapTablePartitionParamTest, tableLoacation) {
     TOlapTableLocationParam tparam;
     tparam.tablets.resize(1);
@@ -1037,6 +1037,32 @@ TEST_F(AggregateTest, test_min) {
 //    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
 //}
 
+TEST_F(AggregateTest, test_count_distinct_update_batch) {
+    const AggregateFunction* func = get_aggregate_function("multi_distinct_count", TYPE_INT, TYPE_BIGINT, false);
+    std::vector<std::unique_ptr<ManagedAggrState>> managed_states;
+    for (int i = 0; i < 3; i++) {
+        managed_states.emplace_back(ManagedAggrState::create(ctx, func));
+    }
+
+    auto data_column = Int32Column::create();
+    std::vector<AggDataPtr> states;
+    for (int i = 0; i < 1000; i++) {
+        data_column->append(i % 100);
+        states.emplace_back(managed_states[i % 3]->state());
+    }
+    const Column* row_column = data_column.get();
+    func->update_batch(ctx, data_column->size(), 0, &row_column, states.data());
+
+    auto result_column = Int64Column::create();
+    for (auto& state : managed_states) {
+        func->finalize_to_column(ctx, state->state(), result_column.get());
+    }
+    // (i % 100, i % 3) covers all the 300 combinations
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(100, result_column->get_data()[i]);
+    }
+}
+
 TEST_F(AggregateTest, test_count_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_count", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
@@ -2658,6 +2684,27 @@ TEST_F(AggregateTest, test_array_agg_distinct) {
     ASSERT_EQ(6, elem->size());
 }
 
+TEST_F(AggregateTest, test_array_agg_distinct_state_allocator) {
+    const AggregateFunction* agg_function = get_aggregate_function("array_agg_distinct", TYPE_INT, TYPE_ARRAY, false);
+    auto state = ManagedAggrState::create(ctx, agg_function);
+    int64_t memory_usage = _allocator->memory_usage();
+
+    Int32Column::Ptr data_column = Int32Column::create();
+    for (int i = 0; i < 1024; i++) {
+        data_column->append(i % 100);
+    }
+    const Column* row_column = data_column.get();
+    agg_function->update_batch_single_state(ctx, data_column->size(), &row_column, state->state());
+    // the hash set of the state is allocated by the aggregate state allocator
+    ASSERT_GT(_allocator->memory_usage(), memory_usage);
+
+    Int32Column::Ptr elem = Int32Column::create();
+    UInt32Column::Ptr offsets = UInt32Column::create(0);
+    ArrayColumn::Ptr result_column = ArrayColumn::create(ColumnHelper::cast_to_nullable_column(elem), offsets);
+    agg_function->finalize_to_column(ctx, state->state(), result_column.get());
+    ASSERT_EQ(100, elem->size());
+}
+
 TEST_F(AggregateTest, test_array_agg_nullable) {
     const AggregateFunction* func = get_aggregate_function("array_agg", TYPE_INT, TYPE_ARRAY, true);
     auto state = ManagedAggrState::create(ctx, func);
@@ -5506,6 +5506,30 @@ TEST_F(ArrayFunctionsTest, array_match_not_null) {
     ASSERT_TRUE(dest_column->get(6).get_int8());
 }
 
+TEST_F(ArrayFunctionsTest, array_match_without_null_elements) {
+    ColumnPtr src_column = ColumnHelper::create_column(TYPE_ARRAY_BOOLEAN, false);
+    for (int i = 0; i < 100; i++) {
+        DatumArray values(i % 7, Datum((int8_t)0));
+        if (i % 3 == 0 && !values.empty()) {
+            values[i % values.size()] = Datum((int8_t)1);
+        }
+        src_column->append_datum(values);
+    }
+
+    auto any_column = ArrayMatch<true>::process(nullptr, {src_column});
+    auto all_column = ArrayMatch<false>::process(nullptr, {src_column});
+    ASSERT_EQ(any_column->size(), 100);
+    ASSERT_EQ(all_column->size(), 100);
+    for (int i = 0; i < 100; i++) {
+        size_t num_values = i % 7;
+        bool has_true = i % 3 == 0 && num_values > 0;
+        ASSERT_FALSE(any_column->get(i).is_null());
+        ASSERT_FALSE(all_column->get(i).is_null());
+        ASSERT_EQ(has_true, any_column->get(i).get_int8());
+        ASSERT_EQ(num_values == 0 || (num_values == 1 && has_true), all_column->get(i).get_int8());
+    }
+}
+
 TEST_F(ArrayFunctionsTest, array_match_only_null) {
     // test only null
     {
@@ -3142,4 +3142,58 @@ TEST_F(DecimalBinaryFunctionTest, test_overflow_report_error) {
                  std::overflow_error);
 }
 
+template <typename Op>
+void test_decimal128_batch_arithmetics(const std::vector<int128_t>& lhs_values,
+                                       const std::vector<int128_t>& rhs_values) {
+    auto lhs_column = Decimal128Column::create(38, 4);
+    auto rhs_column = Decimal128Column::create(38, 4);
+    lhs_column->get_data().assign(lhs_values.begin(), lhs_values.end());
+    rhs_column->get_data().assign(rhs_values.begin(), rhs_values.end());
+
+    using ColumnWiseOp = VectorizedStrictDecimalBinaryFunction<Op, OverflowMode::OUTPUT_NULL>;
+    auto result = ColumnWiseOp::template evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(
+            std::move(lhs_column), std::move(rhs_column));
+    ASSERT_EQ(result->size(), lhs_values.size());
+    using DecimalV3Operators = DecimalV3Arithmetics<int128_t, true>;
+    for (size_t i = 0; i < lhs_values.size(); ++i) {
+        int128_t expect = 0;
+        bool overflow = false;
+        if constexpr (is_add_op<Op>) {
+            overflow = DecimalV3Operators::add(lhs_values[i], rhs_values[i], &expect);
+        } else if constexpr (is_sub_op<Op>) {
+            overflow = DecimalV3Operators::sub(lhs_values[i], rhs_values[i], &expect);
+        } else {
+            overflow = DecimalV3Operators::mul(lhs_values[i], rhs_values[i], &expect);
+        }
+        ASSERT_EQ(result->is_null(i), overflow);
+        if (!overflow) {
+            auto* data = ColumnHelper::get_data_column(result.get());
+            ASSERT_TRUE(down_cast<Decimal128Column*>(data)->get_data()[i] == expect);
+        }
+    }
+}
+
+TEST_F(DecimalBinaryFunctionTest, test_decimal128_batch_arithmetics) {
+    std::mt19937_64 rand(0);
+    const size_t num_rows = 1000;
+    std::vector<int128_t> small_values(num_rows);
+    std::vector<int128_t> medium_values(num_rows);
+    std::vector<int128_t> large_values(num_rows);
+    std::vector<int128_t> other_large_values(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        small_values[i] = static_cast<int64_t>(rand());
+        medium_values[i] = static_cast<int128_t>(small_values[i]) << 60;
+        large_values[i] = static_cast<int128_t>((static_cast<uint128_t>(rand()) << 64) | rand());
+        other_large_values[i] = static_cast<int128_t>((static_cast<uint128_t>(rand()) << 64) | rand());
+    }
+    // no overflow, all the rows are evaluated in the batch fast path
+    test_decimal128_batch_arithmetics<AddOp>(small_values, medium_values);
+    test_decimal128_batch_arithmetics<SubOp>(medium_values, small_values);
+    test_decimal128_batch_arithmetics<MulOp>(small_values, small_values);
+    // some rows overflow, the batch is evaluated again with the per-row checks
+    test_decimal128_batch_arithmetics<AddOp>(large_values, other_large_values);
+    test_decimal128_batch_arithmetics<SubOp>(large_values, other_large_values);
+    test_decimal128_batch_arithmetics<MulOp>(small_values, medium_values);
+}
+
 } // namespace starrocks
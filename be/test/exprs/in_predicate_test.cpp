@@ -479,4 +479,40 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInLongList) {
+    expr_node.child_type = TPrimitiveType::INT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.in_predicate.is_not_in = false;
+
+    // the dense values are tested with a bitset, and the sparse values with the hash set
+    for (int64_t step : {2, 1000000}) {
+        auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+        auto input = Int32Column::create();
+        for (int32_t v = -10; v < 100; v++) {
+            input->append(v * step / 2);
+        }
+        MockColumnExpr col(expr_node, std::move(input));
+        expr->_children.push_back(&col);
+
+        std::vector<std::unique_ptr<MockConstVectorizedExpr<TYPE_INT>>> values;
+        for (int32_t v = 0; v < 50; v++) {
+            values.emplace_back(std::make_unique<MockConstVectorizedExpr<TYPE_INT>>(expr_node, v * step));
+            expr->_children.push_back(values.back().get());
+        }
+
+        ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+        ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ASSERT_EQ(110, ptr->size());
+        auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+        for (int32_t j = 0; j < 110; ++j) {
+            const int32_t value = j - 10;
+            ASSERT_EQ(value >= 0 && value < 100 && value % 2 == 0, v->get_data()[j]) << value;
+        }
+        expr->_children.clear();
+    }
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 #include "exprs/function_call_expr.h"
 #include "exprs/like_predicate.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "testutil/assert.h"
 #include "util/bloom_filter.h"
 
 namespace starrocks {
@@ -694,4 +695,57 @@ TEST_F(LikeTest, splitLikePatternIntoNgramSet) {
     VectorizedFunctionCallExpr::split_like_string_to_ngram(pattern, options, ngram_set);
     ASSERT_EQ(0, ngram_set.size());
 }
+
+TEST_F(LikeTest, splitRegexpPatternIntoNgramSet) {
+    NgramBloomFilterReaderOptions options{3, true};
+    std::vector<std::string> ngram_set;
+    // fragments are split at classes, wildcards and quantifiers, an optional char is dropped
+    ASSERT_TRUE(VectorizedFunctionCallExpr::split_regexp_string_to_ngram("^error: [0-9]+ timeouts?\\.$", options,
+                                                                        ngram_set));
+    ASSERT_EQ((std::vector<std::string>{"err", "rro", "ror", "or:", "r: ", " ti", "tim", "ime", "meo", "eou", "out"}),
+              ngram_set);
+
+    ngram_set.clear();
+    ASSERT_TRUE(VectorizedFunctionCallExpr::split_regexp_string_to_ngram("ab+cd\\d{2}xyz", options, ngram_set));
+    ASSERT_EQ((std::vector<std::string>{"xyz"}), ngram_set);
+
+    // alternations and groups are given up
+    ngram_set.clear();
+    ASSERT_FALSE(VectorizedFunctionCallExpr::split_regexp_string_to_ngram("abcd|efgh", options, ngram_set));
+    ASSERT_FALSE(VectorizedFunctionCallExpr::split_regexp_string_to_ngram("(?i)abcd", options, ngram_set));
+    // no fragment is long enough
+    ngram_set.clear();
+    ASSERT_FALSE(VectorizedFunctionCallExpr::split_regexp_string_to_ngram("ab.cd[efg]h", options, ngram_set));
+}
+
+TEST_F(LikeTest, multiPatternMatcher) {
+    LikePredicate::MultiPatternMatcher matcher;
+    matcher.add_like_pattern("%timeout%");
+    matcher.add_like_pattern("conn_refused");
+    matcher.add_regex_pattern("err[0-9]+");
+    ASSERT_EQ(3, matcher.num_patterns());
+    ASSERT_TRUE(matcher.compile());
+
+    auto str = BinaryColumn::create();
+    str->append("read timeout after 3s");
+    str->append("connXrefused");
+    str->append("conn_refused");
+    str->append("fatal err42 happened");
+    str->append("err");
+    str->append("");
+    auto nulls = NullColumn::create(6, 0);
+    str->append("ignored");
+    nulls->append(1);
+    auto column = NullableColumn::create(std::move(str), std::move(nulls));
+
+    ASSIGN_OR_ABORT(auto result, matcher.match_any(column));
+    ASSERT_EQ(7, result->size());
+    std::vector<bool> expected = {true, false, true, true, false, false};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expected[i], result->get(i).get_uint8()) << i;
+    }
+    ASSERT_TRUE(result->is_null(6));
+}
+
 } // namespace starrocks
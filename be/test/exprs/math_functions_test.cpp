@@ -19,9 +19,12 @@
 
 #include <cmath>
 
+#include "column/array_column.h"
+#include "column/column_helper.h"
 #include "exprs/binary_functions.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "exprs/time_functions.h"
+#include "testutil/assert.h"
 
 #define PI acos(-1)
 
@@ -1804,4 +1807,50 @@ TEST_F(VecMathFunctionsTest, IcbergTransTest) {
     }
 }
 
+TEST_F(VecMathFunctionsTest, VectorDistanceTest) {
+    TypeDescriptor array_type = TypeDescriptor::create_array_type(TypeDescriptor(TYPE_FLOAT));
+    // 19 dimensions to cover both the SIMD loop and the scalar tail
+    const size_t dim = 19;
+    auto make_vector = [&](float start) {
+        DatumArray array;
+        for (size_t i = 0; i < dim; i++) {
+            array.emplace_back(start + i);
+        }
+        return array;
+    };
+    auto query = ColumnHelper::create_column(array_type, false);
+    query->append_datum(make_vector(1));
+    auto targets = ColumnHelper::create_column(array_type, false);
+    targets->append_datum(make_vector(1));
+    targets->append_datum(make_vector(3));
+    targets->append_datum(make_vector(-10));
+
+    Columns columns{ConstColumn::create(std::move(query), 3), std::move(targets)};
+    ASSIGN_OR_ABORT(auto l2, MathFunctions::l2_distance<TYPE_FLOAT>(nullptr, columns));
+    ASSERT_EQ(3, l2->size());
+    ASSERT_FLOAT_EQ(0, l2->get(0).get_float());
+    ASSERT_FLOAT_EQ(4 * dim, l2->get(1).get_float());
+    ASSERT_FLOAT_EQ(121 * dim, l2->get(2).get_float());
+
+    ASSIGN_OR_ABORT(auto cosine, (MathFunctions::cosine_similarity<TYPE_FLOAT, false>(nullptr, columns)));
+    ASSERT_NEAR(1, cosine->get(0).get_float(), 1e-6);
+    float dot = 0, base_norm = 0, target_norm = 0;
+    for (size_t i = 0; i < dim; i++) {
+        dot += (1.0f + i) * (-10.0f + i);
+        base_norm += (1.0f + i) * (1.0f + i);
+        target_norm += (-10.0f + i) * (-10.0f + i);
+    }
+    ASSERT_NEAR(dot / (std::sqrt(base_norm) * std::sqrt(target_norm)), cosine->get(2).get_float(), 1e-5);
+
+    ASSIGN_OR_ABORT(auto product, (MathFunctions::cosine_similarity<TYPE_FLOAT, true>(nullptr, columns)));
+    ASSERT_FLOAT_EQ(dot, product->get(2).get_float());
+
+    auto short_target = ColumnHelper::create_column(array_type, false);
+    for (int i = 0; i < 3; i++) {
+        short_target->append_datum(DatumArray{Datum(1.0f)});
+    }
+    Columns bad_columns{columns[0], std::move(short_target)};
+    ASSERT_FALSE(MathFunctions::l2_distance<TYPE_FLOAT>(nullptr, bad_columns).ok());
+}
+
 } // namespace starrocks
@@ -78,4 +78,29 @@ TEST_F(PercentileFunctionsTest, percentileNullTest) {
     ASSERT_TRUE(result->is_null(0));
 }
 
+TEST_F(PercentileFunctionsTest, percentileBatchMergeTest) {
+    std::vector<PercentileValue> values(100);
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 100; j++) {
+            values[i].add(i * 100 + j);
+        }
+    }
+
+    PercentileValue one_by_one;
+    PercentileValue batch;
+    std::vector<const PercentileValue*> others;
+    for (auto& value : values) {
+        one_by_one.merge(&value);
+        others.push_back(&value);
+    }
+    batch.merge(others);
+
+    ASSERT_EQ(0, batch.quantile(0));
+    ASSERT_EQ(9999, batch.quantile(1));
+    for (double q : {0.1, 0.5, 0.9, 0.99}) {
+        ASSERT_NEAR(one_by_one.quantile(q), batch.quantile(q), 10000 * 0.01);
+        ASSERT_NEAR(q * 10000, batch.quantile(q), 10000 * 0.01);
+    }
+}
+
 } // namespace starrocks
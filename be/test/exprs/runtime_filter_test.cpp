@@ -430,6 +430,39 @@ TEST_P(RuntimeFilterTestFixture, TestJoinRuntimeFilterSerialize) {
     EXPECT_TRUE(check_equals(&bf0, down_cast<ComposedRuntimeBloomFilter<TYPE_INT>*>(rf1)));
 }
 
+TEST_P(RuntimeFilterTestFixture, TestJoinRuntimeFilterCompressedSerialize) {
+    const int rf_version = GetParam();
+
+    ComposedRuntimeBloomFilter<TYPE_INT> bf0;
+    RuntimeFilter* rf0 = &bf0;
+    bf0.membership_filter().init(100000);
+    for (int i = 0; i <= 200; i += 17) {
+        bf0.insert(i);
+    }
+
+    std::string buffer(RuntimeFilterHelper::max_runtime_filter_serialized_size(rf_version, rf0), 0);
+    buffer.resize(
+            RuntimeFilterHelper::serialize_runtime_filter(rf_version, rf0, reinterpret_cast<uint8_t*>(buffer.data())));
+    const size_t uncompressed_size = buffer.size();
+
+    const bool old_enable = config::enable_runtime_filter_compression;
+    const int64_t old_min_bytes = config::runtime_filter_compression_min_bytes;
+    config::enable_runtime_filter_compression = true;
+    config::runtime_filter_compression_min_bytes = 0;
+    RuntimeFilterHelper::compress_serialized_runtime_filter(&buffer);
+    config::enable_runtime_filter_compression = old_enable;
+    config::runtime_filter_compression_min_bytes = old_min_bytes;
+    // the sparse bloom filter is compressed
+    ASSERT_EQ(RF_COMPRESSED_MAGIC, static_cast<uint8_t>(buffer[0]));
+    ASSERT_LT(buffer.size(), uncompressed_size);
+
+    RuntimeFilter* rf1 = nullptr;
+    ObjectPool pool;
+    ASSERT_EQ(rf_version, RuntimeFilterHelper::deserialize_runtime_filter(
+                                  &pool, &rf1, reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));
+    EXPECT_TRUE(check_equals(&bf0, down_cast<ComposedRuntimeBloomFilter<TYPE_INT>*>(rf1)));
+}
+
 TEST_P(RuntimeMembershipFilterTestFixture, TestJoinRuntimeFilterSerialize2) {
     const int rf_version = GetParam();
 
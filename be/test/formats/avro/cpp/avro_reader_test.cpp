@@ -250,6 +250,36 @@ TEST_F(AvroReaderTest, test_read_primitive_types) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+TEST_F(AvroReaderTest, test_read_projected_fields) {
+    std::string filename = "primitive.avro";
+    std::vector<SlotDescriptor> tmp_slot_descs;
+    ASSERT_OK(create_avro_reader(filename)->get_schema(&tmp_slot_descs));
+
+    // only int_field and string_field are read, the other fields are skipped by the decoder
+    std::vector<SlotDescriptor*> slot_descs{&tmp_slot_descs[2], &tmp_slot_descs[7]};
+    create_column_readers(slot_descs, _timezone, false);
+
+    auto file_or = FileSystem::Default()->new_random_access_file(_test_exec_dir + filename);
+    ASSERT_OK(file_or.status());
+    AvroReader reader;
+    ASSERT_OK(reader.init(std::make_unique<AvroBufferInputStream>(std::move(file_or.value()),
+                                                                  config::avro_reader_buffer_size_bytes, _counter),
+                          filename, _state.get(), _counter, &slot_descs, &_column_readers, false));
+
+    std::vector<SlotDescriptor> schema;
+    ASSERT_OK(reader.get_schema(&schema));
+    ASSERT_EQ(8, schema.size());
+
+    auto chunk = create_src_chunk(slot_descs);
+    ASSERT_OK(reader.read_chunk(chunk, 2));
+    materialize_src_chunk_adaptive_nullable_column(chunk);
+    ASSERT_EQ(1, chunk->num_rows());
+    ASSERT_EQ("[123, 'hello avro']", chunk->debug_row(0));
+
+    chunk = create_src_chunk(slot_descs);
+    ASSERT_TRUE(reader.read_chunk(chunk, 2).is_end_of_file());
+}
+
 TEST_F(AvroReaderTest, test_read_complex_types) {
     std::string filename = "complex.avro";
     std::vector<SlotDescriptor*> slot_descs;
@@ -24,6 +24,7 @@
 #include "column/nullable_column.h"
 #include "common/config.h"
 #include "formats/parquet/types.h"
+#include "testutil/assert.h"
 #include "util/byte_stream_split.h"
 
 namespace starrocks::parquet {
@@ -452,6 +453,42 @@ TEST_F(ParquetEncodingTest, String) {
     }
 }
 
+TEST_F(ParquetEncodingTest, StringWithFilter) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 100; i++) {
+        values.push_back(std::string(i % 37, 'a' + i % 26));
+    }
+    std::vector<Slice> slices;
+    for (const auto& value : values) {
+        slices.emplace_back(value);
+    }
+
+    const EncodingInfo* plain_encoding = nullptr;
+    (void)EncodingInfo::get(tparquet::Type::BYTE_ARRAY, tparquet::Encoding::PLAIN, &plain_encoding);
+    ASSERT_TRUE(plain_encoding != nullptr);
+    std::unique_ptr<Decoder> decoder;
+    ASSERT_OK(plain_encoding->create_decoder(&decoder));
+    std::unique_ptr<Encoder> encoder;
+    ASSERT_OK(plain_encoding->create_encoder(&encoder));
+    ASSERT_OK(encoder->append(reinterpret_cast<uint8_t*>(slices.data()), slices.size()));
+    Slice encoded_data = encoder->build();
+
+    std::vector<uint8_t> filter(slices.size());
+    for (size_t i = 0; i < filter.size(); i++) {
+        filter[i] = i % 3 == 0;
+    }
+    // decode in two batches to check the state kept across batches
+    auto column = BinaryColumn::create();
+    ASSERT_OK(decoder->set_data(encoded_data));
+    ASSERT_OK(decoder->next_batch(40, ColumnContentType::VALUE, column.get(), filter.data()));
+    ASSERT_OK(decoder->next_batch(60, ColumnContentType::VALUE, column.get(), filter.data() + 40));
+    ASSERT_EQ(slices.size(), column->size());
+    for (size_t i = 0; i < slices.size(); i++) {
+        ASSERT_EQ(filter[i] ? slices[i] : Slice(), column->get_slice(i));
+    }
+    ASSERT_FALSE(decoder->next_batch(1, ColumnContentType::VALUE, column.get(), filter.data()).ok());
+}
+
 TEST_F(ParquetEncodingTest, FixedString) {
     std::vector<std::string> values;
     for (int i = 100; i < 200; i++) {
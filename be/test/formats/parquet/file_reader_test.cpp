@@ -1188,6 +1188,8 @@ TEST_F(FileReaderTest, TestGetNextPartition) {
     auto* ctx = _create_context_for_partition();
     Status status = file_reader->init(ctx);
     ASSERT_TRUE(status.ok());
+    // the rows are counted from the footer without reading any row group
+    ASSERT_TRUE(file_reader->group_readers().empty());
 
     // get next
     auto chunk = _create_chunk_for_partition();
@@ -1935,6 +1937,49 @@ TEST_F(FileReaderTest, TestTwoNestedLevelArray) {
     EXPECT_EQ(163840, total_row_nums);
 }
 
+TEST_F(FileReaderTest, TestTwoNestedLevelArrayLateMaterialization) {
+    // format:
+    // id: INT, b: ARRAY<ARRAY<INT>>
+    const std::string filepath = "./be/test/exec/test_data/parquet_data/two_level_nested_array.parquet";
+    auto file_reader = _create_file_reader(filepath);
+
+    // --------------init context---------------
+    TypeDescriptor type_array = TypeDescriptor::create_array_type(TYPE_INT_ARRAY_DESC);
+    Utils::SlotDesc slot_descs[] = {
+            {"id", TYPE_INT_DESC},
+            {"b", type_array},
+            {""},
+    };
+    auto ctx = _create_scan_context(slot_descs, filepath);
+    // b is lazy column, only the values of the selected rows are decoded
+    _create_int_conjunct_ctxs(TExprOpcode::EQ, 0, 4, &ctx->conjunct_ctxs_by_slot[0]);
+    // --------------finish init context---------------
+
+    ASSERT_OK(file_reader->init(ctx));
+    ASSERT_EQ(file_reader->row_group_size(), 1);
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ColumnHelper::create_column(TYPE_INT_DESC, true), chunk->num_columns());
+    chunk->append_column(ColumnHelper::create_column(type_array, true), chunk->num_columns());
+
+    Status status;
+    size_t total_row_nums = 0;
+    while (!status.is_end_of_file()) {
+        chunk->reset();
+        status = file_reader->get_next(&chunk);
+        ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status.message();
+        chunk->check_or_die();
+        if (total_row_nums == 0 && chunk->num_rows() > 0) {
+            EXPECT_EQ("[4, [[1,2,3,4],NULL,[1,2,3,4]]]", chunk->debug_row(0));
+        }
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            EXPECT_EQ(4, chunk->get_column_by_index(0)->get(i).get_int32());
+        }
+        total_row_nums += chunk->num_rows();
+    }
+    EXPECT_GT(total_row_nums, 0);
+}
+
 TEST_F(FileReaderTest, TestReadMapNull) {
     auto file_reader = _create_file_reader(_file_map_null_path);
 
@@ -3687,6 +3732,30 @@ TEST_F(FileReaderTest, update_rf_and_filter_row_group) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+TEST_F(FileReaderTest, update_rf_and_filter_all_unread_row_groups) {
+    SlotId slot_id = 0;
+
+    auto file_reader = _create_file_reader(_filter_row_group_path_3);
+    ASSIGN_OR_ASSERT_FAIL(auto* ctx, _create_context_for_filter_row_group_update_rf(slot_id));
+
+    ASSERT_OK(file_reader->init(ctx));
+    ASSERT_EQ(file_reader->row_group_size(), 3);
+
+    // the runtime filter arrives before the second row group is checked, and it prunes all the unread row groups
+    auto* rf = MinMaxRuntimeFilter<TYPE_INT>::create_with_range<false>(&_pool, 3, false);
+    ctx->runtime_filter_collector->descriptors().at(1)->set_runtime_filter(rf);
+
+    ChunkPtr chunk = _create_int_chunk();
+    ASSERT_OK(file_reader->get_next(&chunk));
+    ASSERT_EQ(chunk->num_rows(), 3);
+    ASSERT_EQ(chunk->debug_row(0), "[1, 11]");
+    ASSERT_EQ(chunk->debug_row(2), "[3, 33]");
+
+    chunk->reset();
+    auto st = file_reader->get_next(&chunk);
+    ASSERT_TRUE(st.is_end_of_file());
+}
+
 TEST_F(FileReaderTest, filter_page_index_with_rf_has_null) {
     SlotId slot_id = 1;
 
@@ -3700,6 +3769,40 @@ TEST_F(FileReaderTest, filter_page_index_with_rf_has_null) {
     ASSERT_EQ(group_readers[0]->get_range().to_string(), "([0,20000), [40000,40100))");
 }
 
+TEST_F(FileReaderTest, TestReadPageIndexCache) {
+    CacheOptions options = TestCacheUtils::create_simple_options(256 * KB, 100 * MB);
+    auto local_cache = std::make_shared<StarCacheEngine>();
+    ASSERT_OK(local_cache->init(options));
+    auto cache = std::make_shared<StoragePageCache>(local_cache.get());
+    SlotId slot_id = 1;
+
+    // first init, populate page index cache
+    auto file_reader = _create_file_reader(_filter_page_index_with_rf_has_null);
+    file_reader->_cache = cache.get();
+    auto ret = _create_context_for_filter_page_index(slot_id, 92880, 92990, true);
+    ASSERT_TRUE(ret.ok());
+    auto* ctx = ret.value();
+    ctx->stats->page_index_cache_read_count = 0;
+    ctx->stats->page_index_cache_write_count = 0;
+    ASSERT_OK(file_reader->init(ctx));
+    ASSERT_EQ(ctx->stats->page_index_cache_read_count, 0);
+    int64_t write_count = ctx->stats->page_index_cache_write_count;
+    ASSERT_GT(write_count, 0);
+
+    // second init, read page index cache and get the same ranges
+    auto file_reader2 = _create_file_reader(_filter_page_index_with_rf_has_null);
+    file_reader2->_cache = cache.get();
+    auto ret2 = _create_context_for_filter_page_index(slot_id, 92880, 92990, true);
+    ASSERT_TRUE(ret2.ok());
+    auto* ctx2 = ret2.value();
+    ctx2->stats->page_index_cache_read_count = 0;
+    ctx2->stats->page_index_cache_write_count = 0;
+    ASSERT_OK(file_reader2->init(ctx2));
+    ASSERT_EQ(ctx2->stats->page_index_cache_read_count, write_count);
+    ASSERT_EQ(ctx2->stats->page_index_cache_write_count, 0);
+    ASSERT_EQ(file_reader2->group_readers()[0]->get_range().to_string(), "([0,20000), [40000,40100))");
+}
+
 TEST_F(FileReaderTest, all_type_has_null_page_bool) {
     SlotId slot_id = 0;
 
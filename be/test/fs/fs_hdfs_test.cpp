@@ -18,7 +18,10 @@
 
 #include <filesystem>
 
+#include "common/config.h"
 #include "fs/fs_util.h"
+#include "fs/hdfs/hdfs_fs_cache.h"
+#include "testutil/assert.h"
 #include "testutil/sync_point.h"
 #include "util/defer_op.h"
 
@@ -126,4 +129,38 @@ TEST_F(HdfsFileSystemTest, create_file_with_open_truncate) {
     (*wfile_2).reset();
 }
 
+TEST_F(HdfsFileSystemTest, reuse_cached_file_handle) {
+    auto old_ttl = config::hdfs_client_file_handle_cache_ttl_sec;
+    config::hdfs_client_file_handle_cache_ttl_sec = 60;
+    DeferOp defer([&]() { config::hdfs_client_file_handle_cache_ttl_sec = old_ttl; });
+
+    auto fs = new_fs_hdfs(FSOptions());
+    const std::string filepath = "file://" + _root_path + "/reuse_cached_file_handle";
+    WritableFileOptions opts{.sync_on_close = false, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    auto write_file = [&](const std::string& content) {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(opts, filepath));
+        ASSERT_OK(wfile->append(Slice(content)));
+        ASSERT_OK(wfile->close());
+    };
+    auto read_file = [&]() {
+        ASSIGN_OR_ABORT(auto rfile, fs->new_random_access_file(filepath));
+        ASSIGN_OR_ABORT(auto content, rfile->read_all());
+        return content;
+    };
+
+    auto* cache = HdfsFileHandleCache::instance();
+    write_file("123");
+    size_t cached = cache->size();
+    ASSERT_EQ("123", read_file());
+    ASSERT_EQ(cached + 1, cache->size());
+    // the cached handle is taken and put back
+    ASSERT_EQ("123", read_file());
+    ASSERT_EQ(cached + 1, cache->size());
+
+    // rewriting the file drops the cached handle
+    write_file("456");
+    ASSERT_EQ(cached, cache->size());
+    ASSERT_EQ("456", read_file());
+}
+
 } // namespace starrocks
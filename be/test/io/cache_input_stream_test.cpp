@@ -22,6 +22,7 @@
 #include "fs/fs_util.h"
 #include "runtime/exec_env.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -188,6 +189,36 @@ TEST_F(CacheInputStreamTest, test_random_read) {
     ASSERT_EQ(stats.read_cache_count, 2);
 }
 
+TEST_F(CacheInputStreamTest, test_sequential_read_ahead) {
+    const int64_t block_count = 8;
+
+    int64_t data_size = block_size * block_count;
+    std::vector<char> data(data_size + 1);
+    gen_test_data(data.data(), data_size, block_size);
+
+    const std::string file_name = "test_file_read_ahead";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data.data(), data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_enable_populate_cache(true);
+    auto& stats = cache_stream.stats();
+
+    auto saved_read_ahead_max_blocks = config::datacache_read_ahead_max_blocks;
+    config::datacache_read_ahead_max_blocks = 4;
+    DeferOp defer([&]() { config::datacache_read_ahead_max_blocks = saved_read_ahead_max_blocks; });
+
+    // The first miss reads one block, then the sequential misses read ahead 1, 2 and 4 (capped by the file size)
+    // blocks, which are read from the cache afterwards.
+    for (int i = 0; i < block_count; ++i) {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    ASSERT_EQ(stats.write_cache_count, block_count);
+    ASSERT_EQ(stats.read_cache_count, 4);
+}
+
 TEST_F(CacheInputStreamTest, test_file_overwrite) {
     const int64_t block_count = 3;
 
@@ -0,0 +1,123 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_heatmap.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "io/io_profiler.h"
+
+namespace starrocks {
+
+class IOHeatmapTest : public testing::Test {
+public:
+    void SetUp() override {
+        _old_enable = config::enable_io_heatmap;
+        _old_sample_rate = config::io_heatmap_sample_rate;
+        _old_max_entries = config::io_heatmap_max_entries;
+        config::enable_io_heatmap = true;
+        IOHeatmap::instance()->clear();
+    }
+
+    void TearDown() override {
+        IOHeatmap::instance()->clear();
+        config::enable_io_heatmap = _old_enable;
+        config::io_heatmap_sample_rate = _old_sample_rate;
+        config::io_heatmap_max_entries = _old_max_entries;
+    }
+
+private:
+    bool _old_enable;
+    int32_t _old_sample_rate;
+    int64_t _old_max_entries;
+};
+
+TEST_F(IOHeatmapTest, test_should_sample) {
+    config::io_heatmap_sample_rate = 4;
+    int sampled = 0;
+    for (int i = 0; i < 100; i++) {
+        sampled += IOHeatmap::should_sample();
+    }
+    ASSERT_EQ(25, sampled);
+
+    config::enable_io_heatmap = false;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_FALSE(IOHeatmap::should_sample());
+    }
+}
+
+TEST_F(IOHeatmapTest, test_aggregate) {
+    config::io_heatmap_sample_rate = 2;
+    auto* heatmap = IOHeatmap::instance();
+    IOHeatmap::Key key1{1, 2, 10001, 0};
+    IOHeatmap::Key key2{1, 2, 10001, 1};
+    heatmap->record(key1, 100, 1000);
+    heatmap->record(key1, 200, 3000);
+    heatmap->record(key2, 4096, 50000);
+
+    auto entries = heatmap->entries();
+    ASSERT_EQ(2, entries.size());
+    for (const auto& entry : entries) {
+        // scaled up by the sample rate
+        if (entry.key == key1) {
+            ASSERT_EQ(4, entry.read_ops);
+            ASSERT_EQ(600, entry.read_bytes);
+            ASSERT_EQ(8000, entry.read_time_ns);
+        } else {
+            ASSERT_TRUE(entry.key == key2);
+            ASSERT_EQ(2, entry.read_ops);
+            ASSERT_EQ(8192, entry.read_bytes);
+            ASSERT_EQ(100000, entry.read_time_ns);
+        }
+        ASSERT_GT(entry.last_read_time, 0);
+    }
+
+    // the samples are accumulated across aggregations
+    heatmap->record(key2, 4096, 50000);
+    entries = heatmap->entries();
+    ASSERT_EQ(2, entries.size());
+    for (const auto& entry : entries) {
+        if (entry.key == key2) {
+            ASSERT_EQ(4, entry.read_ops);
+        }
+    }
+}
+
+TEST_F(IOHeatmapTest, test_max_entries) {
+    config::io_heatmap_max_entries = 2;
+    auto* heatmap = IOHeatmap::instance();
+    const int64_t old_dropped = heatmap->num_dropped_samples();
+    for (int i = 0; i < 5; i++) {
+        heatmap->record(IOHeatmap::Key{0, 0, i, 0}, 100, 1000);
+    }
+    ASSERT_EQ(2, heatmap->entries().size());
+    ASSERT_EQ(old_dropped + 3, heatmap->num_dropped_samples());
+}
+
+TEST_F(IOHeatmapTest, test_tablet_id_of_scope) {
+    ASSERT_EQ(0, IOProfiler::get_tablet_id());
+    {
+        auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, 10001);
+        ASSERT_EQ(10001, IOProfiler::get_tablet_id());
+        {
+            auto inner = IOProfiler::scope(IOProfiler::TAG_QUERY, 10002);
+            ASSERT_EQ(10002, IOProfiler::get_tablet_id());
+        }
+        ASSERT_EQ(10001, IOProfiler::get_tablet_id());
+    }
+    ASSERT_EQ(0, IOProfiler::get_tablet_id());
+}
+
+} // namespace starrocks
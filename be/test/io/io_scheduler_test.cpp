@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "io/io_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+
+namespace starrocks::io {
+
+TEST(IOSchedulerTest, test_disabled) {
+    auto old_max_concurrency = config::io_scheduler_max_concurrency;
+    config::io_scheduler_max_concurrency = 0;
+    IOScheduler scheduler;
+    ASSERT_FALSE(scheduler.acquire(IOScheduler::IO_CLASS_QUERY));
+    ASSERT_EQ(0, scheduler.num_running());
+    config::io_scheduler_max_concurrency = old_max_concurrency;
+}
+
+TEST(IOSchedulerTest, test_weighted_dispatch) {
+    auto old_max_concurrency = config::io_scheduler_max_concurrency;
+    auto old_max_wait_ms = config::io_scheduler_max_wait_ms;
+    config::io_scheduler_max_concurrency = 1;
+    config::io_scheduler_max_wait_ms = 1000000;
+    IOScheduler scheduler;
+
+    std::mutex mutex;
+    std::vector<IOScheduler::IOClass> dispatched;
+    std::vector<std::thread> threads;
+    {
+        IOScheduler::Permit permit(&scheduler, IOScheduler::IO_CLASS_QUERY);
+        ASSERT_EQ(1, scheduler.num_running());
+        auto start_waiter = [&](IOScheduler::IOClass io_class) {
+            auto num_waiting = scheduler.num_waiting(io_class);
+            threads.emplace_back([&, io_class]() {
+                IOScheduler::Permit p(&scheduler, io_class);
+                std::lock_guard l(mutex);
+                dispatched.push_back(io_class);
+            });
+            while (scheduler.num_waiting(io_class) == num_waiting) {
+                std::this_thread::yield();
+            }
+        };
+        start_waiter(IOScheduler::IO_CLASS_BACKGROUND);
+        start_waiter(IOScheduler::IO_CLASS_BACKGROUND);
+        start_waiter(IOScheduler::IO_CLASS_QUERY);
+        start_waiter(IOScheduler::IO_CLASS_QUERY);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(0, scheduler.num_running());
+    // The background class has dispatched nothing yet so it goes first, and then the query class takes the slots
+    // before the background class because of its larger weight.
+    std::vector<IOScheduler::IOClass> expected{IOScheduler::IO_CLASS_BACKGROUND, IOScheduler::IO_CLASS_QUERY,
+                                               IOScheduler::IO_CLASS_QUERY, IOScheduler::IO_CLASS_BACKGROUND};
+    ASSERT_EQ(expected, dispatched);
+
+    config::io_scheduler_max_concurrency = old_max_concurrency;
+    config::io_scheduler_max_wait_ms = old_max_wait_ms;
+}
+
+} // namespace starrocks::io
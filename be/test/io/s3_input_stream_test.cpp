@@ -28,6 +28,7 @@
 #include "common/logging.h"
 #include "fs/fs_s3.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -227,4 +228,59 @@ TEST_F(S3InputStreamTest, test_prefetch) {
     ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
     ASSERT_EQ("012345", std::string_view(buf, r));
 }
+
+TEST_F(S3InputStreamTest, test_parallel_read) {
+    auto old_part_size = config::object_storage_parallel_read_part_size;
+    config::object_storage_parallel_read_part_size = 3;
+    DeferOp defer([&]() { config::object_storage_parallel_read_part_size = old_part_size; });
+
+    auto f = new_random_access_file_prefetch(-1);
+    char buf[10];
+    // 3 parts: [1, 4), [4, 7), [7, 9)
+    ASSIGN_OR_ABORT(auto r, f->read_at(1, buf, 8));
+    ASSERT_EQ("12345678", std::string_view(buf, r));
+    ASSERT_EQ(9, *f->position());
+
+    f->set_size(10);
+    ASSIGN_OR_ABORT(auto s, f->read_all());
+    EXPECT_EQ(kObjectContent, s);
+}
+
+TEST_F(S3InputStreamTest, test_hedged_read) {
+    auto old_percentile = config::object_storage_hedged_read_percentile;
+    auto old_min_delay = config::object_storage_hedged_read_min_delay_ms;
+    config::object_storage_hedged_read_percentile = 1;
+    config::object_storage_hedged_read_min_delay_ms = 0;
+    DeferOp defer([&]() {
+        config::object_storage_hedged_read_percentile = old_percentile;
+        config::object_storage_hedged_read_min_delay_ms = old_min_delay;
+    });
+
+    auto f = new_random_access_file_prefetch(-1);
+    char buf[6];
+    for (int i = 0; i < 10; i++) {
+        ASSIGN_OR_ABORT(auto r, f->read_at(2, buf, sizeof(buf)));
+        ASSERT_EQ("234567", std::string_view(buf, r));
+    }
+}
+
+TEST_F(S3InputStreamTest, test_prefetch) {
+    auto f = new_random_access_file_prefetch(-1);
+    f->set_size(10);
+    f->prefetch(2, 5);
+    // overlapping with a prefetched range, ignored
+    f->prefetch(4, 5);
+    char buf[10];
+    // inside the prefetched range
+    ASSIGN_OR_ABORT(auto r, f->read_at(2, buf, 3));
+    ASSERT_EQ("234", std::string_view(buf, r));
+    // crossing the end of the prefetched range, read directly
+    ASSIGN_OR_ABORT(r, f->read_at(5, buf, 4));
+    ASSERT_EQ("5678", std::string_view(buf, r));
+    // reaching the end of the prefetched range
+    ASSIGN_OR_ABORT(r, f->read_at(5, buf, 2));
+    ASSERT_EQ("56", std::string_view(buf, r));
+    ASSIGN_OR_ABORT(r, f->read_at(0, buf, 10));
+    ASSERT_EQ(kObjectContent, std::string_view(buf, r));
+}
 } // namespace starrocks::io
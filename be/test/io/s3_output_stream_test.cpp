@@ -155,6 +155,31 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_concurrent_multipart_upload) {
+    const char* kObjectName = "test_concurrent_multipart_upload";
+    delete_object(kObjectName);
+    auto old_max_inflight_parts = config::experimental_s3_max_inflight_upload_parts;
+    config::experimental_s3_max_inflight_upload_parts = 2;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, 12, /*5MB=*/5 * 1024 * 1024);
+    S3InputStream is(g_s3client, kBucketName, kObjectName, /*5MB=*/5 * 1024 * 1024);
+
+    // 4 full parts and a tail part, more than the inflight limit.
+    std::string data;
+    for (int i = 0; data.size() < 4 * 5 * 1024 * 1024 + 100; i++) {
+        data.append(std::to_string(i)).append(",");
+    }
+    for (size_t off = 0; off < data.size(); off += 1024 * 1024) {
+        ASSERT_OK(os.write(data.data() + off, std::min<size_t>(1024 * 1024, data.size() - off)));
+    }
+    ASSERT_OK(os.close());
+    config::experimental_s3_max_inflight_upload_parts = old_max_inflight_parts;
+
+    ASSIGN_OR_ABORT(auto content, is.read_all());
+    ASSERT_EQ(data, content);
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
@@ -179,4 +179,19 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
+TEST_F(SharedBufferedInputStreamTest, test_coalesce_model) {
+    SharedBufferedInputStream::CoalesceModel model;
+    ASSERT_EQ(1024 * 1024, model.max_dist_size(1024 * 1024, 8 * 1024 * 1024));
+
+    // 1ms per request and 10ns per byte, a gap of 100KB costs the same as a request.
+    for (int i = 0; i < 1000; i++) {
+        int64_t bytes = (i % 10 + 1) * 64 * 1024;
+        model.update(bytes, 1000000 + bytes * 10);
+    }
+    int64_t dist = model.max_dist_size(1024 * 1024, 8 * 1024 * 1024);
+    ASSERT_NEAR(100000, dist, 1000);
+    // capped by the max buffer size
+    ASSERT_EQ(64 * 1024, model.max_dist_size(1024 * 1024, 64 * 1024));
+}
+
 } // namespace starrocks::io
\ No newline at end of file
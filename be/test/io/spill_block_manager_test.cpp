@@ -44,6 +44,7 @@
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
 #include "exec/spill/mem_table.h"
+#include "exec/spill/memory_block_manager.h"
 #include "exec/spill/spill_components.h"
 #include "exec/spill/spiller.h"
 #include "exec/spill/spiller.hpp"
@@ -380,4 +381,42 @@ TEST_F(SpillBlockManagerTest, block_capacity_test) {
     ASSERT_EQ(local_dir->get_current_size(), 0);
 }
 
+TEST_F(SpillBlockManagerTest, memory_block_allocation_test) {
+    auto log_block_mgr = std::make_unique<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
+    auto memory_block_mgr = std::make_shared<spill::MemoryBlockManager>(dummy_query_id, 20, std::move(log_block_mgr));
+    ASSERT_OK(memory_block_mgr->open());
+    spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                    .fragment_instance_id = dummy_query_id,
+                                    .plan_node_id = 1,
+                                    .name = "node1",
+                                    .block_size = 10};
+    {
+        // 1. the first block can be kept in memory
+        ASSIGN_OR_ABORT(auto block, memory_block_mgr->acquire_block(opts));
+        ASSERT_TRUE(block->debug_string().find("MemoryBlock") != std::string::npos);
+        ASSERT_FALSE(block->is_remote());
+        std::string data = "0123456789abcdef";
+        ASSERT_OK(block->append(std::vector<Slice>{Slice(data.data(), 10), Slice(data.data() + 10, 6)}));
+        ASSERT_OK(block->flush());
+        ASSERT_EQ(block->size(), 16);
+        ASSERT_EQ(memory_block_mgr->memory_usage(), 16);
+        ASSERT_OK(memory_block_mgr->release_block(block));
+
+        auto reader = block->get_reader(spill::BlockReaderOptions{});
+        char buffer[16];
+        ASSERT_OK(reader->read_fully(buffer, 16));
+        ASSERT_EQ(std::string(buffer, 16), data);
+        ASSERT_TRUE(reader->read_fully(buffer, 1).is_end_of_file());
+
+        // 2. the quota is used up, the second block will be written to disk
+        ASSIGN_OR_ABORT(auto disk_block, memory_block_mgr->acquire_block(opts));
+        ASSERT_TRUE(disk_block->debug_string().find("LogBlock") != std::string::npos);
+        ASSERT_OK(memory_block_mgr->release_block(disk_block));
+    }
+    // 3. the quota is released with the blocks
+    ASSERT_EQ(memory_block_mgr->memory_usage(), 0);
+    ASSIGN_OR_ABORT(auto block, memory_block_mgr->acquire_block(opts));
+    ASSERT_TRUE(block->debug_string().find("MemoryBlock") != std::string::npos);
+}
+
 } // namespace starrocks::vectorized
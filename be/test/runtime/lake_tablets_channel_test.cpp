@@ -17,6 +17,8 @@
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "column/chunk.h"
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
@@ -506,6 +508,77 @@ TEST_F(LakeTabletsChannelTest, test_write_bundling_file) {
     }
 }
 
+TEST_F(LakeTabletsChannelTest, test_write_bundling_small_flushes) {
+    auto open_request = _open_request;
+    open_request.set_num_senders(1);
+    open_request.mutable_lake_tablet_params()->set_enable_data_file_bundling(true);
+    // Every chunk fills the memtable, so each tablet flushes one segment per chunk before the end of the load.
+    auto old_write_buffer_size = config::write_buffer_size;
+    config::write_buffer_size = 1;
+    DeferOp defer([&]() {
+        open_request.mutable_lake_tablet_params()->set_enable_data_file_bundling(false);
+        config::write_buffer_size = old_write_buffer_size;
+    });
+
+    ASSERT_OK(_tablets_channel->open(open_request, &_open_response, _schema_param, false));
+
+    constexpr int kChunkSize = 128;
+    constexpr int kChunkSizePerTablet = kChunkSize / 4;
+    constexpr int kNumChunks = 2;
+    bool close_channel;
+    for (int seq = 0; seq < kNumChunks; seq++) {
+        auto chunk = generate_data(kChunkSize);
+        PTabletWriterAddChunkRequest add_chunk_request;
+        PTabletWriterAddBatchResult add_chunk_response;
+        add_chunk_request.set_index_id(kIndexId);
+        add_chunk_request.set_sender_id(0);
+        add_chunk_request.set_eos(false);
+        add_chunk_request.set_packet_seq(seq);
+        for (int i = 0; i < kChunkSize; i++) {
+            int64_t tablet_id = 10086 + (i / kChunkSizePerTablet);
+            add_chunk_request.add_tablet_ids(tablet_id);
+            add_chunk_request.add_partition_ids(tablet_id < 10088 ? 10 : 11);
+        }
+        ASSIGN_OR_ABORT(auto chunk_pb, serde::ProtobufChunkSerde::serialize(chunk));
+        add_chunk_request.mutable_chunk()->Swap(&chunk_pb);
+
+        _tablets_channel->add_chunk(&chunk, add_chunk_request, &add_chunk_response, &close_channel);
+        ASSERT_TRUE(add_chunk_response.status().status_code() == TStatusCode::OK);
+        ASSERT_FALSE(close_channel);
+    }
+
+    PTabletWriterAddChunkRequest finish_request;
+    PTabletWriterAddBatchResult finish_response;
+    finish_request.set_index_id(kIndexId);
+    finish_request.set_sender_id(0);
+    finish_request.set_eos(true);
+    finish_request.set_packet_seq(kNumChunks);
+    finish_request.add_partition_ids(10);
+    finish_request.add_partition_ids(11);
+
+    _tablets_channel->add_chunk(nullptr, finish_request, &finish_response, &close_channel);
+    ASSERT_TRUE(finish_response.status().status_code() == TStatusCode::OK);
+    ASSERT_EQ(4, finish_response.tablet_vec_size());
+    ASSERT_TRUE(close_channel);
+
+    // All the small segments of the tablets of one partition are in the same bundle file.
+    for (auto tablet_ids : {std::vector<int64_t>{10086, 10087}, std::vector<int64_t>{10088, 10089}}) {
+        std::set<std::string> bundle_files;
+        for (auto tablet_id : tablet_ids) {
+            ASSIGN_OR_ABORT(auto tablet, _tablet_manager->get_tablet(tablet_id));
+            ASSIGN_OR_ABORT(auto txnlog, tablet.get_txn_log(kTxnId));
+            const auto& rowset = txnlog->op_write().rowset();
+            ASSERT_EQ(kNumChunks, rowset.segments_size());
+            ASSERT_EQ(kNumChunks, rowset.bundle_file_offsets_size());
+            for (int i = 0; i < rowset.segments_size(); i++) {
+                ASSERT_GE(rowset.bundle_file_offsets(i), 0);
+                bundle_files.insert(rowset.segments(i));
+            }
+        }
+        ASSERT_EQ(1, bundle_files.size());
+    }
+}
+
 TEST_F(LakeTabletsChannelTest, test_write_concurrently) {
     ASSERT_OK(_tablets_channel->open(_open_request, &_open_response, _schema_param, false));
 
@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_pool_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "runtime/memory/column_allocator.h"
+
+namespace starrocks {
+
+TEST(ColumnPoolAllocatorTest, reuse) {
+    ColumnPoolAllocator allocator(1024 * 1024);
+    // small buffers are not pooled
+    void* ptr = allocator.alloc(16);
+    ASSERT_NE(ptr, nullptr);
+    allocator.free(ptr);
+    ASSERT_EQ(allocator.pooled_bytes(), 0);
+
+    ptr = allocator.alloc(32 * 1024);
+    ASSERT_NE(ptr, nullptr);
+    allocator.free(ptr);
+    ASSERT_GE(allocator.pooled_bytes(), 32 * 1024);
+    // a buffer of the same size class is reused
+    void* reused = allocator.alloc(20 * 1024);
+    ASSERT_EQ(reused, ptr);
+    ASSERT_EQ(allocator.pooled_bytes(), 0);
+    allocator.free(reused);
+
+    // a larger size class can't reuse it
+    void* larger = allocator.alloc(64 * 1024);
+    ASSERT_NE(larger, ptr);
+    allocator.free(larger);
+
+    // the pooled bytes are limited
+    void* huge = allocator.alloc(2 * 1024 * 1024);
+    allocator.free(huge);
+    ASSERT_LE(allocator.pooled_bytes(), 1024 * 1024);
+
+    allocator.release();
+    ASSERT_EQ(allocator.pooled_bytes(), 0);
+}
+
+TEST(ColumnPoolAllocatorTest, column) {
+    ColumnPoolAllocator allocator(1024 * 1024);
+    ThreadLocalColumnAllocatorSetter setter(&allocator);
+    const void* data = nullptr;
+    {
+        auto column = Int64Column::create();
+        column->resize(4096);
+        data = column->raw_data();
+    }
+    ASSERT_GT(allocator.pooled_bytes(), 0);
+    auto column = Int64Column::create();
+    column->resize(4096);
+    ASSERT_EQ(column->raw_data(), data);
+}
+
+} // namespace starrocks
@@ -319,4 +319,45 @@ TEST_F(SortedChunksMergerTest, three_suppliers) {
     }
 }
 
+TEST_F(SortedChunksMergerTest, suppliers_with_empty_one) {
+    ChunkSuppliers suppliers;
+    ChunkProbeSuppliers probe_suppliers;
+    ChunkHasSuppliers has_suppliers;
+    std::vector<ChunkPtr> chunks = {_chunk_1, nullptr, _chunk_2, _chunk_3};
+    for (auto& chunk : chunks) {
+        auto supplier = [&chunk](Chunk** cnk) -> Status {
+            if (chunk != nullptr) {
+                *cnk = chunk->clone_unique().release();
+                chunk = nullptr;
+            } else {
+                *cnk = nullptr;
+            }
+            return Status::OK();
+        };
+        auto probe_supplier = [](Chunk** cnk) -> bool { return false; };
+        auto has_supplier = []() -> bool { return false; };
+        suppliers.push_back(supplier);
+        probe_suppliers.push_back(probe_supplier);
+        has_suppliers.push_back(has_supplier);
+    }
+
+    SortedChunksMerger merger(_runtime_state.get(), false);
+    ASSERT_OK(merger.init(suppliers, probe_suppliers, has_suppliers, &_sort_exprs, &_is_asc, &_is_null_first));
+
+    bool eos = false;
+    ChunkPtr page_1, page_2;
+    ASSERT_OK(merger.get_next(&page_1, &eos));
+    ASSERT_FALSE(eos);
+    ASSERT_TRUE(page_1 != nullptr);
+    ASSERT_OK(merger.get_next(&page_2, &eos));
+    ASSERT_TRUE(eos);
+
+    const size_t Size = 16;
+    ASSERT_EQ(Size, page_1->num_rows());
+    int32_t permutation[Size] = {71, 70, 69, 54, 4, 56, 55, 49, 41, 16, 52, 58, 24, 12, 2, 6};
+    for (size_t i = 0; i < Size; ++i) {
+        ASSERT_EQ(permutation[i], page_1->get(i).get(0).get_int32());
+    }
+}
+
 } // namespace starrocks
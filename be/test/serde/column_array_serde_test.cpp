@@ -25,6 +25,7 @@
 #include "column/json_column.h"
 #include "column/nullable_column.h"
 #include "gutil/strings/substitute.h"
+#include "serde/encode_context.h"
 #include "testutil/parallel_test.h"
 #include "util/json.h"
 
@@ -349,4 +350,32 @@ PARALLEL_TEST(ColumnArraySerdeTest, array_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, encode_context_adjust) {
+    // adjust, and encode integers and strings
+    EncodeContext context(2, 7);
+    auto encode_chunk = [&]() {
+        context.update(0, 100, 50);
+        context.update(1, 100, 100);
+        context.adjust_encode_levels();
+    };
+
+    for (int i = 0; i < EncodeSamplingNum; i++) {
+        encode_chunk();
+    }
+    ASSERT_EQ(7, context.get_encode_level(0));
+    // column 1 doesn't benefit from encoding, drop the string encoding first
+    ASSERT_EQ(3, context.get_encode_level(1));
+
+    std::vector<int> levels{3};
+    for (int i = 0; i < 1000; i++) {
+        encode_chunk();
+        if (levels.back() != context.get_encode_level(1)) {
+            levels.emplace_back(context.get_encode_level(1));
+        }
+    }
+    ASSERT_EQ(7, context.get_encode_level(0));
+    ASSERT_EQ((std::vector<int>{3, 5, 0}), levels);
+}
+
 } // namespace starrocks::serde
@@ -54,4 +54,33 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testRunOptimize) {
+    DelVector dv;
+    dv.set_empty();
+    std::vector<uint32_t> dels;
+    for (uint32_t i = 0; i < 100000; i++) {
+        dels.push_back(i + 1000);
+    }
+    std::shared_ptr<DelVector> ndv;
+    dv.add_dels_as_new_version(dels, 2, &ndv);
+    ASSERT_EQ(dels.size(), ndv->cardinality());
+    // a run of 100000 ids takes a few run containers instead of two bitsets of 8KB
+    ASSERT_LT(ndv->memory_usage(), 1024);
+    std::string raw = ndv->save();
+    ASSERT_LT(raw.size(), 1024);
+
+    std::shared_ptr<DelVector> ndv2;
+    ndv->add_dels_as_new_version({5, 7, 200000}, 3, &ndv2);
+    ASSERT_EQ(dels.size() + 3, ndv2->cardinality());
+    raw = ndv2->save();
+    DelVector dv2;
+    ASSERT_TRUE(dv2.load(3, raw.data(), raw.size()).ok());
+    ASSERT_EQ(dels.size() + 3, dv2.cardinality());
+    ASSERT_TRUE(dv2.roaring()->contains(5));
+    ASSERT_TRUE(dv2.roaring()->contains(1000));
+    ASSERT_TRUE(dv2.roaring()->contains(100999));
+    ASSERT_FALSE(dv2.roaring()->contains(101000));
+}
+
 } // namespace starrocks
@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/flat_json_access_stats.h"
+
+#include <gtest/gtest.h>
+
+#include "column/column_access_path.h"
+#include "common/config.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class FlatJsonAccessStatsTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _min_access = config::json_flat_hot_path_min_access;
+        config::json_flat_hot_path_min_access = 2;
+        FlatJsonAccessStats::instance()->clear();
+    }
+
+    void TearDown() override {
+        config::json_flat_hot_path_min_access = _min_access;
+        FlatJsonAccessStats::instance()->clear();
+    }
+
+    ColumnAccessPathPtr create_path(const std::string& column,
+                                    const std::vector<std::pair<std::string, LogicalType>>& leafs) {
+        ASSIGN_OR_ABORT(auto root, ColumnAccessPath::create(TAccessPathType::ROOT, column, 0));
+        for (const auto& [path, type] : leafs) {
+            ColumnAccessPath::insert_json_path(root.get(), type, path);
+        }
+        return root;
+    }
+
+private:
+    int32_t _min_access = 0;
+};
+
+TEST_F(FlatJsonAccessStatsTest, test_hot_paths) {
+    auto* stats = FlatJsonAccessStats::instance();
+    auto p1 = create_path("c1", {{"a.b", TYPE_BIGINT}, {"c", TYPE_VARCHAR}});
+    auto p2 = create_path("c1", {{"a.b", TYPE_BIGINT}, {"d", TYPE_DOUBLE}});
+    auto p3 = create_path("c1", {{"c", TYPE_VARCHAR}, {"a.b", TYPE_BIGINT}});
+    auto p4 = create_path("c2", {{"x", TYPE_INT}});
+    auto whole = create_path("c2", {});
+    stats->record(10, p1.get());
+    stats->record(10, p2.get());
+    stats->record(10, p3.get());
+    stats->record(10, p4.get());
+    stats->record(10, whole.get());
+    stats->record(11, p4.get());
+    stats->record(11, p4.get());
+
+    auto hot = stats->hot_paths(10, "c1");
+    ASSERT_EQ(2, hot.size());
+    EXPECT_EQ("a.b", hot[0].first);
+    EXPECT_EQ(TYPE_BIGINT, hot[0].second);
+    EXPECT_EQ("c", hot[1].first);
+    EXPECT_EQ(TYPE_VARCHAR, hot[1].second);
+
+    EXPECT_TRUE(stats->hot_paths(10, "c2").empty());
+    EXPECT_TRUE(stats->hot_paths(12, "c1").empty());
+
+    hot = stats->hot_paths(11, "c2");
+    ASSERT_EQ(1, hot.size());
+    EXPECT_EQ("x", hot[0].first);
+
+    stats->erase(11);
+    EXPECT_TRUE(stats->hot_paths(11, "c2").empty());
+}
+
+} // namespace starrocks
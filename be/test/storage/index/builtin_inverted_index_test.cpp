@@ -0,0 +1,155 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "fs/fs_util.h"
+#include "storage/index/inverted/builtin/builtin_plugin.h"
+#include "storage/index/inverted/inverted_index_iterator.h"
+#include "storage/index/inverted/inverted_plugin_factory.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class BuiltinInvertedIndexTest : public testing::Test {
+protected:
+    void SetUp() override {
+        CHECK_OK(fs::remove_all(_test_dir));
+        CHECK_OK(fs::create_directories(_test_dir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(_test_dir); }
+
+    std::shared_ptr<TabletIndex> prepare_tablet_index(const std::string& parser) {
+        auto tablet_index = std::make_shared<TabletIndex>();
+        TabletIndexPB index_pb;
+        index_pb.set_index_id(0);
+        index_pb.set_index_name("test_index");
+        index_pb.set_index_type(IndexType::GIN);
+        index_pb.add_col_unique_id(1);
+        CHECK_OK(tablet_index->init_from_pb(index_pb));
+        tablet_index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+        tablet_index->add_index_properties(INVERTED_INDEX_PARSER_KEY, parser);
+        return tablet_index;
+    }
+
+    // Every value takes a row, nullopt stands for a null row.
+    void write_index(const std::shared_ptr<TabletIndex>& tablet_index,
+                     const std::vector<std::optional<std::string>>& values) {
+        ASSIGN_OR_ABORT(auto imp_type, get_inverted_imp_type(*tablet_index));
+        ASSERT_EQ(InvertedImplementType::BUILTIN, imp_type);
+        ASSIGN_OR_ABORT(auto plugin, InvertedPluginFactory::get_plugin(imp_type));
+        std::unique_ptr<InvertedWriter> writer;
+        ASSERT_OK(plugin->create_inverted_index_writer(get_type_info(TYPE_VARCHAR), "c1", _index_path,
+                                                       tablet_index.get(), &writer));
+        ASSERT_OK(writer->init());
+        for (const auto& value : values) {
+            if (value.has_value()) {
+                Slice slice(*value);
+                writer->add_values(&slice, 1);
+            } else {
+                writer->add_nulls(1);
+            }
+        }
+        ASSERT_EQ(values.size(), writer->size());
+        ASSERT_OK(writer->finish());
+    }
+
+    std::vector<uint32_t> query(InvertedReader* reader, const std::string& value, InvertedIndexQueryType type) {
+        Slice slice(value);
+        roaring::Roaring result;
+        CHECK_OK(reader->query(nullptr, "c1", &slice, type, &result));
+        std::vector<uint32_t> rows(result.cardinality());
+        result.toUint32Array(rows.data());
+        return rows;
+    }
+
+    const std::string _test_dir = "builtin_inverted_index_test";
+    const std::string _index_path = _test_dir + "/0_0_0.ivt";
+};
+
+TEST_F(BuiltinInvertedIndexTest, test_untokenized) {
+    auto tablet_index = prepare_tablet_index(INVERTED_INDEX_PARSER_NONE);
+    // enough distinct values to take several term blocks
+    std::vector<std::optional<std::string>> values;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 10 == 9) {
+            values.emplace_back(std::nullopt);
+        } else {
+            values.emplace_back(fmt::format("key_{:04d}", i % 300));
+        }
+    }
+    write_index(tablet_index, values);
+    ASSERT_TRUE(fs::path_exist(_index_path + "/" + BUILTIN_INVERTED_INDEX_FILE_NAME));
+
+    std::unique_ptr<InvertedReader> reader;
+    ASSERT_OK(BuiltinInvertedPlugin::get_instance().create_inverted_index_reader(_index_path, tablet_index,
+                                                                                TYPE_VARCHAR, &reader));
+    ASSERT_EQ((std::vector<uint32_t>{0, 300, 600, 900}),
+              query(reader.get(), "key_0000", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{}), query(reader.get(), "key_0009", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{}), query(reader.get(), "key_1", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{298, 598, 898}),
+              query(reader.get(), "key_0298", InvertedIndexQueryType::EQUAL_QUERY));
+
+    ASSERT_EQ(8, query(reader.get(), "key_0002", InvertedIndexQueryType::LESS_THAN_QUERY).size());
+    ASSERT_EQ(12, query(reader.get(), "key_0002", InvertedIndexQueryType::LESS_EQUAL_QUERY).size());
+    ASSERT_EQ(3, query(reader.get(), "key_0297", InvertedIndexQueryType::GREATER_THAN_QUERY).size());
+    ASSERT_EQ(6, query(reader.get(), "key_0297", InvertedIndexQueryType::GREATER_EQUAL_QUERY).size());
+
+    ASSERT_EQ(900, query(reader.get(), "key%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY).size());
+    ASSERT_EQ(36, query(reader.get(), "key_001_", InvertedIndexQueryType::MATCH_WILDCARD_QUERY).size());
+    ASSERT_EQ((std::vector<uint32_t>{298, 598, 898}),
+              query(reader.get(), "%298", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+
+    roaring::Roaring nulls;
+    ASSERT_OK(reader->query_null(nullptr, "c1", &nulls));
+    ASSERT_EQ(100, nulls.cardinality());
+    ASSERT_TRUE(nulls.contains(9));
+    ASSERT_FALSE(nulls.contains(10));
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_tokenized) {
+    auto tablet_index = prepare_tablet_index(INVERTED_INDEX_PARSER_ENGLISH);
+    write_index(tablet_index, {"Hello World", "hello, starrocks!", std::nullopt, "world-wide web", ""});
+
+    std::unique_ptr<InvertedReader> reader;
+    ASSERT_OK(BuiltinInvertedPlugin::get_instance().create_inverted_index_reader(_index_path, tablet_index,
+                                                                                TYPE_VARCHAR, &reader));
+    ASSERT_EQ((std::vector<uint32_t>{0, 1}), query(reader.get(), "hello", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{0, 3}), query(reader.get(), "world", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{1}), query(reader.get(), "star*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{3}), query(reader.get(), "w?d%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ((std::vector<uint32_t>{}), query(reader.get(), "Hello", InvertedIndexQueryType::EQUAL_QUERY));
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_wildcard_match) {
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("abc", "abc"));
+    ASSERT_FALSE(BuiltinInvertedReader::wildcard_match("abc", "abcd"));
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("a%c", "abbbc"));
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("a*c%", "ac"));
+    ASSERT_FALSE(BuiltinInvertedReader::wildcard_match("a%c", "abcd"));
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("a_c", "a中c"));
+    ASSERT_FALSE(BuiltinInvertedReader::wildcard_match("a__c", "a中c"));
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("%_c", "中c"));
+    ASSERT_TRUE(BuiltinInvertedReader::wildcard_match("a\\%", "a%"));
+    ASSERT_FALSE(BuiltinInvertedReader::wildcard_match("a\\%", "ab"));
+}
+
+} // namespace starrocks
@@ -181,4 +181,24 @@ TEST_F(VectorIndexSearchTest, test_select_empty_mark) {
 #endif
 }
 
+TEST_F(VectorIndexSearchTest, test_del_id_filter) {
+#ifdef WITH_TENANN
+    SparseRange<> scan_range;
+    scan_range.add(Range<>(2, 5));
+    scan_range.add(Range<>(63, 130));
+    DelIdFilter del_id_filter(scan_range);
+    ASSERT_FALSE(del_id_filter.IsMember(-1));
+    ASSERT_FALSE(del_id_filter.IsMember(1));
+    ASSERT_TRUE(del_id_filter.IsMember(2));
+    ASSERT_TRUE(del_id_filter.IsMember(4));
+    ASSERT_FALSE(del_id_filter.IsMember(5));
+    ASSERT_FALSE(del_id_filter.IsMember(62));
+    ASSERT_TRUE(del_id_filter.IsMember(63));
+    ASSERT_TRUE(del_id_filter.IsMember(64));
+    ASSERT_TRUE(del_id_filter.IsMember(129));
+    ASSERT_FALSE(del_id_filter.IsMember(130));
+    ASSERT_FALSE(del_id_filter.IsMember(100000));
+#endif
+}
+
 } // namespace starrocks
\ No newline at end of file
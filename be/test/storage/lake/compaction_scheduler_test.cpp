@@ -298,4 +298,27 @@ TEST_F(LakeCompactionSchedulerTest, test_abort_with_not_write_txnlog) {
     SyncPoint::GetInstance()->DisableProcessing();
 }
 
+TEST_F(LakeCompactionSchedulerTest, test_bundle_file_context) {
+    CompactRequest request;
+    CompactResponse response;
+    request.add_tablet_ids(101);
+
+    // a single tablet has nothing to share the data file with
+    {
+        auto cb = std::make_shared<CompactionTaskCallback>(nullptr, &request, &response, nullptr);
+        EXPECT_EQ(nullptr, cb->bundle_file_context("s3://bucket/db1/table1/partition1"));
+    }
+
+    request.add_tablet_ids(102);
+    {
+        auto cb = std::make_shared<CompactionTaskCallback>(nullptr, &request, &response, nullptr);
+        auto* ctx1 = cb->bundle_file_context("s3://bucket/db1/table1/partition1");
+        ASSERT_NE(nullptr, ctx1);
+        EXPECT_EQ(ctx1, cb->bundle_file_context("s3://bucket/db1/table1/partition1"));
+        auto* ctx2 = cb->bundle_file_context("s3://bucket/db1/table1/partition2");
+        ASSERT_NE(nullptr, ctx2);
+        EXPECT_NE(ctx1, ctx2);
+    }
+}
+
 } // namespace starrocks::lake
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "fs/fs_util.h"
 #include "fs/key_cache.h"
 #include "storage/rowset/segment_writer.h"
@@ -110,4 +111,25 @@ TEST_F(SegmentMetaCollecterTest, test_open_and_collect) {
     EXPECT_EQ(0, col->get(0).get_int64());
 }
 
+TEST_F(SegmentMetaCollecterTest, test_collect_ndv) {
+    SegmentMetaCollecter collecter(_segment);
+
+    SegmentMetaCollecterParams params;
+    params.fields.emplace_back("ndv");
+    params.field_type.emplace_back(LogicalType::TYPE_INT);
+    params.cids.emplace_back(0);
+    params.read_page.emplace_back(false);
+    params.tablet_schema = _tablet_schema;
+    EXPECT_OK(collecter.init(&params));
+    EXPECT_OK(collecter.open());
+
+    auto col = NullableColumn::create(Int64Column::create(), NullColumn::create());
+    std::vector<Column*> columns{col.get()};
+    EXPECT_OK(collecter.collect(&columns));
+    EXPECT_EQ(1, col->size());
+    // the segment is empty, so its zone map has no non-null value
+    EXPECT_FALSE(col->is_null(0));
+    EXPECT_EQ(0, col->get(0).get_int64());
+}
+
 } // namespace starrocks
@@ -35,6 +35,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <random>
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
@@ -62,6 +63,7 @@
 #include "storage/types.h"
 #include "testutil/assert.h"
 #include "types/date_value.h"
+#include "util/defer_op.h"
 
 using std::string;
 
@@ -715,6 +717,140 @@ TEST_F(ColumnReaderWriterTest, test_scalar_column_total_mem_footprint) {
     }
 }
 
+TEST_F(ColumnReaderWriterTest, test_speculate_for_encoding) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_speculate_for_encoding.data", TEST_DIR);
+    const int64_t num_rows = 20000;
+    bool old_config = config::enable_for_encoding_speculation;
+    config::enable_for_encoding_speculation = true;
+    DeferOp defer([&]() { config::enable_for_encoding_speculation = old_config; });
+
+    // An ascending column uses FOR_ENCODING, and a shuffled one keeps BIT_SHUFFLE
+    for (bool ascending : {true, false}) {
+        auto col = ChunkHelper::column_from_field_type(TYPE_BIGINT, false);
+        for (int64_t i = 0; i < num_rows; i++) {
+            int64_t value = ascending ? 1000000 + i * 7 : (i * 7919) % num_rows;
+            (void)col->append_numbers(&value, sizeof(int64_t));
+        }
+
+        fs->delete_file(fname);
+        ColumnMetaPB meta;
+        {
+            ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+            ColumnWriterOptions writer_opts;
+            writer_opts.page_format = 2;
+            writer_opts.meta = &meta;
+            writer_opts.meta->set_column_id(0);
+            writer_opts.meta->set_unique_id(0);
+            writer_opts.meta->set_type(TYPE_BIGINT);
+            writer_opts.meta->set_length(0);
+            writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+            writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+            writer_opts.meta->set_is_nullable(false);
+            writer_opts.need_zone_map = true;
+
+            TabletColumn column(STORAGE_AGGREGATE_NONE, TYPE_BIGINT);
+            ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+            ASSERT_OK(writer->init());
+            ASSERT_OK(writer->append(*col));
+            ASSERT_OK(writer->finish());
+            ASSERT_OK(writer->write_data());
+            ASSERT_OK(writer->write_ordinal_index());
+            ASSERT_OK(writer->write_zone_map());
+            ASSERT_OK(wfile->close());
+        }
+        ASSERT_EQ(ascending ? FOR_ENCODING : BIT_SHUFFLE, meta.encoding());
+
+        auto segment = create_dummy_segment(fs, fname);
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator());
+        ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+        ASSERT_OK(iter->seek_to_first());
+        auto dst = ChunkHelper::column_from_field_type(TYPE_BIGINT, false);
+        size_t rows_read = num_rows;
+        ASSERT_OK(iter->next_batch(&rows_read, dst.get()));
+        ASSERT_EQ(num_rows, dst->size());
+        for (int64_t i = 0; i < num_rows; i++) {
+            ASSERT_EQ(col->get(i).get_int64(), dst->get(i).get_int64());
+        }
+    }
+}
+
+TEST_F(ColumnReaderWriterTest, test_tune_compression) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_tune_compression.data", TEST_DIR);
+    const int64_t num_rows = 20000;
+
+    // Random values are stored uncompressed, and the repeated ones compressed. PLAIN_ENCODING, as BIT_SHUFFLE
+    // compresses the page itself.
+    for (bool random : {true, false}) {
+        std::mt19937_64 rng(0);
+        auto col = ChunkHelper::column_from_field_type(TYPE_BIGINT, false);
+        for (int64_t i = 0; i < num_rows; i++) {
+            int64_t value = random ? static_cast<int64_t>(rng()) : i % 16;
+            (void)col->append_numbers(&value, sizeof(int64_t));
+        }
+
+        fs->delete_file(fname);
+        ColumnMetaPB meta;
+        {
+            ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+            ColumnWriterOptions writer_opts;
+            writer_opts.page_format = 2;
+            writer_opts.meta = &meta;
+            writer_opts.meta->set_column_id(0);
+            writer_opts.meta->set_unique_id(0);
+            writer_opts.meta->set_type(TYPE_BIGINT);
+            writer_opts.meta->set_length(0);
+            writer_opts.meta->set_encoding(PLAIN_ENCODING);
+            writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+            writer_opts.meta->set_is_nullable(false);
+            writer_opts.need_zone_map = true;
+            writer_opts.need_tune_compression = true;
+
+            TabletColumn column(STORAGE_AGGREGATE_NONE, TYPE_BIGINT);
+            ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+            ASSERT_OK(writer->init());
+            ASSERT_OK(writer->append(*col));
+            ASSERT_OK(writer->finish());
+            ASSERT_OK(writer->write_data());
+            ASSERT_OK(writer->write_ordinal_index());
+            ASSERT_OK(writer->write_zone_map());
+            ASSERT_OK(wfile->close());
+        }
+        if (random) {
+            ASSERT_EQ(NO_COMPRESSION, meta.compression());
+        } else {
+            ASSERT_NE(NO_COMPRESSION, meta.compression());
+        }
+
+        auto segment = create_dummy_segment(fs, fname);
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator());
+        ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+        ASSERT_OK(iter->seek_to_first());
+        auto dst = ChunkHelper::column_from_field_type(TYPE_BIGINT, false);
+        size_t rows_read = num_rows;
+        ASSERT_OK(iter->next_batch(&rows_read, dst.get()));
+        ASSERT_EQ(num_rows, dst->size());
+        for (int64_t i = 0; i < num_rows; i++) {
+            ASSERT_EQ(col->get(i).get_int64(), dst->get(i).get_int64());
+        }
+    }
+}
+
 TEST_F(ColumnReaderWriterTest, test_large_varchar_column_writer) {
     auto fs = std::make_shared<MemoryFileSystem>();
     ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
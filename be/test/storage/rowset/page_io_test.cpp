@@ -18,6 +18,7 @@
 
 #include "cache/lrucache_engine.h"
 #include "cache/object_cache/page_cache.h"
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/bitshuffle_page.h"
@@ -243,4 +244,57 @@ TEST_F(PageIOTest, test_use_cache_hit) {
         ASSERT_EQ(col.debug_string(), "[1, 2, 3]");
     }
 }
+
+TEST_F(PageIOTest, test_use_compressed_cache_hit) {
+    std::vector<int32_t> values{1, 2, 3};
+    OwnedSlice page = _build_data_page(values);
+    size_t uncompressed_size = page.slice().size;
+
+    // compress
+    faststring compressed_body;
+    _compress_data_page(page.slice(), &compressed_body);
+
+    // page footer
+    PageFooterPB footer = _build_page_footer(uncompressed_size);
+
+    // write
+    WritableFileOptions write_opts;
+    write_opts.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+    ASSIGN_OR_ASSERT_FAIL(auto write_file, _fs->new_writable_file(write_opts, "/test_use_compressed_cache_hit"));
+
+    PagePointer result;
+    std::vector<Slice> compressed_page{compressed_body};
+    ASSERT_OK(PageIO::write_page(write_file.get(), compressed_page, footer, &result));
+    ASSERT_OK(write_file->close());
+    uint64_t file_size = write_file->size();
+
+    // read
+    ASSIGN_OR_ASSERT_FAIL(auto read_file, _fs->new_random_access_file("/test_use_compressed_cache_hit"));
+    PageReadOptions read_opts = _build_read_options(read_file.get(), 0, file_size, true);
+
+    auto prev_threshold = config::storage_page_cache_compressed_ratio_threshold;
+    config::storage_page_cache_compressed_ratio_threshold = 1.0;
+    DeferOp defer([&]() { config::storage_page_cache_compressed_ratio_threshold = prev_threshold; });
+
+    // the 1st read caches the compressed page, the 2nd read hits it and caches the decompressed page,
+    // and the 3rd read hits the decompressed page.
+    const std::vector<std::pair<int64_t, int64_t>> expected_hits{{0, 0}, {0, 1}, {1, 1}};
+    for (const auto& [cached_pages_num, cached_compressed_pages_num] : expected_hits) {
+        PageHandle handle;
+        Slice body;
+        PageFooterPB read_footer;
+        ASSERT_OK(PageIO::read_and_decompress_page(read_opts, &handle, &body, &read_footer));
+        ASSERT_EQ(_stats.cached_pages_num, cached_pages_num);
+        ASSERT_EQ(_stats.cached_compressed_pages_num, cached_compressed_pages_num);
+
+        // check
+        BitShufflePageDecoder<TYPE_INT> decoder(body);
+        ASSERT_OK(decoder.init());
+
+        size_t size = 10;
+        Int32Column col;
+        ASSERT_OK(decoder.next_batch(&size, &col));
+        ASSERT_EQ(col.debug_string(), "[1, 2, 3]");
+    }
+}
 } // namespace starrocks
@@ -36,6 +36,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace starrocks {
 
 class ShortKeyIndexTest : public testing::Test {
@@ -106,4 +110,42 @@ TEST_F(ShortKeyIndexTest, buider) {
     }
 }
 
+TEST_F(ShortKeyIndexTest, interpolation_search) {
+    // skewed keys with long common prefixes, compare the results with std::lower_bound/upper_bound
+    const std::string ff(1, '\xff');
+    std::vector<std::string> keys;
+    for (int i = 0; i < 3000; i++) {
+        keys.emplace_back("prefix_" + std::to_string(100000 + i));
+    }
+    for (int i = 0; i < 100; i++) {
+        keys.emplace_back(ff + std::to_string(1000000 + i * i * i));
+    }
+    ShortKeyIndexBuilder builder(0, 1024);
+    for (const auto& key : keys) {
+        builder.add_item(key);
+    }
+    std::vector<Slice> slices;
+    PageFooterPB footer;
+    ASSERT_TRUE(builder.finalize(keys.size() * 1024, &slices, &footer).ok());
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+    ShortKeyIndexDecoder decoder;
+    ASSERT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+
+    std::vector<std::string> targets = {"",         "a",         "prefix_",       "prefix_100000", "prefix_1015",
+                                        "prefix_2", "prefix_9",  "prefix_102999", "zzz",           ff,
+                                        ff + "1",   ff + "1000", ff + "1001000",  ff + "1010001",  ff + ff};
+    for (const auto& key : keys) {
+        targets.emplace_back(key);
+    }
+    for (const auto& target : targets) {
+        auto expect_lower = std::lower_bound(keys.begin(), keys.end(), target) - keys.begin();
+        auto expect_upper = std::upper_bound(keys.begin(), keys.end(), target) - keys.begin();
+        ASSERT_EQ(expect_lower, decoder.lower_bound(target).ordinal()) << target;
+        ASSERT_EQ(expect_upper, decoder.upper_bound(target).ordinal()) << target;
+    }
+}
+
 } // namespace starrocks
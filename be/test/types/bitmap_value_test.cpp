@@ -302,6 +302,70 @@ TEST_F(BitmapValueTest, bitmap_union) {
     check_bitmap(BitmapDataType::BITMAP, bitmap_14, 0, 132);
 }
 
+TEST_F(BitmapValueTest, bitmap_union_many) {
+    // small values only, keep the set type
+    auto bitmap_1 = _single_bitmap;
+    auto set_1 = gen_bitmap(1, 3);
+    BitmapValue single_1(3);
+    const BitmapValue* values_1[] = {&set_1, &single_1, &_empty_bitmap};
+    bitmap_1.union_many(3, values_1);
+    check_bitmap(BitmapDataType::SET, bitmap_1, 0, 4);
+
+    // the only bitmap is shared and copied on write
+    BitmapValue bitmap_2;
+    BitmapValue single_2(64);
+    const BitmapValue* values_2[] = {&_large_bitmap, &single_2};
+    bitmap_2.union_many(2, values_2);
+    check_bitmap(BitmapDataType::BITMAP, bitmap_2, 0, 65);
+    check_bitmap(BitmapDataType::BITMAP, _large_bitmap, 0, 64);
+
+    // mixed types
+    auto bitmap_3 = _medium_bitmap;
+    auto set_3 = gen_bitmap(64, 70);
+    BitmapValue single_3(70);
+    auto large_3 = gen_bitmap(100, 200);
+    const BitmapValue* values_3[] = {&_large_bitmap, &set_3, &single_3, &_empty_bitmap, &large_3};
+    bitmap_3.union_many(5, values_3);
+    check_bitmap(BitmapDataType::BITMAP, bitmap_3, 0, 71, 100, 200);
+    check_bitmap(BitmapDataType::BITMAP, _large_bitmap, 0, 64);
+
+    // 64-bit values are merged by high bytes
+    std::vector<BitmapValue> bitmaps(8);
+    BitmapValue expected;
+    for (size_t i = 0; i < bitmaps.size(); i++) {
+        for (uint64_t v = 0; v < 100; v++) {
+            bitmaps[i].add(((i % 3) << 40) + v * bitmaps.size() + i);
+        }
+        expected |= bitmaps[i];
+    }
+    std::vector<const BitmapValue*> values_4;
+    for (const auto& bitmap : bitmaps) {
+        values_4.push_back(&bitmap);
+    }
+    BitmapValue bitmap_4(1);
+    bitmap_4.union_many(values_4.size(), values_4.data());
+    expected.add(1);
+    ASSERT_EQ(expected.to_string(), bitmap_4.to_string());
+    ASSERT_EQ(801, bitmap_4.cardinality());
+}
+
+TEST_F(BitmapValueTest, bitmap_intersect_many) {
+    auto bitmap_1 = gen_bitmap(0, 64);
+    auto large_1 = gen_bitmap(10, 100);
+    auto set_1 = gen_bitmap(0, 20);
+    const BitmapValue* values_1[] = {&large_1, &set_1, &_large_bitmap};
+    bitmap_1.intersect_many(3, values_1);
+    check_bitmap(BitmapDataType::SET, bitmap_1, 10, 20);
+
+    auto bitmap_2 = gen_bitmap(0, 64);
+    auto set_2 = gen_bitmap(0, 5);
+    BitmapValue single_2(100);
+    const BitmapValue* values_2[] = {&_large_bitmap, &set_2, &single_2};
+    bitmap_2.intersect_many(3, values_2);
+    ASSERT_EQ(BitmapDataType::EMPTY, bitmap_2.type());
+    ASSERT_EQ(0, bitmap_2.cardinality());
+}
+
 TEST_F(BitmapValueTest, bitmap_intersect) {
     auto bitmap_1 = gen_bitmap(0, 100);
     bitmap_1 &= _empty_bitmap;
@@ -15,6 +15,7 @@
 #include "util/cpu_info.h"
 
 #include "gtest/gtest.h"
+#include "util/cpu_util.h"
 
 namespace starrocks {
 
@@ -55,4 +56,24 @@ TEST_F(CpuInfoTest, test_fail_cpu_flags_check) {
     GTEST_SKIP() << "avx2 is not supported, skip the test!";
 #endif
 }
+
+TEST_F(CpuInfoTest, test_split_by_numa_node) {
+    ASSERT_GE(CpuInfo::get_max_num_numa_nodes(), 1);
+    auto core_ids = CpuInfo::get_core_ids();
+    auto node_cpuids = CpuUtil::split_by_numa_node(core_ids);
+    ASSERT_EQ(CpuInfo::get_max_num_numa_nodes(), node_cpuids.size());
+
+    size_t num_cpuids = 0;
+    for (int node = 0; node < node_cpuids.size(); ++node) {
+        for (auto cpu_id : node_cpuids[node]) {
+            EXPECT_EQ(node, CpuInfo::get_numa_node_for_core(cpu_id));
+        }
+        num_cpuids += node_cpuids[node].size();
+    }
+    EXPECT_EQ(core_ids.size(), num_cpuids);
+
+    int current_node = CpuInfo::get_current_numa_node();
+    EXPECT_GE(current_node, 0);
+    EXPECT_LT(current_node, CpuInfo::get_max_num_numa_nodes());
+}
 } // namespace starrocks
@@ -385,6 +385,52 @@ TEST_F(JsonFlattenerTest, testSortHitNums) {
     }
 }
 
+TEST_F(JsonFlattenerTest, testHotPaths) {
+    // key k{j} appears in the first j + 1 rows
+    auto json_column = JsonColumn::create();
+    for (int r = 0; r < 20; r++) {
+        vpack::Builder builder;
+        builder.openObject();
+        for (int j = r; j < 20; j++) {
+            builder.add("k" + std::to_string(j), vpack::Value(j));
+        }
+        builder.close();
+        JsonValue jv;
+        jv.assign(builder);
+        json_column->append(&jv);
+    }
+    std::vector<const Column*> columns{json_column.get()};
+
+    double sparsity_factor = config::json_flat_sparsity_factor;
+    int column_max = config::json_flat_column_max;
+    config::json_flat_sparsity_factor = 0.8;
+    {
+        JsonPathDeriver jf;
+        jf.set_generate_filter(true);
+        jf.set_hot_paths({"k0", "k3", "missing"});
+        jf.derived(columns);
+
+        std::vector<std::string> paths = {"k0", "k15", "k16", "k17", "k18", "k19", "k3"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+        ASSERT_TRUE(nullptr != jf.remain_fitler());
+        EXPECT_TRUE(jf.remain_fitler()->test_bytes("k5", 2));
+    }
+    {
+        // the hot paths take precedence within the max column count
+        config::json_flat_column_max = 3;
+        JsonPathDeriver jf;
+        jf.set_hot_paths({"k0"});
+        jf.derived(columns);
+
+        std::vector<std::string> paths = {"k0", "k18", "k19"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+    config::json_flat_sparsity_factor = sparsity_factor;
+    config::json_flat_column_max = column_max;
+}
+
 TEST_F(JsonFlattenerTest, testRemainFilter) {
     // clang-format off
     std::vector<std::string> jsons = {
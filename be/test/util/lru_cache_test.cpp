@@ -280,6 +280,78 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(900 + key_mem_usage, cache.get_usage());
 }
 
+TEST_F(CacheTest, UpdateCharge) {
+    LRUCache cache;
+    cache.set_capacity(1000);
+
+    CacheKey key1("100");
+    size_t key_mem_usage = sizeof(LRUHandle) - 1 + key1.size();
+    insert_LRUCache(cache, key1, 100, CachePriority::NORMAL);
+    CacheKey key2("200");
+    uint32_t hash2 = key2.hash(key2.data(), key2.size(), 0);
+    Cache::Handle* handle = cache.insert(key2, hash2, EncodeValue(200), 200, &deleter, CachePriority::NORMAL);
+    ASSERT_EQ(300 + key_mem_usage * 2, cache.get_usage());
+
+    cache.update_charge(handle, 300);
+    ASSERT_EQ(400 + key_mem_usage * 2, cache.get_usage());
+
+    // the referenced entry grows, the other one is evicted
+    cache.update_charge(handle, 900);
+    ASSERT_EQ(900 + key_mem_usage, cache.get_usage());
+    cache.release(handle);
+
+    handle = cache.lookup(key2, hash2);
+    ASSERT_NE(nullptr, handle);
+    cache.update_charge(handle, 100);
+    cache.release(handle);
+    ASSERT_EQ(100 + key_mem_usage, cache.get_usage());
+}
+
+static bool lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    Cache::Handle* handle = cache.lookup(key, hash);
+    cache.release(handle);
+    return handle != nullptr;
+}
+
+TEST_F(CacheTest, AdmissionFilter) {
+    LRUCache cache;
+    cache.set_capacity(1000);
+    cache.enable_admission_filter(1024);
+
+    CacheKey key1("100");
+    CacheKey key2("200");
+    insert_LRUCache(cache, key1, 400, CachePriority::NORMAL);
+    insert_LRUCache(cache, key2, 400, CachePriority::NORMAL);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, key1));
+        ASSERT_TRUE(lookup_LRUCache(cache, key2));
+    }
+
+    // a key accessed only once doesn't evict the frequently accessed ones
+    CacheKey key3("300");
+    ASSERT_FALSE(lookup_LRUCache(cache, key3));
+    insert_LRUCache(cache, key3, 400, CachePriority::NORMAL);
+    ASSERT_EQ(1, cache.get_rejected_count());
+    ASSERT_FALSE(lookup_LRUCache(cache, key3));
+    ASSERT_TRUE(lookup_LRUCache(cache, key1));
+    ASSERT_TRUE(lookup_LRUCache(cache, key2));
+
+    // the rejected entry is freed after it is released
+    size_t key_mem_usage = sizeof(LRUHandle) - 1 + key1.size();
+    ASSERT_EQ(800 + key_mem_usage * 2, cache.get_usage());
+
+    // a key accessed more frequently than the least recently used one is admitted
+    for (int i = 0; i < 5; i++) {
+        ASSERT_FALSE(lookup_LRUCache(cache, key3));
+    }
+    insert_LRUCache(cache, key3, 400, CachePriority::NORMAL);
+    ASSERT_EQ(1, cache.get_rejected_count());
+    ASSERT_TRUE(lookup_LRUCache(cache, key3));
+    ASSERT_FALSE(lookup_LRUCache(cache, key1));
+    ASSERT_TRUE(lookup_LRUCache(cache, key2));
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace starrocks {
+
+TEST(PerfEventCountersTest, test_read) {
+    auto* counters = PerfEventCounters::thread_local_instance();
+    ASSERT_EQ(counters, PerfEventCounters::thread_local_instance());
+
+    PerfEventCounters::Values begin;
+    PerfEventCounters::Values end;
+    if (!counters->available()) {
+        // perf_event_open(2) is not allowed in this environment.
+        ASSERT_FALSE(counters->read(&begin));
+        return;
+    }
+
+    ASSERT_TRUE(counters->read(&begin));
+    volatile uint64_t sum = 0;
+    for (int i = 0; i < 1000000; i++) {
+        sum += i;
+    }
+    ASSERT_TRUE(counters->read(&end));
+    ASSERT_GT(end[PerfEventCounters::CYCLES], begin[PerfEventCounters::CYCLES]);
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+        ASSERT_GE(end[i], begin[i]);
+    }
+}
+
+TEST(PerfEventCountersTest, test_per_thread) {
+    PerfEventCounters* other = nullptr;
+    std::thread t([&]() { other = PerfEventCounters::thread_local_instance(); });
+    t.join();
+    ASSERT_NE(other, PerfEventCounters::thread_local_instance());
+}
+
+TEST(PerfEventCountersTest, test_event_name) {
+    ASSERT_STREQ("HwCycles", PerfEventCounters::event_name(PerfEventCounters::CYCLES));
+    ASSERT_STREQ("HwBranchMisses", PerfEventCounters::event_name(PerfEventCounters::BRANCH_MISSES));
+}
+
+} // namespace starrocks
@@ -0,0 +1,78 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/debug/query_cpu_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/current_thread.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+static void burn_cpu(int64_t ms) {
+    volatile uint64_t sum = 0;
+    int64_t deadline = MonotonicMillis() + ms;
+    while (MonotonicMillis() < deadline) {
+        for (int i = 0; i < 10000; i++) {
+            sum += i;
+        }
+    }
+}
+
+TEST(QueryCpuProfilerTest, test_invalid_options) {
+    QueryCpuProfiler::Options options;
+    options.frequency = 0;
+    ASSERT_FALSE(QueryCpuProfiler::instance()->start(options).ok());
+    ASSERT_FALSE(QueryCpuProfiler::instance()->started());
+}
+
+TEST(QueryCpuProfilerTest, test_sample_query) {
+    auto* profiler = QueryCpuProfiler::instance();
+    QueryCpuProfiler::Options options;
+    options.frequency = 200;
+    ASSERT_TRUE(profiler->start(options).ok());
+    ASSERT_TRUE(profiler->started());
+
+    TUniqueId query_id;
+    query_id.hi = 100;
+    query_id.lo = 200;
+    CurrentThread::current().set_query_id(query_id);
+    CurrentThread::current().set_workgroup_id(10);
+    burn_cpu(500);
+    CurrentThread::current().set_query_id({});
+    CurrentThread::current().set_workgroup_id(-1);
+
+    profiler->stop();
+    ASSERT_FALSE(profiler->started());
+    ASSERT_GT(profiler->num_samples(), 0);
+
+    QueryCpuProfiler::Filter filter;
+    filter.query_id = print_id(query_id);
+    std::string folded = profiler->dump_folded(filter);
+    ASSERT_NE(std::string::npos, folded.find("workgroup_10;query_" + print_id(query_id))) << folded;
+
+    filter.workgroup_id = 11;
+    ASSERT_TRUE(profiler->dump_folded(filter).empty());
+
+    filter.workgroup_id = 10;
+    std::string pprof = profiler->dump_pprof(filter);
+    // The header, at least one sample and the trailer.
+    ASSERT_GT(pprof.size(), sizeof(uintptr_t) * 11);
+    ASSERT_EQ(0, reinterpret_cast<const uintptr_t*>(pprof.data())[0]);
+    ASSERT_EQ(3, reinterpret_cast<const uintptr_t*>(pprof.data())[1]);
+}
+
+} // namespace starrocks
@@ -311,6 +311,23 @@ TEST(StringToInt, Overflow) {
                             StringParser::PARSE_OVERFLOW);
 }
 
+TEST(StringToInt, EightDigitsAtOnce) {
+    test_int_value<int32_t>("87654321", 87654321, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-987654321", -987654321, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567890123456", 1234567890123456LL, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-1234567890123456789", -1234567890123456789LL, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("9223372036854775807", 9223372036854775807LL, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("00000000000000000012", 12, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567a", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678/1", 0, StringParser::PARSE_FAILURE);
+
+    std::mt19937_64 rng(0);
+    for (int i = 0; i < 1000; ++i) {
+        auto v = static_cast<int64_t>(rng());
+        test_int_value<int64_t>(std::to_string(v).c_str(), v, StringParser::PARSE_SUCCESS);
+    }
+}
+
 TEST(StringToInt, Int8_Exhaustive) {
     char buffer[5];
     for (int i = -256; i <= 256; ++i) {
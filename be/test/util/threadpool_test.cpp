@@ -485,6 +485,28 @@ TEST_F(ThreadPoolTest, TestTokenSubmitsProcessedSerially) {
     ASSERT_EQ("abcde", result);
 }
 
+TEST_F(ThreadPoolTest, TestTokenPriority) {
+    ASSERT_TRUE(rebuild_pool_with_min_max(1, 1).ok());
+    std::unique_ptr<ThreadPoolToken> low = _pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    std::unique_ptr<ThreadPoolToken> high =
+            _pool->new_token(ThreadPool::ExecutionMode::SERIAL, ThreadPool::HIGH_PRIORITY);
+    CountDownLatch blocker(1);
+    string result;
+    // Occupy the only thread so that the following tasks are all queued.
+    ASSERT_TRUE(_pool->submit_func([&blocker]() { blocker.wait(); }).ok());
+    for (char c = 'a'; c < 'd'; c++) {
+        ASSERT_TRUE(low->submit_func([&result, c]() { result += c; }).ok());
+    }
+    for (char c = 'x'; c < 'z'; c++) {
+        ASSERT_TRUE(high->submit_func([&result, c]() { result += c; }).ok());
+    }
+    blocker.count_down();
+    _pool->wait();
+    // The tasks of the high priority token are not delayed by the queued low priority token, and the tasks of each
+    // token are still executed in order.
+    ASSERT_EQ("xyabc", result);
+}
+
 TEST_P(ThreadPoolTestTokenTypes, TestTokenSubmitsProcessedConcurrently) {
     const int kNumTokens = 5;
     ASSERT_TRUE(rebuild_pool_with_builder(ThreadPoolBuilder(kDefaultPoolName).set_max_threads(kNumTokens)).ok());
@@ -62,4 +62,42 @@ PARALLEL_TEST(TimezoneUtilTest, find_time_zone) {
     }
 }
 
+PARALLEL_TEST(TimezoneUtilTest, offset_cache) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("America/New_York", ctz));
+    TimezoneOffsetCache offsets(ctz);
+
+    // 2019-01-01 00:00:00 UTC, two years by 17 minutes crossing the daylight saving transitions back and forth
+    const int64_t start = 1546300800;
+    int64_t num_fallbacks = 0;
+    for (int64_t i = 0; i < 2 * 365 * 24 * 60 / 17; i++) {
+        int64_t utc = start + (i % 2 == 0 ? i : 2 * 365 * 24 * 60 / 17 - i) * 17 * 60;
+
+        DateTimeValue dtv;
+        ASSERT_TRUE(dtv.from_unixtime(utc, ctz));
+        int64_t local = cctz::civil_second(dtv.year(), dtv.month(), dtv.day(), dtv.hour(), dtv.minute(), dtv.second()) -
+                        cctz::civil_second(1970, 1, 1, 0, 0, 0);
+        ASSERT_EQ(local, utc + offsets.utc_offset(utc));
+
+        int64_t expected_utc;
+        ASSERT_TRUE(dtv.unix_timestamp(&expected_utc, ctz));
+        int64_t actual_utc;
+        if (offsets.local_to_utc(local, &actual_utc)) {
+            ASSERT_EQ(expected_utc, actual_utc);
+        } else {
+            num_fallbacks++;
+        }
+    }
+    // only the civil times around the four transitions fall back to cctz
+    ASSERT_GT(num_fallbacks, 0);
+    ASSERT_LT(num_fallbacks, 4 * 4 * 24 * 60 / 17 + 4);
+
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("+08:00", ctz));
+    TimezoneOffsetCache fixed_offsets(ctz);
+    ASSERT_EQ(28800, fixed_offsets.utc_offset(0));
+    int64_t utc;
+    ASSERT_TRUE(fixed_offsets.local_to_utc(28800, &utc));
+    ASSERT_EQ(0, utc);
+}
+
 } // namespace starrocks